@@ -52,6 +52,7 @@ function(open3d_print_configuration_summary)
         )
     endif()
     open3d_aligned_print("Build Benchmarks" "${BUILD_BENCHMARKS}")
+    open3d_aligned_print("Build Tracing" "${BUILD_TRACING}")
     open3d_aligned_print("Bundle Open3D-ML" "${BUNDLE_OPEN3D_ML}")
     if(GLIBCXX_USE_CXX11_ABI)
         open3d_aligned_print("Force GLIBCXX_USE_CXX11_ABI=" "1")
@@ -54,6 +54,9 @@ function(open3d_set_global_properties target)
     if (WITH_FAISS)
         target_compile_definitions(${target} PRIVATE WITH_FAISS)
     endif()
+    if (BUILD_TRACING)
+        target_compile_definitions(${target} PRIVATE BUILD_TRACING)
+    endif()
     if (GLIBCXX_USE_CXX11_ABI)
         target_compile_definitions(${target} PUBLIC _GLIBCXX_USE_CXX11_ABI=1)
     else()
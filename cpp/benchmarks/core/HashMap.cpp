@@ -525,13 +525,15 @@ void HashReserveInt3(benchmark::State& state,
     ENUM_BM_CAPACITY(FN, 32, DEVICE, BACKEND)
 
 #ifdef BUILD_CUDA_MODULE
-#define ENUM_BM_BACKEND(FN)                                     \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)   \
-    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::Slab) \
+#define ENUM_BM_BACKEND(FN)                                              \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)            \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::OpenAddressing) \
+    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::Slab)          \
     ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::StdGPU)
 #else
-#define ENUM_BM_BACKEND(FN) \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)
+#define ENUM_BM_BACKEND(FN)                                   \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB) \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::OpenAddressing)
 #endif
 
 ENUM_BM_BACKEND(HashInsertInt)
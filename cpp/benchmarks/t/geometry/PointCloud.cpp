@@ -103,6 +103,57 @@ void VoxelDownSample(benchmark::State& state,
     }
 }
 
+void VoxelDownSampleReduction(
+        benchmark::State& state,
+        const core::Device& device,
+        float voxel_size,
+        const PointCloud::VoxelReductionType& reduction) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warp up
+    pcd.VoxelDownSample(voxel_size, reduction);
+
+    for (auto _ : state) {
+        pcd.VoxelDownSample(voxel_size, reduction);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void FarthestPointDownSample(benchmark::State& state,
+                             const core::Device& device,
+                             int64_t num_samples,
+                             double voxel_size) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warp up
+    pcd.FarthestPointDownSample(num_samples, 0, voxel_size);
+
+    for (auto _ : state) {
+        pcd.FarthestPointDownSample(num_samples, 0, voxel_size);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void PoissonDiskDownSample(benchmark::State& state,
+                           const core::Device& device,
+                           double radius) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warp up
+    pcd.PoissonDiskDownSample(radius);
+
+    for (auto _ : state) {
+        pcd.PoissonDiskDownSample(radius);
+        core::cuda::Synchronize(device);
+    }
+}
+
 void Transform(benchmark::State& state, const core::Device& device) {
     PointCloud pcd;
     t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
@@ -216,6 +267,48 @@ BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_32, 0.32)
         ->Unit(benchmark::kMillisecond);
 ENUM_VOXELDOWNSAMPLE_BACKEND()
 
+BENCHMARK_CAPTURE(VoxelDownSampleReduction,
+                  CPU Mean[0.01],
+                  core::Device("CPU:0"),
+                  0.01,
+                  PointCloud::VoxelReductionType::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(VoxelDownSampleReduction,
+                  CPU CentroidNearest[0.01],
+                  core::Device("CPU:0"),
+                  0.01,
+                  PointCloud::VoxelReductionType::CentroidNearest)
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(VoxelDownSampleReduction,
+                  CUDA Mean[0.01],
+                  core::Device("CUDA:0"),
+                  0.01,
+                  PointCloud::VoxelReductionType::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(VoxelDownSampleReduction,
+                  CUDA CentroidNearest[0.01],
+                  core::Device("CUDA:0"),
+                  0.01,
+                  PointCloud::VoxelReductionType::CentroidNearest)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+BENCHMARK_CAPTURE(FarthestPointDownSample,
+                  CPU[4096],
+                  core::Device("CPU:0"),
+                  4096,
+                  0.0)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FarthestPointDownSample,
+                  CPU[4096 | 0.01],
+                  core::Device("CPU:0"),
+                  4096,
+                  0.01)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(PoissonDiskDownSample, CPU[0.02], core::Device("CPU:0"), 0.02)
+        ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_CAPTURE(Transform, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudStagingBuffers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+// Size of a live point cloud view updated every frame.
+static const int64_t kNumPoints = 2000000;
+
+static core::Tensor CreateAttribute(core::Dtype dtype) {
+    core::Tensor values = core::Tensor::Ones({kNumPoints, 3}, core::Float32);
+    return dtype == core::UInt8 ? (values * 200).To(core::UInt8)
+                                : values.To(dtype);
+}
+
+void Stage(benchmark::State& state,
+           PointCloudStagingBuffers::Attribute attribute,
+           const core::Dtype& dtype) {
+    PointCloudStagingBuffers staging;
+    const core::Tensor values = CreateAttribute(dtype);
+
+    for (auto _ : state) {
+        // The renderer releases the upload once it is consumed.
+        auto upload = staging.Stage(attribute, values);
+        upload.callback(upload.data, upload.size, upload.user);
+    }
+}
+
+// Baseline: a fresh buffer per update, converted element by element.
+void MallocAndConvertColors(benchmark::State& state) {
+    const core::Tensor values = CreateAttribute(core::UInt8);
+    const size_t num_values = kNumPoints * 3;
+
+    for (auto _ : state) {
+        float* colors = static_cast<float*>(malloc(num_values * sizeof(float)));
+        const uint8_t* src = values.GetDataPtr<uint8_t>();
+        for (size_t i = 0; i < num_values; ++i) {
+            colors[i] = src[i] / 255.f;
+        }
+        benchmark::DoNotOptimize(colors);
+        free(colors);
+    }
+}
+
+BENCHMARK_CAPTURE(Stage,
+                  PositionsFloat32,
+                  PointCloudStagingBuffers::Attribute::Positions,
+                  core::Float32)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(Stage,
+                  PositionsFloat64,
+                  PointCloudStagingBuffers::Attribute::Positions,
+                  core::Float64)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(Stage,
+                  ColorsUInt8,
+                  PointCloudStagingBuffers::Attribute::Colors,
+                  core::UInt8)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(MallocAndConvertColors)->Unit(benchmark::kMillisecond);
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
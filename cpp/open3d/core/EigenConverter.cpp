@@ -26,29 +26,46 @@
 
 #include "open3d/core/EigenConverter.h"
 
+#include <memory>
 #include <type_traits>
 
-#include "open3d/core/Indexer.h"
-#include "open3d/core/ParallelFor.h"
 #include "open3d/core/TensorCheck.h"
 
 namespace open3d {
 namespace core {
 namespace eigen_converter {
 
-/// Fills tensor[:][i] with func(i).
-///
-/// \param indexer The input tensor and output tensor to the indexer are the
-/// same (as a hack), since the tensor are filled in-place.
-/// \param func A function that takes pointer location and
-/// workload index i, computes the value to fill, and fills the value at the
-/// pointer location.
-template <typename func_t>
-static void LaunchIndexFillKernel(const Indexer &indexer, const func_t &func) {
-    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &func](int64_t i) {
-                    func(indexer.GetInputPtr(0, i), i);
-                });
+template <typename T>
+static EigenMatrixXTensorMap<T> TensorAsEigenMatrixMap(
+        const core::Tensor &tensor) {
+    core::AssertTensorDtype(tensor, core::Dtype::FromType<T>());
+    core::AssertTensorDevice(tensor, core::Device("CPU:0"));
+    if (tensor.NumDims() != 2) {
+        utility::LogError(
+                "[TensorAsEigenMatrixMap]: Number of dimensions supported = 2, "
+                "but got {}.",
+                tensor.NumDims());
+    }
+    return EigenMatrixXTensorMap<T>(
+            tensor.GetDataPtr<T>(), tensor.GetShape(0), tensor.GetShape(1),
+            Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>(tensor.GetStride(0),
+                                                          tensor.GetStride(1)));
+}
+
+template <typename T, int N>
+static core::Tensor EigenVectorNxVectorAsTensor(
+        std::vector<Eigen::Matrix<T, N, 1>> &values) {
+    static_assert(sizeof(Eigen::Matrix<T, N, 1>) == sizeof(T) * N,
+                  "Eigen::VectorNx must be tightly packed.");
+    int64_t num_values = static_cast<int64_t>(values.size());
+    if (num_values == 0) {
+        return core::Tensor::Empty({0, N}, core::Dtype::FromType<T>());
+    }
+    // The blob does not own the memory, the deleter is a no-op.
+    auto blob = std::make_shared<Blob>(Device("CPU:0"), values.data()->data(),
+                                       [](void *) {});
+    return core::Tensor({num_values, N}, {N, 1}, values.data()->data(),
+                        core::Dtype::FromType<T>(), blob);
 }
 
 template <typename T>
@@ -121,6 +138,16 @@ static std::vector<Eigen::Matrix<T, N, 1>> TensorToEigenVectorNxVector(
     // safe to write directly into std vector memory, see:
     // https://eigen.tuxfamily.org/dox/group__TopicStlContainers.html.
     std::vector<Eigen::Matrix<T, N, 1>> eigen_vector(tensor.GetLength());
+    if (tensor.GetDevice().GetType() == Device::DeviceType::CPU &&
+        tensor.GetDtype() == dtype && !tensor.IsContiguous() &&
+        tensor.GetLength() > 0) {
+        // Strided host tensor of the right dtype, e.g. a column slice: gather
+        // it in one pass instead of making it contiguous first.
+        Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, N, Eigen::RowMajor>>(
+                eigen_vector.data()->data(), tensor.GetLength(), N) =
+                TensorAsEigenMatrixMap<T>(tensor);
+        return eigen_vector;
+    }
     const core::Tensor t = tensor.To(dtype).Contiguous();
     MemoryManager::MemcpyToHost(eigen_vector.data(), t.GetDataPtr(),
                                 t.GetDevice(),
@@ -139,26 +166,17 @@ static core::Tensor EigenVectorNxVectorToTensor(
             (std::is_same<T, double>::value || std::is_same<T, int>::value) &&
                     N > 0,
             "Only supports double and int (VectorNd and VectorNi) with N>0.");
-    // Init CPU Tensor.
     int64_t num_values = static_cast<int64_t>(values.size());
-    core::Tensor tensor_cpu =
-            core::Tensor::Empty({num_values, N}, dtype, Device("CPU:0"));
-
-    // Fill Tensor. This takes care of dtype conversion at the same time.
-    core::Indexer indexer({tensor_cpu}, tensor_cpu,
-                          core::DtypePolicy::ALL_SAME);
-    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        LaunchIndexFillKernel(indexer, [&](void *ptr, int64_t workload_idx) {
-            // Fills the flattened tensor tensor_cpu[:] with dtype
-            // casting. tensor_cpu[:][i] corresponds to the (i/N)-th
-            // element's (i%N)-th coordinate value.
-            *static_cast<scalar_t *>(ptr) = static_cast<scalar_t>(
-                    values[workload_idx / N](workload_idx % N));
-        });
-    });
-
-    // Copy Tensor to device if necessary.
-    return tensor_cpu.To(device);
+    if (num_values == 0) {
+        return core::Tensor::Empty({0, N}, dtype, device);
+    }
+
+    // Eigen::VectorNx is tightly packed, so the vector storage already is a
+    // row-major (num_values, N) array. Wrap it and let Tensor::To() do the
+    // dtype conversion and device transfer in a single copy.
+    core::Tensor view = EigenVectorNxVectorAsTensor(
+            const_cast<std::vector<Eigen::Matrix<T, N, 1>> &>(values));
+    return view.To(device, dtype, /*copy=*/true);
 }
 
 std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(
@@ -196,6 +214,33 @@ core::Tensor EigenVector2iVectorToTensor(
     return EigenVectorNxVectorToTensor(values, dtype, device);
 }
 
+core::Tensor EigenVector3dVectorAsTensor(std::vector<Eigen::Vector3d> &values) {
+    return EigenVectorNxVectorAsTensor(values);
+}
+
+core::Tensor EigenVector2iVectorAsTensor(std::vector<Eigen::Vector2i> &values) {
+    return EigenVectorNxVectorAsTensor(values);
+}
+
+core::Tensor EigenVector3iVectorAsTensor(std::vector<Eigen::Vector3i> &values) {
+    return EigenVectorNxVectorAsTensor(values);
+}
+
+EigenMatrixXTensorMap<double> TensorAsEigenMatrixXdMap(
+        const core::Tensor &tensor) {
+    return TensorAsEigenMatrixMap<double>(tensor);
+}
+
+EigenMatrixXTensorMap<float> TensorAsEigenMatrixXfMap(
+        const core::Tensor &tensor) {
+    return TensorAsEigenMatrixMap<float>(tensor);
+}
+
+EigenMatrixXTensorMap<int> TensorAsEigenMatrixXiMap(
+        const core::Tensor &tensor) {
+    return TensorAsEigenMatrixMap<int>(tensor);
+}
+
 }  // namespace eigen_converter
 }  // namespace core
 }  // namespace open3d
@@ -141,6 +141,64 @@ core::Tensor EigenVector3iVectorToTensor(
         core::Dtype dtype,
         const core::Device &device);
 
+/// \brief Wraps the storage of a vector of Eigen::Vector3d as a (N, 3) Float64
+/// tensor on CPU:0 without copying.
+///
+/// The returned tensor does not own the memory. \p values must outlive the
+/// tensor and must not be resized while the tensor is in use. Writes to the
+/// tensor are visible in \p values and vice versa.
+///
+/// \param values A vector of Eigen::Vector3d values, e.g. a list of 3D points.
+/// \return A Float64 tensor of shape (N, 3) sharing memory with \p values.
+core::Tensor EigenVector3dVectorAsTensor(std::vector<Eigen::Vector3d> &values);
+
+/// \brief Wraps the storage of a vector of Eigen::Vector2i as a (N, 2) Int32
+/// tensor on CPU:0 without copying. See EigenVector3dVectorAsTensor() for the
+/// lifetime requirements.
+///
+/// \param values A vector of Eigen::Vector2i values, e.g. a list of lines.
+/// \return An Int32 tensor of shape (N, 2) sharing memory with \p values.
+core::Tensor EigenVector2iVectorAsTensor(std::vector<Eigen::Vector2i> &values);
+
+/// \brief Wraps the storage of a vector of Eigen::Vector3i as a (N, 3) Int32
+/// tensor on CPU:0 without copying. See EigenVector3dVectorAsTensor() for the
+/// lifetime requirements.
+///
+/// \param values A vector of Eigen::Vector3i values, e.g. a list of triangles.
+/// \return An Int32 tensor of shape (N, 3) sharing memory with \p values.
+core::Tensor EigenVector3iVectorAsTensor(std::vector<Eigen::Vector3i> &values);
+
+/// Read-only Eigen view of a 2D tensor, following the tensor strides.
+template <typename T>
+using EigenMatrixXTensorMap =
+        Eigen::Map<const Eigen::Matrix<T,
+                                       Eigen::Dynamic,
+                                       Eigen::Dynamic,
+                                       Eigen::RowMajor>,
+                   Eigen::Unaligned,
+                   Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>>;
+
+/// \brief Views a 2D Float64 CPU tensor as a read-only Eigen matrix without
+/// copying. Unlike TensorToEigenMatrixXd(), the tensor may be non-contiguous,
+/// e.g. a column slice, and no data is moved. An exception is thrown if the
+/// tensor is not a 2D Float64 tensor on CPU.
+///
+/// The view does not keep the tensor memory alive; \p tensor must outlive it.
+/// Legacy geometry algorithms take std::vector storage and do not accept this
+/// view; within Open3D it only backs the tensor to std::vector conversions.
+///
+/// \param tensor A 2D Float64 tensor on CPU.
+/// \return An Eigen::Map over the tensor memory.
+EigenMatrixXTensorMap<double> TensorAsEigenMatrixXdMap(
+        const core::Tensor &tensor);
+
+/// \brief Same as TensorAsEigenMatrixXdMap(), for Float32 tensors.
+EigenMatrixXTensorMap<float> TensorAsEigenMatrixXfMap(
+        const core::Tensor &tensor);
+
+/// \brief Same as TensorAsEigenMatrixXdMap(), for Int32 tensors.
+EigenMatrixXTensorMap<int> TensorAsEigenMatrixXiMap(const core::Tensor &tensor);
+
 }  // namespace eigen_converter
 }  // namespace core
 }  // namespace open3d
@@ -34,13 +34,32 @@
 #include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
 
+#ifdef BUILD_TRACING
+/// The tracer only records pointers to names, so they have to be static.
+static const char* GetTraceDeviceName(const Device& device) {
+    switch (device.GetType()) {
+        case Device::DeviceType::CPU:
+            return "CPU";
+        case Device::DeviceType::CUDA:
+            return "CUDA";
+        default:
+            return "Undefined";
+    }
+}
+#endif
+
 void* MemoryManager::Malloc(size_t byte_size, const Device& device) {
     void* ptr = GetDeviceMemoryManager(device)->Malloc(byte_size, device);
     MemoryManagerStatistic::GetInstance().CountMalloc(ptr, byte_size, device);
+#ifdef BUILD_TRACING
+    utility::Tracer::GetInstance().RecordMalloc(
+            GetTraceDeviceName(device), device.GetID(), ptr, byte_size);
+#endif
     return ptr;
 }
 
@@ -48,6 +67,10 @@ void MemoryManager::Free(void* ptr, const Device& device) {
     // Update statistics before freeing the memory. This ensures a consistent
     // order in case a subsequent Malloc requires the currently freed memory.
     MemoryManagerStatistic::GetInstance().CountFree(ptr, device);
+#ifdef BUILD_TRACING
+    utility::Tracer::GetInstance().RecordFree(GetTraceDeviceName(device),
+                                              device.GetID(), ptr);
+#endif
     GetDeviceMemoryManager(device)->Free(ptr, device);
 }
 
@@ -0,0 +1,451 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/hashmap/CPU/CPUHashBackendBufferAccessor.hpp"
+#include "open3d/core/hashmap/DeviceHashBackend.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+/// Flat open-addressing hash table with linear probing for the CPU.
+///
+/// The table is a power-of-two array of 64-bit slot words. A slot word packs
+/// the upper 32 bits of the (mixed) key hash as a tag together with the buffer
+/// index of the entry, so most mismatches are rejected without touching the
+/// key buffer. Keys and values live in the shared HashBackendBuffer, as for the
+/// other backends.
+///
+/// - Insert is lock-free: a thread claims an empty slot by CAS with a busy
+///   word carrying its tag, writes the key and values, then publishes the
+///   buffer index. Threads probing the same tag wait for the publication, so
+///   duplicates within one batch are detected.
+/// - Erase replaces slots with tombstones in parallel. The table is rebuilt in
+///   place once tombstones take up a quarter of the slots.
+/// - The table holds at least twice as many slots as the buffer capacity, and
+///   is resized by Reserve().
+template <typename Key, typename Hash, typename Eq>
+class OpenAddressingHashBackend : public DeviceHashBackend {
+public:
+    OpenAddressingHashBackend(int64_t init_capacity,
+                              int64_t key_dsize,
+                              const std::vector<int64_t>& value_dsizes,
+                              const Device& device);
+    ~OpenAddressingHashBackend();
+
+    void Reserve(int64_t capacity) override;
+
+    void Insert(const void* input_keys,
+                const std::vector<const void*>& input_values_soa,
+                buf_index_t* output_buf_indices,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Find(const void* input_keys,
+              buf_index_t* output_buf_indices,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(buf_index_t* output_indices) override;
+
+    void Clear() override;
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    void Allocate(int64_t capacity) override;
+    void Free() override{};
+
+protected:
+    /// Unused slot. Its lower half matches kBusyIndex, so it is never live.
+    static constexpr uint64_t kEmptyWord = ~uint64_t(0);
+    /// Erased slot, skipped by probing but not reused until the next rebuild.
+    static constexpr uint64_t kTombstoneWord = kEmptyWord - (uint64_t(1) << 32);
+    /// Buffer index of a slot that is claimed but not yet published.
+    static constexpr uint32_t kBusyIndex = 0xFFFFFFFF;
+
+    static uint64_t MixHash(uint64_t hash) {
+        // MurmurHash3 finalizer, spreads the key hash over the low bits used
+        // for the slot index.
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+        hash ^= hash >> 33;
+        return hash;
+    }
+    static uint32_t GetTag(uint64_t hash) {
+        // Tags 0xFFFFFFFE and 0xFFFFFFFF are reserved by the tombstone and
+        // empty words.
+        uint32_t tag = static_cast<uint32_t>(hash >> 32);
+        return tag >= 0xFFFFFFFE ? tag - 2 : tag;
+    }
+    static uint64_t PackWord(uint32_t tag, uint32_t buf_index) {
+        return (static_cast<uint64_t>(tag) << 32) | buf_index;
+    }
+    static bool IsLive(uint64_t word) {
+        return static_cast<uint32_t>(word) != kBusyIndex;
+    }
+    static int64_t NumSlotsForCapacity(int64_t capacity) {
+        int64_t num_slots = 16;
+        while (num_slots < 2 * capacity) {
+            num_slots <<= 1;
+        }
+        return num_slots;
+    }
+
+    const Key& GetKey(buf_index_t buf_index) const {
+        return *static_cast<const Key*>(buffer_accessor_->GetKeyPtr(buf_index));
+    }
+
+    /// Returns the slot holding \p key, or -1 if the key is absent.
+    int64_t FindSlot(const Key& key) const;
+
+    /// Rebuilds the table with \p num_slots slots from the live entries,
+    /// dropping all tombstones.
+    void Rehash(int64_t num_slots);
+
+    /// Resets all slots to empty.
+    void ResetSlots();
+
+protected:
+    int64_t num_slots_ = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+    int64_t num_tombstones_ = 0;
+
+    std::shared_ptr<CPUHashBackendBufferAccessor> buffer_accessor_;
+};
+
+template <typename Key, typename Hash, typename Eq>
+OpenAddressingHashBackend<Key, Hash, Eq>::OpenAddressingHashBackend(
+        int64_t init_capacity,
+        int64_t key_dsize,
+        const std::vector<int64_t>& value_dsizes,
+        const Device& device)
+    : DeviceHashBackend(init_capacity, key_dsize, value_dsizes, device) {
+    Allocate(init_capacity);
+}
+
+template <typename Key, typename Hash, typename Eq>
+OpenAddressingHashBackend<Key, Hash, Eq>::~OpenAddressingHashBackend() {}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::Size() const {
+    return this->buffer_->GetHeapTopIndex();
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::FindSlot(
+        const Key& key) const {
+    const uint64_t hash = MixHash(Hash()(key));
+    const uint32_t tag = GetTag(hash);
+    const uint64_t slot_mask = num_slots_ - 1;
+
+    int64_t slot = hash & slot_mask;
+    for (int64_t probe = 0; probe < num_slots_; ++probe) {
+        const uint64_t word = slots_[slot].load(std::memory_order_acquire);
+        if (word == kEmptyWord) {
+            return -1;
+        }
+        if (IsLive(word) && static_cast<uint32_t>(word >> 32) == tag &&
+            Eq()(GetKey(static_cast<buf_index_t>(word)), key)) {
+            return slot;
+        }
+        slot = (slot + 1) & slot_mask;
+    }
+    return -1;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Find(
+        const void* input_keys,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const int64_t slot = FindSlot(input_keys_templated[i]);
+        const bool flag = slot >= 0;
+        output_masks[i] = flag;
+        output_buf_indices[i] =
+                flag ? static_cast<buf_index_t>(
+                               slots_[slot].load(std::memory_order_relaxed))
+                     : 0;
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Insert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const size_t n_values = input_values_soa.size();
+
+    // Keep at least a quarter of the slots empty so that probe sequences
+    // stay short and always terminate.
+    if (num_tombstones_ > 0 &&
+        Size() + num_tombstones_ + count > num_slots_ / 4 * 3) {
+        Rehash(num_slots_);
+    }
+
+    const uint64_t slot_mask = num_slots_ - 1;
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        output_buf_indices[i] = 0;
+        output_masks[i] = false;
+
+        const Key& key = input_keys_templated[i];
+        const uint64_t hash = MixHash(Hash()(key));
+        const uint32_t tag = GetTag(hash);
+
+        int64_t slot = hash & slot_mask;
+        for (int64_t probe = 0; probe < num_slots_;
+             ++probe, slot = (slot + 1) & slot_mask) {
+            uint64_t word = slots_[slot].load(std::memory_order_acquire);
+            if (word == kEmptyWord &&
+                slots_[slot].compare_exchange_strong(
+                        word, PackWord(tag, kBusyIndex),
+                        std::memory_order_acq_rel, std::memory_order_acquire)) {
+                // Slot claimed: copy key and values to the buffer before
+                // publishing the buffer index.
+                const buf_index_t buf_index =
+                        buffer_accessor_->DeviceAllocate();
+                *static_cast<Key*>(buffer_accessor_->GetKeyPtr(buf_index)) =
+                        key;
+                for (size_t j = 0; j < n_values; ++j) {
+                    const uint8_t* src_value =
+                            static_cast<const uint8_t*>(input_values_soa[j]) +
+                            this->value_dsizes_[j] * i;
+                    std::memcpy(buffer_accessor_->GetValuePtr(buf_index, j),
+                                src_value, this->value_dsizes_[j]);
+                }
+                slots_[slot].store(PackWord(tag, buf_index),
+                                   std::memory_order_release);
+
+                output_buf_indices[i] = buf_index;
+                output_masks[i] = true;
+                break;
+            }
+
+            // Either the slot was taken, or another thread won the race for
+            // it and word now holds its entry.
+            if (static_cast<uint32_t>(word >> 32) != tag) {
+                continue;
+            }
+            // Same tag: the entry may hold the same key, wait until it is
+            // published before comparing.
+            while (!IsLive(word)) {
+                std::this_thread::yield();
+                word = slots_[slot].load(std::memory_order_acquire);
+            }
+            if (Eq()(GetKey(static_cast<buf_index_t>(word)), key)) {
+                break;
+            }
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
+                                                     bool* output_masks,
+                                                     int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    int64_t num_erased = 0;
+#pragma omp parallel for reduction(+ : num_erased) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        output_masks[i] = false;
+        const int64_t slot = FindSlot(input_keys_templated[i]);
+        if (slot < 0) {
+            continue;
+        }
+        // Only one thread erases a key repeated in the input.
+        uint64_t word = slots_[slot].load(std::memory_order_acquire);
+        if (IsLive(word) &&
+            slots_[slot].compare_exchange_strong(word, kTombstoneWord,
+                                                 std::memory_order_acq_rel)) {
+            buffer_accessor_->DeviceFree(static_cast<buf_index_t>(word));
+            output_masks[i] = true;
+            ++num_erased;
+        }
+    }
+
+    num_tombstones_ += num_erased;
+    if (num_tombstones_ > num_slots_ / 4) {
+        Rehash(num_slots_);
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::GetActiveIndices(
+        buf_index_t* output_buf_indices) {
+    // Count live slots per block, then write each block at its offset, so the
+    // output follows the slot order.
+    const int64_t num_blocks =
+            std::min<int64_t>(num_slots_, utility::EstimateMaxThreads() * 4);
+    const int64_t block_size = (num_slots_ + num_blocks - 1) / num_blocks;
+    std::vector<int64_t> block_offsets(num_blocks + 1, 0);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        const int64_t end = std::min(num_slots_, (b + 1) * block_size);
+        int64_t block_count = 0;
+        for (int64_t slot = b * block_size; slot < end; ++slot) {
+            block_count += IsLive(slots_[slot].load(std::memory_order_relaxed));
+        }
+        block_offsets[b + 1] = block_count;
+    }
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        block_offsets[b + 1] += block_offsets[b];
+    }
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        const int64_t end = std::min(num_slots_, (b + 1) * block_size);
+        int64_t offset = block_offsets[b];
+        for (int64_t slot = b * block_size; slot < end; ++slot) {
+            const uint64_t word = slots_[slot].load(std::memory_order_relaxed);
+            if (IsLive(word)) {
+                output_buf_indices[offset++] = static_cast<buf_index_t>(word);
+            }
+        }
+    }
+
+    return block_offsets[num_blocks];
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::ResetSlots() {
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t slot = 0; slot < num_slots_; ++slot) {
+        slots_[slot].store(kEmptyWord, std::memory_order_relaxed);
+    }
+    num_tombstones_ = 0;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Rehash(int64_t num_slots) {
+    std::vector<buf_index_t> active_buf_indices(Size());
+    const int64_t count = GetActiveIndices(active_buf_indices.data());
+
+    if (num_slots != num_slots_) {
+        num_slots_ = num_slots;
+        slots_.reset(new std::atomic<uint64_t>[num_slots_]);
+    }
+    ResetSlots();
+
+    // Entries are unique, so each one only needs the first empty slot.
+    const uint64_t slot_mask = num_slots_ - 1;
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const buf_index_t buf_index = active_buf_indices[i];
+        const uint64_t hash = MixHash(Hash()(GetKey(buf_index)));
+        const uint64_t new_word = PackWord(GetTag(hash), buf_index);
+
+        int64_t slot = hash & slot_mask;
+        uint64_t expected = kEmptyWord;
+        while (!slots_[slot].compare_exchange_strong(
+                expected, new_word, std::memory_order_relaxed)) {
+            expected = kEmptyWord;
+            slot = (slot + 1) & slot_mask;
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Clear() {
+    ResetSlots();
+    this->buffer_->ResetHeap();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Reserve(int64_t capacity) {
+    const int64_t num_slots = NumSlotsForCapacity(capacity);
+    if (num_slots > num_slots_) {
+        Rehash(num_slots);
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::GetBucketCount() const {
+    return num_slots_;
+}
+
+template <typename Key, typename Hash, typename Eq>
+std::vector<int64_t> OpenAddressingHashBackend<Key, Hash, Eq>::BucketSizes()
+        const {
+    std::vector<int64_t> ret(num_slots_);
+    for (int64_t slot = 0; slot < num_slots_; ++slot) {
+        ret[slot] = IsLive(slots_[slot].load(std::memory_order_relaxed));
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash, typename Eq>
+float OpenAddressingHashBackend<Key, Hash, Eq>::LoadFactor() const {
+    return static_cast<float>(Size()) / static_cast<float>(num_slots_);
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
+    this->capacity_ = capacity;
+
+    this->buffer_ = std::make_shared<HashBackendBuffer>(
+            this->capacity_, this->key_dsize_, this->value_dsizes_,
+            this->device_);
+
+    buffer_accessor_ =
+            std::make_shared<CPUHashBackendBufferAccessor>(*this->buffer_);
+
+    num_slots_ = NumSlotsForCapacity(capacity);
+    slots_.reset(new std::atomic<uint64_t>[num_slots_]);
+    ResetSlots();
+}
+
+}  // namespace core
+}  // namespace open3d
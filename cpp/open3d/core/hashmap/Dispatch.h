@@ -116,7 +116,10 @@ public:
             hash ^= static_cast<uint64_t>(key[i]);
             hash *= UINT64_C(1099511628211);
         }
-        return hash;
+        // Multiplication only carries low bits upwards. Fold the high bits
+        // back so that keys sharing trailing zeros, such as the bit patterns
+        // of floats, still spread over power of two bucket counts.
+        return hash ^ (hash >> 32);
     }
 };
 
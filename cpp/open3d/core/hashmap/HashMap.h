@@ -35,7 +35,7 @@ namespace core {
 
 class DeviceHashBackend;
 
-enum class HashBackendType { Slab, StdGPU, TBB, Default };
+enum class HashBackendType { Slab, StdGPU, TBB, OpenAddressing, Default };
 
 class HashMap {
 public:
@@ -27,6 +27,7 @@
 #include "open3d/core/nns/NearestNeighborSearch.h"
 
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
@@ -40,6 +41,7 @@ bool NearestNeighborSearch::SetIndex() {
 };
 
 bool NearestNeighborSearch::KnnIndex() {
+    OPEN3D_TRACE_ZONE("nns", "KnnIndex");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         if (dataset_points_.GetShape()[1] == 3) {
@@ -65,9 +67,13 @@ bool NearestNeighborSearch::KnnIndex() {
     }
 };
 
-bool NearestNeighborSearch::MultiRadiusIndex() { return SetIndex(); };
+bool NearestNeighborSearch::MultiRadiusIndex() {
+    OPEN3D_TRACE_ZONE("nns", "MultiRadiusIndex");
+    return SetIndex();
+};
 
 bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
+    OPEN3D_TRACE_ZONE("nns", "FixedRadiusIndex");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (!radius.has_value())
             utility::LogError("radius is required for GPU FixedRadiusIndex.");
@@ -88,6 +94,7 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
 }
 
 bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
+    OPEN3D_TRACE_ZONE("nns", "HybridIndex");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (!radius.has_value())
             utility::LogError("radius is required for GPU HybridIndex.");
@@ -108,6 +115,7 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
+    OPEN3D_TRACE_ZONE("nns", "KnnSearch");
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -129,6 +137,7 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius, bool sort) {
+    OPEN3D_TRACE_ZONE("nns", "FixedRadiusSearch");
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -149,6 +158,7 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
         const Tensor& query_points, const Tensor& radii) {
+    OPEN3D_TRACE_ZONE("nns", "MultiRadiusSearch");
     AssertNotCUDA(query_points);
     AssertTensorDtype(query_points, dataset_points_.GetDtype());
     AssertTensorDtype(radii, dataset_points_.GetDtype());
@@ -161,6 +171,7 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         const Tensor& query_points, double radius, int max_knn) {
+    OPEN3D_TRACE_ZONE("nns", "HybridSearch");
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
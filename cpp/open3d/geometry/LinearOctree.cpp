@@ -0,0 +1,757 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <utility>
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+constexpr size_t LinearOctree::kMaxDepth;
+
+namespace {
+
+/// Spreads the lower 21 bits of \p v to every third bit.
+uint64_t SplitBy3(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+/// Inverse of SplitBy3.
+uint64_t CompactBy3(uint64_t v) {
+    v &= 0x1249249249249249;
+    v = (v ^ (v >> 2)) & 0x10c30c30c30c30c3;
+    v = (v ^ (v >> 4)) & 0x100f00f00f00f00f;
+    v = (v ^ (v >> 8)) & 0x1f0000ff0000ff;
+    v = (v ^ (v >> 16)) & 0x1f00000000ffff;
+    v = (v ^ (v >> 32)) & 0x1fffff;
+    return v;
+}
+
+uint64_t EncodeMorton(uint64_t x, uint64_t y, uint64_t z) {
+    return SplitBy3(x) | SplitBy3(y) << 1 | SplitBy3(z) << 2;
+}
+
+Eigen::Vector3d DecodeMorton(uint64_t code) {
+    return Eigen::Vector3d(double(CompactBy3(code)),
+                           double(CompactBy3(code >> 1)),
+                           double(CompactBy3(code >> 2)));
+}
+
+int PopCount(uint8_t mask) {
+    int count = 0;
+    for (; mask; mask &= mask - 1) ++count;
+    return count;
+}
+
+/// Sorts \p codes and \p order together by the lowest \p num_bits bits of the
+/// codes, with a parallel least significant digit radix sort. The sort is
+/// stable, so points in the same cell keep their input order.
+void RadixSortByCode(std::vector<uint64_t> &codes,
+                     std::vector<int> &order,
+                     int num_bits) {
+    constexpr int kDigitBits = 8;
+    constexpr int kNumBuckets = 1 << kDigitBits;
+    const int n = int(codes.size());
+    const int num_chunks = std::max(
+            1, std::min(utility::EstimateMaxThreads(), n / kNumBuckets));
+    std::vector<uint64_t> codes_tmp(n);
+    std::vector<int> order_tmp(n);
+    std::vector<int> offsets(num_chunks * kNumBuckets);
+    auto chunk_begin = [&](int chunk) {
+        return int(int64_t(n) * chunk / num_chunks);
+    };
+
+    for (int shift = 0; shift < num_bits; shift += kDigitBits) {
+        // Per chunk histograms of the digit.
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static, 1) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            int *histogram = offsets.data() + chunk * kNumBuckets;
+            for (int i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+                histogram[(codes[i] >> shift) & (kNumBuckets - 1)]++;
+            }
+        }
+        // Exclusive offsets, bucket major so that the order within a bucket
+        // follows the chunks.
+        int sum = 0;
+        for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+            for (int chunk = 0; chunk < num_chunks; ++chunk) {
+                int &offset = offsets[chunk * kNumBuckets + bucket];
+                const int count = offset;
+                offset = sum;
+                sum += count;
+            }
+        }
+#pragma omp parallel for schedule(static, 1) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            int *cursor = offsets.data() + chunk * kNumBuckets;
+            for (int i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+                const int dst =
+                        cursor[(codes[i] >> shift) & (kNumBuckets - 1)]++;
+                codes_tmp[dst] = codes[i];
+                order_tmp[dst] = order[i];
+            }
+        }
+        codes.swap(codes_tmp);
+        order.swap(order_tmp);
+    }
+}
+
+/// Nodes of one depth, in Morton order.
+struct OctreeLevel {
+    std::vector<uint64_t> codes_;
+    std::vector<int> first_child_;
+    std::vector<uint8_t> child_masks_;
+    std::vector<int> point_begin_;
+    std::vector<int> point_end_;
+};
+
+/// Returns the positions of the first element of every run of equal keys in
+/// \p keys, computed with a parallel flag pass and a prefix sum.
+std::vector<int> RunStarts(const std::vector<uint64_t> &keys) {
+    const int n = int(keys.size());
+    std::vector<int> flags(n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < n; ++i) {
+        flags[i] = (i == 0 || keys[i] != keys[i - 1]) ? 1 : 0;
+    }
+    std::vector<int> run_index(n);
+    std::partial_sum(flags.begin(), flags.end(), run_index.begin());
+    std::vector<int> starts(n > 0 ? run_index.back() : 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < n; ++i) {
+        if (flags[i]) {
+            starts[run_index[i] - 1] = i;
+        }
+    }
+    return starts;
+}
+
+/// Builds the parent level of \p level. Siblings are adjacent in Morton
+/// order, so the parents are the runs of equal code >> 3.
+OctreeLevel BuildParentLevel(const OctreeLevel &level) {
+    std::vector<uint64_t> parent_codes(level.codes_.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < int(level.codes_.size()); ++i) {
+        parent_codes[i] = level.codes_[i] >> 3;
+    }
+    const std::vector<int> starts = RunStarts(parent_codes);
+    const int num_parents = int(starts.size());
+
+    OctreeLevel parents;
+    parents.codes_.resize(num_parents);
+    parents.first_child_ = starts;
+    parents.child_masks_.resize(num_parents);
+    parents.point_begin_.resize(num_parents);
+    parents.point_end_.resize(num_parents);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int p = 0; p < num_parents; ++p) {
+        const int begin = starts[p];
+        const int end = p + 1 < num_parents ? starts[p + 1]
+                                            : int(level.codes_.size());
+        uint8_t mask = 0;
+        for (int c = begin; c < end; ++c) {
+            mask |= uint8_t(1 << (level.codes_[c] & 7));
+        }
+        parents.codes_[p] = parent_codes[begin];
+        parents.child_masks_[p] = mask;
+        parents.point_begin_[p] = level.point_begin_[begin];
+        parents.point_end_[p] = level.point_end_[end - 1];
+    }
+    return parents;
+}
+
+/// Squared distance from \p point to the box [min_bound, min_bound + size].
+double BoxDistance2(const Eigen::Vector3d &point,
+                    const Eigen::Vector3d &min_bound,
+                    double size) {
+    const Eigen::Array3d d =
+            (min_bound.array() - point.array())
+                    .max(point.array() - (min_bound.array() + size))
+                    .max(0.0);
+    return d.matrix().squaredNorm();
+}
+
+}  // namespace
+
+LinearOctree &LinearOctree::Clear() {
+    points_.clear();
+    colors_.clear();
+    point_indices_.clear();
+    level_offsets_.clear();
+    node_codes_.clear();
+    node_first_child_.clear();
+    node_child_masks_.clear();
+    node_point_begin_.clear();
+    node_point_end_.clear();
+    return *this;
+}
+
+void LinearOctree::ConvertFromPointCloud(const PointCloud &point_cloud,
+                                         double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    Clear();
+    if (point_cloud.IsEmpty()) {
+        return;
+    }
+    // Same bounds as Octree::ConvertFromPointCloud.
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+    ConvertFromPoints(point_cloud.points_, point_cloud.colors_);
+}
+
+void LinearOctree::ConvertFromPoints(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<Eigen::Vector3d> &colors) {
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth {} exceeds the maximum of {}.",
+                          max_depth_, kMaxDepth);
+    }
+    if (!colors.empty() && colors.size() != points.size()) {
+        utility::LogError("Got {} colors for {} points.", colors.size(),
+                          points.size());
+    }
+    Clear();
+
+    // Morton codes of the leaf cells. Points out of bound are skipped.
+    const int num_input = int(points.size());
+    const uint64_t resolution = uint64_t(1) << max_depth_;
+    std::vector<uint64_t> input_codes(num_input);
+    std::vector<uint8_t> in_bound(num_input);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_input; ++i) {
+        in_bound[i] = Octree::IsPointInBound(points[i], origin_, size_);
+        if (!in_bound[i]) continue;
+        const Eigen::Array3d cell =
+                ((points[i] - origin_) / size_ * double(resolution))
+                        .array()
+                        .floor()
+                        .min(double(resolution - 1));
+        input_codes[i] = EncodeMorton(uint64_t(cell(0)), uint64_t(cell(1)),
+                                      uint64_t(cell(2)));
+    }
+    std::vector<uint64_t> codes;
+    for (int i = 0; i < num_input; ++i) {
+        if (in_bound[i]) {
+            codes.push_back(input_codes[i]);
+            point_indices_.push_back(i);
+        }
+    }
+    if (codes.size() < points.size()) {
+        utility::LogDebug("Skipped {} points out of bound.",
+                          points.size() - codes.size());
+    }
+    if (codes.empty()) {
+        return;
+    }
+
+    RadixSortByCode(codes, point_indices_, int(3 * max_depth_));
+    const int num_points = int(codes.size());
+    points_.resize(num_points);
+    if (!colors.empty()) {
+        colors_.resize(num_points);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_points; ++i) {
+        points_[i] = points[point_indices_[i]];
+        if (!colors.empty()) {
+            colors_[i] = colors[point_indices_[i]];
+        }
+    }
+
+    // Leaf level from the runs of equal codes, then the coarser levels from
+    // the leaves up.
+    std::vector<OctreeLevel> levels(max_depth_ + 1);
+    OctreeLevel &leaves = levels[max_depth_];
+    leaves.point_begin_ = RunStarts(codes);
+    const int num_leaves = int(leaves.point_begin_.size());
+    leaves.codes_.resize(num_leaves);
+    leaves.point_end_.resize(num_leaves);
+    leaves.first_child_.assign(num_leaves, -1);
+    leaves.child_masks_.assign(num_leaves, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int l = 0; l < num_leaves; ++l) {
+        leaves.codes_[l] = codes[leaves.point_begin_[l]];
+        leaves.point_end_[l] =
+                l + 1 < num_leaves ? leaves.point_begin_[l + 1] : num_points;
+    }
+    for (int depth = int(max_depth_) - 1; depth >= 0; --depth) {
+        levels[depth] = BuildParentLevel(levels[depth + 1]);
+    }
+
+    // Concatenate the levels in breadth-first order.
+    level_offsets_.assign(max_depth_ + 2, 0);
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        level_offsets_[depth + 1] =
+                level_offsets_[depth] + int(levels[depth].codes_.size());
+    }
+    const int num_nodes = level_offsets_.back();
+    node_codes_.resize(num_nodes);
+    node_first_child_.resize(num_nodes);
+    node_child_masks_.resize(num_nodes);
+    node_point_begin_.resize(num_nodes);
+    node_point_end_.resize(num_nodes);
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        const OctreeLevel &level = levels[depth];
+        const int offset = level_offsets_[depth];
+        const int child_offset =
+                depth < max_depth_ ? level_offsets_[depth + 1] : 0;
+        std::copy(level.codes_.begin(), level.codes_.end(),
+                  node_codes_.begin() + offset);
+        std::copy(level.child_masks_.begin(), level.child_masks_.end(),
+                  node_child_masks_.begin() + offset);
+        std::copy(level.point_begin_.begin(), level.point_begin_.end(),
+                  node_point_begin_.begin() + offset);
+        std::copy(level.point_end_.begin(), level.point_end_.end(),
+                  node_point_end_.begin() + offset);
+        for (size_t i = 0; i < level.first_child_.size(); ++i) {
+            node_first_child_[offset + i] =
+                    depth < max_depth_ ? child_offset + level.first_child_[i]
+                                       : -1;
+        }
+    }
+}
+
+bool LinearOctree::SetFromChildMasks(
+        const std::vector<uint8_t> &child_masks,
+        const std::vector<int> &leaf_point_counts) {
+    level_offsets_.clear();
+    node_codes_.clear();
+    node_first_child_.clear();
+    node_child_masks_.clear();
+    node_point_begin_.clear();
+    node_point_end_.clear();
+    if (max_depth_ > kMaxDepth) {
+        utility::LogWarning("max_depth {} exceeds the maximum of {}.",
+                            max_depth_, kMaxDepth);
+        return false;
+    }
+    if (child_masks.empty()) {
+        return leaf_point_counts.empty() && points_.empty();
+    }
+
+    // Expand the codes level by level from the root.
+    level_offsets_.push_back(0);
+    node_codes_.push_back(0);
+    node_first_child_.push_back(-1);
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        const int begin = level_offsets_.back();
+        const int end = int(node_codes_.size());
+        level_offsets_.push_back(end);
+        if (end > int(child_masks.size())) {
+            utility::LogWarning("Child masks are truncated.");
+            return false;
+        }
+        for (int node = begin; node < end; ++node) {
+            const uint8_t mask = child_masks[node];
+            if ((depth == max_depth_) != (mask == 0)) {
+                utility::LogWarning(
+                        "Child masks do not match the max depth {}.",
+                        max_depth_);
+                return false;
+            }
+            if (mask == 0) continue;
+            node_first_child_[node] = int(node_codes_.size());
+            for (int child = 0; child < 8; ++child) {
+                if (mask & (1 << child)) {
+                    node_codes_.push_back(node_codes_[node] << 3 | child);
+                    node_first_child_.push_back(-1);
+                }
+            }
+        }
+    }
+    const int num_nodes = int(node_codes_.size());
+    const int num_leaves = num_nodes - level_offsets_[max_depth_];
+    if (num_nodes != int(child_masks.size()) ||
+        num_leaves != int(leaf_point_counts.size())) {
+        utility::LogWarning("Child masks and leaf counts do not match.");
+        return false;
+    }
+    node_child_masks_ = child_masks;
+
+    // Point ranges of the leaves, then of the internal nodes from the
+    // leaves up.
+    node_point_begin_.resize(num_nodes);
+    node_point_end_.resize(num_nodes);
+    int num_points = 0;
+    for (int leaf = 0; leaf < num_leaves; ++leaf) {
+        const int node = level_offsets_[max_depth_] + leaf;
+        if (leaf_point_counts[leaf] <= 0) {
+            utility::LogWarning("Leaf {} has no points.", leaf);
+            return false;
+        }
+        node_point_begin_[node] = num_points;
+        num_points += leaf_point_counts[leaf];
+        node_point_end_[node] = num_points;
+    }
+    if (num_points != int(points_.size()) ||
+        num_points != int(point_indices_.size()) ||
+        (!colors_.empty() && num_points != int(colors_.size()))) {
+        utility::LogWarning("Leaf counts do not match the {} points.",
+                            points_.size());
+        return false;
+    }
+    for (int node = level_offsets_[max_depth_] - 1; node >= 0; --node) {
+        const int first = node_first_child_[node];
+        const int last = first + PopCount(node_child_masks_[node]) - 1;
+        node_point_begin_[node] = node_point_begin_[first];
+        node_point_end_[node] = node_point_end_[last];
+    }
+    return true;
+}
+
+size_t LinearOctree::GetNodeDepth(int node) const {
+    return size_t(std::upper_bound(level_offsets_.begin(),
+                                   level_offsets_.end(), node) -
+                  level_offsets_.begin() - 1);
+}
+
+OctreeNodeInfo LinearOctree::GetNodeInfo(int node) const {
+    const size_t depth = GetNodeDepth(node);
+    const double node_size = size_ / double(uint64_t(1) << depth);
+    const Eigen::Vector3d origin =
+            origin_ + DecodeMorton(node_codes_[node]) * node_size;
+    return OctreeNodeInfo(origin, node_size, depth,
+                          depth == 0 ? 0 : node_codes_[node] & 7);
+}
+
+int LinearOctree::GetChildNode(int node, int child_index) const {
+    const uint8_t mask = node_child_masks_[node];
+    if (!(mask & (1 << child_index))) {
+        return -1;
+    }
+    return node_first_child_[node] +
+           PopCount(uint8_t(mask & ((1 << child_index) - 1)));
+}
+
+std::vector<int> LinearOctree::GetPointIndices(int node) const {
+    return std::vector<int>(point_indices_.begin() + node_point_begin_[node],
+                            point_indices_.begin() + node_point_end_[node]);
+}
+
+int LinearOctree::LocateLeafNode(const Eigen::Vector3d &point) const {
+    if (IsEmpty() || !Octree::IsPointInBound(point, origin_, size_)) {
+        return -1;
+    }
+    const uint64_t resolution = uint64_t(1) << max_depth_;
+    const Eigen::Array3d cell = ((point - origin_) / size_ * double(resolution))
+                                        .array()
+                                        .floor()
+                                        .min(double(resolution - 1));
+    const uint64_t code = EncodeMorton(uint64_t(cell(0)), uint64_t(cell(1)),
+                                       uint64_t(cell(2)));
+    auto begin = node_codes_.begin() + level_offsets_[max_depth_];
+    auto end = node_codes_.begin() + level_offsets_[max_depth_ + 1];
+    auto it = std::lower_bound(begin, end, code);
+    if (it == end || *it != code) {
+        return -1;
+    }
+    return int(it - node_codes_.begin());
+}
+
+std::vector<int> LinearOctree::LocateLeafNodes(
+        const std::vector<Eigen::Vector3d> &points) const {
+    std::vector<int> nodes(points.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < int(points.size()); ++i) {
+        nodes[i] = LocateLeafNode(points[i]);
+    }
+    return nodes;
+}
+
+int LinearOctree::SearchKNN(const Eigen::Vector3d &query,
+                            int knn,
+                            std::vector<int> &indices,
+                            std::vector<double> &distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (IsEmpty() || knn <= 0) {
+        return 0;
+    }
+    // Max heap of the best points so far, as (distance2, point).
+    std::priority_queue<std::pair<double, int>> best;
+    // Min heap of the nodes to visit, as (box distance2, node).
+    std::priority_queue<std::pair<double, int>,
+                        std::vector<std::pair<double, int>>,
+                        std::greater<std::pair<double, int>>>
+            frontier;
+    frontier.emplace(BoxDistance2(query, origin_, size_), 0);
+    while (!frontier.empty()) {
+        const double node_distance2 = frontier.top().first;
+        const int node = frontier.top().second;
+        frontier.pop();
+        if (int(best.size()) == knn && node_distance2 > best.top().first) {
+            break;
+        }
+        if (IsLeafNode(node)) {
+            for (int p = node_point_begin_[node]; p < node_point_end_[node];
+                 ++p) {
+                const double d2 = (points_[p] - query).squaredNorm();
+                if (int(best.size()) < knn) {
+                    best.emplace(d2, p);
+                } else if (d2 < best.top().first) {
+                    best.pop();
+                    best.emplace(d2, p);
+                }
+            }
+            continue;
+        }
+        const int first = node_first_child_[node];
+        const int num_children = PopCount(node_child_masks_[node]);
+        for (int child = first; child < first + num_children; ++child) {
+            const OctreeNodeInfo info = GetNodeInfo(child);
+            const double d2 = BoxDistance2(query, info.origin_, info.size_);
+            if (int(best.size()) < knn || d2 <= best.top().first) {
+                frontier.emplace(d2, child);
+            }
+        }
+    }
+
+    const int num_found = int(best.size());
+    indices.resize(num_found);
+    distance2.resize(num_found);
+    for (int i = num_found - 1; i >= 0; --i) {
+        indices[i] = point_indices_[best.top().second];
+        distance2[i] = best.top().first;
+        best.pop();
+    }
+    return num_found;
+}
+
+int LinearOctree::SearchRadius(const Eigen::Vector3d &query,
+                               double radius,
+                               std::vector<int> &indices,
+                               std::vector<double> &distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (IsEmpty() || radius < 0) {
+        return 0;
+    }
+    const double radius2 = radius * radius;
+    std::vector<std::pair<double, int>> found;
+    std::vector<int> stack = {0};
+    while (!stack.empty()) {
+        const int node = stack.back();
+        stack.pop_back();
+        const OctreeNodeInfo info = GetNodeInfo(node);
+        if (BoxDistance2(query, info.origin_, info.size_) > radius2) {
+            continue;
+        }
+        if (IsLeafNode(node)) {
+            for (int p = node_point_begin_[node]; p < node_point_end_[node];
+                 ++p) {
+                const double d2 = (points_[p] - query).squaredNorm();
+                if (d2 <= radius2) {
+                    found.emplace_back(d2, point_indices_[p]);
+                }
+            }
+            continue;
+        }
+        const int first = node_first_child_[node];
+        const int num_children = PopCount(node_child_masks_[node]);
+        for (int child = first; child < first + num_children; ++child) {
+            stack.push_back(child);
+        }
+    }
+
+    std::sort(found.begin(), found.end());
+    indices.resize(found.size());
+    distance2.resize(found.size());
+    for (size_t i = 0; i < found.size(); ++i) {
+        distance2[i] = found[i].first;
+        indices[i] = found[i].second;
+    }
+    return int(found.size());
+}
+
+std::vector<int> LinearOctree::SearchBoundingBox(
+        const AxisAlignedBoundingBox &bbox) const {
+    std::vector<int> indices;
+    if (IsEmpty()) {
+        return indices;
+    }
+    const Eigen::Array3d min_bound = bbox.min_bound_.array();
+    const Eigen::Array3d max_bound = bbox.max_bound_.array();
+    std::vector<int> stack = {0};
+    while (!stack.empty()) {
+        const int node = stack.back();
+        stack.pop_back();
+        const OctreeNodeInfo info = GetNodeInfo(node);
+        const Eigen::Array3d node_min = info.origin_.array();
+        const Eigen::Array3d node_max = node_min + info.size_;
+        if ((node_max < min_bound).any() || (node_min > max_bound).any()) {
+            continue;
+        }
+        const int begin = node_point_begin_[node];
+        const int end = node_point_end_[node];
+        if ((node_min >= min_bound).all() && (node_max <= max_bound).all()) {
+            indices.insert(indices.end(), point_indices_.begin() + begin,
+                           point_indices_.begin() + end);
+            continue;
+        }
+        if (IsLeafNode(node)) {
+            for (int p = begin; p < end; ++p) {
+                const Eigen::Array3d point = points_[p].array();
+                if ((point >= min_bound).all() && (point <= max_bound).all()) {
+                    indices.push_back(point_indices_[p]);
+                }
+            }
+            continue;
+        }
+        const int first = node_first_child_[node];
+        const int num_children = PopCount(node_child_masks_[node]);
+        for (int child = first; child < first + num_children; ++child) {
+            stack.push_back(child);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+std::shared_ptr<PointCloud> LinearOctree::ExtractLevelOfDetail(
+        size_t depth) const {
+    auto lod = std::make_shared<PointCloud>();
+    if (IsEmpty()) {
+        return lod;
+    }
+    if (depth > max_depth_) {
+        utility::LogError("depth {} exceeds max_depth {}.", depth, max_depth_);
+    }
+    const int offset = level_offsets_[depth];
+    const int num_nodes = level_offsets_[depth + 1] - offset;
+    lod->points_.resize(num_nodes);
+    if (!colors_.empty()) {
+        lod->colors_.resize(num_nodes);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_nodes; ++i) {
+        const int begin = node_point_begin_[offset + i];
+        const int end = node_point_end_[offset + i];
+        Eigen::Vector3d point_sum = Eigen::Vector3d::Zero();
+        Eigen::Vector3d color_sum = Eigen::Vector3d::Zero();
+        for (int p = begin; p < end; ++p) {
+            point_sum += points_[p];
+            if (!colors_.empty()) {
+                color_sum += colors_[p];
+            }
+        }
+        lod->points_[i] = point_sum / double(end - begin);
+        if (!colors_.empty()) {
+            lod->colors_[i] = color_sum / double(end - begin);
+        }
+    }
+    return lod;
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (IsEmpty()) {
+        return octree;
+    }
+    // Octree stores the indices of each node in insertion order.
+    auto sorted_indices = [this](int node) {
+        std::vector<size_t> indices(point_indices_.begin() +
+                                            node_point_begin_[node],
+                                    point_indices_.begin() +
+                                            node_point_end_[node]);
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    };
+    std::vector<std::shared_ptr<OctreeNode>> nodes(NumNodes());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int node = 0; node < int(NumNodes()); ++node) {
+        if (IsLeafNode(node)) {
+            auto leaf = std::make_shared<OctreePointColorLeafNode>();
+            leaf->indices_ = sorted_indices(node);
+            if (!colors_.empty()) {
+                // The color of the last inserted point, as in Octree.
+                int last = node_point_begin_[node];
+                for (int p = last; p < node_point_end_[node]; ++p) {
+                    if (point_indices_[p] > point_indices_[last]) last = p;
+                }
+                leaf->color_ = colors_[last];
+            }
+            nodes[node] = leaf;
+        } else {
+            auto internal = std::make_shared<OctreeInternalPointNode>();
+            internal->indices_ = sorted_indices(node);
+            nodes[node] = internal;
+        }
+    }
+    for (int node = 0; node < level_offsets_[max_depth_]; ++node) {
+        auto internal =
+                std::static_pointer_cast<OctreeInternalNode>(nodes[node]);
+        for (int child_index = 0; child_index < 8; ++child_index) {
+            const int child = GetChildNode(node, child_index);
+            if (child >= 0) {
+                internal->children_[child_index] = nodes[child];
+            }
+        }
+    }
+    octree->root_node_ = nodes[0];
+    return octree;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,223 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class AxisAlignedBoundingBox;
+class PointCloud;
+
+/// \class LinearOctree
+///
+/// \brief Pointerless octree stored as flat node arrays in breadth-first
+/// order.
+///
+/// The points are sorted by the Morton codes of their cells at max_depth_ with
+/// a parallel radix sort, so the points of every node are a contiguous range
+/// of points_. The nodes of each depth are the unique prefixes of the sorted
+/// codes, and are built level by level from the leaves up. The children of a
+/// node are stored contiguously, in increasing child index order. The child
+/// index of a cell follows Octree, i.e. x + 2 * y + 4 * z.
+///
+/// All queries are const and can be called from multiple threads.
+class LinearOctree {
+public:
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree, at
+    /// most 21.
+    LinearOctree(size_t max_depth)
+        : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree, at
+    /// most 21.
+    /// \param origin Sets the global min bound of the octree.
+    /// \param size Sets the outer bounding box edge size for the whole octree.
+    LinearOctree(size_t max_depth, const Eigen::Vector3d &origin, double size)
+        : origin_(origin), size_(size), max_depth_(max_depth) {}
+
+public:
+    /// Removes all nodes and points, keeping the bounds and the max depth.
+    LinearOctree &Clear();
+
+    /// Returns true if the octree has no nodes.
+    bool IsEmpty() const { return node_codes_.empty(); }
+
+    /// \brief Builds the octree from a point cloud, with the same bounds as
+    /// Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud. Its colors are kept, if any.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const PointCloud &point_cloud,
+                               double size_expand = 0.01);
+
+    /// \brief Builds the octree from the points within the current bounds,
+    /// i.e. origin_ <= point < origin_ + size_. Other points are skipped.
+    ///
+    /// \param points Input points.
+    /// \param colors Colors of the points, or empty.
+    void ConvertFromPoints(const std::vector<Eigen::Vector3d> &points,
+                           const std::vector<Eigen::Vector3d> &colors = {});
+
+    /// \brief Rebuilds the nodes from the breadth-first child masks and the
+    /// point counts of the leaves, the compact encoding of the tree.
+    ///
+    /// The bounds, max depth, the points in Morton order and their indices
+    /// must be set.
+    /// \return false if the encoding is inconsistent with the max depth or
+    /// the number of points.
+    bool SetFromChildMasks(const std::vector<uint8_t> &child_masks,
+                           const std::vector<int> &leaf_point_counts);
+
+    /// Number of nodes.
+    size_t NumNodes() const { return node_codes_.size(); }
+
+    /// Number of points stored in the octree.
+    size_t NumPoints() const { return points_.size(); }
+
+    /// Depth of \p node. The root is of depth 0.
+    size_t GetNodeDepth(int node) const;
+
+    /// Returns true if \p node is a leaf, i.e. of depth max_depth_.
+    bool IsLeafNode(int node) const {
+        return node >= level_offsets_[max_depth_];
+    }
+
+    /// Returns the origin, size, depth and child index of \p node.
+    OctreeNodeInfo GetNodeInfo(int node) const;
+
+    /// Returns the node index of the child \p child_index of \p node, or -1
+    /// if that child is empty.
+    int GetChildNode(int node, int child_index) const;
+
+    /// Returns the original indices of the points in \p node, in Morton order.
+    std::vector<int> GetPointIndices(int node) const;
+
+    /// \brief Returns the index of the leaf node where \p point resides, or
+    /// -1 if the point is out of bound or in an empty cell.
+    ///
+    /// The leaf is found by a binary search of the Morton code of the point
+    /// in the leaf level.
+    int LocateLeafNode(const Eigen::Vector3d &point) const;
+
+    /// Locates the leaf node of every point in parallel. See LocateLeafNode.
+    std::vector<int> LocateLeafNodes(
+            const std::vector<Eigen::Vector3d> &points) const;
+
+    /// \brief Finds the \p knn nearest points of \p query, with a best-first
+    /// traversal of the nodes.
+    ///
+    /// \param indices Output original indices of the points, closest first.
+    /// \param distance2 Output squared distances.
+    /// \return The number of points found.
+    int SearchKNN(const Eigen::Vector3d &query,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) const;
+
+    /// \brief Finds the points within \p radius of \p query.
+    ///
+    /// \param indices Output original indices of the points, closest first.
+    /// \param distance2 Output squared distances.
+    /// \return The number of points found.
+    int SearchRadius(const Eigen::Vector3d &query,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    /// Returns the sorted original indices of the points inside \p bbox.
+    std::vector<int> SearchBoundingBox(
+            const AxisAlignedBoundingBox &bbox) const;
+
+    /// \brief Returns a point cloud with one point per node of \p depth, at
+    /// the centroid of the points of the node, with their mean color.
+    ///
+    /// \param depth Depth of the level of detail, at most max_depth_.
+    std::shared_ptr<PointCloud> ExtractLevelOfDetail(size_t depth) const;
+
+    /// \brief Converts to a pointer based Octree, equal to the one built by
+    /// Octree::ConvertFromPointCloud from the same points.
+    std::shared_ptr<Octree> ToOctree() const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+
+    /// Max depth of the octree, at most 21 so that a Morton code fits in
+    /// 64 bits. A tree with only the root node has depth 0.
+    size_t max_depth_;
+
+    /// Points in Morton order.
+    std::vector<Eigen::Vector3d> points_;
+
+    /// Colors of the points in Morton order, or empty.
+    std::vector<Eigen::Vector3d> colors_;
+
+    /// Original index of each point in points_.
+    std::vector<int> point_indices_;
+
+    /// The nodes of depth d are [level_offsets_[d], level_offsets_[d + 1]).
+    std::vector<int> level_offsets_;
+
+    /// Morton code of each node, the 3 * depth bits of its cell.
+    std::vector<uint64_t> node_codes_;
+
+    /// Index of the first child of each node, or -1 for leaves.
+    std::vector<int> node_first_child_;
+
+    /// Bit i is set if the node has the child of child index i.
+    std::vector<uint8_t> node_child_masks_;
+
+    /// The points of node n are points_[node_point_begin_[n],
+    /// node_point_end_[n]).
+    std::vector<int> node_point_begin_;
+    std::vector<int> node_point_end_;
+
+    /// Max depth supported by 64 bit Morton codes.
+    static constexpr size_t kMaxDepth = 21;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -25,169 +25,235 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <unordered_map>
+#include <utility>
 
 #include "open3d/geometry/IntersectionTest.h"
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-class BallPivotingVertex;
-class BallPivotingEdge;
-class BallPivotingTriangle;
+namespace {
 
-typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+/// Side length of the automatic tiles in multiples of the largest radius.
+constexpr double kAutoTileSizeInRadii = 50.0;
+
+// The vertex, edge and triangle records refer to each other by their index
+// in the arenas of BallPivoting.
 
 class BallPivotingVertex {
 public:
-    enum Type { Orphan = 0, Front = 1, Inner = 2 };
-
-    BallPivotingVertex(int idx,
-                       const Eigen::Vector3d& point,
-                       const Eigen::Vector3d& normal)
-        : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
+    enum Type : uint8_t { Orphan = 0, Front = 1, Inner = 2 };
 
-    void UpdateType();
+    void UpdateType() {
+        if (num_edges_ == 0) {
+            type_ = Type::Orphan;
+        } else if (num_inner_edges_ < num_edges_) {
+            type_ = Type::Front;
+        } else {
+            type_ = Type::Inner;
+        }
+    }
 
 public:
-    int idx_;
-    const Eigen::Vector3d& point_;
-    const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
-    Type type_;
+    int num_edges_ = 0;
+    int num_inner_edges_ = 0;
+    Type type_ = Type::Orphan;
 };
 
 class BallPivotingEdge {
 public:
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
-    BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
+    BallPivotingEdge(int source, int target)
         : source_(source), target_(target), type_(Type::Front) {}
 
-    void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
-    BallPivotingVertexPtr GetOppositeVertex();
-
 public:
-    BallPivotingVertexPtr source_;
-    BallPivotingVertexPtr target_;
-    BallPivotingTrianglePtr triangle0_;
-    BallPivotingTrianglePtr triangle1_;
+    int source_;
+    int target_;
+    int triangle0_ = -1;
+    int triangle1_ = -1;
     Type type_;
 };
 
 class BallPivotingTriangle {
 public:
-    BallPivotingTriangle(BallPivotingVertexPtr vert0,
-                         BallPivotingVertexPtr vert1,
-                         BallPivotingVertexPtr vert2,
-                         Eigen::Vector3d ball_center)
+    BallPivotingTriangle(int vert0,
+                         int vert1,
+                         int vert2,
+                         const Eigen::Vector3d& ball_center)
         : vert0_(vert0),
           vert1_(vert1),
           vert2_(vert2),
           ball_center_(ball_center) {}
 
 public:
-    BallPivotingVertexPtr vert0_;
-    BallPivotingVertexPtr vert1_;
-    BallPivotingVertexPtr vert2_;
+    int vert0_;
+    int vert1_;
+    int vert2_;
     Eigen::Vector3d ball_center_;
 };
 
-void BallPivotingVertex::UpdateType() {
-    if (edges_.empty()) {
-        type_ = Type::Orphan;
-    } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
-            if (edge->type_ != BallPivotingEdge::Type::Inner) {
-                type_ = Type::Front;
-                return;
+/// Points bucketed into cubic cells by sorting their cell keys. A radius
+/// search visits the cells overlapping the query box and reuses its buffers,
+/// so that the searches of a reconstruction do not allocate.
+class BallPivotingGrid {
+public:
+    BallPivotingGrid(const std::vector<Eigen::Vector3d>& points,
+                     double cell_size)
+        : points_(points), cell_size_(cell_size) {
+        const int n = int(points.size());
+        Eigen::Vector3d max_bound = Eigen::Vector3d::Zero();
+        origin_ = Eigen::Vector3d::Zero();
+        if (n > 0) {
+            origin_ = max_bound = points[0];
+            for (const Eigen::Vector3d& point : points) {
+                origin_ = origin_.cwiseMin(point);
+                max_bound = max_bound.cwiseMax(point);
             }
         }
-        type_ = Type::Inner;
+        double num_cells = 1;
+        for (int d = 0; d < 3; ++d) {
+            dims_[d] = int64_t((max_bound(d) - origin_(d)) / cell_size) + 1;
+            num_cells *= double(dims_[d]);
+        }
+        if (num_cells > 4e18) {
+            utility::LogError(
+                    "The radii are too small for the extent of the point "
+                    "cloud.");
+        }
+
+        std::vector<std::pair<int64_t, int>> keyed(n);
+        for (int i = 0; i < n; ++i) {
+            int64_t cell[3];
+            for (int d = 0; d < 3; ++d) {
+                cell[d] = std::min(
+                        dims_[d] - 1,
+                        int64_t((points[i](d) - origin_(d)) / cell_size));
+            }
+            keyed[i] = std::make_pair(Key(cell[0], cell[1], cell[2]), i);
+        }
+        std::sort(keyed.begin(), keyed.end());
+        cell_points_.resize(n);
+        for (int i = 0; i < n; ++i) {
+            if (i == 0 || keyed[i].first != keyed[i - 1].first) {
+                cell_keys_.push_back(keyed[i].first);
+                cell_splits_.push_back(i);
+            }
+            cell_points_[i] = keyed[i].second;
+        }
+        cell_splits_.push_back(n);
     }
-}
 
-void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
-    if (triangle != triangle0_ && triangle != triangle1_) {
-        if (triangle0_ == nullptr) {
-            triangle0_ = triangle;
-            type_ = Type::Front;
-            // update orientation
-            if (BallPivotingVertexPtr opp = GetOppositeVertex()) {
-                Eigen::Vector3d tr_norm =
-                        (target_->point_ - source_->point_)
-                                .cross(opp->point_ - source_->point_);
-                tr_norm /= tr_norm.norm();
-                Eigen::Vector3d pt_norm =
-                        source_->normal_ + target_->normal_ + opp->normal_;
-                pt_norm /= pt_norm.norm();
-                if (pt_norm.dot(tr_norm) < 0) {
-                    std::swap(target_, source_);
+    /// Returns the indices of the points closer than \p radius to \p query,
+    /// sorted by distance like KDTreeFlann::SearchRadius.
+    void SearchRadius(const Eigen::Vector3d& query,
+                      double radius,
+                      std::vector<int>& indices) {
+        indices.clear();
+        neighbors_.clear();
+        int64_t lo[3], hi[3];
+        for (int d = 0; d < 3; ++d) {
+            const double min_cell =
+                    std::floor((query(d) - radius - origin_(d)) / cell_size_);
+            const double max_cell =
+                    std::floor((query(d) + radius - origin_(d)) / cell_size_);
+            if (max_cell < 0 || min_cell >= double(dims_[d])) {
+                return;
+            }
+            lo[d] = std::max(int64_t(0), int64_t(min_cell));
+            hi[d] = std::min(dims_[d] - 1, int64_t(max_cell));
+        }
+        const double radius2 = radius * radius;
+        for (int64_t x = lo[0]; x <= hi[0]; ++x) {
+            for (int64_t y = lo[1]; y <= hi[1]; ++y) {
+                // The cells along z have consecutive keys.
+                const int64_t key_end = Key(x, y, hi[2]);
+                for (auto it = std::lower_bound(cell_keys_.begin(),
+                                                cell_keys_.end(),
+                                                Key(x, y, lo[2]));
+                     it != cell_keys_.end() && *it <= key_end; ++it) {
+                    const size_t cell = it - cell_keys_.begin();
+                    for (int i = cell_splits_[cell]; i < cell_splits_[cell + 1];
+                         ++i) {
+                        const int idx = cell_points_[i];
+                        const double dist2 =
+                                (points_[idx] - query).squaredNorm();
+                        if (dist2 < radius2) {
+                            neighbors_.emplace_back(dist2, idx);
+                        }
+                    }
                 }
-            } else {
-                utility::LogError("GetOppositeVertex() returns nullptr.");
             }
-        } else if (triangle1_ == nullptr) {
-            triangle1_ = triangle;
-            type_ = Type::Inner;
-        } else {
-            utility::LogDebug("!!! This case should not happen");
+        }
+        std::sort(neighbors_.begin(), neighbors_.end());
+        for (const auto& neighbor : neighbors_) {
+            indices.push_back(neighbor.second);
         }
     }
-}
 
-BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
-    if (triangle0_ != nullptr) {
-        if (triangle0_->vert0_->idx_ != source_->idx_ &&
-            triangle0_->vert0_->idx_ != target_->idx_) {
-            return triangle0_->vert0_;
-        } else if (triangle0_->vert1_->idx_ != source_->idx_ &&
-                   triangle0_->vert1_->idx_ != target_->idx_) {
-            return triangle0_->vert1_;
-        } else {
-            return triangle0_->vert2_;
-        }
-    } else {
-        return nullptr;
+private:
+    int64_t Key(int64_t x, int64_t y, int64_t z) const {
+        return (x * dims_[1] + y) * dims_[2] + z;
     }
-}
 
+private:
+    const std::vector<Eigen::Vector3d>& points_;
+    double cell_size_;
+    Eigen::Vector3d origin_;
+    int64_t dims_[3];
+    std::vector<int64_t> cell_keys_;
+    std::vector<int> cell_splits_;
+    std::vector<int> cell_points_;
+    std::vector<std::pair<double, int>> neighbors_;
+};
+
+/// Ball pivoting over a set of oriented points. Tiles of a point cloud are
+/// reconstructed independently with Run, and a last instance over all points
+/// closes the seams between them with Stitch.
 class BallPivoting {
 public:
-    BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
-        mesh_ = std::make_shared<TriangleMesh>();
-        mesh_->vertices_ = pcd.points_;
-        mesh_->vertex_normals_ = pcd.normals_;
-        mesh_->vertex_colors_ = pcd.colors_;
-        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
-        }
+    BallPivoting(const std::vector<Eigen::Vector3d>& points,
+                 const std::vector<Eigen::Vector3d>& normals,
+                 double cell_size)
+        : points_(points),
+          normals_(normals),
+          grid_(points, cell_size),
+          vertices_(points.size()) {}
+
+    const std::vector<Eigen::Vector3i>& GetMeshTriangles() const {
+        return mesh_triangles_;
     }
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
-        }
+    const std::vector<Eigen::Vector3d>& GetMeshTriangleNormals() const {
+        return mesh_triangle_normals_;
+    }
+
+    /// Triangles in the order of their creation, with the vertices in the
+    /// order of the pivot that created them.
+    const std::vector<BallPivotingTriangle>& GetTriangles() const {
+        return triangles_;
+    }
+
+    BallPivotingVertex::Type GetVertexType(int vidx) const {
+        return vertices_[vidx].type_;
     }
 
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
                            int vidx3,
                            double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+                           Eigen::Vector3d& center) const {
+        const Eigen::Vector3d& v1 = points_[vidx1];
+        const Eigen::Vector3d& v2 = points_[vidx2];
+        const Eigen::Vector3d& v3 = points_[vidx3];
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -218,9 +284,8 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm =
+                    normals_[vidx1] + normals_[vidx2] + normals_[vidx3];
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -233,72 +298,86 @@ public:
         return false;
     }
 
-    BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
-                                       const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
-                }
-            }
-        }
-        return nullptr;
+    /// Returns the edge between \p v0 and \p v1 or -1.
+    int GetLinkingEdge(int v0, int v1) const {
+        auto it = edge_lookup_.find(EdgeKey(v0, v1));
+        return it == edge_lookup_.end() ? -1 : it->second;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
-                        const BallPivotingVertexPtr& v1,
-                        const BallPivotingVertexPtr& v2,
-                        const Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
-                v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
-        if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
+    int GetOppositeVertex(int edge) const {
+        const BallPivotingEdge& e = edges_[edge];
+        if (e.triangle0_ < 0) {
+            return -1;
         }
-        e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
-
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
+        const BallPivotingTriangle& triangle = triangles_[e.triangle0_];
+        if (triangle.vert0_ != e.source_ && triangle.vert0_ != e.target_) {
+            return triangle.vert0_;
+        } else if (triangle.vert1_ != e.source_ &&
+                   triangle.vert1_ != e.target_) {
+            return triangle.vert1_;
+        } else {
+            return triangle.vert2_;
         }
-        e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
+    }
 
-        BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
-        if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
+    void AddAdjacentTriangle(int edge, int triangle) {
+        BallPivotingEdge& e = edges_[edge];
+        if (triangle == e.triangle0_ || triangle == e.triangle1_) {
+            return;
+        }
+        if (e.triangle0_ < 0) {
+            e.triangle0_ = triangle;
+            e.type_ = BallPivotingEdge::Type::Front;
+            // update orientation
+            const int opp = GetOppositeVertex(edge);
+            Eigen::Vector3d tr_norm = (points_[e.target_] - points_[e.source_])
+                                              .cross(points_[opp] -
+                                                     points_[e.source_]);
+            tr_norm /= tr_norm.norm();
+            Eigen::Vector3d pt_norm = normals_[e.source_] +
+                                      normals_[e.target_] + normals_[opp];
+            pt_norm /= pt_norm.norm();
+            if (pt_norm.dot(tr_norm) < 0) {
+                std::swap(e.target_, e.source_);
+            }
+        } else if (e.triangle1_ < 0) {
+            e.triangle1_ = triangle;
+            e.type_ = BallPivotingEdge::Type::Inner;
+            vertices_[e.source_].num_inner_edges_++;
+            vertices_[e.target_].num_inner_edges_++;
+        } else {
+            utility::LogDebug("!!! This case should not happen");
         }
-        e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
+    }
 
-        v0->UpdateType();
-        v1->UpdateType();
-        v2->UpdateType();
+    /// Records the triangle and its edges without emitting it to the mesh.
+    void AddTriangle(int v0, int v1, int v2, const Eigen::Vector3d& center) {
+        const int triangle = int(triangles_.size());
+        triangles_.emplace_back(v0, v1, v2, center);
+        AddAdjacentTriangle(GetOrCreateEdge(v0, v1), triangle);
+        AddAdjacentTriangle(GetOrCreateEdge(v1, v2), triangle);
+        AddAdjacentTriangle(GetOrCreateEdge(v2, v0), triangle);
+    }
+
+    void CreateTriangle(int v0, int v1, int v2, const Eigen::Vector3d& center) {
+        AddTriangle(v0, v1, v2, center);
+        vertices_[v0].UpdateType();
+        vertices_[v1].UpdateType();
+        vertices_[v2].UpdateType();
 
         Eigen::Vector3d face_normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (face_normal.dot(normals_[v0]) > -1e-16) {
+            mesh_triangles_.emplace_back(v0, v1, v2);
         } else {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
+            mesh_triangles_.emplace_back(v0, v2, v1);
         }
-        mesh_->triangle_normals_.push_back(face_normal);
+        mesh_triangle_normals_.push_back(face_normal);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
                                       const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
+                                      const Eigen::Vector3d& v2) const {
         Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
         double norm = normal.norm();
         if (norm > 0) {
@@ -307,125 +386,70 @@ public:
         return normal;
     }
 
-    bool IsCompatible(const BallPivotingVertexPtr& v0,
-                      const BallPivotingVertexPtr& v1,
-                      const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
+    bool IsCompatible(int v0, int v1, int v2) const {
         Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (normal.dot(normals_[v0]) < -1e-16) {
             normal *= -1;
         }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
-        utility::LogDebug("[IsCompatible] returns = {}", ret);
-        return ret;
-    }
-
-    BallPivotingVertexPtr FindCandidateVertex(
-            const BallPivotingEdgePtr& edge,
-            double radius,
-            Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
-        BallPivotingVertexPtr src = edge->source_;
-        BallPivotingVertexPtr tgt = edge->target_;
-
-        const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
-        if (opp == nullptr) {
-            utility::LogError("edge->GetOppositeVertex() returns nullptr.");
-            assert(opp == nullptr);
-        }
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
-
-        Eigen::Vector3d v = tgt->point_ - src->point_;
+        return normal.dot(normals_[v0]) > -1e-16 &&
+               normal.dot(normals_[v1]) > -1e-16 &&
+               normal.dot(normals_[v2]) > -1e-16;
+    }
+
+    int FindCandidateVertex(int edge,
+                            double radius,
+                            Eigen::Vector3d& candidate_center) {
+        const int src = edges_[edge].source_;
+        const int tgt = edges_[edge].target_;
+        const int opp = GetOppositeVertex(edge);
+        if (opp < 0) {
+            utility::LogError("GetOppositeVertex() returns -1.");
+        }
+
+        const Eigen::Vector3d mp = 0.5 * (points_[src] + points_[tgt]);
+        const Eigen::Vector3d& center =
+                triangles_[edges_[edge].triangle0_].ball_center_;
+
+        Eigen::Vector3d v = points_[tgt] - points_[src];
         v /= v.norm();
 
         Eigen::Vector3d a = center - mp;
         a /= a.norm();
 
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
-        utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
-                          indices.size());
+        std::vector<int>& indices = candidate_indices_;
+        grid_.SearchRadius(mp, 2 * radius, indices);
 
-        BallPivotingVertexPtr min_candidate = nullptr;
+        int min_candidate = -1;
         double min_angle = 2 * M_PI;
-        for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
+        for (int candidate : indices) {
+            if (candidate == src || candidate == tgt || candidate == opp) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
 
             bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
+                    points_[src], points_[tgt], points_[opp],
+                    points_[candidate]);
             if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
+                                     mp, points_[candidate], points_[src],
+                                     points_[opp]) < 1e-12 ||
                              IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is intersecting "
-                        "the existing triangle",
-                        candidate->idx_);
+                                     mp, points_[candidate], points_[tgt],
+                                     points_[opp]) < 1e-12)) {
                 continue;
             }
 
             Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} can not compute "
-                        "ball",
-                        candidate->idx_);
+            if (!ComputeBallCenter(src, tgt, candidate, radius, new_center)) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
 
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
 
             double angle = std::acos(cosinus);
 
@@ -435,200 +459,159 @@ public:
             }
 
             if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
                 continue;
             }
 
             bool empty_ball = true;
-            for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
+            for (int nb : indices) {
+                if (nb == src || nb == tgt || nb == candidate) {
                     continue;
                 }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
-                            "[FindCandidateVertex] candidate {:d} not an empty "
-                            "ball",
-                            candidate->idx_);
+                if ((new_center - points_[nb]).norm() < radius - 1e-16) {
                     empty_ball = false;
                     break;
                 }
             }
 
             if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
                 min_angle = angle;
-                min_candidate = vertices[nbidx];
+                min_candidate = candidate;
                 candidate_center = new_center;
             }
         }
-
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
         return min_candidate;
     }
 
     void ExpandTriangulation(double radius) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
         while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
+            const int edge = edge_front_.front();
             edge_front_.pop_front();
-            if (edge->type_ != BallPivotingEdge::Front) {
+            if (edges_[edge].type_ != BallPivotingEdge::Front) {
                 continue;
             }
 
+            const int src = edges_[edge].source_;
+            const int tgt = edges_[edge].target_;
             Eigen::Vector3d center;
-            BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
-            if (candidate == nullptr ||
-                candidate->type_ == BallPivotingVertex::Type::Inner ||
-                !IsCompatible(candidate, edge->source_, edge->target_)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
+            const int candidate = FindCandidateVertex(edge, radius, center);
+            if (candidate < 0 ||
+                vertices_[candidate].type_ ==
+                        BallPivotingVertex::Type::Inner ||
+                !IsCompatible(candidate, src, tgt)) {
+                edges_[edge].type_ = BallPivotingEdge::Type::Border;
                 border_edges_.push_back(edge);
                 continue;
             }
 
-            BallPivotingEdgePtr e0 = GetLinkingEdge(candidate, edge->source_);
-            BallPivotingEdgePtr e1 = GetLinkingEdge(candidate, edge->target_);
-            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
-                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
+            int e0 = GetLinkingEdge(candidate, src);
+            int e1 = GetLinkingEdge(candidate, tgt);
+            if ((e0 >= 0 &&
+                 edges_[e0].type_ != BallPivotingEdge::Type::Front) ||
+                (e1 >= 0 &&
+                 edges_[e1].type_ != BallPivotingEdge::Type::Front)) {
+                edges_[edge].type_ = BallPivotingEdge::Type::Border;
                 border_edges_.push_back(edge);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(src, tgt, candidate, center);
 
-            e0 = GetLinkingEdge(candidate, edge->source_);
-            e1 = GetLinkingEdge(candidate, edge->target_);
-            if (e0->type_ == BallPivotingEdge::Type::Front) {
+            e0 = GetLinkingEdge(candidate, src);
+            e1 = GetLinkingEdge(candidate, tgt);
+            if (edges_[e0].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e0);
             }
-            if (e1->type_ == BallPivotingEdge::Type::Front) {
+            if (edges_[e1].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e1);
             }
         }
     }
 
-    bool TryTriangleSeed(const BallPivotingVertexPtr& v0,
-                         const BallPivotingVertexPtr& v1,
-                         const BallPivotingVertexPtr& v2,
+    bool TryTriangleSeed(int v0,
+                         int v1,
+                         int v2,
                          const std::vector<int>& nb_indices,
                          double radius,
-                         Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
-                "radius={}",
-                v0->idx_, v1->idx_, v2->idx_, radius);
-
+                         Eigen::Vector3d& center) const {
         if (!IsCompatible(v0, v1, v2)) {
             return false;
         }
 
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e0 is inner edge",
-                    false);
+        const int e0 = GetLinkingEdge(v0, v2);
+        const int e1 = GetLinkingEdge(v1, v2);
+        if (e0 >= 0 && edges_[e0].type_ == BallPivotingEdge::Type::Inner) {
             return false;
         }
-        if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e1 is inner edge",
-                    false);
+        if (e1 >= 0 && edges_[e1].type_ == BallPivotingEdge::Type::Inner) {
             return false;
         }
 
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} could not compute ball "
-                    "center",
-                    false);
+        if (!ComputeBallCenter(v0, v1, v2, radius, center)) {
             return false;
         }
 
         // test if no other point is within the ball
-        for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
+        for (int nb : nb_indices) {
+            if (nb == v0 || nb == v1 || nb == v2) {
                 continue;
             }
-            if ((center - v->point_).norm() < radius - 1e-16) {
-                utility::LogDebug(
-                        "[TryTriangleSeed] returns {} computed ball is not "
-                        "empty",
-                        false);
+            if ((center - points_[nb]).norm() < radius - 1e-16) {
                 return false;
             }
         }
-
-        utility::LogDebug("[TryTriangleSeed] returns {}", true);
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
+    bool TrySeed(int v, double radius) {
+        std::vector<int>& indices = seed_indices_;
+        grid_.SearchRadius(points_[v], 2 * radius, indices);
         if (indices.size() < 3u) {
             return false;
         }
 
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
+            const int nb0 = indices[nbidx0];
+            if (vertices_[nb0].type_ != BallPivotingVertex::Type::Orphan) {
                 continue;
             }
-            if (nb0->idx_ == v->idx_) {
+            if (nb0 == v) {
                 continue;
             }
 
-            int candidate_vidx2 = -1;
+            int nb1 = -1;
             Eigen::Vector3d center;
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
+                const int candidate = indices[nbidx1];
+                if (vertices_[candidate].type_ !=
+                    BallPivotingVertex::Type::Orphan) {
                     continue;
                 }
-                if (nb1->idx_ == v->idx_) {
+                if (candidate == v) {
                     continue;
                 }
-                if (TryTriangleSeed(v, nb0, nb1, indices, radius, center)) {
-                    candidate_vidx2 = nb1->idx_;
+                if (TryTriangleSeed(v, nb0, candidate, indices, radius,
+                                    center)) {
+                    nb1 = candidate;
                     break;
                 }
             }
 
-            if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
-
-                BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
-                if (e0 != nullptr &&
-                    e0->type_ != BallPivotingEdge::Type::Front) {
+            if (nb1 >= 0) {
+                int e0 = GetLinkingEdge(v, nb1);
+                if (e0 >= 0 &&
+                    edges_[e0].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
-                BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
-                if (e1 != nullptr &&
-                    e1->type_ != BallPivotingEdge::Type::Front) {
+                int e1 = GetLinkingEdge(nb0, nb1);
+                if (e1 >= 0 &&
+                    edges_[e1].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
-                BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
-                if (e2 != nullptr &&
-                    e2->type_ != BallPivotingEdge::Type::Front) {
+                int e2 = GetLinkingEdge(v, nb0);
+                if (e2 >= 0 &&
+                    edges_[e2].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
 
@@ -637,98 +620,77 @@ public:
                 e0 = GetLinkingEdge(v, nb1);
                 e1 = GetLinkingEdge(nb0, nb1);
                 e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e0].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e0);
                 }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e1].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e1);
                 }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e2].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e2);
                 }
 
                 if (edge_front_.size() > 0) {
-                    utility::LogDebug(
-                            "[TrySeed] edge_front_.size() > 0 => return "
-                            "true");
                     return true;
                 }
             }
         }
-
-        utility::LogDebug("[TrySeed] return false");
         return false;
     }
 
-    void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
+    /// Seeds and expands from the orphans among \p candidates, or among all
+    /// vertices if \p candidates is null.
+    void FindSeedTriangle(double radius,
+                          const std::vector<int>* candidates = nullptr) {
+        const int num_candidates =
+                candidates ? int(candidates->size()) : int(vertices_.size());
+        for (int i = 0; i < num_candidates; ++i) {
+            const int vidx = candidates ? (*candidates)[i] : i;
+            if (vertices_[vidx].type_ == BallPivotingVertex::Type::Orphan) {
+                if (TrySeed(vidx, radius)) {
                     ExpandTriangulation(radius);
                 }
             }
         }
     }
 
-    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
-        if (!has_normals_) {
-            utility::LogError("ReconstructBallPivoting requires normals");
+    /// Moves the border edges whose triangle admits an empty ball of
+    /// \p radius back to the front.
+    void ReviveBorderEdges(double radius) {
+        std::vector<int>& indices = ball_indices_;
+        size_t num_kept = 0;
+        for (size_t i = 0; i < border_edges_.size(); ++i) {
+            const int edge = border_edges_[i];
+            const BallPivotingTriangle& triangle =
+                    triangles_[edges_[edge].triangle0_];
+            Eigen::Vector3d center;
+            bool empty_ball = false;
+            if (ComputeBallCenter(triangle.vert0_, triangle.vert1_,
+                                  triangle.vert2_, radius, center)) {
+                grid_.SearchRadius(center, radius, indices);
+                empty_ball = std::all_of(
+                        indices.begin(), indices.end(), [&](int idx) {
+                            return idx == triangle.vert0_ ||
+                                   idx == triangle.vert1_ ||
+                                   idx == triangle.vert2_;
+                        });
+            }
+            if (empty_ball) {
+                edges_[edge].type_ = BallPivotingEdge::Type::Front;
+                edge_front_.push_back(edge);
+            } else {
+                border_edges_[num_kept++] = edge;
+            }
         }
+        border_edges_.resize(num_kept);
+    }
 
-        mesh_->triangles_.clear();
-
+    void Run(const std::vector<double>& radii) {
         for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
             utility::LogDebug("[Run] change to radius {:.4f}", radius);
-            if (radius <= 0) {
-                utility::LogError(
-                        "got an invalid, negative radius as parameter");
-            }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
-                }
-                ++it;
-            }
+            ReviveBorderEdges(radius);
 
             // do the reconstruction
             if (edge_front_.empty()) {
@@ -737,26 +699,293 @@ public:
                 ExpandTriangulation(radius);
             }
 
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
-            utility::LogDebug("[Run] ################################");
+            utility::LogDebug("[Run] mesh has {:d} triangles",
+                              mesh_triangles_.size());
+        }
+    }
+
+    /// Adds a triangle reconstructed in a tile. The triangles of a tile have
+    /// to be added in their order of creation, after setting the vertex
+    /// types of the tile with SetVertexType.
+    void ImportTriangle(const BallPivotingTriangle& triangle) {
+        AddTriangle(triangle.vert0_, triangle.vert1_, triangle.vert2_,
+                    triangle.ball_center_);
+    }
+
+    void SetVertexType(int vidx, BallPivotingVertex::Type type) {
+        vertices_[vidx].type_ = type;
+    }
+
+    /// Pivots over the seams between tiles. Only the triangles of the front
+    /// vertices of the tiles are imported, so that the edges of these
+    /// vertices are complete. An imported edge with one triangle is a
+    /// boundary of its tile if both its vertices are front vertices, and
+    /// otherwise an inner edge whose second triangle was not imported.
+    /// Boundary edges touching a vertex in \p seam are expanded again, and
+    /// the orphans in \p seam are seeded again.
+    void Stitch(const std::vector<double>& radii,
+                const std::vector<bool>& seam) {
+        for (int edge = 0; edge < int(edges_.size()); ++edge) {
+            BallPivotingEdge& e = edges_[edge];
+            if (e.type_ != BallPivotingEdge::Type::Front) {
+                continue;
+            }
+            if (vertices_[e.source_].type_ != BallPivotingVertex::Front ||
+                vertices_[e.target_].type_ != BallPivotingVertex::Front) {
+                e.type_ = BallPivotingEdge::Type::Inner;
+            } else if (seam[e.source_] || seam[e.target_]) {
+                edge_front_.push_back(edge);
+            } else {
+                e.type_ = BallPivotingEdge::Type::Border;
+            }
+        }
+        std::vector<int> seam_vertices;
+        for (int vidx = 0; vidx < int(seam.size()); ++vidx) {
+            if (seam[vidx]) {
+                seam_vertices.push_back(vidx);
+            }
+        }
+
+        for (size_t i = 0; i < radii.size(); ++i) {
+            utility::LogDebug("[Stitch] change to radius {:.4f}", radii[i]);
+            if (i > 0) {
+                ReviveBorderEdges(radii[i]);
+            }
+            ExpandTriangulation(radii[i]);
+            FindSeedTriangle(radii[i], &seam_vertices);
+            utility::LogDebug("[Stitch] added {:d} triangles",
+                              mesh_triangles_.size());
+        }
+    }
+
+private:
+    static uint64_t EdgeKey(int v0, int v1) {
+        if (v0 > v1) {
+            std::swap(v0, v1);
+        }
+        return uint64_t(uint32_t(v0)) << 32 | uint32_t(v1);
+    }
+
+    int GetOrCreateEdge(int v0, int v1) {
+        auto inserted =
+                edge_lookup_.emplace(EdgeKey(v0, v1), int(edges_.size()));
+        if (inserted.second) {
+            edges_.emplace_back(v0, v1);
+            vertices_[v0].num_edges_++;
+            vertices_[v1].num_edges_++;
         }
-        return mesh_;
+        return inserted.first->second;
     }
 
 private:
-    bool has_normals_;
-    KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
-    std::shared_ptr<TriangleMesh> mesh_;
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
+    BallPivotingGrid grid_;
+    std::vector<BallPivotingVertex> vertices_;
+    std::vector<BallPivotingEdge> edges_;
+    std::vector<BallPivotingTriangle> triangles_;
+    std::unordered_map<uint64_t, int> edge_lookup_;
+    std::deque<int> edge_front_;
+    std::vector<int> border_edges_;
+    std::vector<Eigen::Vector3i> mesh_triangles_;
+    std::vector<Eigen::Vector3d> mesh_triangle_normals_;
+    std::vector<int> seed_indices_;
+    std::vector<int> candidate_indices_;
+    std::vector<int> ball_indices_;
 };
 
+/// Output of the reconstruction of one tile, in point cloud indices.
+struct BallPivotingTile {
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<Eigen::Vector3d> triangle_normals_;
+    /// Triangles with a front vertex, needed to stitch the tile.
+    std::vector<BallPivotingTriangle> front_triangles_;
+};
+
+}  // namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
-        const PointCloud& pcd, const std::vector<double>& radii) {
-    BallPivoting bp(pcd);
-    return bp.Run(radii);
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        double tile_size) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    for (double radius : radii) {
+        if (radius <= 0) {
+            utility::LogError("got an invalid, negative radius as parameter");
+        }
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = pcd.points_;
+    mesh->vertex_normals_ = pcd.normals_;
+    mesh->vertex_colors_ = pcd.colors_;
+    if (pcd.points_.empty() || radii.empty()) {
+        return mesh;
+    }
+    // Cells of the neighbor search grids hold the largest search radius.
+    const double max_radius = *std::max_element(radii.begin(), radii.end());
+    const double cell_size = 2 * max_radius;
+    if (tile_size <= 0) {
+        tile_size = kAutoTileSizeInRadii * max_radius;
+    } else if (tile_size < 2 * cell_size) {
+        // The ghosts of a tile would reach past its neighbors.
+        utility::LogError(
+                "tile_size {} is smaller than 4 times the largest radius {}",
+                tile_size, max_radius);
+    }
+
+    const int num_points = int(pcd.points_.size());
+    const Eigen::Vector3d origin = pcd.GetMinBound();
+    const Eigen::Vector3d extent = pcd.GetMaxBound() - origin;
+    // The bucketing keys below are twice the linear tile index.
+    double num_grid_tiles = 1;
+    for (int d = 0; d < 3; ++d) {
+        num_grid_tiles *= std::floor(extent(d) / tile_size) + 1;
+    }
+    if (num_grid_tiles > 4e18) {
+        utility::LogError(
+                "tile_size {} is too small for the extent of the point cloud.",
+                tile_size);
+    }
+    int64_t dims[3];
+    for (int d = 0; d < 3; ++d) {
+        dims[d] = int64_t(extent(d) / tile_size) + 1;
+    }
+    if (dims[0] * dims[1] * dims[2] == 1) {
+        BallPivoting bp(pcd.points_, pcd.normals_, cell_size);
+        bp.Run(radii);
+        mesh->triangles_ = bp.GetMeshTriangles();
+        mesh->triangle_normals_ = bp.GetMeshTriangleNormals();
+        return mesh;
+    }
+
+    // Bucket the points into tiles. Each tile also holds the points within
+    // cell_size of its box as ghosts, which take part in the empty ball tests
+    // but never become vertices. Thus the triangles of a tile are also valid
+    // for the whole point cloud, and its fronts stop in front of the seams.
+    // The entries of the points of a tile are (2 * tile) and of its ghosts
+    // (2 * tile + 1), so that a tile lists its points first and in order.
+    std::vector<std::pair<int64_t, int>> keyed;
+    keyed.reserve(num_points);
+    // Points that are ghosts of another tile, where the stitching happens.
+    std::vector<bool> seam(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        const Eigen::Vector3d local = pcd.points_[i] - origin;
+        int64_t own[3], lo[3], hi[3];
+        for (int d = 0; d < 3; ++d) {
+            auto tile = [&](double x) {
+                return std::min(dims[d] - 1,
+                                std::max(int64_t(0),
+                                         int64_t(std::floor(x / tile_size))));
+            };
+            own[d] = tile(local(d));
+            lo[d] = tile(local(d) - cell_size);
+            hi[d] = tile(local(d) + cell_size);
+        }
+        for (int64_t x = lo[0]; x <= hi[0]; ++x) {
+            for (int64_t y = lo[1]; y <= hi[1]; ++y) {
+                for (int64_t z = lo[2]; z <= hi[2]; ++z) {
+                    const bool ghost =
+                            x != own[0] || y != own[1] || z != own[2];
+                    keyed.emplace_back(
+                            2 * ((x * dims[1] + y) * dims[2] + z) + ghost, i);
+                    seam[i] = seam[i] || ghost;
+                }
+            }
+        }
+    }
+    std::sort(keyed.begin(), keyed.end());
+    std::vector<int> tile_splits;
+    for (size_t i = 0; i < keyed.size(); ++i) {
+        if (i == 0 || keyed[i].first / 2 != keyed[i - 1].first / 2) {
+            tile_splits.push_back(int(i));
+        }
+    }
+    tile_splits.push_back(int(keyed.size()));
+    const int num_tiles = int(tile_splits.size()) - 1;
+    utility::LogDebug("[CreateFromPointCloudBallPivoting] {:d} tiles",
+                      num_tiles);
+
+    // Reconstruct the tiles independently. A tile only copies its points and
+    // ghosts, and keeps the triangles of its front vertices for stitching.
+    std::vector<BallPivotingTile> tiles(num_tiles);
+    std::vector<BallPivotingVertex::Type> vertex_types(num_points);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int t = 0; t < num_tiles; ++t) {
+        const int begin = tile_splits[t];
+        const int size = tile_splits[t + 1] - begin;
+        std::vector<Eigen::Vector3d> points(size), normals(size);
+        int num_owned = 0;
+        for (int i = 0; i < size; ++i) {
+            points[i] = pcd.points_[keyed[begin + i].second];
+            normals[i] = pcd.normals_[keyed[begin + i].second];
+            num_owned += keyed[begin + i].first % 2 == 0;
+        }
+        BallPivoting bp(points, normals, cell_size);
+        for (int i = num_owned; i < size; ++i) {
+            bp.SetVertexType(i, BallPivotingVertex::Inner);
+        }
+        bp.Run(radii);
+
+        auto global = [&](int vidx) { return keyed[begin + vidx].second; };
+        BallPivotingTile& tile = tiles[t];
+        for (const Eigen::Vector3i& triangle : bp.GetMeshTriangles()) {
+            tile.triangles_.emplace_back(global(triangle(0)),
+                                         global(triangle(1)),
+                                         global(triangle(2)));
+        }
+        tile.triangle_normals_ = bp.GetMeshTriangleNormals();
+        for (int i = 0; i < num_owned; ++i) {
+            vertex_types[global(i)] = bp.GetVertexType(i);
+        }
+        for (const BallPivotingTriangle& triangle : bp.GetTriangles()) {
+            if (bp.GetVertexType(triangle.vert0_) ==
+                        BallPivotingVertex::Front ||
+                bp.GetVertexType(triangle.vert1_) ==
+                        BallPivotingVertex::Front ||
+                bp.GetVertexType(triangle.vert2_) ==
+                        BallPivotingVertex::Front) {
+                tile.front_triangles_.emplace_back(
+                        global(triangle.vert0_), global(triangle.vert1_),
+                        global(triangle.vert2_), triangle.ball_center_);
+            }
+        }
+    }
+
+    BallPivoting stitch(pcd.points_, pcd.normals_, cell_size);
+    for (int i = 0; i < num_points; ++i) {
+        stitch.SetVertexType(i, vertex_types[i]);
+    }
+    size_t num_triangles = 0;
+    for (const BallPivotingTile& tile : tiles) {
+        for (const BallPivotingTriangle& triangle : tile.front_triangles_) {
+            stitch.ImportTriangle(triangle);
+        }
+        num_triangles += tile.triangles_.size();
+    }
+    stitch.Stitch(radii, seam);
+
+    num_triangles += stitch.GetMeshTriangles().size();
+    mesh->triangles_.reserve(num_triangles);
+    mesh->triangle_normals_.reserve(num_triangles);
+    for (BallPivotingTile& tile : tiles) {
+        mesh->triangles_.insert(mesh->triangles_.end(),
+                                tile.triangles_.begin(),
+                                tile.triangles_.end());
+        mesh->triangle_normals_.insert(mesh->triangle_normals_.end(),
+                                       tile.triangle_normals_.begin(),
+                                       tile.triangle_normals_.end());
+    }
+    mesh->triangles_.insert(mesh->triangles_.end(),
+                            stitch.GetMeshTriangles().begin(),
+                            stitch.GetMeshTriangles().end());
+    mesh->triangle_normals_.insert(mesh->triangle_normals_.end(),
+                                   stitch.GetMeshTriangleNormals().begin(),
+                                   stitch.GetMeshTriangleNormals().end());
+    return mesh;
 }
 
 }  // namespace geometry
@@ -25,15 +25,27 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <array>
+#include <atomic>
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <list>
+#include <map>
+#include <unordered_map>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
 // clang-format off
@@ -734,6 +746,323 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
+/// Integer coordinates of a tile of the tiled reconstruction.
+typedef std::array<int64_t, 3> TileKey;
+
+/// Appends the points of every tile to a file of the tile, holding at most
+/// max_buffered_points points in memory. Points are stored with double
+/// positions and float normals and colors.
+class TileSpill {
+public:
+    TileSpill(const std::string& directory,
+              size_t max_buffered_points,
+              bool has_colors)
+        : max_buffered_points_(max_buffered_points),
+          has_colors_(has_colors),
+          record_size_(3 * sizeof(double) +
+                       (has_colors ? 6 : 3) * sizeof(float)) {
+        // The process id and a counter make the prefix unique across
+        // processes and across the spills of one process.
+        static std::atomic<uint64_t> counter(0);
+        prefix_ = directory.empty()
+                          ? utility::filesystem::GetTempDirectoryPath()
+                          : directory;
+        prefix_ += "/poisson_tile_" + std::to_string(GetProcessId()) + "_" +
+                   std::to_string(counter++);
+    }
+
+    ~TileSpill() {
+        for (const auto& kv : tiles_) {
+            if (kv.second.written_) {
+                utility::filesystem::RemoveFile(GetFileName(kv.first));
+            }
+        }
+    }
+
+    /// Adds a point to the tile \p key. \p core tells if the point is in the
+    /// tile itself rather than in its overlap.
+    void Add(const TileKey& key,
+             bool core,
+             const Eigen::Vector3d& point,
+             const Eigen::Vector3d& normal,
+             const Eigen::Vector3d& color) {
+        Tile& tile = tiles_[key];
+        const size_t offset = tile.buffer_.size();
+        tile.buffer_.resize(offset + record_size_);
+        char* record = tile.buffer_.data() + offset;
+        std::memcpy(record, point.data(), 3 * sizeof(double));
+        float* values = reinterpret_cast<float*>(record + 3 * sizeof(double));
+        for (int i = 0; i < 3; ++i) {
+            values[i] = float(normal(i));
+            if (has_colors_) {
+                values[3 + i] = float(color(i));
+            }
+        }
+        tile.num_points_++;
+        tile.num_core_points_ += core;
+        if (++num_buffered_points_ >= max_buffered_points_) {
+            Flush();
+        }
+    }
+
+    /// Appends the buffered points to the tile files.
+    void Flush() {
+        for (auto& kv : tiles_) {
+            std::vector<char>& buffer = kv.second.buffer_;
+            if (buffer.empty()) {
+                continue;
+            }
+            // The first flush of a tile truncates any stale file.
+            const std::string filename = GetFileName(kv.first);
+            FILE* file = utility::filesystem::FOpen(
+                    filename, kv.second.written_ ? "ab" : "wb");
+            if (file == nullptr ||
+                fwrite(buffer.data(), 1, buffer.size(), file) !=
+                        buffer.size()) {
+                if (file) fclose(file);
+                utility::LogError("Failed to write tile file {}: {}", filename,
+                                  utility::filesystem::GetIOErrorString(errno));
+            }
+            fclose(file);
+            kv.second.written_ = true;
+            buffer.clear();
+            buffer.shrink_to_fit();
+        }
+        num_buffered_points_ = 0;
+    }
+
+    bool HasColors() const { return has_colors_; }
+
+    /// Tiles with points in the tile itself, in lexicographic order.
+    std::vector<TileKey> GetTiles() const {
+        std::vector<TileKey> keys;
+        for (const auto& kv : tiles_) {
+            if (kv.second.num_core_points_ > 0) {
+                keys.push_back(kv.first);
+            }
+        }
+        return keys;
+    }
+
+    /// Reads the points of a tile and removes its file. Flush first.
+    PointCloud Load(const TileKey& key) {
+        const std::string filename = GetFileName(key);
+        const size_t num_points = tiles_.at(key).num_points_;
+        std::vector<char> buffer;
+        if (!utility::filesystem::FReadToBuffer(filename, buffer, nullptr) ||
+            buffer.size() != num_points * record_size_) {
+            utility::LogError("Failed to read tile file {}.", filename);
+        }
+        utility::filesystem::RemoveFile(filename);
+        tiles_.erase(key);
+
+        PointCloud pcd;
+        pcd.points_.resize(num_points);
+        pcd.normals_.resize(num_points);
+        if (has_colors_) {
+            pcd.colors_.resize(num_points);
+        }
+        for (size_t i = 0; i < num_points; ++i) {
+            const char* record = buffer.data() + i * record_size_;
+            std::memcpy(pcd.points_[i].data(), record, 3 * sizeof(double));
+            float values[6];
+            std::memcpy(values, record + 3 * sizeof(double),
+                        record_size_ - 3 * sizeof(double));
+            pcd.normals_[i] = Eigen::Vector3d(values[0], values[1], values[2]);
+            if (has_colors_) {
+                pcd.colors_[i] =
+                        Eigen::Vector3d(values[3], values[4], values[5]);
+            }
+        }
+        return pcd;
+    }
+
+private:
+    static int GetProcessId() {
+#ifdef _WIN32
+        return _getpid();
+#else
+        return getpid();
+#endif
+    }
+
+    struct Tile {
+        std::vector<char> buffer_;
+        size_t num_points_ = 0;
+        size_t num_core_points_ = 0;
+        bool written_ = false;
+    };
+
+    std::string GetFileName(const TileKey& key) const {
+        return prefix_ + "_" + std::to_string(key[0]) + "_" +
+               std::to_string(key[1]) + "_" + std::to_string(key[2]) + ".bin";
+    }
+
+private:
+    size_t max_buffered_points_;
+    bool has_colors_;
+    size_t record_size_;
+    std::string prefix_;
+    std::map<TileKey, Tile> tiles_;
+    size_t num_buffered_points_ = 0;
+};
+
+/// Collects the cropped meshes of the tiles. The grid of a tile is the global
+/// grid of spacing voxel_size, offset by the cells of the tiles before it, so
+/// a vertex that two tiles place on the same edge of their common face has
+/// the same global grid edge in both tiles.
+class TileMerger {
+public:
+    TileMerger(int64_t num_cells, int64_t overlap_cells, double voxel_size)
+        : num_cells_(num_cells),
+          overlap_cells_(overlap_cells),
+          core_cells_(num_cells - 2 * overlap_cells),
+          voxel_size_(voxel_size),
+          mesh_(std::make_shared<TriangleMesh>()) {}
+
+    /// Global grid coordinates of the first corner of the cube of a tile.
+    Eigen::Vector3d GetCubeOrigin(const TileKey& key) const {
+        return Eigen::Vector3d(double(key[0] * core_cells_ - overlap_cells_),
+                               double(key[1] * core_cells_ - overlap_cells_),
+                               double(key[2] * core_cells_ - overlap_cells_));
+    }
+
+    /// Adds the triangles of \p tile_mesh, reconstructed in the unit cube of
+    /// the tile \p key, whose centroids are in the tile itself.
+    void Add(const TileKey& key,
+             const TriangleMesh& tile_mesh,
+             const std::vector<double>& tile_densities) {
+        const Eigen::Vector3d cube_origin = GetCubeOrigin(key);
+        const Eigen::Vector3d core_min =
+                cube_origin + Eigen::Vector3d::Constant(double(overlap_cells_));
+        const Eigen::Vector3d core_max =
+                core_min + Eigen::Vector3d::Constant(double(core_cells_));
+        std::vector<Eigen::Vector3d> cells(tile_mesh.vertices_.size());
+        for (size_t i = 0; i < cells.size(); ++i) {
+            cells[i] = cube_origin +
+                       double(num_cells_) * tile_mesh.vertices_[i];
+        }
+
+        std::vector<Eigen::Vector3i> triangles;
+        std::vector<int> remap(cells.size(), -1);
+        for (const Eigen::Vector3i& triangle : tile_mesh.triangles_) {
+            const Eigen::Vector3d centroid =
+                    (cells[triangle(0)] + cells[triangle(1)] +
+                     cells[triangle(2)]) /
+                    3.0;
+            if ((centroid.array() >= core_min.array()).all() &&
+                (centroid.array() < core_max.array()).all()) {
+                triangles.push_back(triangle);
+                remap[triangle(0)] = remap[triangle(1)] = remap[triangle(2)] =
+                        0;
+            }
+        }
+
+        const bool has_normals = tile_mesh.HasVertexNormals();
+        const bool has_colors = tile_mesh.HasVertexColors();
+        for (size_t i = 0; i < cells.size(); ++i) {
+            if (remap[i] < 0) {
+                continue;
+            }
+            const Eigen::Vector3d vertex = voxel_size_ * cells[i];
+            const Eigen::Vector3d normal =
+                    has_normals ? tile_mesh.vertex_normals_[i]
+                                : Eigen::Vector3d::Zero();
+            const Eigen::Vector3d color = has_colors
+                                                  ? tile_mesh.vertex_colors_[i]
+                                                  : Eigen::Vector3d::Zero();
+            const double density = tile_densities[i];
+
+            SeamEdge edge;
+            if (GetSeamEdge(cells[i], core_min, core_max, edge)) {
+                auto inserted = seam_vertices_.emplace(
+                        edge,
+                        std::make_pair(int(mesh_->vertices_.size()), 0));
+                const int vidx = inserted.first->second.first;
+                const int count = ++inserted.first->second.second;
+                if (!inserted.second) {
+                    // Blend with the vertices of the other tiles.
+                    auto blend = [count](Eigen::Vector3d& mean,
+                                         const Eigen::Vector3d& value) {
+                        mean += (value - mean) / double(count);
+                    };
+                    blend(mesh_->vertices_[vidx], vertex);
+                    blend(mesh_->vertex_normals_[vidx], normal);
+                    blend(mesh_->vertex_colors_[vidx], color);
+                    densities_[vidx] += (density - densities_[vidx]) / count;
+                    remap[i] = vidx;
+                    continue;
+                }
+            }
+            remap[i] = int(mesh_->vertices_.size());
+            mesh_->vertices_.push_back(vertex);
+            mesh_->vertex_normals_.push_back(normal);
+            mesh_->vertex_colors_.push_back(color);
+            densities_.push_back(density);
+        }
+        for (const Eigen::Vector3i& triangle : triangles) {
+            mesh_->triangles_.emplace_back(remap[triangle(0)],
+                                           remap[triangle(1)],
+                                           remap[triangle(2)]);
+        }
+    }
+
+    std::shared_ptr<TriangleMesh> GetMesh() const { return mesh_; }
+
+    const std::vector<double>& GetDensities() const { return densities_; }
+
+private:
+    /// (face axis, face plane, edge axis, plane of the third axis, cell along
+    /// the edge axis).
+    typedef Eigen::Matrix<int64_t, 5, 1> SeamEdge;
+
+    /// Returns true if the vertex at global grid coordinates \p cell is on a
+    /// face of the tile and sets \p edge to the grid edge it lies on. A vertex
+    /// on several faces uses the face of the smallest axis, like the tiles
+    /// sharing that face.
+    static bool GetSeamEdge(const Eigen::Vector3d& cell,
+                            const Eigen::Vector3d& core_min,
+                            const Eigen::Vector3d& core_max,
+                            SeamEdge& edge) {
+        const double tolerance = 1e-3;
+        for (int axis = 0; axis < 3; ++axis) {
+            double plane;
+            if (std::abs(cell(axis) - core_min(axis)) < tolerance) {
+                plane = core_min(axis);
+            } else if (std::abs(cell(axis) - core_max(axis)) < tolerance) {
+                plane = core_max(axis);
+            } else {
+                continue;
+            }
+            // The vertex is on the edge along the in-plane axis that is
+            // farther from the grid lines.
+            int b = (axis + 1) % 3;
+            int c = (axis + 2) % 3;
+            if (std::abs(cell(b) - std::round(cell(b))) <
+                std::abs(cell(c) - std::round(cell(c)))) {
+                std::swap(b, c);
+            }
+            edge << axis, int64_t(plane), b, int64_t(std::round(cell(c))),
+                    int64_t(std::floor(cell(b)));
+            return true;
+        }
+        return false;
+    }
+
+private:
+    int64_t num_cells_;
+    int64_t overlap_cells_;
+    int64_t core_cells_;
+    double voxel_size_;
+    std::shared_ptr<TriangleMesh> mesh_;
+    std::vector<double> densities_;
+    /// Vertex index and number of tiles of the vertices on the tile faces.
+    std::unordered_map<SeamEdge,
+                       std::pair<int, int>,
+                       utility::hash_eigen<SeamEdge>>
+            seam_vertices_;
+};
+
 }  // namespace poisson
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -775,5 +1104,179 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
     return std::make_tuple(mesh, densities);
 }
 
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoissonTiled(
+        const std::function<bool(PointCloud&)>& read_chunk,
+        double tile_size,
+        size_t depth,
+        bool linear_fit,
+        int n_threads,
+        const std::string& scratch_dir,
+        size_t max_buffered_points) {
+    static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
+    typedef IsotropicUIntPack<
+            poisson::DIMENSION,
+            FEMDegreeAndBType</* Degree */ 1, BType>::Signature>
+            FEMSigs;
+
+    if (!(tile_size > 0)) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] tile_size (={}) has to be "
+                "> 0",
+                tile_size);
+    }
+    if (depth < 3) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] depth (={}) has to be >= 3",
+                depth);
+    }
+
+    // Every tile is reconstructed in a cube of num_cells finest cells that
+    // holds the tile and an overlap of overlap_cells on each side, so that
+    // the solution near the tile faces sees the points of the neighbors.
+    const int64_t num_cells = int64_t(1) << depth;
+    const int64_t overlap_cells = num_cells / 8;
+    const int64_t core_cells = num_cells - 2 * overlap_cells;
+    const double voxel_size = tile_size / double(core_cells);
+    const double margin = double(overlap_cells) * voxel_size;
+
+    // Distribute the points of the chunks to the tiles whose cube holds them.
+    std::unique_ptr<poisson::TileSpill> spill;
+    PointCloud chunk;
+    size_t num_points = 0;
+    while (true) {
+        chunk.Clear();
+        if (!read_chunk(chunk)) {
+            break;
+        }
+        if (chunk.IsEmpty()) {
+            continue;
+        }
+        if (!chunk.HasNormals()) {
+            utility::LogError(
+                    "[CreateFromPointCloudPoissonTiled] chunk has no normals");
+        }
+        // The tile files store colors for all points or for none, as given by
+        // the first chunk.
+        const bool has_colors = chunk.HasColors();
+        if (!spill) {
+            spill.reset(new poisson::TileSpill(scratch_dir, max_buffered_points,
+                                               has_colors));
+        } else if (has_colors != spill->HasColors()) {
+            utility::LogError(
+                    "[CreateFromPointCloudPoissonTiled] chunk has {}colors "
+                    "unlike the first chunk",
+                    has_colors ? "" : "no ");
+        }
+        for (size_t i = 0; i < chunk.points_.size(); ++i) {
+            const Eigen::Vector3d& point = chunk.points_[i];
+            Eigen::Array3i lo, hi, core;
+            for (int axis = 0; axis < 3; ++axis) {
+                lo(axis) = int(std::floor((point(axis) - margin) / tile_size));
+                hi(axis) = int(std::floor((point(axis) + margin) / tile_size));
+                core(axis) = int(std::floor(point(axis) / tile_size));
+            }
+            const Eigen::Vector3d color =
+                    has_colors ? chunk.colors_[i] : Eigen::Vector3d::Zero();
+            for (int x = lo(0); x <= hi(0); ++x) {
+                for (int y = lo(1); y <= hi(1); ++y) {
+                    for (int z = lo(2); z <= hi(2); ++z) {
+                        spill->Add({x, y, z},
+                                   x == core(0) && y == core(1) && z == core(2),
+                                   point, chunk.normals_[i], color);
+                    }
+                }
+            }
+        }
+        num_points += chunk.points_.size();
+    }
+    chunk.Clear();
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    std::vector<double> densities;
+    if (!spill) {
+        return std::make_tuple(mesh, densities);
+    }
+    spill->Flush();
+    const std::vector<poisson::TileKey> tiles = spill->GetTiles();
+    utility::LogDebug(
+            "[CreateFromPointCloudPoissonTiled] {} points in {} tiles",
+            num_points, tiles.size());
+
+    if (n_threads <= 0) {
+        n_threads = (int)std::thread::hardware_concurrency();
+    }
+
+    // The thread pool of PoissonRecon is global, so the tiles are solved one
+    // after the other, each with all threads.
+#ifdef _OPENMP
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
+                     n_threads);
+#else
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
+                     n_threads);
+#endif
+
+    poisson::TileMerger merger(num_cells, overlap_cells, voxel_size);
+    const double cube_size = double(num_cells) * voxel_size;
+    for (const poisson::TileKey& key : tiles) {
+        PointCloud tile_pcd = spill->Load(key);
+        const Eigen::Vector3d cube_origin =
+                voxel_size * merger.GetCubeOrigin(key);
+        for (Eigen::Vector3d& point : tile_pcd.points_) {
+            point = (point - cube_origin) / cube_size;
+        }
+        auto tile_mesh = std::make_shared<TriangleMesh>();
+        std::vector<double> tile_densities;
+        poisson::Execute<float>(tile_pcd, tile_mesh, tile_densities,
+                                static_cast<int>(depth), 0, 0.f, linear_fit,
+                                FEMSigs());
+        merger.Add(key, *tile_mesh, tile_densities);
+    }
+
+    ThreadPool::Terminate();
+
+    mesh = merger.GetMesh();
+    densities = merger.GetDensities();
+    if (!spill->HasColors()) {
+        mesh->vertex_colors_.clear();
+    }
+    return std::make_tuple(mesh, densities);
+}
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoissonTiled(const PointCloud& pcd,
+                                               double tile_size,
+                                               size_t depth,
+                                               bool linear_fit,
+                                               int n_threads,
+                                               const std::string& scratch_dir) {
+    if (!pcd.HasNormals()) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] pcd has no normals");
+    }
+    const size_t chunk_size = size_t(1) << 20;
+    const size_t num_points = pcd.points_.size();
+    size_t begin = 0;
+    auto read_chunk = [&](PointCloud& chunk) {
+        if (begin >= num_points) {
+            return false;
+        }
+        const size_t end = std::min(begin + chunk_size, num_points);
+        chunk.points_.assign(pcd.points_.begin() + begin,
+                             pcd.points_.begin() + end);
+        chunk.normals_.assign(pcd.normals_.begin() + begin,
+                              pcd.normals_.begin() + end);
+        if (pcd.HasColors()) {
+            chunk.colors_.assign(pcd.colors_.begin() + begin,
+                                 pcd.colors_.begin() + end);
+        }
+        begin = end;
+        return true;
+    };
+    return CreateFromPointCloudPoissonTiled(read_chunk, tile_size, depth,
+                                            linear_fit, n_threads, scratch_dir);
+}
+
 }  // namespace geometry
 }  // namespace open3d
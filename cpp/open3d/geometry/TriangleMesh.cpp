@@ -27,13 +27,14 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <numeric>
 #include <queue>
 #include <random>
 #include <tuple>
+#include <unordered_set>
 
 #include "open3d/geometry/BoundingVolume.h"
-#include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
@@ -128,10 +129,214 @@ TriangleMesh TriangleMesh::operator+(const TriangleMesh &mesh) const {
     return (TriangleMesh(*this) += mesh);
 }
 
+namespace {
+
+/// Vertex adjacency in compressed sparse row form. The neighbors of vertex i
+/// are neighbors_[offsets_[i]:offsets_[i + 1]], sorted in increasing order.
+struct AdjacencyCSR {
+    std::vector<int> offsets_;
+    std::vector<int> neighbors_;
+
+    int Degree(size_t vidx) const {
+        return offsets_[vidx + 1] - offsets_[vidx];
+    }
+};
+
+/// Sorts and deduplicates the targets of each source vertex in parallel, and
+/// packs them into a CSR adjacency. The targets of vertex i are in
+/// targets[target_offsets[i]:target_offsets[i + 1]].
+AdjacencyCSR PackAdjacencyCSR(const std::vector<int> &target_offsets,
+                              std::vector<int> &targets) {
+    const int num_vertices = int(target_offsets.size()) - 1;
+    std::vector<int> degrees(num_vertices);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        auto begin = targets.begin() + target_offsets[vidx];
+        auto end = targets.begin() + target_offsets[vidx + 1];
+        std::sort(begin, end);
+        degrees[vidx] = int(std::unique(begin, end) - begin);
+    }
+
+    AdjacencyCSR adjacency;
+    adjacency.offsets_.resize(num_vertices + 1, 0);
+    std::partial_sum(degrees.begin(), degrees.end(),
+                     adjacency.offsets_.begin() + 1);
+    adjacency.neighbors_.resize(adjacency.offsets_.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        std::copy_n(targets.begin() + target_offsets[vidx], degrees[vidx],
+                    adjacency.neighbors_.begin() + adjacency.offsets_[vidx]);
+    }
+    return adjacency;
+}
+
+/// Builds the CSR adjacency from the triangles. The directed edges are
+/// grouped by source vertex with a counting sort, then each group is sorted
+/// and deduplicated in parallel.
+AdjacencyCSR ComputeAdjacencyCSR(const std::vector<Eigen::Vector3i> &triangles,
+                                 size_t num_vertices) {
+    std::vector<int> target_offsets(num_vertices + 1, 0);
+    for (const auto &triangle : triangles) {
+        target_offsets[triangle(0) + 1] += 2;
+        target_offsets[triangle(1) + 1] += 2;
+        target_offsets[triangle(2) + 1] += 2;
+    }
+    std::partial_sum(target_offsets.begin(), target_offsets.end(),
+                     target_offsets.begin());
+
+    std::vector<int> cursors(target_offsets.begin(), target_offsets.end() - 1);
+    std::vector<int> targets(target_offsets.back());
+    for (const auto &triangle : triangles) {
+        for (int k = 0; k < 3; ++k) {
+            int &cursor = cursors[triangle(k)];
+            targets[cursor++] = triangle((k + 1) % 3);
+            targets[cursor++] = triangle((k + 2) % 3);
+        }
+    }
+    return PackAdjacencyCSR(target_offsets, targets);
+}
+
+/// Groups the corners of the triangles by vertex with a counting sort. The
+/// triangles incident to vertex i are neighbors_[offsets_[i]:offsets_[i + 1]],
+/// in increasing order.
+AdjacencyCSR ComputeVertexTriangleCSR(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices) {
+    AdjacencyCSR incidence;
+    incidence.offsets_.resize(num_vertices + 1, 0);
+    for (const auto &triangle : triangles) {
+        incidence.offsets_[triangle(0) + 1]++;
+        incidence.offsets_[triangle(1) + 1]++;
+        incidence.offsets_[triangle(2) + 1]++;
+    }
+    std::partial_sum(incidence.offsets_.begin(), incidence.offsets_.end(),
+                     incidence.offsets_.begin());
+
+    std::vector<int> cursors(incidence.offsets_.begin(),
+                             incidence.offsets_.end() - 1);
+    incidence.neighbors_.resize(incidence.offsets_.back());
+    for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+        for (int k = 0; k < 3; ++k) {
+            incidence.neighbors_[cursors[triangles[tidx](k)]++] = tidx;
+        }
+    }
+    return incidence;
+}
+
+/// Converts a user provided adjacency list to CSR form.
+AdjacencyCSR AdjacencyListToCSR(
+        const std::vector<std::unordered_set<int>> &adjacency_list) {
+    std::vector<int> target_offsets(adjacency_list.size() + 1, 0);
+    for (size_t vidx = 0; vidx < adjacency_list.size(); ++vidx) {
+        target_offsets[vidx + 1] =
+                target_offsets[vidx] + int(adjacency_list[vidx].size());
+    }
+    std::vector<int> targets(target_offsets.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(adjacency_list.size()); ++vidx) {
+        std::copy(adjacency_list[vidx].begin(), adjacency_list[vidx].end(),
+                  targets.begin() + target_offsets[vidx]);
+    }
+    return PackAdjacencyCSR(target_offsets, targets);
+}
+
+std::vector<std::unordered_set<int>> CSRToAdjacencyList(
+        const AdjacencyCSR &adjacency) {
+    const int num_vertices = int(adjacency.offsets_.size()) - 1;
+    std::vector<std::unordered_set<int>> adjacency_list(num_vertices);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        adjacency_list[vidx].insert(
+                adjacency.neighbors_.begin() + adjacency.offsets_[vidx],
+                adjacency.neighbors_.begin() + adjacency.offsets_[vidx + 1]);
+    }
+    return adjacency_list;
+}
+
+/// Prepares the output mesh of the filters below, and returns the adjacency
+/// of \p input in CSR form. The output keeps the adjacency list of the input,
+/// or gets a new one if the input has none.
+AdjacencyCSR InitFilteredMesh(const TriangleMesh &input, TriangleMesh &mesh) {
+    mesh.vertices_.resize(input.vertices_.size());
+    mesh.vertex_normals_.resize(input.vertex_normals_.size());
+    mesh.vertex_colors_.resize(input.vertex_colors_.size());
+    mesh.triangles_ = input.triangles_;
+    if (input.HasAdjacencyList()) {
+        mesh.adjacency_list_ = input.adjacency_list_;
+        return AdjacencyListToCSR(input.adjacency_list_);
+    }
+    AdjacencyCSR adjacency =
+            ComputeAdjacencyCSR(input.triangles_, input.vertices_.size());
+    mesh.adjacency_list_ = CSRToAdjacencyList(adjacency);
+    return adjacency;
+}
+
+/// One pass of Laplacian smoothing with inverse distance weights.
+void FilterSmoothLaplacianHelper(
+        TriangleMesh &mesh,
+        const std::vector<Eigen::Vector3d> &prev_vertices,
+        const std::vector<Eigen::Vector3d> &prev_vertex_normals,
+        const std::vector<Eigen::Vector3d> &prev_vertex_colors,
+        const AdjacencyCSR &adjacency,
+        double lambda,
+        bool filter_vertex,
+        bool filter_normal,
+        bool filter_color) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(mesh.vertices_.size()); ++vidx) {
+        Eigen::Vector3d vertex_sum(0, 0, 0);
+        Eigen::Vector3d normal_sum(0, 0, 0);
+        Eigen::Vector3d color_sum(0, 0, 0);
+        double total_weight = 0;
+        for (int idx = adjacency.offsets_[vidx];
+             idx < adjacency.offsets_[vidx + 1]; ++idx) {
+            const int nbidx = adjacency.neighbors_[idx];
+            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
+            double dist = diff.norm();
+            double weight = 1. / (dist + 1e-12);
+            total_weight += weight;
+
+            if (filter_vertex) {
+                vertex_sum += weight * prev_vertices[nbidx];
+            }
+            if (filter_normal) {
+                normal_sum += weight * prev_vertex_normals[nbidx];
+            }
+            if (filter_color) {
+                color_sum += weight * prev_vertex_colors[nbidx];
+            }
+        }
+
+        if (filter_vertex) {
+            mesh.vertices_[vidx] =
+                    prev_vertices[vidx] +
+                    lambda * (vertex_sum / total_weight - prev_vertices[vidx]);
+        }
+        if (filter_normal) {
+            mesh.vertex_normals_[vidx] = prev_vertex_normals[vidx] +
+                                         lambda * (normal_sum / total_weight -
+                                                   prev_vertex_normals[vidx]);
+        }
+        if (filter_color) {
+            mesh.vertex_colors_[vidx] = prev_vertex_colors[vidx] +
+                                        lambda * (color_sum / total_weight -
+                                                  prev_vertex_colors[vidx]);
+        }
+    }
+}
+
+}  // unnamed namespace
+
 TriangleMesh &TriangleMesh::ComputeTriangleNormals(
         bool normalized /* = true*/) {
     triangle_normals_.resize(triangles_.size());
-    for (size_t i = 0; i < triangles_.size(); i++) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < int(triangles_.size()); i++) {
         auto &triangle = triangles_[i];
         Eigen::Vector3d v01 = vertices_[triangle(1)] - vertices_[triangle(0)];
         Eigen::Vector3d v02 = vertices_[triangle(2)] - vertices_[triangle(0)];
@@ -144,15 +349,23 @@ TriangleMesh &TriangleMesh::ComputeTriangleNormals(
 }
 
 TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
-    if (!HasTriangleNormals()) {
-        ComputeTriangleNormals(false);
-    }
-    vertex_normals_.resize(vertices_.size(), Eigen::Vector3d::Zero());
-    for (size_t i = 0; i < triangles_.size(); i++) {
-        auto &triangle = triangles_[i];
-        vertex_normals_[triangle(0)] += triangle_normals_[i];
-        vertex_normals_[triangle(1)] += triangle_normals_[i];
-        vertex_normals_[triangle(2)] += triangle_normals_[i];
+    // Always recompute the triangle normals. Normalizing them below would
+    // otherwise change the weights of the next call.
+    ComputeTriangleNormals(false);
+    // Each vertex gathers the normals of its incident triangles, so the
+    // vertices can be summed in parallel without atomics.
+    const AdjacencyCSR incidence =
+            ComputeVertexTriangleCSR(triangles_, vertices_.size());
+    vertex_normals_.resize(vertices_.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
+        Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+        for (int idx = incidence.offsets_[vidx];
+             idx < incidence.offsets_[vidx + 1]; ++idx) {
+            normal += triangle_normals_[incidence.neighbors_[idx]];
+        }
+        vertex_normals_[vidx] = normal;
     }
     if (normalized) {
         NormalizeNormals();
@@ -161,16 +374,8 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
-    adjacency_list_.clear();
-    adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
-    }
+    adjacency_list_ = CSRToAdjacencyList(
+            ComputeAdjacencyCSR(triangles_, vertices_.size()));
     return *this;
 }
 
@@ -190,21 +395,18 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const AdjacencyCSR adjacency = InitFilteredMesh(*this, *mesh);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int idx = adjacency.offsets_[vidx];
+                 idx < adjacency.offsets_[vidx + 1]; ++idx) {
+                const int nbidx = adjacency.neighbors_[idx];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -216,7 +418,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            const int nb_size = adjacency.Degree(vidx);
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         prev_vertices[vidx] +
@@ -261,21 +463,18 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const AdjacencyCSR adjacency = InitFilteredMesh(*this, *mesh);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int idx = adjacency.offsets_[vidx];
+                 idx < adjacency.offsets_[vidx + 1]; ++idx) {
+                const int nbidx = adjacency.neighbors_[idx];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -287,7 +486,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            const int nb_size = adjacency.Degree(vidx);
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
@@ -311,56 +510,6 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     return mesh;
 }
 
-void TriangleMesh::FilterSmoothLaplacianHelper(
-        std::shared_ptr<TriangleMesh> &mesh,
-        const std::vector<Eigen::Vector3d> &prev_vertices,
-        const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-        const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
-        double lambda,
-        bool filter_vertex,
-        bool filter_normal,
-        bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-        Eigen::Vector3d vertex_sum(0, 0, 0);
-        Eigen::Vector3d normal_sum(0, 0, 0);
-        Eigen::Vector3d color_sum(0, 0, 0);
-        double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
-            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
-            double dist = diff.norm();
-            double weight = 1. / (dist + 1e-12);
-            total_weight += weight;
-
-            if (filter_vertex) {
-                vertex_sum += weight * prev_vertices[nbidx];
-            }
-            if (filter_normal) {
-                normal_sum += weight * prev_vertex_normals[nbidx];
-            }
-            if (filter_color) {
-                color_sum += weight * prev_vertex_colors[nbidx];
-            }
-        }
-
-        if (filter_vertex) {
-            mesh->vertices_[vidx] =
-                    prev_vertices[vidx] +
-                    lambda * (vertex_sum / total_weight - prev_vertices[vidx]);
-        }
-        if (filter_normal) {
-            mesh->vertex_normals_[vidx] = prev_vertex_normals[vidx] +
-                                          lambda * (normal_sum / total_weight -
-                                                    prev_vertex_normals[vidx]);
-        }
-        if (filter_color) {
-            mesh->vertex_colors_[vidx] = prev_vertex_colors[vidx] +
-                                         lambda * (color_sum / total_weight -
-                                                   prev_vertex_colors[vidx]);
-        }
-    }
-}
-
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
         int number_of_iterations, double lambda, FilterScope scope) const {
     bool filter_vertex =
@@ -377,20 +526,12 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const AdjacencyCSR adjacency = InitFilteredMesh(*this, *mesh);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+        FilterSmoothLaplacianHelper(*mesh, prev_vertices, prev_vertex_normals,
+                                    prev_vertex_colors, adjacency, lambda,
+                                    filter_vertex, filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -419,26 +560,17 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const AdjacencyCSR adjacency = InitFilteredMesh(*this, *mesh);
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+        FilterSmoothLaplacianHelper(*mesh, prev_vertices, prev_vertex_normals,
+                                    prev_vertex_colors, adjacency, lambda,
+                                    filter_vertex, filter_normal, filter_color);
         std::swap(mesh->vertices_, prev_vertices);
         std::swap(mesh->vertex_normals_, prev_vertex_normals);
         std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
+        FilterSmoothLaplacianHelper(*mesh, prev_vertices, prev_vertex_normals,
+                                    prev_vertex_colors, adjacency, mu,
+                                    filter_vertex, filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -1369,69 +1501,6 @@ bool TriangleMesh::IsVertexManifold() const {
     return GetNonManifoldVertices().empty();
 }
 
-std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
-        const {
-    std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
-
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
-        }
-    }
-    return self_intersecting_triangles;
-}
-
-bool TriangleMesh::IsSelfIntersecting() const {
-    return !GetSelfIntersectingTriangles().empty();
-}
-
-bool TriangleMesh::IsBoundingBoxIntersecting(const TriangleMesh &other) const {
-    return IntersectionTest::AABBAABB(GetMinBound(), GetMaxBound(),
-                                      other.GetMinBound(), other.GetMaxBound());
-}
-
-bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
-    if (!IsBoundingBoxIntersecting(other)) {
-        return false;
-    }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
 TriangleMesh::ClusterConnectedTriangles() const {
     std::vector<int> triangle_clusters(triangles_.size(), -1);
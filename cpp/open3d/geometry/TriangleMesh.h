@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <functional>
 #include <memory>
 #include <numeric>
 #include <tuple>
@@ -129,6 +130,14 @@ public:
 
     /// \brief Function to compute vertex normals, usually called before
     /// rendering.
+    ///
+    /// The normal of a vertex is the area weighted sum of the normals of its
+    /// triangles. The triangle normals are recomputed from the vertices and
+    /// existing vertex normals are overwritten, so calling this function
+    /// again gives the same result.
+    ///
+    /// \param normalized If true, the vertex and triangle normals are
+    /// normalized.
     TriangleMesh &ComputeVertexNormals(bool normalized = true);
 
     /// \brief Function to compute adjacency list, call before adjacency list is
@@ -254,11 +263,13 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh. Each pair (i, j) has i < j, and the list is sorted. Triangles
+    /// sharing a vertex are not tested. Candidate pairs are found by a
+    /// parallel traversal of a bounding volume hierarchy over the triangles.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// Stops at the first intersecting triangle pair.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -266,7 +277,8 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Traverses the bounding volume hierarchies of both meshes and
+    /// stops at the first intersecting triangle pair.
     bool IsIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the given triangle mesh is orientable, i.e.
@@ -547,8 +559,17 @@ public:
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
     /// the ball that are used for the surface reconstruction.
+    /// \param tile_size Side length of the cubic tiles that are reconstructed
+    /// in parallel before their seams are closed. Set to 0 or a negative
+    /// value to use 50 times the largest radius. Otherwise it has to be at
+    /// least 4 times the largest radius, twice the width of the border that
+    /// a tile shares with its neighbors. A point cloud that fits into one
+    /// tile is reconstructed in a single pass. The seams between tiles may be
+    /// triangulated differently than by a single pass over the whole cloud.
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
-            const PointCloud &pcd, const std::vector<double> &radii);
+            const PointCloud &pcd,
+            const std::vector<double> &radii,
+            double tile_size = 0);
 
     /// \brief Function that computes a triangle mesh from an oriented
     /// PointCloud pcd. This implements the Screened Poisson Reconstruction
@@ -581,6 +602,54 @@ public:
                                 bool linear_fit = false,
                                 int n_threads = -1);
 
+    /// \brief Tiled, out-of-core variant of CreateFromPointCloudPoisson for
+    /// point clouds that do not fit into memory at the required depth.
+    ///
+    /// Space is partitioned into cubic tiles of side \p tile_size. The chunks
+    /// returned by \p read_chunk are spilled to one file per tile in
+    /// \p scratch_dir, so that peak memory is bounded by the largest tile
+    /// rather than by the point cloud. The tiles are then reconstructed one
+    /// after the other, each on its cube enlarged by 1/8 of the octree on
+    /// every side. The octree grids of all tiles are aligned, so every tile
+    /// is cropped to its cube along grid planes, and the vertices that two
+    /// tiles place on the same grid edge of their common face are merged into
+    /// their average.
+    ///
+    /// \param read_chunk Fills the given empty PointCloud with the next chunk
+    /// of points with normals, and optionally colors. Either all chunks have
+    /// colors or none. Returns false when there are no more points.
+    /// \param tile_size Side length of the tiles.
+    /// \param depth Depth of the octree of each tile. The grid spacing of the
+    /// reconstruction is tile_size / (0.75 * 2^depth).
+    /// \param linear_fit If true, the reconstructor use linear interpolation
+    /// to estimate the positions of iso-vertices.
+    /// \param n_threads Number of threads used for the reconstruction of a
+    /// tile. Set to -1 to automatically determine it.
+    /// \param scratch_dir Directory of the temporary tile files, the system
+    /// temporary directory if empty. The files are removed when done.
+    /// \param max_buffered_points Number of points held in memory before they
+    /// are appended to the tile files.
+    /// \return The TriangleMesh, and the per vertex densities.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+    CreateFromPointCloudPoissonTiled(
+            const std::function<bool(PointCloud &)> &read_chunk,
+            double tile_size,
+            size_t depth = 8,
+            bool linear_fit = false,
+            int n_threads = -1,
+            const std::string &scratch_dir = "",
+            size_t max_buffered_points = 1 << 22);
+
+    /// \brief Tiled reconstruction of a PointCloud in memory, see the
+    /// overload with read_chunk.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+    CreateFromPointCloudPoissonTiled(const PointCloud &pcd,
+                                     double tile_size,
+                                     size_t depth = 8,
+                                     bool linear_fit = false,
+                                     int n_threads = -1,
+                                     const std::string &scratch_dir = "");
+
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \p radius defines the
     /// distance from the center to the mesh vertices.
@@ -744,17 +813,6 @@ protected:
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : MeshBase(type) {}
 
-    void FilterSmoothLaplacianHelper(
-            std::shared_ptr<TriangleMesh> &mesh,
-            const std::vector<Eigen::Vector3d> &prev_vertices,
-            const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-            const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
-            double lambda,
-            bool filter_vertex,
-            bool filter_normal,
-            bool filter_color) const;
-
     /// \brief Function that computes for each edge in the triangle mesh and
     /// passed as parameter edges_to_vertices the cot weight.
     ///
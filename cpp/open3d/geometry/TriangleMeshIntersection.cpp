@@ -0,0 +1,339 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Bounding volume hierarchy over the triangles of a mesh, built by median
+/// splits along the longest axis of the triangle centroids. Nodes are stored
+/// in a flat array, and each node covers the range [begin_, end_) of
+/// triangle_order_.
+class TriangleBVH {
+public:
+    struct Node {
+        Eigen::Vector3d min_bound_;
+        Eigen::Vector3d max_bound_;
+        /// Children of an inner node, -1 for leaves.
+        int left_ = -1;
+        int right_ = -1;
+        int begin_ = 0;
+        int end_ = 0;
+
+        bool IsLeaf() const { return left_ < 0; }
+        int Size() const { return end_ - begin_; }
+    };
+
+    static constexpr int kMaxLeafSize = 4;
+
+    explicit TriangleBVH(const TriangleMesh &mesh) : mesh_(mesh) {
+        const int num_triangles = int(mesh.triangles_.size());
+        triangle_min_.resize(num_triangles);
+        triangle_max_.resize(num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int tidx = 0; tidx < num_triangles; ++tidx) {
+            const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+            const Eigen::Vector3d &v0 = mesh.vertices_[triangle(0)];
+            const Eigen::Vector3d &v1 = mesh.vertices_[triangle(1)];
+            const Eigen::Vector3d &v2 = mesh.vertices_[triangle(2)];
+            triangle_min_[tidx] = v0.cwiseMin(v1).cwiseMin(v2);
+            triangle_max_[tidx] = v0.cwiseMax(v1).cwiseMax(v2);
+        }
+        triangle_order_.resize(num_triangles);
+        std::iota(triangle_order_.begin(), triangle_order_.end(), 0);
+        if (num_triangles > 0) {
+            Build();
+        }
+    }
+
+    const TriangleMesh &mesh_;
+    std::vector<Eigen::Vector3d> triangle_min_;
+    std::vector<Eigen::Vector3d> triangle_max_;
+    std::vector<int> triangle_order_;
+    std::vector<Node> nodes_;
+
+private:
+    void Build() {
+        const int num_triangles = int(triangle_order_.size());
+        std::vector<Eigen::Vector3d> centroids(num_triangles);
+        for (int tidx = 0; tidx < num_triangles; ++tidx) {
+            centroids[tidx] = 0.5 * (triangle_min_[tidx] + triangle_max_[tidx]);
+        }
+
+        const Eigen::Vector3d inf = Eigen::Vector3d::Constant(
+                std::numeric_limits<double>::infinity());
+        nodes_.reserve(2 * (num_triangles / kMaxLeafSize + 1));
+        nodes_.emplace_back();
+        nodes_[0].end_ = num_triangles;
+        std::vector<int> stack = {0};
+        while (!stack.empty()) {
+            const int nidx = stack.back();
+            stack.pop_back();
+            const int begin = nodes_[nidx].begin_;
+            const int end = nodes_[nidx].end_;
+
+            Eigen::Vector3d min_bound = inf, max_bound = -inf;
+            Eigen::Vector3d centroid_min = inf, centroid_max = -inf;
+            for (int i = begin; i < end; ++i) {
+                const int tidx = triangle_order_[i];
+                min_bound = min_bound.cwiseMin(triangle_min_[tidx]);
+                max_bound = max_bound.cwiseMax(triangle_max_[tidx]);
+                centroid_min = centroid_min.cwiseMin(centroids[tidx]);
+                centroid_max = centroid_max.cwiseMax(centroids[tidx]);
+            }
+            nodes_[nidx].min_bound_ = min_bound;
+            nodes_[nidx].max_bound_ = max_bound;
+            if (end - begin <= kMaxLeafSize) {
+                continue;
+            }
+
+            int axis;
+            (centroid_max - centroid_min).maxCoeff(&axis);
+            const int mid = begin + (end - begin) / 2;
+            std::nth_element(triangle_order_.begin() + begin,
+                             triangle_order_.begin() + mid,
+                             triangle_order_.begin() + end,
+                             [&](int a, int b) {
+                                 return centroids[a](axis) < centroids[b](axis);
+                             });
+
+            const int left = int(nodes_.size());
+            nodes_.emplace_back();
+            nodes_.back().begin_ = begin;
+            nodes_.back().end_ = mid;
+            nodes_.emplace_back();
+            nodes_.back().begin_ = mid;
+            nodes_.back().end_ = end;
+            nodes_[nidx].left_ = left;
+            nodes_[nidx].right_ = left + 1;
+            stack.push_back(left);
+            stack.push_back(left + 1);
+        }
+    }
+};
+
+/// Pair of nodes whose triangles are tested against each other. When both
+/// nodes are from the same BVH, (n, n) stands for all pairs within node n.
+typedef std::pair<int, int> NodePair;
+
+/// Returns the pairs of intersecting triangles between the meshes of \p bvh0
+/// and \p bvh1. If both are the same BVH, returns the self-intersecting pairs
+/// (i, j) with i < j, sorted, skipping triangles that share a vertex. If
+/// \p first_only is set, stops as soon as one pair is found.
+///
+/// The BVH-vs-BVH traversal is first expanded breadth-first into enough
+/// overlapping node pairs to keep all threads busy, then each node pair is
+/// traversed depth-first by one thread.
+std::vector<Eigen::Vector2i> IntersectingTrianglePairs(const TriangleBVH &bvh0,
+                                                       const TriangleBVH &bvh1,
+                                                       bool first_only) {
+    const bool self = &bvh0 == &bvh1;
+    if (bvh0.nodes_.empty() || bvh1.nodes_.empty()) {
+        return {};
+    }
+    const std::vector<TriangleBVH::Node> &nodes0 = bvh0.nodes_;
+    const std::vector<TriangleBVH::Node> &nodes1 = bvh1.nodes_;
+    const TriangleMesh &mesh0 = bvh0.mesh_;
+    const TriangleMesh &mesh1 = bvh1.mesh_;
+
+    auto push_if_overlap = [&](int nidx0, int nidx1,
+                               std::vector<NodePair> &pairs) {
+        if (IntersectionTest::AABBAABB(
+                    nodes0[nidx0].min_bound_, nodes0[nidx0].max_bound_,
+                    nodes1[nidx1].min_bound_, nodes1[nidx1].max_bound_)) {
+            pairs.emplace_back(nidx0, nidx1);
+        }
+    };
+    auto is_leaf_pair = [&](const NodePair &pair) {
+        return nodes0[pair.first].IsLeaf() && nodes1[pair.second].IsLeaf();
+    };
+    // Replaces a pair with at least one inner node by its overlapping child
+    // pairs, descending into the larger node.
+    auto expand = [&](const NodePair &pair, std::vector<NodePair> &pairs) {
+        const TriangleBVH::Node &node0 = nodes0[pair.first];
+        const TriangleBVH::Node &node1 = nodes1[pair.second];
+        if (self && pair.first == pair.second) {
+            pairs.emplace_back(node0.left_, node0.left_);
+            pairs.emplace_back(node0.right_, node0.right_);
+            push_if_overlap(node0.left_, node0.right_, pairs);
+        } else if (!node0.IsLeaf() &&
+                   (node1.IsLeaf() || node0.Size() >= node1.Size())) {
+            push_if_overlap(node0.left_, pair.second, pairs);
+            push_if_overlap(node0.right_, pair.second, pairs);
+        } else {
+            push_if_overlap(pair.first, node1.left_, pairs);
+            push_if_overlap(pair.first, node1.right_, pairs);
+        }
+    };
+    auto test_leaf_pair = [&](const NodePair &pair,
+                              std::vector<Eigen::Vector2i> &intersecting) {
+        const TriangleBVH::Node &node0 = nodes0[pair.first];
+        const TriangleBVH::Node &node1 = nodes1[pair.second];
+        const bool same_leaf = self && pair.first == pair.second;
+        for (int i = node0.begin_; i < node0.end_; ++i) {
+            const int tidx0 = bvh0.triangle_order_[i];
+            const Eigen::Vector3i &tria_p = mesh0.triangles_[tidx0];
+            for (int j = same_leaf ? i + 1 : node1.begin_; j < node1.end_;
+                 ++j) {
+                const int tidx1 = bvh1.triangle_order_[j];
+                if (!IntersectionTest::AABBAABB(
+                            bvh0.triangle_min_[tidx0],
+                            bvh0.triangle_max_[tidx0],
+                            bvh1.triangle_min_[tidx1],
+                            bvh1.triangle_max_[tidx1])) {
+                    continue;
+                }
+                const Eigen::Vector3i &tria_q = mesh1.triangles_[tidx1];
+                // check if neighbour triangle
+                if (self && (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
+                             tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
+                             tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
+                             tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
+                             tria_p(2) == tria_q(2))) {
+                    continue;
+                }
+                if (IntersectionTest::TriangleTriangle3d(
+                            mesh0.vertices_[tria_p(0)],
+                            mesh0.vertices_[tria_p(1)],
+                            mesh0.vertices_[tria_p(2)],
+                            mesh1.vertices_[tria_q(0)],
+                            mesh1.vertices_[tria_q(1)],
+                            mesh1.vertices_[tria_q(2)])) {
+                    if (self) {
+                        intersecting.emplace_back(std::min(tidx0, tidx1),
+                                                  std::max(tidx0, tidx1));
+                    } else {
+                        intersecting.emplace_back(tidx0, tidx1);
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<NodePair> tasks;
+    if (self) {
+        tasks.emplace_back(0, 0);
+    } else {
+        push_if_overlap(0, 0, tasks);
+    }
+    const size_t min_num_tasks = 64 * size_t(utility::EstimateMaxThreads());
+    while (tasks.size() < min_num_tasks) {
+        std::vector<NodePair> next_tasks;
+        bool expanded = false;
+        for (const NodePair &pair : tasks) {
+            if (is_leaf_pair(pair)) {
+                next_tasks.push_back(pair);
+            } else {
+                expand(pair, next_tasks);
+                expanded = true;
+            }
+        }
+        tasks.swap(next_tasks);
+        if (!expanded) {
+            break;
+        }
+    }
+
+    std::atomic<bool> found(false);
+    std::vector<std::vector<Eigen::Vector2i>> task_intersecting(tasks.size());
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int task_idx = 0; task_idx < int(tasks.size()); ++task_idx) {
+        std::vector<Eigen::Vector2i> &intersecting =
+                task_intersecting[task_idx];
+        std::vector<NodePair> stack = {tasks[task_idx]};
+        while (!stack.empty()) {
+            if (first_only && found.load(std::memory_order_relaxed)) {
+                break;
+            }
+            const NodePair pair = stack.back();
+            stack.pop_back();
+            if (is_leaf_pair(pair)) {
+                test_leaf_pair(pair, intersecting);
+                if (first_only && !intersecting.empty()) {
+                    found.store(true, std::memory_order_relaxed);
+                }
+            } else {
+                expand(pair, stack);
+            }
+        }
+    }
+
+    std::vector<Eigen::Vector2i> intersecting;
+    for (const std::vector<Eigen::Vector2i> &pairs : task_intersecting) {
+        intersecting.insert(intersecting.end(), pairs.begin(), pairs.end());
+    }
+    std::sort(intersecting.begin(), intersecting.end(),
+              [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
+    return intersecting;
+}
+
+}  // unnamed namespace
+
+std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
+        const {
+    TriangleBVH bvh(*this);
+    return IntersectingTrianglePairs(bvh, bvh, /*first_only=*/false);
+}
+
+bool TriangleMesh::IsSelfIntersecting() const {
+    TriangleBVH bvh(*this);
+    return !IntersectingTrianglePairs(bvh, bvh, /*first_only=*/true).empty();
+}
+
+bool TriangleMesh::IsBoundingBoxIntersecting(const TriangleMesh &other) const {
+    return IntersectionTest::AABBAABB(GetMinBound(), GetMaxBound(),
+                                      other.GetMinBound(), other.GetMaxBound());
+}
+
+bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
+    if (!IsBoundingBoxIntersecting(other)) {
+        return false;
+    }
+    TriangleBVH bvh0(*this);
+    TriangleBVH bvh1(other);
+    return !IntersectingTrianglePairs(bvh0, bvh1, /*first_only=*/true).empty();
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "open3d/io/OctreeIO.h"
 
+#include <cstring>
+#include <fstream>
 #include <unordered_map>
 
 #include "open3d/io/IJsonConvertibleIO.h"
@@ -109,5 +111,181 @@ bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree) {
     return WriteIJsonConvertibleToJSON(filename, octree);
 }
+
+// Layout of linear octree files. Values are stored in host byte order.
+//   char[8]      magic "O3DLOCT\0"
+//   uint32       version
+//   uint32       max depth
+//   float64[3]   origin
+//   float64      size
+//   uint8        1 if the points have colors
+//   int64        number of nodes N
+//   int64        number of leaves L
+//   int64        number of points P
+//   uint8[N]     child masks in breadth-first order
+//   int32[L]     number of points of each leaf
+//   float64[3P]  points in Morton order
+//   int32[P]     original index of each point
+//   float64[3P]  colors, if any
+static constexpr char kLinearOctreeMagic[8] = {'O', '3', 'D', 'L',
+                                               'O', 'C', 'T', '\0'};
+static constexpr uint32_t kLinearOctreeVersion = 1;
+
+template <typename T>
+static void WriteBinary(std::ofstream &out, const T &value) {
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+static void WriteBinaryVector(std::ofstream &out, const std::vector<T> &data) {
+    out.write(reinterpret_cast<const char *>(data.data()),
+              data.size() * sizeof(T));
+}
+
+template <typename T>
+static bool ReadBinary(std::ifstream &in, T &value) {
+    in.read(reinterpret_cast<char *>(&value), sizeof(T));
+    return bool(in);
+}
+
+template <typename T>
+static bool ReadBinaryVector(std::ifstream &in,
+                             std::vector<T> &data,
+                             int64_t size) {
+    data.resize(size);
+    in.read(reinterpret_cast<char *>(data.data()), size * sizeof(T));
+    return bool(in);
+}
+
+bool ReadLinearOctree(const std::string &filename,
+                      geometry::LinearOctree &octree) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) {
+        utility::LogWarning("Read LinearOctree failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    char magic[sizeof(kLinearOctreeMagic)];
+    uint32_t version = 0;
+    if (!in.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, kLinearOctreeMagic, sizeof(magic)) ||
+        !ReadBinary(in, version) || version != kLinearOctreeVersion) {
+        utility::LogWarning(
+                "Read LinearOctree failed: {} is not a linear octree file.",
+                filename);
+        return false;
+    }
+
+    uint32_t max_depth = 0;
+    uint8_t has_colors = 0;
+    int64_t num_nodes = 0, num_leaves = 0, num_points = 0;
+    bool rc = ReadBinary(in, max_depth) &&
+              ReadBinary(in, octree.origin_(0)) &&
+              ReadBinary(in, octree.origin_(1)) &&
+              ReadBinary(in, octree.origin_(2)) &&
+              ReadBinary(in, octree.size_) && ReadBinary(in, has_colors) &&
+              ReadBinary(in, num_nodes) && ReadBinary(in, num_leaves) &&
+              ReadBinary(in, num_points);
+    if (!rc || num_nodes < 0 || num_leaves < 0 || num_points < 0) {
+        utility::LogWarning("Read LinearOctree failed: corrupted header.");
+        return false;
+    }
+    // Check the counts against the rest of the file before allocating
+    // anything, so that a corrupted header cannot trigger huge allocations.
+    const std::streamoff body_begin = in.tellg();
+    in.seekg(0, std::ios::end);
+    const int64_t body_size = int64_t(in.tellg() - body_begin);
+    in.seekg(body_begin);
+    const int64_t leaf_bytes = sizeof(int);
+    const int64_t point_bytes =
+            (has_colors ? 6 : 3) * sizeof(double) + sizeof(int);
+    if (!in || num_nodes > body_size || num_leaves > body_size / leaf_bytes ||
+        num_points > body_size / point_bytes ||
+        num_nodes + num_leaves * leaf_bytes + num_points * point_bytes >
+                body_size) {
+        utility::LogWarning(
+                "Read LinearOctree failed: {} is shorter than its header.",
+                filename);
+        return false;
+    }
+    octree.Clear();
+    octree.max_depth_ = max_depth;
+
+    std::vector<uint8_t> child_masks;
+    std::vector<int> leaf_point_counts;
+    std::vector<double> points, colors;
+    rc = ReadBinaryVector(in, child_masks, num_nodes) &&
+         ReadBinaryVector(in, leaf_point_counts, num_leaves) &&
+         ReadBinaryVector(in, points, 3 * num_points) &&
+         ReadBinaryVector(in, octree.point_indices_, num_points) &&
+         (!has_colors || ReadBinaryVector(in, colors, 3 * num_points));
+    if (!rc) {
+        utility::LogWarning("Read LinearOctree failed: unexpected end of {}.",
+                            filename);
+        octree.Clear();
+        return false;
+    }
+    octree.points_.resize(num_points);
+    octree.colors_.resize(has_colors ? num_points : 0);
+    for (int64_t i = 0; i < num_points; ++i) {
+        octree.points_[i] = Eigen::Vector3d(points.data() + 3 * i);
+        if (has_colors) {
+            octree.colors_[i] = Eigen::Vector3d(colors.data() + 3 * i);
+        }
+    }
+    if (!octree.SetFromChildMasks(child_masks, leaf_point_counts)) {
+        utility::LogWarning("Read LinearOctree failed: corrupted nodes in {}.",
+                            filename);
+        octree.Clear();
+        return false;
+    }
+    return true;
+}
+
+bool WriteLinearOctree(const std::string &filename,
+                       const geometry::LinearOctree &octree) {
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) {
+        utility::LogWarning(
+                "Write LinearOctree failed: unable to open file: {}",
+                filename);
+        return false;
+    }
+    std::vector<int> leaf_point_counts;
+    if (!octree.IsEmpty()) {
+        for (int node = octree.level_offsets_[octree.max_depth_];
+             node < int(octree.NumNodes()); ++node) {
+            leaf_point_counts.push_back(octree.node_point_end_[node] -
+                                        octree.node_point_begin_[node]);
+        }
+    }
+    const uint8_t has_colors = octree.colors_.empty() ? 0 : 1;
+
+    out.write(kLinearOctreeMagic, sizeof(kLinearOctreeMagic));
+    WriteBinary(out, kLinearOctreeVersion);
+    WriteBinary(out, static_cast<uint32_t>(octree.max_depth_));
+    WriteBinary(out, octree.origin_(0));
+    WriteBinary(out, octree.origin_(1));
+    WriteBinary(out, octree.origin_(2));
+    WriteBinary(out, octree.size_);
+    WriteBinary(out, has_colors);
+    WriteBinary(out, static_cast<int64_t>(octree.NumNodes()));
+    WriteBinary(out, static_cast<int64_t>(leaf_point_counts.size()));
+    WriteBinary(out, static_cast<int64_t>(octree.NumPoints()));
+    WriteBinaryVector(out, octree.node_child_masks_);
+    WriteBinaryVector(out, leaf_point_counts);
+    // Eigen::Vector3d is three packed doubles.
+    WriteBinaryVector(out, octree.points_);
+    WriteBinaryVector(out, octree.point_indices_);
+    if (has_colors) {
+        WriteBinaryVector(out, octree.colors_);
+    }
+    if (!out) {
+        utility::LogWarning("Write LinearOctree failed: unable to write {}.",
+                            filename);
+        return false;
+    }
+    return true;
+}
 }  // namespace io
 }  // namespace open3d
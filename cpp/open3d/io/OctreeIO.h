@@ -28,6 +28,7 @@
 
 #include <string>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/Octree.h"
 
 namespace open3d {
@@ -57,5 +58,18 @@ bool ReadOctreeFromJson(const std::string &filename, geometry::Octree &octree);
 bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree);
 
+/// Reads a LinearOctree written by WriteLinearOctree.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadLinearOctree(const std::string &filename,
+                      geometry::LinearOctree &octree);
+
+/// Writes a LinearOctree in a compact binary format: the bounds, one child
+/// mask byte per node in breadth-first order, the point count of each leaf,
+/// and the points in Morton order with their original indices and colors.
+/// The node arrays are rebuilt from the child masks when reading.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteLinearOctree(const std::string &filename,
+                       const geometry::LinearOctree &octree);
+
 }  // namespace io
 }  // namespace open3d
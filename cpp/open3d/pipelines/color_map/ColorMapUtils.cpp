@@ -26,12 +26,16 @@
 
 #include "open3d/pipelines/color_map/ColorMapUtils.h"
 
+#include <algorithm>
+
 #include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/pipelines/color_map/ImageWarpingField.h"
+#include "open3d/t/geometry/RaycastingScene.h"
 #include "open3d/utility/Parallel.h"
 
 namespace open3d {
@@ -131,6 +135,74 @@ std::vector<geometry::Image> CreateDepthBoundaryMasks(
     return masks;
 }
 
+/// Checks the visibility of a vertex projected to (u_d, v_d) with depth d
+/// against the sensor depth and the depth boundary mask of an image.
+static bool IsVisibleInDepthImage(const geometry::Image& image_depth,
+                                  const geometry::Image& image_mask,
+                                  int u_d,
+                                  int v_d,
+                                  float d,
+                                  double maximum_allowable_depth,
+                                  double depth_threshold_for_visibility_check) {
+    // Skip if vertex in image boundary.
+    if (d < 0.0 || !image_depth.TestImageBoundary(u_d, v_d)) {
+        return false;
+    }
+    // Skip if vertex's depth is too large (e.g. background).
+    float d_sensor = *image_depth.PointerAt<float>(u_d, v_d);
+    if (d_sensor > maximum_allowable_depth) {
+        return false;
+    }
+    // Check depth boundary mask. If a vertex is located at the boundary
+    // of an object, its color will be highly diverse from different
+    // viewing angles.
+    if (*image_mask.PointerAt<uint8_t>(u_d, v_d) == 255) {
+        return false;
+    }
+    // Check depth errors.
+    if (std::fabs(d - d_sensor) >= depth_threshold_for_visibility_check) {
+        return false;
+    }
+    return true;
+}
+
+/// Builds visibility_vertex_to_image from visibility_image_to_vertex. Cameras
+/// are visited in order, so the camera lists of each vertex are sorted.
+static std::vector<std::vector<int>> TransposeVisibility(
+        const std::vector<std::vector<int>>& visibility_image_to_vertex,
+        size_t n_vertex) {
+    std::vector<int> counts(n_vertex, 0);
+    for (const std::vector<int>& vertices : visibility_image_to_vertex) {
+        for (int vertex_id : vertices) {
+            counts[vertex_id]++;
+        }
+    }
+    std::vector<std::vector<int>> visibility_vertex_to_image(n_vertex);
+    for (size_t vertex_id = 0; vertex_id < n_vertex; vertex_id++) {
+        visibility_vertex_to_image[vertex_id].reserve(counts[vertex_id]);
+    }
+    for (int camera_id = 0; camera_id < int(visibility_image_to_vertex.size());
+         camera_id++) {
+        for (int vertex_id : visibility_image_to_vertex[camera_id]) {
+            visibility_vertex_to_image[vertex_id].push_back(camera_id);
+        }
+    }
+    return visibility_vertex_to_image;
+}
+
+static void LogVisibility(
+        const std::vector<std::vector<int>>& visibility_image_to_vertex,
+        size_t n_vertex) {
+    for (int camera_id = 0; camera_id < int(visibility_image_to_vertex.size());
+         camera_id++) {
+        size_t n_visible_vertex = visibility_image_to_vertex[camera_id].size();
+        utility::LogDebug(
+                "[cam {:d}]: {:d}/{:d} ({:.5f}%) vertices are visible",
+                camera_id, n_visible_vertex, n_vertex,
+                double(n_visible_vertex) / n_vertex * 100);
+    }
+}
+
 std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
 CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
@@ -144,10 +216,9 @@ CreateVertexAndImageVisibility(
     // visibility_image_to_vertex[c]: vertices visible by camera c.
     std::vector<std::vector<int>> visibility_image_to_vertex;
     visibility_image_to_vertex.resize(n_camera);
-    // visibility_vertex_to_image[v]: cameras that can see vertex v.
-    std::vector<std::vector<int>> visibility_vertex_to_image;
-    visibility_vertex_to_image.resize(n_vertex);
 
+    // Each camera only writes to its own list, the vertex to image lists are
+    // built afterwards without synchronization.
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
@@ -157,44 +228,127 @@ CreateVertexAndImageVisibility(
             std::tie(u, v, d) = Project3DPointAndGetUVDepth(
                     X, camera_trajectory.parameters_[camera_id]);
             int u_d = int(round(u)), v_d = int(round(v));
-            // Skip if vertex in image boundary.
-            if (d < 0.0 ||
-                !images_depth[camera_id].TestImageBoundary(u_d, v_d)) {
-                continue;
+            if (IsVisibleInDepthImage(images_depth[camera_id],
+                                      images_mask[camera_id], u_d, v_d, d,
+                                      maximum_allowable_depth,
+                                      depth_threshold_for_visibility_check)) {
+                visibility_image_to_vertex[camera_id].push_back(vertex_id);
             }
-            // Skip if vertex's depth is too large (e.g. background).
-            float d_sensor =
-                    *images_depth[camera_id].PointerAt<float>(u_d, v_d);
-            if (d_sensor > maximum_allowable_depth) {
+        }
+    }
+    LogVisibility(visibility_image_to_vertex, n_vertex);
+
+    return std::make_tuple(
+            TransposeVisibility(visibility_image_to_vertex, n_vertex),
+            visibility_image_to_vertex);
+}
+
+std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
+CreateVertexAndImageVisibilityByRaycasting(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<geometry::Image>& images_depth,
+        const std::vector<geometry::Image>& images_mask,
+        const camera::PinholeCameraTrajectory& camera_trajectory,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check) {
+    size_t n_camera = camera_trajectory.parameters_.size();
+    size_t n_vertex = mesh.vertices_.size();
+    std::vector<std::vector<int>> visibility_image_to_vertex(n_camera);
+
+    t::geometry::RaycastingScene scene;
+    const core::Device host("CPU:0");
+    scene.AddTriangles(core::eigen_converter::EigenVector3dVectorToTensor(
+                               mesh.vertices_, core::Float32, host),
+                       core::eigen_converter::EigenVector3iVectorToTensor(
+                               mesh.triangles_, core::UInt32, host));
+    const uint32_t invalid_id = t::geometry::RaycastingScene::INVALID_ID();
+
+    // Marks candidate vertices of the current camera. Reset through the
+    // candidate list, so that a camera costs O(pixels) instead of O(vertices).
+    std::vector<uint8_t> is_candidate(n_vertex, 0);
+    std::vector<int> candidates;
+    std::vector<uint8_t> is_visible;
+    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+        const camera::PinholeCameraParameters& camera_parameter =
+                camera_trajectory.parameters_[camera_id];
+        const geometry::Image& image_depth = images_depth[camera_id];
+        const int width = image_depth.width_;
+        const int height = image_depth.height_;
+
+        // Rays are cast through pixel centers (x + 0.5, y + 0.5). Shift the
+        // principal point by half a pixel so that the ray of pixel (x, y)
+        // passes through (u, v) = (x, y), matching the rounded projections
+        // used by the optimizers.
+        Eigen::Matrix3d intrinsic =
+                camera_parameter.intrinsic_.intrinsic_matrix_;
+        intrinsic(0, 2) += 0.5;
+        intrinsic(1, 2) += 0.5;
+        core::Tensor rays = t::geometry::RaycastingScene::CreateRaysPinhole(
+                core::eigen_converter::EigenMatrixToTensor(intrinsic),
+                core::eigen_converter::EigenMatrixToTensor(
+                        camera_parameter.extrinsic_),
+                width, height);
+        // Ray directions have a unit z component in the camera frame, so the
+        // hit distance is the rendered depth.
+        std::unordered_map<std::string, core::Tensor> result =
+                scene.CastRays(rays);
+        const float* depth_ptr = result["t_hit"].GetDataPtr<float>();
+        const uint32_t* primitive_ids_ptr =
+                result["primitive_ids"].GetDataPtr<uint32_t>();
+
+        // Vertices of the triangles seen through any pixel.
+        candidates.clear();
+        for (int64_t i = 0; i < int64_t(width) * height; i++) {
+            if (primitive_ids_ptr[i] == invalid_id) {
                 continue;
             }
-            // Check depth boundary mask. If a vertex is located at the boundary
-            // of an object, its color will be highly diverse from different
-            // viewing angles.
-            if (*images_mask[camera_id].PointerAt<uint8_t>(u_d, v_d) == 255) {
-                continue;
+            const Eigen::Vector3i& triangle =
+                    mesh.triangles_[primitive_ids_ptr[i]];
+            for (int k = 0; k < 3; k++) {
+                if (!is_candidate[triangle(k)]) {
+                    is_candidate[triangle(k)] = 1;
+                    candidates.push_back(triangle(k));
+                }
             }
-            // Check depth errors.
-            if (std::fabs(d - d_sensor) >=
-                depth_threshold_for_visibility_check) {
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        // A candidate is visible if it is not behind the rendered surface at
+        // its own pixel and passes the depth image checks.
+        is_visible.assign(candidates.size(), 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < int(candidates.size()); i++) {
+            const int vertex_id = candidates[i];
+            float u, v, d;
+            std::tie(u, v, d) = Project3DPointAndGetUVDepth(
+                    mesh.vertices_[vertex_id], camera_parameter);
+            int u_d = int(round(u)), v_d = int(round(v));
+            if (!IsVisibleInDepthImage(image_depth, images_mask[camera_id],
+                                       u_d, v_d, d, maximum_allowable_depth,
+                                       depth_threshold_for_visibility_check)) {
                 continue;
             }
-            visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#pragma omp critical(CreateVertexAndImageVisibility)
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
+            const float d_render = depth_ptr[int64_t(v_d) * width + u_d];
+            is_visible[i] =
+                    d <= d_render + depth_threshold_for_visibility_check;
         }
-    }
 
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        size_t n_visible_vertex = visibility_image_to_vertex[camera_id].size();
-        utility::LogDebug(
-                "[cam {:d}]: {:d}/{:d} ({:.5f}%) vertices are visible",
-                camera_id, n_visible_vertex, n_vertex,
-                double(n_visible_vertex) / n_vertex * 100);
+        std::vector<int>& visible_vertices =
+                visibility_image_to_vertex[camera_id];
+        for (size_t i = 0; i < candidates.size(); i++) {
+            is_candidate[candidates[i]] = 0;
+            if (is_visible[i]) {
+                visible_vertices.push_back(candidates[i]);
+            }
+        }
+        visible_vertices.shrink_to_fit();
     }
+    LogVisibility(visibility_image_to_vertex, n_vertex);
 
-    return std::make_tuple(visibility_vertex_to_image,
-                           visibility_image_to_vertex);
+    return std::make_tuple(
+            TransposeVisibility(visibility_image_to_vertex, n_vertex),
+            visibility_image_to_vertex);
 }
 
 void SetProxyIntensityForVertex(
@@ -62,6 +62,21 @@ CreateVertexAndImageVisibility(
         double maximum_allowable_depth,
         double depth_threshold_for_visibility_check);
 
+/// Same as CreateVertexAndImageVisibility(), but raycasts the mesh once per
+/// camera. Only the vertices of the triangles hit through a pixel are tested,
+/// and vertices occluded by the mesh itself are rejected. The cost per camera
+/// scales with the number of pixels instead of the number of vertices.
+/// Vertices whose adjacent triangles are all smaller than a pixel in an image
+/// may be missed for that image.
+std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
+CreateVertexAndImageVisibilityByRaycasting(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<geometry::Image>& images_depth,
+        const std::vector<geometry::Image>& images_mask,
+        const camera::PinholeCameraTrajectory& camera_trajectory,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check);
+
 void SetProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<geometry::Image>& images_gray,
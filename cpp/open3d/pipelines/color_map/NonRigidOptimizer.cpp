@@ -282,10 +282,17 @@ geometry::TriangleMesh RunNonRigidOptimizer(
 
     utility::LogDebug("[ColorMapOptimization] CreateVertexAndImageVisibility");
     std::tie(visibility_vertex_to_image, visibility_image_to_vertex) =
-            CreateVertexAndImageVisibility(
-                    opt_mesh, images_depth, images_mask, opt_camera_trajectory,
-                    option.maximum_allowable_depth_,
-                    option.depth_threshold_for_visibility_check_);
+            option.use_raycasting_visibility_
+                    ? CreateVertexAndImageVisibilityByRaycasting(
+                              opt_mesh, images_depth, images_mask,
+                              opt_camera_trajectory,
+                              option.maximum_allowable_depth_,
+                              option.depth_threshold_for_visibility_check_)
+                    : CreateVertexAndImageVisibility(
+                              opt_mesh, images_depth, images_mask,
+                              opt_camera_trajectory,
+                              option.maximum_allowable_depth_,
+                              option.depth_threshold_for_visibility_check_);
 
     utility::LogDebug("[ColorMapOptimization] Non-Rigid Optimization");
     warping_fields = CreateWarpingFields(images_gray,
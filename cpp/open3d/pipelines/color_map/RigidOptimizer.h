@@ -84,6 +84,12 @@ struct RigidOptimizerOption {
     /// output dir. Existing files will be overwritten if the names are the
     /// same.
     std::string debug_output_dir_ = "";
+
+    /// If true, visibility is computed by raycasting the mesh once per camera
+    /// instead of projecting every vertex into every depth image. Vertices
+    /// occluded by the mesh are rejected, and the cost scales with the number
+    /// of pixels instead of the number of vertices.
+    bool use_raycasting_visibility_ = false;
 };
 
 geometry::TriangleMesh RunRigidOptimizer(
@@ -26,164 +26,183 @@
 
 #include "open3d/pipelines/odometry/Odometry.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <Eigen/Dense>
+#include <algorithm>
 #include <memory>
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace pipelines {
 namespace odometry {
 
-static std::tuple<geometry::Image, geometry::Image> InitializeCorrespondenceMap(
-        int width, int height) {
-    // initialization: filling with any (u,v) to (-1,-1)
-    geometry::Image correspondence_map;
-    geometry::Image depth_buffer;
-    correspondence_map.Prepare(width, height, 2, 4);
-    depth_buffer.Prepare(width, height, 1, 4);
-    for (int v = 0; v < correspondence_map.height_; v++) {
-        for (int u = 0; u < correspondence_map.width_; u++) {
-            *correspondence_map.PointerAt<int>(u, v, 0) = -1;
-            *correspondence_map.PointerAt<int>(u, v, 1) = -1;
-            *depth_buffer.PointerAt<float>(u, v, 0) = -1.0f;
-        }
+namespace {
+
+/// Per-thread partial sums of the 6x6 Gauss-Newton system together with the
+/// Jacobian scratch vectors, kept alive across iterations and pyramid levels.
+struct PartialLinearSystem {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    void SetZero() {
+        JTJ_.setZero();
+        JTr_.setZero();
+        r2_ = 0.0;
     }
-    return std::make_tuple(correspondence_map, depth_buffer);
-}
 
-static inline void AddElementToCorrespondenceMap(
-        geometry::Image &correspondence_map,
-        geometry::Image &depth_buffer,
-        int u_s,
-        int v_s,
-        int u_t,
-        int v_t,
-        float transformed_d_t) {
-    int exist_u_t, exist_v_t;
-    double exist_d_t;
-    exist_u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-    exist_v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-    if (exist_u_t != -1 && exist_v_t != -1) {
-        exist_d_t = *depth_buffer.PointerAt<float>(u_s, v_s);
-        if (transformed_d_t <
-            exist_d_t) {  // update nearer point as correspondence
-            *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-            *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-            *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-        }
-    } else {  // register correspondence
-        *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-        *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-        *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
+    void Add(const PartialLinearSystem &other) {
+        JTJ_ += other.JTJ_;
+        JTr_ += other.JTr_;
+        r2_ += other.r2_;
     }
+
+    Eigen::Matrix6d JTJ_ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr_ = Eigen::Vector6d::Zero();
+    double r2_ = 0.0;
+    std::vector<Eigen::Vector6d, utility::Vector6d_allocator> J_r_;
+    std::vector<double> r_;
+    std::vector<double> w_;
+};
+
+typedef std::vector<PartialLinearSystem,
+                    Eigen::aligned_allocator<PartialLinearSystem>>
+        PartialLinearSystemVector;
+
+/// Buffers shared by all odometry iterations of a session.
+struct OdometryWorkspace {
+    OdometryWorkspace()
+        : num_threads_(std::max(1, utility::EstimateMaxThreads())),
+          partials_(num_threads_) {}
+
+    int num_threads_;
+    /// Linear target pixel index per source pixel, or -1.
+    std::vector<int> correspondence_map_;
+    /// Exclusive prefix sum of the number of correspondences per source row.
+    std::vector<int> row_offset_;
+    CorrespondenceSetPixelWise correspondence_;
+    PartialLinearSystemVector partials_;
+};
+
+/// Preprocessed frame. \p pyramid_ holds the intensity normalized for the
+/// current image pair while \p raw_color_ keeps the unnormalized intensity, so
+/// that the frame can be re-used with a different partner frame.
+struct OdometryFrame {
+    bool is_rgb_ = false;
+    geometry::RGBDImagePyramid pyramid_;
+    std::vector<geometry::Image> raw_color_;
+    std::vector<geometry::Image> xyz_;
+    bool has_gradients_ = false;
+    geometry::RGBDImagePyramid pyramid_dx_;
+    geometry::RGBDImagePyramid pyramid_dy_;
+    std::vector<geometry::Image> raw_color_dx_;
+    std::vector<geometry::Image> raw_color_dy_;
+};
+
+}  // unnamed namespace
+
+static inline int GetThreadNum() {
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
 }
 
-static void MergeCorrespondenceMaps(geometry::Image &correspondence_map,
-                                    geometry::Image &depth_buffer,
-                                    geometry::Image &correspondence_map_part,
-                                    geometry::Image &depth_buffer_part) {
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                float transformed_d_t =
-                        *depth_buffer_part.PointerAt<float>(u_s, v_s);
-                AddElementToCorrespondenceMap(correspondence_map, depth_buffer,
-                                              u_s, v_s, u_t, v_t,
-                                              transformed_d_t);
-            }
-        }
-    }
+static inline int GetNumThreads() {
+#ifdef _OPENMP
+    return omp_get_num_threads();
+#else
+    return 1;
+#endif
 }
 
-static int CountCorrespondence(const geometry::Image &correspondence_map) {
-    int correspondence_count = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                correspondence_count++;
-            }
+/// Pairwise reduction of the per-thread partial systems into partials[0]. Has
+/// to be called by every thread of the enclosing parallel region.
+static void TreeReducePartials(PartialLinearSystemVector &partials,
+                               int thread_id,
+                               int num_threads) {
+    for (int stride = 1; stride < num_threads; stride *= 2) {
+#pragma omp barrier
+        if (thread_id % (2 * stride) == 0 && thread_id + stride < num_threads) {
+            partials[thread_id].Add(partials[thread_id + stride]);
         }
     }
-    return correspondence_count;
 }
 
-static CorrespondenceSetPixelWise ComputeCorrespondence(
+static const CorrespondenceSetPixelWise &ComputeCorrespondence(
         const Eigen::Matrix3d intrinsic_matrix,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
-        const OdometryOption &option) {
+        const OdometryOption &option,
+        OdometryWorkspace &workspace) {
     const Eigen::Matrix3d K = intrinsic_matrix;
     const Eigen::Matrix3d K_inv = K.inverse();
     const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
     const Eigen::Matrix3d KRK_inv = K * R * K_inv;
     Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
 
-    geometry::Image correspondence_map;
-    geometry::Image depth_buffer;
-    std::tie(correspondence_map, depth_buffer) =
-            InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-
-#pragma omp parallel
-    {
-        geometry::Image correspondence_map_private;
-        geometry::Image depth_buffer_private;
-        std::tie(correspondence_map_private, depth_buffer_private) =
-                InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-#pragma omp for nowait
-        for (int v_s = 0; v_s < depth_s.height_; v_s++) {
-            for (int u_s = 0; u_s < depth_s.width_; u_s++) {
-                double d_s = *depth_s.PointerAt<float>(u_s, v_s);
-                if (!std::isnan(d_s)) {
-                    Eigen::Vector3d uv_in_s =
-                            d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
-                    double transformed_d_s = uv_in_s(2);
-                    int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
-                    int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
-                    if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
-                        v_t < depth_t.height_) {
-                        double d_t = *depth_t.PointerAt<float>(u_t, v_t);
-                        if (!std::isnan(d_t) &&
-                            std::abs(transformed_d_s - d_t) <=
-                                    option.max_depth_diff_) {
-                            AddElementToCorrespondenceMap(
-                                    correspondence_map_private,
-                                    depth_buffer_private, u_s, v_s, u_t, v_t,
-                                    (float)d_s);
-                        }
+    const int width = depth_s.width_;
+    const int height = depth_s.height_;
+    std::vector<int> &correspondence_map = workspace.correspondence_map_;
+    std::vector<int> &row_offset = workspace.row_offset_;
+    correspondence_map.resize(width * height);
+    row_offset.resize(height + 1);
+
+    // Each source pixel has at most one candidate and is owned by exactly one
+    // thread, so the map and the row counts are written without any locking.
+#pragma omp parallel for schedule(static) num_threads(workspace.num_threads_)
+    for (int v_s = 0; v_s < height; v_s++) {
+        int count = 0;
+        for (int u_s = 0; u_s < width; u_s++) {
+            int target_index = -1;
+            double d_s = *depth_s.PointerAt<float>(u_s, v_s);
+            if (!std::isnan(d_s)) {
+                Eigen::Vector3d uv_in_s =
+                        d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
+                double transformed_d_s = uv_in_s(2);
+                int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
+                int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
+                if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
+                    v_t < depth_t.height_) {
+                    double d_t = *depth_t.PointerAt<float>(u_t, v_t);
+                    if (!std::isnan(d_t) &&
+                        std::abs(transformed_d_s - d_t) <=
+                                option.max_depth_diff_) {
+                        target_index = v_t * depth_t.width_ + u_t;
+                        count++;
                     }
                 }
             }
+            correspondence_map[v_s * width + u_s] = target_index;
         }
-#pragma omp critical(ComputeCorrespondence)
-        {
-            MergeCorrespondenceMaps(correspondence_map, depth_buffer,
-                                    correspondence_map_private,
-                                    depth_buffer_private);
-
-        }  //    omp critical
-    }      //    omp parallel
-
-    CorrespondenceSetPixelWise correspondence;
-    int correspondence_count = CountCorrespondence(correspondence_map);
-    correspondence.resize(correspondence_count);
-    int cnt = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                Eigen::Vector4i pixel_correspondence(u_s, v_s, u_t, v_t);
-                correspondence[cnt] = pixel_correspondence;
+        row_offset[v_s + 1] = count;
+    }
+
+    row_offset[0] = 0;
+    for (int v_s = 0; v_s < height; v_s++) {
+        row_offset[v_s + 1] += row_offset[v_s];
+    }
+
+    CorrespondenceSetPixelWise &correspondence = workspace.correspondence_;
+    correspondence.resize(row_offset[height]);
+#pragma omp parallel for schedule(static) num_threads(workspace.num_threads_)
+    for (int v_s = 0; v_s < height; v_s++) {
+        int cnt = row_offset[v_s];
+        for (int u_s = 0; u_s < width; u_s++) {
+            int target_index = correspondence_map[v_s * width + u_s];
+            if (target_index >= 0) {
+                correspondence[cnt] = Eigen::Vector4i(
+                        u_s, v_s, target_index % depth_t.width_,
+                        target_index / depth_t.width_);
                 cnt++;
             }
         }
@@ -191,9 +210,9 @@ static CorrespondenceSetPixelWise ComputeCorrespondence(
     return correspondence;
 }
 
-static std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
-        const geometry::Image &depth, const Eigen::Matrix3d &intrinsic_matrix) {
-    auto image_xyz = std::make_shared<geometry::Image>();
+static void ConvertDepthImageToXYZImage(const geometry::Image &depth,
+                                        const Eigen::Matrix3d &intrinsic_matrix,
+                                        geometry::Image &image_xyz) {
     if (depth.num_of_channels_ != 1 || depth.bytes_per_channel_ != 4) {
         utility::LogError(
                 "[ConvertDepthImageToXYZImage] Unsupported image format.");
@@ -202,20 +221,19 @@ static std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
     const double inv_fy = 1.0 / intrinsic_matrix(1, 1);
     const double ox = intrinsic_matrix(0, 2);
     const double oy = intrinsic_matrix(1, 2);
-    image_xyz->Prepare(depth.width_, depth.height_, 3, 4);
+    image_xyz.Prepare(depth.width_, depth.height_, 3, 4);
 
-    for (int y = 0; y < image_xyz->height_; y++) {
-        for (int x = 0; x < image_xyz->width_; x++) {
-            float *px = image_xyz->PointerAt<float>(x, y, 0);
-            float *py = image_xyz->PointerAt<float>(x, y, 1);
-            float *pz = image_xyz->PointerAt<float>(x, y, 2);
+    for (int y = 0; y < image_xyz.height_; y++) {
+        for (int x = 0; x < image_xyz.width_; x++) {
+            float *px = image_xyz.PointerAt<float>(x, y, 0);
+            float *py = image_xyz.PointerAt<float>(x, y, 1);
+            float *pz = image_xyz.PointerAt<float>(x, y, 2);
             float z = *depth.PointerAt<float>(x, y);
             *px = (float)((x - ox) * z * inv_fx);
             *py = (float)((y - oy) * z * inv_fy);
             *pz = z;
         }
     }
-    return image_xyz;
 }
 
 static std::vector<Eigen::Matrix3d> CreateCameraMatrixPyramid(
@@ -235,60 +253,182 @@ static std::vector<Eigen::Matrix3d> CreateCameraMatrixPyramid(
     return pyramid_camera_matrix;
 }
 
+static std::shared_ptr<geometry::Image> PreprocessDepth(
+        const geometry::Image &depth_orig, const OdometryOption &option) {
+    std::shared_ptr<geometry::Image> depth_processed =
+            std::make_shared<geometry::Image>();
+    *depth_processed = depth_orig;
+    for (int y = 0; y < depth_processed->height_; y++) {
+        for (int x = 0; x < depth_processed->width_; x++) {
+            float *p = depth_processed->PointerAt<float>(x, y);
+            if ((*p < option.min_depth_ || *p > option.max_depth_ || *p <= 0))
+                *p = std::numeric_limits<float>::quiet_NaN();
+        }
+    }
+    return depth_processed;
+}
+
+static inline bool CheckImagePair(const geometry::Image &image_s,
+                                  const geometry::Image &image_t) {
+    return (image_s.width_ == image_t.width_ &&
+            image_s.height_ == image_t.height_);
+}
+
+static inline bool IsColorImageRGB(const geometry::Image &image) {
+    return (image.num_of_channels_ == 3);
+}
+
+static inline bool CheckRGBDImage(const geometry::RGBDImage &image) {
+    if (IsColorImageRGB(image.color_)) {
+        return (CheckImagePair(image.color_, image.depth_) &&
+                image.color_.bytes_per_channel_ == 1 &&
+                image.depth_.num_of_channels_ == 1 &&
+                image.depth_.bytes_per_channel_ == 4);
+    }
+    return (CheckImagePair(image.color_, image.depth_) &&
+            image.color_.num_of_channels_ == 1 &&
+            image.color_.bytes_per_channel_ == 4 &&
+            image.depth_.num_of_channels_ == 1 &&
+            image.depth_.bytes_per_channel_ == 4);
+}
+
+static inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
+                                      const geometry::RGBDImage &target) {
+    return (CheckRGBDImage(source) && CheckRGBDImage(target) &&
+            IsColorImageRGB(source.color_) == IsColorImageRGB(target.color_) &&
+            CheckImagePair(source.color_, target.color_));
+}
+
 static Eigen::Matrix6d CreateInformationMatrix(
         const Eigen::Matrix4d &extrinsic,
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
-        const OdometryOption &option) {
-    CorrespondenceSetPixelWise correspondence =
-            ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
-                                  extrinsic, depth_s, depth_t, option);
-
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
+        const geometry::Image &xyz_t,
+        const OdometryOption &option,
+        OdometryWorkspace &workspace) {
+    const CorrespondenceSetPixelWise &correspondence = ComputeCorrespondence(
+            pinhole_camera_intrinsic.intrinsic_matrix_, extrinsic, depth_s,
+            depth_t, option, workspace);
+    const int correspondence_count = (int)correspondence.size();
 
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
-    Eigen::Matrix6d GTG = Eigen::Matrix6d::Identity();
-#pragma omp parallel
+    auto &partials = workspace.partials_;
+#pragma omp parallel num_threads(workspace.num_threads_)
     {
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Identity();
+        const int thread_id = GetThreadNum();
+        PartialLinearSystem &partial = partials[thread_id];
+        partial.SetZero();
         Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
 #pragma omp for nowait
-        for (int row = 0; row < int(correspondence.size()); row++) {
+        for (int row = 0; row < correspondence_count; row++) {
             int u_t = correspondence[row](2);
             int v_t = correspondence[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+            double x = *xyz_t.PointerAt<float>(u_t, v_t, 0);
+            double y = *xyz_t.PointerAt<float>(u_t, v_t, 1);
+            double z = *xyz_t.PointerAt<float>(u_t, v_t, 2);
             G_r_private.setZero();
             G_r_private(1) = z;
             G_r_private(2) = -y;
             G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            partial.JTJ_.noalias() += G_r_private * G_r_private.transpose();
             G_r_private.setZero();
             G_r_private(0) = -z;
             G_r_private(2) = x;
             G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            partial.JTJ_.noalias() += G_r_private * G_r_private.transpose();
             G_r_private.setZero();
             G_r_private(0) = y;
             G_r_private(1) = -x;
             G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            partial.JTJ_.noalias() += G_r_private * G_r_private.transpose();
+        }
+        TreeReducePartials(partials, thread_id, GetNumThreads());
+    }
+    return Eigen::Matrix6d::Identity() + partials[0].JTJ_;
+}
+
+/// Builds the unnormalized pyramid of a frame, its per-level vertex maps and,
+/// if requested, the intensity gradients needed when it acts as the target.
+static void PrepareFrame(const geometry::RGBDImage &image,
+                         const std::vector<Eigen::Matrix3d> &camera_matrices,
+                         const OdometryOption &option,
+                         OdometryFrame &frame) {
+    const int num_levels = (int)camera_matrices.size();
+    frame.is_rgb_ = IsColorImageRGB(image.color_);
+    std::shared_ptr<geometry::Image> color;
+    if (frame.is_rgb_) {
+        color = image.color_.CreateFloatImage();
+    } else {
+        color = std::make_shared<geometry::Image>(image.color_);
+    }
+    auto gray = color->Filter(geometry::Image::FilterType::Gaussian3);
+    auto depth_preprocessed = PreprocessDepth(image.depth_, option);
+    auto depth =
+            depth_preprocessed->Filter(geometry::Image::FilterType::Gaussian3);
+
+    frame.pyramid_ = geometry::RGBDImage(*gray, *depth).CreatePyramid(
+            num_levels);
+    frame.raw_color_.resize(num_levels);
+    frame.xyz_.resize(num_levels);
+    for (int level = 0; level < num_levels; level++) {
+        frame.raw_color_[level] = frame.pyramid_[level]->color_;
+        ConvertDepthImageToXYZImage(frame.pyramid_[level]->depth_,
+                                    camera_matrices[level],
+                                    frame.xyz_[level]);
+    }
+    frame.has_gradients_ = false;
+}
+
+static void PrepareFrameGradients(OdometryFrame &frame) {
+    if (frame.has_gradients_) {
+        return;
+    }
+    const int num_levels = (int)frame.pyramid_.size();
+    frame.pyramid_dx_.resize(num_levels);
+    frame.pyramid_dy_.resize(num_levels);
+    frame.raw_color_dx_.resize(num_levels);
+    frame.raw_color_dy_.resize(num_levels);
+    for (int level = 0; level < num_levels; level++) {
+        const geometry::Image &color = frame.raw_color_[level];
+        const geometry::Image &depth = frame.pyramid_[level]->depth_;
+        frame.pyramid_dx_[level] = std::make_shared<geometry::RGBDImage>(
+                *color.Filter(geometry::Image::FilterType::Sobel3Dx),
+                *depth.Filter(geometry::Image::FilterType::Sobel3Dx));
+        frame.pyramid_dy_[level] = std::make_shared<geometry::RGBDImage>(
+                *color.Filter(geometry::Image::FilterType::Sobel3Dy),
+                *depth.Filter(geometry::Image::FilterType::Sobel3Dy));
+        frame.raw_color_dx_[level] = frame.pyramid_dx_[level]->color_;
+        frame.raw_color_dy_[level] = frame.pyramid_dy_[level]->color_;
+    }
+    frame.has_gradients_ = true;
+}
+
+/// Scales the working intensity of every level (and the gradients, if any) of
+/// \p frame by \p scale, starting from the unnormalized intensity. Intensity
+/// pyramid and Sobel filters are linear, so this matches normalizing the
+/// full-resolution image before building the pyramid.
+static void NormalizeFrameIntensity(OdometryFrame &frame, double scale) {
+    for (size_t level = 0; level < frame.pyramid_.size(); level++) {
+        frame.pyramid_[level]->color_ = frame.raw_color_[level];
+        frame.pyramid_[level]->color_.LinearTransform(scale, 0.0);
+        if (frame.has_gradients_) {
+            frame.pyramid_dx_[level]->color_ = frame.raw_color_dx_[level];
+            frame.pyramid_dx_[level]->color_.LinearTransform(scale, 0.0);
+            frame.pyramid_dy_[level]->color_ = frame.raw_color_dy_[level];
+            frame.pyramid_dy_[level]->color_.LinearTransform(scale, 0.0);
         }
-#pragma omp critical(CreateInformationMatrix)
-        { GTG += GTG_private; }
     }
-    return GTG;
 }
 
 static void NormalizeIntensity(
-        geometry::Image &image_s,
-        geometry::Image &image_t,
+        OdometryFrame &source,
+        OdometryFrame &target,
         const CorrespondenceSetPixelWise &correspondence) {
+    const geometry::Image &image_s = source.raw_color_[0];
+    const geometry::Image &image_t = target.raw_color_[0];
     if (image_s.width_ != image_t.width_ ||
         image_s.height_ != image_t.height_) {
         utility::LogError(
@@ -306,112 +446,8 @@ static void NormalizeIntensity(
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
-}
-
-static inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
-        const geometry::Image &color, const geometry::Image &depth) {
-    return std::make_shared<geometry::RGBDImage>(
-            geometry::RGBDImage(color, depth));
-}
-
-static std::shared_ptr<geometry::Image> PreprocessDepth(
-        const geometry::Image &depth_orig, const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> depth_processed =
-            std::make_shared<geometry::Image>();
-    *depth_processed = depth_orig;
-    for (int y = 0; y < depth_processed->height_; y++) {
-        for (int x = 0; x < depth_processed->width_; x++) {
-            float *p = depth_processed->PointerAt<float>(x, y);
-            if ((*p < option.min_depth_ || *p > option.max_depth_ || *p <= 0))
-                *p = std::numeric_limits<float>::quiet_NaN();
-        }
-    }
-    return depth_processed;
-}
-
-static inline bool CheckImagePair(const geometry::Image &image_s,
-                                  const geometry::Image &image_t) {
-    return (image_s.width_ == image_t.width_ &&
-            image_s.height_ == image_t.height_);
-}
-
-static inline bool IsColorImageRGB(const geometry::Image &image) {
-    return (image.num_of_channels_ == 3);
-}
-
-static inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
-                                      const geometry::RGBDImage &target) {
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        return (CheckImagePair(source.color_, target.color_) &&
-                CheckImagePair(source.depth_, target.depth_) &&
-                CheckImagePair(source.color_, source.depth_) &&
-                CheckImagePair(target.color_, target.depth_) &&
-                CheckImagePair(source.color_, target.color_) &&
-                source.color_.num_of_channels_ == 3 &&
-                target.color_.num_of_channels_ == 3 &&
-                source.depth_.num_of_channels_ == 1 &&
-                target.depth_.num_of_channels_ == 1 &&
-                source.color_.bytes_per_channel_ == 1 &&
-                target.color_.bytes_per_channel_ == 1 &&
-                source.depth_.bytes_per_channel_ == 4 &&
-                target.depth_.bytes_per_channel_ == 4);
-    }
-    if (!IsColorImageRGB(source.color_) && !IsColorImageRGB(target.color_)) {
-        return (CheckImagePair(source.color_, target.color_) &&
-                CheckImagePair(source.depth_, target.depth_) &&
-                CheckImagePair(source.color_, source.depth_) &&
-                CheckImagePair(target.color_, target.depth_) &&
-                CheckImagePair(source.color_, target.color_) &&
-                source.color_.num_of_channels_ == 1 &&
-                source.depth_.num_of_channels_ == 1 &&
-                target.color_.num_of_channels_ == 1 &&
-                target.depth_.num_of_channels_ == 1 &&
-                source.color_.bytes_per_channel_ == 4 &&
-                target.color_.bytes_per_channel_ == 4 &&
-                source.depth_.bytes_per_channel_ == 4 &&
-                target.depth_.bytes_per_channel_ == 4);
-    }
-    return false;
-}
-
-static std::tuple<std::shared_ptr<geometry::RGBDImage>,
-                  std::shared_ptr<geometry::RGBDImage>>
-InitializeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
-        const Eigen::Matrix4d &odo_init,
-        const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> source_color, target_color;
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        source_color = source.color_.CreateFloatImage();
-        target_color = target.color_.CreateFloatImage();
-    } else {
-        source_color = std::make_shared<geometry::Image>(source.color_);
-        target_color = std::make_shared<geometry::Image>(target.color_);
-    }
-
-    auto source_gray =
-            source_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-
-    CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, correspondence);
-
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
-    return std::make_tuple(source_out, target_out);
+    NormalizeFrameIntensity(source, 0.5 / mean_s);
+    NormalizeFrameIntensity(target, 0.5 / mean_t);
 }
 
 static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
@@ -425,32 +461,45 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const Eigen::Matrix3d intrinsic,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
-    CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
-            intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
+        const OdometryOption &option,
+        OdometryWorkspace &workspace) {
+    const CorrespondenceSetPixelWise &correspondence =
+            ComputeCorrespondence(intrinsic, extrinsic_initial, source.depth_,
+                                  target.depth_, option, workspace);
     int corresps_count = (int)correspondence.size();
 
-    auto f_lambda =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r, std::vector<double> &w) {
-                jacobian_method.ComputeJacobianAndResidual(
-                        i, J_r, r, w, source, target, source_xyz, target_dx,
-                        target_dy, intrinsic, extrinsic_initial,
-                        correspondence);
-            };
     utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    f_lambda, corresps_count);
+    auto &partials = workspace.partials_;
+#pragma omp parallel num_threads(workspace.num_threads_)
+    {
+        const int thread_id = GetThreadNum();
+        PartialLinearSystem &partial = partials[thread_id];
+        partial.SetZero();
+#pragma omp for nowait
+        for (int i = 0; i < corresps_count; i++) {
+            jacobian_method.ComputeJacobianAndResidual(
+                    i, partial.J_r_, partial.r_, partial.w_, source, target,
+                    source_xyz, target_dx, target_dy, intrinsic,
+                    extrinsic_initial, correspondence);
+            for (int j = 0; j < (int)partial.r_.size(); j++) {
+                partial.JTJ_.noalias() += partial.J_r_[j] * partial.w_[j] *
+                                          partial.J_r_[j].transpose();
+                partial.JTr_.noalias() +=
+                        partial.J_r_[j] * partial.w_[j] * partial.r_[j];
+                partial.r2_ += partial.r_[j] * partial.r_[j];
+            }
+        }
+        TreeReducePartials(partials, thread_id, GetNumThreads());
+    }
+    const PartialLinearSystem &system = partials[0];
+    utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                      system.r2_ / (double)corresps_count, corresps_count);
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
     std::tie(is_success, extrinsic) =
-            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(system.JTJ_,
+                                                                 system.JTr_);
     if (!is_success) {
         utility::LogWarning("[ComputeOdometry] no solution!");
         return std::make_tuple(false, Eigen::Matrix4d::Identity());
@@ -460,52 +509,33 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const OdometryFrame &source,
+        const OdometryFrame &target,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
+        const OdometryOption &option,
+        OdometryWorkspace &workspace) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
-
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
-
     for (int level = num_levels - 1; level >= 0; level--) {
         const Eigen::Matrix3d level_camera_matrix =
                 pyramid_camera_matrix[level];
 
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
-
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    iter, level, *source.pyramid_[level],
+                    *target.pyramid_[level], source.xyz_[level],
+                    *target.pyramid_dx_[level], *target.pyramid_dy_[level],
+                    level_camera_matrix, result_odo, jacobian_method, option,
+                    workspace);
             result_odo = curr_odo * result_odo;
 
             if (!is_success) {
@@ -517,37 +547,98 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     return std::make_tuple(true, result_odo);
 }
 
-std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
+struct OdometrySession::Impl {
+    camera::PinholeCameraIntrinsic pinhole_camera_intrinsic_;
+    OdometryOption option_;
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix_;
+    OdometryFrame source_;
+    OdometryFrame target_;
+    bool has_source_ = false;
+    bool has_target_ = false;
+    OdometryWorkspace workspace_;
+};
+
+OdometrySession::OdometrySession(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
         /*= camera::PinholeCameraIntrinsic()*/,
+        const OdometryOption &option /*= OdometryOption()*/)
+    : impl_(new OdometrySession::Impl()) {
+    impl_->pinhole_camera_intrinsic_ = pinhole_camera_intrinsic;
+    impl_->option_ = option;
+    impl_->pyramid_camera_matrix_ = CreateCameraMatrixPyramid(
+            pinhole_camera_intrinsic,
+            (int)option.iteration_number_per_pyramid_level_.size());
+}
+
+OdometrySession::~OdometrySession() {}
+
+bool OdometrySession::SetTarget(const geometry::RGBDImage &target) {
+    if (!CheckRGBDImage(target)) {
+        utility::LogWarning("[OdometrySession] Unsupported target format.");
+        return false;
+    }
+    PrepareFrame(target, impl_->pyramid_camera_matrix_, impl_->option_,
+                 impl_->target_);
+    PrepareFrameGradients(impl_->target_);
+    impl_->has_target_ = true;
+    impl_->has_source_ = false;
+    return true;
+}
+
+bool OdometrySession::AdvanceTarget() {
+    if (!impl_->has_source_) {
+        utility::LogWarning(
+                "[OdometrySession] No source frame to advance the target to.");
+        return false;
+    }
+    std::swap(impl_->source_, impl_->target_);
+    PrepareFrameGradients(impl_->target_);
+    impl_->has_target_ = true;
+    impl_->has_source_ = false;
+    return true;
+}
+
+bool OdometrySession::HasTarget() const { return impl_->has_target_; }
+
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> OdometrySession::Compute(
+        const geometry::RGBDImage &source,
         const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
         const RGBDOdometryJacobian &jacobian_method
-        /*=RGBDOdometryJacobianFromHybridTerm*/,
-        const OdometryOption &option /*= OdometryOption()*/) {
-    if (!CheckRGBDImagePair(source, target)) {
+        /*=RGBDOdometryJacobianFromHybridTerm*/) {
+    const OdometryFrame &target = impl_->target_;
+    if (!impl_->has_target_ || !CheckRGBDImage(source) ||
+        IsColorImageRGB(source.color_) != target.is_rgb_ ||
+        !CheckImagePair(source.depth_, target.pyramid_[0]->depth_)) {
         utility::LogWarning(
                 "[RGBDOdometry] Two RGBD pairs should be same in size.");
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
                                Eigen::Matrix6d::Zero());
     }
 
-    std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
-    std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
-            source, target, pinhole_camera_intrinsic, odo_init, option);
+    PrepareFrame(source, impl_->pyramid_camera_matrix_, impl_->option_,
+                 impl_->source_);
+    impl_->has_source_ = true;
+
+    const CorrespondenceSetPixelWise &correspondence = ComputeCorrespondence(
+            impl_->pinhole_camera_intrinsic_.intrinsic_matrix_, odo_init,
+            impl_->source_.pyramid_[0]->depth_,
+            impl_->target_.pyramid_[0]->depth_, impl_->option_,
+            impl_->workspace_);
+    NormalizeIntensity(impl_->source_, impl_->target_, correspondence);
 
     Eigen::Matrix4d extrinsic;
     bool is_success;
     std::tie(is_success, extrinsic) = ComputeMultiscale(
-            *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+            impl_->source_, impl_->target_, impl_->pyramid_camera_matrix_,
+            odo_init, jacobian_method, impl_->option_, impl_->workspace_);
 
     if (is_success) {
         Eigen::Matrix4d trans_output = extrinsic;
         Eigen::MatrixXd info_output = CreateInformationMatrix(
-                extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
-                target_processed->depth_, option);
+                extrinsic, impl_->pinhole_camera_intrinsic_,
+                impl_->source_.pyramid_[0]->depth_,
+                impl_->target_.pyramid_[0]->depth_, impl_->target_.xyz_[0],
+                impl_->option_, impl_->workspace_);
         return std::make_tuple(true, trans_output, info_output);
     } else {
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
@@ -555,6 +646,27 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
+        /*= camera::PinholeCameraIntrinsic()*/,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/,
+        const OdometryOption &option /*= OdometryOption()*/) {
+    if (!CheckRGBDImagePair(source, target)) {
+        utility::LogWarning(
+                "[RGBDOdometry] Two RGBD pairs should be same in size.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+
+    OdometrySession session(pinhole_camera_intrinsic, option);
+    session.SetTarget(target);
+    return session.Compute(source, odo_init, jacobian_method);
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <iostream>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -46,6 +47,60 @@ class RGBDImage;
 namespace pipelines {
 namespace odometry {
 
+/// \class OdometrySession
+///
+/// \brief Persistent RGBD odometry state for tracking consecutive frames.
+///
+/// The session keeps the preprocessed target pyramid, its gradients and all
+/// intermediate buffers between calls. After Compute(), AdvanceTarget() turns
+/// the last source frame into the new target without preprocessing it again.
+class OdometrySession {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameteres.
+    OdometrySession(const camera::PinholeCameraIntrinsic
+                            &pinhole_camera_intrinsic =
+                                    camera::PinholeCameraIntrinsic(),
+                    const OdometryOption &option = OdometryOption());
+    ~OdometrySession();
+    OdometrySession(const OdometrySession &) = delete;
+    OdometrySession &operator=(const OdometrySession &) = delete;
+
+public:
+    /// \brief Preprocesses and caches \p target as the current target frame.
+    ///
+    /// \return false if the image format is not supported.
+    bool SetTarget(const geometry::RGBDImage &target);
+
+    /// \brief Makes the source frame of the last Compute() call the target.
+    ///
+    /// \return false if no source frame has been processed since the target
+    /// was set.
+    bool AdvanceTarget();
+
+    /// Returns true if a target frame has been set.
+    bool HasTarget() const;
+
+    /// \brief Estimates the 6D rigid motion from \p source to the cached
+    /// target.
+    ///
+    /// \param source Source RGBD image.
+    /// \param odo_init Initial 4x4 motion matrix estimation.
+    /// \param jacobian_method The odometry Jacobian method to use.
+    /// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> Compute(
+            const geometry::RGBDImage &source,
+            const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+            const RGBDOdometryJacobian &jacobian_method =
+                    RGBDOdometryJacobianFromHybridTerm());
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 /// \brief Function to estimate 6D rigid motion from two RGBD image pairs.
 ///
 /// \param source Source RGBD image.
@@ -0,0 +1,315 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/BoundingVolume.h"
+
+#include <Eigen/Eigenvalues>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// Selects the corners of the unit cube in the order of the legacy
+/// GetBoxPoints().
+static core::Tensor BoxCornerSelector(core::Dtype dtype,
+                                      const core::Device &device) {
+    return core::Tensor::Init<float>({{0, 0, 0},
+                                      {1, 0, 0},
+                                      {0, 1, 0},
+                                      {0, 0, 1},
+                                      {1, 1, 1},
+                                      {0, 1, 1},
+                                      {1, 0, 1},
+                                      {1, 1, 0}},
+                                     device)
+            .To(dtype);
+}
+
+AxisAlignedBoundingBox::AxisAlignedBoundingBox(const core::Device &device)
+    : Geometry(Geometry::GeometryType::AxisAlignedBoundingBox, 3),
+      device_(device),
+      min_bound_(core::Tensor::Zeros({3}, core::Float32, device)),
+      max_bound_(core::Tensor::Zeros({3}, core::Float32, device)) {}
+
+AxisAlignedBoundingBox::AxisAlignedBoundingBox(const core::Tensor &min_bound,
+                                               const core::Tensor &max_bound)
+    : AxisAlignedBoundingBox(min_bound.GetDevice()) {
+    core::AssertTensorShape(min_bound, {3});
+    core::AssertTensorDtypes(min_bound, {core::Float32, core::Float64});
+    core::AssertTensorShape(max_bound, {3});
+    core::AssertTensorDtype(max_bound, min_bound.GetDtype());
+    core::AssertTensorDevice(max_bound, device_);
+    min_bound_ = min_bound;
+    max_bound_ = max_bound;
+}
+
+AxisAlignedBoundingBox AxisAlignedBoundingBox::To(const core::Device &device,
+                                                  bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return *this;
+    }
+    return AxisAlignedBoundingBox(min_bound_.To(device, /*copy=*/true),
+                                  max_bound_.To(device, /*copy=*/true));
+}
+
+AxisAlignedBoundingBox &AxisAlignedBoundingBox::Clear() {
+    min_bound_ = core::Tensor::Zeros({3}, GetDtype(), device_);
+    max_bound_ = core::Tensor::Zeros({3}, GetDtype(), device_);
+    return *this;
+}
+
+double AxisAlignedBoundingBox::GetMaxExtent() const {
+    return GetExtent().Max({0}).To(core::Float64).Item<double>();
+}
+
+double AxisAlignedBoundingBox::Volume() const {
+    return GetExtent().Prod({0}).To(core::Float64).Item<double>();
+}
+
+core::Tensor AxisAlignedBoundingBox::GetBoxPoints() const {
+    return min_bound_.Reshape({1, 3}) +
+           BoxCornerSelector(GetDtype(), device_) * GetExtent().Reshape({1, 3});
+}
+
+core::Tensor AxisAlignedBoundingBox::GetPointMaskWithinBoundingBox(
+        const core::Tensor &points) const {
+    core::AssertTensorDevice(points, device_);
+    core::Tensor mask;
+    kernel::pointcloud::GetPointMaskWithinAABB(points, min_bound_, max_bound_,
+                                               mask);
+    return mask;
+}
+
+core::Tensor AxisAlignedBoundingBox::GetPointIndicesWithinBoundingBox(
+        const core::Tensor &points) const {
+    return GetPointMaskWithinBoundingBox(points).NonZero().Reshape({-1});
+}
+
+std::string AxisAlignedBoundingBox::ToString() const {
+    return fmt::format("AxisAlignedBoundingBox on {} [{} min: {}, max: {}].",
+                       device_.ToString(), GetDtype().ToString(),
+                       min_bound_.ToString(/*with_suffix=*/false),
+                       max_bound_.ToString(/*with_suffix=*/false));
+}
+
+AxisAlignedBoundingBox AxisAlignedBoundingBox::CreateFromPoints(
+        const core::Tensor &points) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    if (points.GetLength() == 0) {
+        utility::LogWarning("Creating bounding box from empty points.");
+        AxisAlignedBoundingBox box(points.GetDevice());
+        return AxisAlignedBoundingBox(box.GetMinBound().To(points.GetDtype()),
+                                      box.GetMaxBound().To(points.GetDtype()));
+    }
+    return AxisAlignedBoundingBox(points.Min({0}), points.Max({0}));
+}
+
+AxisAlignedBoundingBox AxisAlignedBoundingBox::FromLegacy(
+        const open3d::geometry::AxisAlignedBoundingBox &box,
+        core::Dtype dtype,
+        const core::Device &device) {
+    if (dtype != core::Float32 && dtype != core::Float64) {
+        utility::LogError("dtype must be Float32 or Float64, but got {}.",
+                          dtype.ToString());
+    }
+    return AxisAlignedBoundingBox(
+            core::Tensor(box.min_bound_.data(), {3}, core::Float64, device)
+                    .To(dtype),
+            core::Tensor(box.max_bound_.data(), {3}, core::Float64, device)
+                    .To(dtype));
+}
+
+open3d::geometry::AxisAlignedBoundingBox AxisAlignedBoundingBox::ToLegacy()
+        const {
+    static const core::Device host("CPU:0");
+    core::Tensor min_bound = min_bound_.To(host, core::Float64).Contiguous();
+    core::Tensor max_bound = max_bound_.To(host, core::Float64).Contiguous();
+    const double *min_ptr = min_bound.GetDataPtr<double>();
+    const double *max_ptr = max_bound.GetDataPtr<double>();
+    return open3d::geometry::AxisAlignedBoundingBox(
+            Eigen::Vector3d(min_ptr[0], min_ptr[1], min_ptr[2]),
+            Eigen::Vector3d(max_ptr[0], max_ptr[1], max_ptr[2]));
+}
+
+OrientedBoundingBox::OrientedBoundingBox(const core::Device &device)
+    : Geometry(Geometry::GeometryType::OrientedBoundingBox, 3),
+      device_(device),
+      center_(core::Tensor::Zeros({3}, core::Float32, device)),
+      rotation_(core::Tensor::Eye(3, core::Float32, device)),
+      extent_(core::Tensor::Zeros({3}, core::Float32, device)) {}
+
+OrientedBoundingBox::OrientedBoundingBox(const core::Tensor &center,
+                                         const core::Tensor &rotation,
+                                         const core::Tensor &extent)
+    : OrientedBoundingBox(center.GetDevice()) {
+    core::AssertTensorShape(center, {3});
+    core::AssertTensorDtypes(center, {core::Float32, core::Float64});
+    core::AssertTensorShape(rotation, {3, 3});
+    core::AssertTensorDtype(rotation, center.GetDtype());
+    core::AssertTensorDevice(rotation, device_);
+    core::AssertTensorShape(extent, {3});
+    core::AssertTensorDtype(extent, center.GetDtype());
+    core::AssertTensorDevice(extent, device_);
+    center_ = center;
+    rotation_ = rotation;
+    extent_ = extent;
+}
+
+OrientedBoundingBox OrientedBoundingBox::To(const core::Device &device,
+                                            bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return *this;
+    }
+    return OrientedBoundingBox(center_.To(device, /*copy=*/true),
+                               rotation_.To(device, /*copy=*/true),
+                               extent_.To(device, /*copy=*/true));
+}
+
+OrientedBoundingBox &OrientedBoundingBox::Clear() {
+    center_ = core::Tensor::Zeros({3}, GetDtype(), device_);
+    rotation_ = core::Tensor::Eye(3, GetDtype(), device_);
+    extent_ = core::Tensor::Zeros({3}, GetDtype(), device_);
+    return *this;
+}
+
+double OrientedBoundingBox::Volume() const {
+    return extent_.Prod({0}).To(core::Float64).Item<double>();
+}
+
+core::Tensor OrientedBoundingBox::GetBoxPoints() const {
+    // Corners in the box frame, from -extent / 2 to extent / 2.
+    core::Tensor local = (BoxCornerSelector(GetDtype(), device_) - 0.5) *
+                         extent_.Reshape({1, 3});
+    return local.Matmul(rotation_.T()) + center_.Reshape({1, 3});
+}
+
+AxisAlignedBoundingBox OrientedBoundingBox::GetAxisAlignedBoundingBox() const {
+    core::Tensor box_points = GetBoxPoints();
+    return AxisAlignedBoundingBox(box_points.Min({0}), box_points.Max({0}));
+}
+
+core::Tensor OrientedBoundingBox::GetPointMaskWithinBoundingBox(
+        const core::Tensor &points) const {
+    core::AssertTensorDevice(points, device_);
+    core::Tensor mask;
+    kernel::pointcloud::GetPointMaskWithinOBB(points, center_, rotation_,
+                                              extent_, mask);
+    return mask;
+}
+
+core::Tensor OrientedBoundingBox::GetPointIndicesWithinBoundingBox(
+        const core::Tensor &points) const {
+    return GetPointMaskWithinBoundingBox(points).NonZero().Reshape({-1});
+}
+
+std::string OrientedBoundingBox::ToString() const {
+    return fmt::format(
+            "OrientedBoundingBox on {} [{} center: {}, extent: {}].",
+            device_.ToString(), GetDtype().ToString(),
+            center_.ToString(/*with_suffix=*/false),
+            extent_.ToString(/*with_suffix=*/false));
+}
+
+OrientedBoundingBox OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
+        const AxisAlignedBoundingBox &aabb) {
+    return OrientedBoundingBox(
+            aabb.GetCenter(),
+            core::Tensor::Eye(3, aabb.GetDtype(), aabb.GetDevice()),
+            aabb.GetExtent());
+}
+
+OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
+        const core::Tensor &points) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    if (points.GetLength() == 0) {
+        utility::LogError("Cannot create bounding box from empty points.");
+    }
+    const core::Device device = points.GetDevice();
+    const core::Dtype dtype = points.GetDtype();
+
+    // Principal axes from the eigenvectors of the covariance. Only the
+    // {3, 3} covariance is copied to the host.
+    core::Tensor points_d = points.To(core::Float64);
+    core::Tensor mean = points_d.Mean({0});
+    core::Tensor centered = points_d - mean.Reshape({1, 3});
+    core::Tensor covariance = centered.T().Matmul(centered);
+    Eigen::Matrix3d cov = core::eigen_converter::TensorToEigenMatrixXd(
+            covariance.To(core::Device("CPU:0")));
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cov);
+    Eigen::Matrix3d R = solver.eigenvectors();
+    // Largest variance first, and a right-handed frame.
+    R = R.rowwise().reverse().eval();
+    if (R.determinant() < 0) {
+        R.col(2) = -R.col(2);
+    }
+    core::Tensor rotation =
+            core::eigen_converter::EigenMatrixToTensor(R).To(device);
+
+    core::Tensor local = centered.Matmul(rotation);
+    core::Tensor local_min = local.Min({0});
+    core::Tensor local_max = local.Max({0});
+    core::Tensor local_center = ((local_min + local_max) * 0.5).Reshape({3, 1});
+    core::Tensor center = mean + rotation.Matmul(local_center).Reshape({3});
+    return OrientedBoundingBox(center.To(dtype), rotation.To(dtype),
+                               (local_max - local_min).To(dtype));
+}
+
+OrientedBoundingBox OrientedBoundingBox::FromLegacy(
+        const open3d::geometry::OrientedBoundingBox &box,
+        core::Dtype dtype,
+        const core::Device &device) {
+    if (dtype != core::Float32 && dtype != core::Float64) {
+        utility::LogError("dtype must be Float32 or Float64, but got {}.",
+                          dtype.ToString());
+    }
+    return OrientedBoundingBox(
+            core::Tensor(box.center_.data(), {3}, core::Float64, device)
+                    .To(dtype),
+            core::eigen_converter::EigenMatrixToTensor(box.R_).To(device,
+                                                                  dtype),
+            core::Tensor(box.extent_.data(), {3}, core::Float64, device)
+                    .To(dtype));
+}
+
+open3d::geometry::OrientedBoundingBox OrientedBoundingBox::ToLegacy() const {
+    static const core::Device host("CPU:0");
+    Eigen::Matrix3d R = core::eigen_converter::TensorToEigenMatrixXd(
+            rotation_.To(host, core::Float64));
+    Eigen::Vector3d center = core::eigen_converter::TensorToEigenMatrixXd(
+            center_.To(host, core::Float64).Reshape({3, 1}));
+    Eigen::Vector3d extent = core::eigen_converter::TensorToEigenMatrixXd(
+            extent_.To(host, core::Float64).Reshape({3, 1}));
+    return open3d::geometry::OrientedBoundingBox(center, R, extent);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,261 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/t/geometry/Geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+class OrientedBoundingBox;
+
+/// \class AxisAlignedBoundingBox
+/// \brief A bounding box that is aligned along the coordinate axes.
+///
+/// The bounds are stored as Float32 or Float64 tensors of shape {3}. The
+/// device of the bounds determines the device of the bounding box. All
+/// queries on points run on that device without copying the points to the
+/// host.
+class AxisAlignedBoundingBox : public Geometry {
+public:
+    /// Construct an empty box on the provided device.
+    AxisAlignedBoundingBox(const core::Device &device = core::Device("CPU:0"));
+
+    /// Construct a box from its bounds. The tensors are used directly as the
+    /// underlying storage (no memory copy).
+    ///
+    /// \param min_bound Lower bounds of the box, a Float32 or Float64 tensor
+    /// of shape {3}.
+    /// \param max_bound Upper bounds of the box, with the same dtype and
+    /// device as \p min_bound.
+    AxisAlignedBoundingBox(const core::Tensor &min_bound,
+                           const core::Tensor &max_bound);
+
+    virtual ~AxisAlignedBoundingBox() override {}
+
+    /// Returns the device of the bounding box.
+    core::Device GetDevice() const { return device_; }
+
+    /// Returns the dtype of the bounds.
+    core::Dtype GetDtype() const { return min_bound_.GetDtype(); }
+
+    /// Transfer the box to a specified device.
+    /// \param device The targeted device to convert to.
+    /// \param copy If true, a new box is always created; if false, the copy
+    /// is avoided when the original box is already on the targeted device.
+    AxisAlignedBoundingBox To(const core::Device &device,
+                              bool copy = false) const;
+
+    /// Returns copy of the box on the same device.
+    AxisAlignedBoundingBox Clone() const {
+        return To(GetDevice(), /*copy=*/true);
+    }
+
+    /// Reset the bounds to zero.
+    AxisAlignedBoundingBox &Clear() override;
+
+    /// Returns true iff the volume of the box is not positive.
+    bool IsEmpty() const override { return Volume() <= 0; }
+
+    core::Tensor GetMinBound() const { return min_bound_; }
+
+    core::Tensor GetMaxBound() const { return max_bound_; }
+
+    core::Tensor GetCenter() const { return (min_bound_ + max_bound_) * 0.5; }
+
+    /// Returns the lengths of the box along the coordinate axes.
+    core::Tensor GetExtent() const { return max_bound_ - min_bound_; }
+
+    /// Returns half the lengths of the box along the coordinate axes.
+    core::Tensor GetHalfExtent() const { return GetExtent() * 0.5; }
+
+    /// Returns the largest length of the box along the coordinate axes.
+    double GetMaxExtent() const;
+
+    /// Returns the volume of the box.
+    double Volume() const;
+
+    /// Returns the eight corners of the box as a {8, 3} tensor, in the same
+    /// order as the legacy AxisAlignedBoundingBox.
+    core::Tensor GetBoxPoints() const;
+
+    /// Returns a Bool tensor of shape {N} that is true for the \p points
+    /// inside the box, boundary included.
+    /// \param points A Float32 or Float64 tensor of shape {N, 3} on the same
+    /// device as the box.
+    core::Tensor GetPointMaskWithinBoundingBox(
+            const core::Tensor &points) const;
+
+    /// Returns the Int64 indices of the \p points inside the box, boundary
+    /// included.
+    /// \param points A Float32 or Float64 tensor of shape {N, 3} on the same
+    /// device as the box.
+    core::Tensor GetPointIndicesWithinBoundingBox(
+            const core::Tensor &points) const;
+
+    /// Text description.
+    std::string ToString() const;
+
+    /// Creates the tightest box containing \p points.
+    /// \param points A Float32 or Float64 tensor of shape {N, 3}.
+    static AxisAlignedBoundingBox CreateFromPoints(const core::Tensor &points);
+
+    /// Create an AxisAlignedBoundingBox from a legacy AxisAlignedBoundingBox.
+    static AxisAlignedBoundingBox FromLegacy(
+            const open3d::geometry::AxisAlignedBoundingBox &box,
+            core::Dtype dtype = core::Float32,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Convert to a legacy AxisAlignedBoundingBox.
+    open3d::geometry::AxisAlignedBoundingBox ToLegacy() const;
+
+protected:
+    core::Device device_ = core::Device("CPU:0");
+    core::Tensor min_bound_;
+    core::Tensor max_bound_;
+};
+
+/// \class OrientedBoundingBox
+/// \brief A bounding box oriented along an arbitrary frame.
+///
+/// The box is defined by its \p center, a {3, 3} \p rotation whose columns
+/// are the box axes, and its \p extent, the lengths of the box along those
+/// axes. All tensors share the same Float32 or Float64 dtype and device.
+class OrientedBoundingBox : public Geometry {
+public:
+    /// Construct an empty box on the provided device.
+    OrientedBoundingBox(const core::Device &device = core::Device("CPU:0"));
+
+    /// Construct a box from its center, rotation and extent. The tensors are
+    /// used directly as the underlying storage (no memory copy).
+    ///
+    /// \param center Center of the box, a tensor of shape {3}.
+    /// \param rotation Rotation of the box, a tensor of shape {3, 3}.
+    /// \param extent Lengths of the box along its axes, a tensor of shape
+    /// {3}.
+    OrientedBoundingBox(const core::Tensor &center,
+                        const core::Tensor &rotation,
+                        const core::Tensor &extent);
+
+    virtual ~OrientedBoundingBox() override {}
+
+    /// Returns the device of the bounding box.
+    core::Device GetDevice() const { return device_; }
+
+    /// Returns the dtype of the box tensors.
+    core::Dtype GetDtype() const { return center_.GetDtype(); }
+
+    /// Transfer the box to a specified device.
+    /// \param device The targeted device to convert to.
+    /// \param copy If true, a new box is always created; if false, the copy
+    /// is avoided when the original box is already on the targeted device.
+    OrientedBoundingBox To(const core::Device &device, bool copy = false) const;
+
+    /// Returns copy of the box on the same device.
+    OrientedBoundingBox Clone() const { return To(GetDevice(), /*copy=*/true); }
+
+    /// Reset to a zero-sized box at the origin.
+    OrientedBoundingBox &Clear() override;
+
+    /// Returns true iff the volume of the box is not positive.
+    bool IsEmpty() const override { return Volume() <= 0; }
+
+    core::Tensor GetCenter() const { return center_; }
+
+    core::Tensor GetRotation() const { return rotation_; }
+
+    core::Tensor GetExtent() const { return extent_; }
+
+    core::Tensor GetHalfExtent() const { return extent_ * 0.5; }
+
+    /// Returns the minimum corner of the axis aligned box around this box.
+    core::Tensor GetMinBound() const { return GetBoxPoints().Min({0}); }
+
+    /// Returns the maximum corner of the axis aligned box around this box.
+    core::Tensor GetMaxBound() const { return GetBoxPoints().Max({0}); }
+
+    /// Returns the volume of the box.
+    double Volume() const;
+
+    /// Returns the eight corners of the box as a {8, 3} tensor, in the same
+    /// order as the legacy OrientedBoundingBox.
+    core::Tensor GetBoxPoints() const;
+
+    /// Returns the axis aligned box around this box.
+    AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const;
+
+    /// Returns a Bool tensor of shape {N} that is true for the \p points
+    /// inside the box, boundary included.
+    /// \param points A Float32 or Float64 tensor of shape {N, 3} on the same
+    /// device as the box.
+    core::Tensor GetPointMaskWithinBoundingBox(
+            const core::Tensor &points) const;
+
+    /// Returns the Int64 indices of the \p points inside the box, boundary
+    /// included.
+    /// \param points A Float32 or Float64 tensor of shape {N, 3} on the same
+    /// device as the box.
+    core::Tensor GetPointIndicesWithinBoundingBox(
+            const core::Tensor &points) const;
+
+    /// Text description.
+    std::string ToString() const;
+
+    /// Creates an oriented box with the same geometry as \p aabb.
+    static OrientedBoundingBox CreateFromAxisAlignedBoundingBox(
+            const AxisAlignedBoundingBox &aabb);
+
+    /// Creates a box around \p points, oriented along their principal axes.
+    /// Only the {3, 3} covariance matrix is decomposed on the host.
+    /// \param points A Float32 or Float64 tensor of shape {N, 3} with N > 0.
+    static OrientedBoundingBox CreateFromPoints(const core::Tensor &points);
+
+    /// Create an OrientedBoundingBox from a legacy OrientedBoundingBox.
+    static OrientedBoundingBox FromLegacy(
+            const open3d::geometry::OrientedBoundingBox &box,
+            core::Dtype dtype = core::Float32,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Convert to a legacy OrientedBoundingBox.
+    open3d::geometry::OrientedBoundingBox ToLegacy() const;
+
+protected:
+    core::Device device_ = core::Device("CPU:0");
+    core::Tensor center_;
+    core::Tensor rotation_;
+    core::Tensor extent_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
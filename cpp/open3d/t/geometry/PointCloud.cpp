@@ -39,6 +39,7 @@
 #include "open3d/core/hashmap/HashSet.h"
 #include "open3d/core/linalg/Matmul.h"
 #include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
@@ -212,6 +213,89 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     return *this;
 }
 
+/// Returns for each voxel group the index of the point closest to the mean
+/// position of the group.
+static core::Tensor VoxelCentroidNearestIndices(
+        const core::Tensor &positions,
+        const core::Tensor &voxel_indices,
+        const core::Tensor &splits,
+        const core::Tensor &members) {
+    core::Tensor centroids;
+    kernel::pointcloud::VoxelMean(splits, members, positions, utility::nullopt,
+                                  centroids);
+    core::Tensor diff = positions - centroids.IndexGet({voxel_indices});
+    core::Tensor scores = (diff * diff).Sum({1}).Neg();
+    core::Tensor indices;
+    kernel::pointcloud::VoxelArgMax(splits, members, scores, indices);
+    return indices;
+}
+
+PointCloud PointCloud::SelectByMask(const core::Tensor &boolean_mask,
+                                    bool invert) const {
+    const int64_t length = GetPointPositions().GetLength();
+    core::AssertTensorShape(boolean_mask, {length});
+    core::AssertTensorDtype(boolean_mask, core::Bool);
+    core::AssertTensorDevice(boolean_mask, GetDevice());
+
+    // Resolve the mask once and share the indices between the attributes.
+    core::Tensor indices =
+            (invert ? boolean_mask.LogicalNot() : boolean_mask)
+                    .NonZero()
+                    .Reshape({-1});
+    PointCloud pcd(GetDevice());
+    for (const auto &kv : point_attr_) {
+        pcd.SetPointAttr(kv.first, kv.second.IndexGet({indices}));
+    }
+    return pcd;
+}
+
+PointCloud PointCloud::SelectByIndex(const core::Tensor &indices,
+                                     bool invert,
+                                     bool remove_duplicates) const {
+    core::AssertTensorShape(indices, {utility::nullopt});
+    core::AssertTensorDtypes(indices, {core::Int32, core::Int64});
+    core::AssertTensorDevice(indices, GetDevice());
+
+    const core::Tensor indices_i64 = indices.To(core::Int64);
+    if (!invert && !remove_duplicates) {
+        PointCloud pcd(GetDevice());
+        for (const auto &kv : point_attr_) {
+            pcd.SetPointAttr(kv.first, kv.second.IndexGet({indices_i64}));
+        }
+        return pcd;
+    }
+
+    // IndexSet does not support Bool, mark the indices in UInt8.
+    core::Tensor mask =
+            core::Tensor::Zeros({GetPointPositions().GetLength()}, core::UInt8,
+                                GetDevice());
+    mask.IndexSet({indices_i64},
+                  core::Tensor::Ones({indices_i64.GetLength()}, core::UInt8,
+                                     GetDevice()));
+    return SelectByMask(mask.To(core::Bool), invert);
+}
+
+PointCloud PointCloud::Crop(const AxisAlignedBoundingBox &aabb,
+                            bool invert) const {
+    core::AssertTensorDevice(aabb.GetMinBound(), GetDevice());
+    return SelectByMask(
+            aabb.GetPointMaskWithinBoundingBox(GetPointPositions()), invert);
+}
+
+PointCloud PointCloud::Crop(const OrientedBoundingBox &obb, bool invert) const {
+    core::AssertTensorDevice(obb.GetCenter(), GetDevice());
+    return SelectByMask(obb.GetPointMaskWithinBoundingBox(GetPointPositions()),
+                        invert);
+}
+
+AxisAlignedBoundingBox PointCloud::GetAxisAlignedBoundingBox() const {
+    return AxisAlignedBoundingBox::CreateFromPoints(GetPointPositions());
+}
+
+OrientedBoundingBox PointCloud::GetOrientedBoundingBox() const {
+    return OrientedBoundingBox::CreateFromPoints(GetPointPositions());
+}
+
 PointCloud PointCloud::VoxelDownSample(
         double voxel_size, const core::HashBackendType &backend) const {
     if (voxel_size <= 0) {
@@ -241,6 +325,265 @@ PointCloud PointCloud::VoxelDownSample(
     return pcd_down;
 }
 
+PointCloud PointCloud::VoxelDownSample(
+        double voxel_size,
+        const VoxelReductionType &reduction,
+        const core::HashBackendType &backend) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    if (reduction == VoxelReductionType::MaxIntensity &&
+        !HasPointAttr("intensities")) {
+        utility::LogError(
+                "MaxIntensity reduction requires the \"intensities\" "
+                "attribute.");
+    }
+    if (reduction == VoxelReductionType::MajorityLabel &&
+        !HasPointAttr("labels")) {
+        utility::LogError(
+                "MajorityLabel reduction requires the \"labels\" attribute.");
+    }
+
+    const int64_t n = GetPointPositions().GetLength();
+    PointCloud pcd_down(device_);
+    if (n == 0) {
+        return pcd_down;
+    }
+
+    core::Tensor points_voxeli =
+            (GetPointPositions() / voxel_size).Floor().To(core::Int64);
+
+    // Compact voxel index of every point.
+    core::HashSet voxel_hashset(n, core::Int64, {3}, device_, backend);
+    core::Tensor voxel_indices =
+            CompactHashIndices(voxel_hashset, points_voxeli);
+    const int64_t m = voxel_hashset.Size();
+
+    core::Tensor splits, members;
+    kernel::pointcloud::GroupByVoxel(voxel_indices, m, splits, members);
+
+    // Reduces every attribute to the selected representative points.
+    auto select_points = [&](const core::Tensor &indices) {
+        for (auto &kv : point_attr_) {
+            pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({indices}));
+        }
+    };
+    // Averages every attribute, optionally over masked points only.
+    auto mean_points = [&](const utility::optional<
+                                   std::reference_wrapper<const core::Tensor>>
+                                   mask) {
+        for (auto &kv : point_attr_) {
+            core::Tensor reduced;
+            kernel::pointcloud::VoxelMean(splits, members, kv.second, mask,
+                                          reduced);
+            pcd_down.SetPointAttr(kv.first, reduced);
+        }
+    };
+
+    switch (reduction) {
+        case VoxelReductionType::Mean: {
+            mean_points(utility::nullopt);
+            break;
+        }
+        case VoxelReductionType::CentroidNearest: {
+            select_points(VoxelCentroidNearestIndices(
+                    GetPointPositions(), voxel_indices, splits, members));
+            break;
+        }
+        case VoxelReductionType::MaxIntensity: {
+            core::Tensor scores = GetPointAttr("intensities").Reshape({n});
+            core::Tensor indices;
+            kernel::pointcloud::VoxelArgMax(splits, members, scores, indices);
+            select_points(indices);
+            break;
+        }
+        case VoxelReductionType::MajorityLabel: {
+            const core::Tensor &labels = GetPointAttr("labels");
+            if (labels.NumElements() != n) {
+                utility::LogError("\"labels\" must have one label per point.");
+            }
+            core::AssertTensorDtypes(labels, {core::Int8, core::Int16,
+                                              core::Int32, core::Int64,
+                                              core::UInt8, core::UInt16,
+                                              core::UInt32, core::UInt64});
+
+            // Count the occurrences of each (voxel, label) pair, and score
+            // each point with the count of its pair.
+            core::Tensor voxel_label_keys =
+                    voxel_indices.Reshape({n, 1}).Append(
+                            labels.Reshape({n, 1}).To(core::Int64), 1);
+            core::HashSet pair_hashset(n, core::Int64, {2}, device_, backend);
+            core::Tensor pair_indices =
+                    CompactHashIndices(pair_hashset, voxel_label_keys);
+            core::Tensor pair_splits, pair_members;
+            kernel::pointcloud::GroupByVoxel(pair_indices, pair_hashset.Size(),
+                                             pair_splits, pair_members);
+            core::Tensor pair_counts =
+                    pair_splits.Slice(0, 1, pair_splits.GetLength()) -
+                    pair_splits.Slice(0, 0, pair_splits.GetLength() - 1);
+            core::Tensor scores = pair_counts.IndexGet({pair_indices});
+
+            core::Tensor indices;
+            kernel::pointcloud::VoxelArgMax(splits, members, scores, indices);
+            core::Tensor majority_mask =
+                    pair_indices.IndexGet({indices}).IndexGet(
+                            {voxel_indices}) == pair_indices;
+            mean_points(majority_mask);
+            pcd_down.SetPointAttr("labels", labels.IndexGet({indices}));
+            break;
+        }
+        default:
+            utility::LogError("Unsupported voxel reduction type.");
+    }
+
+    return pcd_down;
+}
+
+PointCloud PointCloud::FarthestPointDownSample(
+        int64_t num_samples,
+        int64_t start_index,
+        double voxel_size,
+        const core::HashBackendType &backend) const {
+    const int64_t n = GetPointPositions().GetLength();
+    if (num_samples <= 0 || num_samples > n) {
+        utility::LogError("num_samples must be in (0, {}], but got {}.", n,
+                          num_samples);
+    }
+    if (start_index < 0 || start_index >= n) {
+        utility::LogError("start_index must be in [0, {}), but got {}.", n,
+                          start_index);
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+
+    // Candidate points: all points, or one point per voxel in the approximate
+    // mode.
+    const bool use_voxels = voxel_size > 0;
+    core::Tensor candidates;
+    int64_t candidate_start = start_index;
+    if (use_voxels) {
+        core::Tensor points_voxeli =
+                (GetPointPositions() / voxel_size).Floor().To(core::Int64);
+        core::HashSet voxel_hashset(n, core::Int64, {3}, device_, backend);
+        core::Tensor voxel_indices =
+                CompactHashIndices(voxel_hashset, points_voxeli);
+        core::Tensor splits, members;
+        kernel::pointcloud::GroupByVoxel(voxel_indices, voxel_hashset.Size(),
+                                         splits, members);
+        candidates = VoxelCentroidNearestIndices(
+                GetPointPositions(), voxel_indices, splits, members);
+        if (candidates.GetLength() < num_samples) {
+            utility::LogError(
+                    "Only {} voxels of size {} are occupied, fewer than "
+                    "num_samples = {}. Use a smaller voxel_size.",
+                    candidates.GetLength(), voxel_size, num_samples);
+        }
+        candidate_start = voxel_indices[start_index].Item<int64_t>();
+    }
+
+    // The sampling runs on CPU. Points on other devices are copied there.
+    static const core::Device host("CPU:0");
+    core::Tensor points = GetPointPositions();
+    if (use_voxels) {
+        points = points.IndexGet({candidates});
+    }
+    core::Tensor indices;
+    kernel::pointcloud::FarthestPointDownSampleCPU(
+            points.To(host).Contiguous(), num_samples, candidate_start,
+            indices);
+    indices = indices.To(device_);
+    if (use_voxels) {
+        indices = candidates.IndexGet({indices});
+    }
+
+    PointCloud pcd_down(device_);
+    for (auto &kv : point_attr_) {
+        pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({indices}));
+    }
+    return pcd_down;
+}
+
+PointCloud PointCloud::PoissonDiskDownSample(
+        double radius, const core::HashBackendType &backend) const {
+    if (radius <= 0) {
+        utility::LogError("radius must be positive.");
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    const int64_t n = GetPointPositions().GetLength();
+    PointCloud pcd_down(device_);
+    if (n == 0) {
+        return pcd_down;
+    }
+
+    // Cells of size radius, so that conflicting samples are at most one cell
+    // apart.
+    static const core::Device host("CPU:0");
+    core::Tensor points = GetPointPositions().To(host).Contiguous();
+    core::Tensor points_celli = (points / radius).Floor().To(core::Int64);
+    core::HashSet cell_hashset(n, core::Int64, {3}, host, backend);
+    core::Tensor cell_indices = CompactHashIndices(cell_hashset, points_celli);
+    const int64_t num_cells = cell_hashset.Size();
+
+    core::Tensor splits, members;
+    kernel::pointcloud::GroupByVoxel(cell_indices, num_cells, splits, members);
+    core::Tensor cell_keys = points_celli.IndexGet(
+            {members.IndexGet({splits.Slice(0, 0, num_cells)})});
+
+    // Cells with the same coordinates modulo 3 are at least 2 * radius apart,
+    // and are sampled in parallel in one of the 27 phases.
+    core::Tensor cell_keys_mod =
+            cell_keys -
+            (cell_keys.To(core::Float64) / 3).Floor().To(core::Int64) * 3;
+    core::Tensor cell_phases =
+            (cell_keys_mod *
+             core::Tensor::Init<int64_t>({9, 3, 1}, host).Reshape({1, 3}))
+                    .Sum({1});
+
+    std::vector<int64_t> offsets;
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+            for (int64_t dz = -1; dz <= 1; ++dz) {
+                offsets.insert(offsets.end(), {dx, dy, dz});
+            }
+        }
+    }
+    core::Tensor neighbor_offsets(offsets, {1, 27, 3}, core::Int64, host);
+    core::Tensor buf_to_compact = BufferToCompactIndices(cell_hashset);
+
+    core::Tensor counts = core::Tensor::Zeros({num_cells}, core::Int64, host);
+    core::Tensor accepted = core::Tensor::Zeros({n}, core::Bool, host);
+    for (int64_t phase = 0; phase < 27; ++phase) {
+        core::Tensor cells = cell_phases.Eq(phase).NonZero().Reshape({-1});
+        const int64_t num_phase_cells = cells.GetLength();
+        if (num_phase_cells == 0) {
+            continue;
+        }
+
+        core::Tensor neighbor_keys =
+                (cell_keys.IndexGet({cells}).Reshape({num_phase_cells, 1, 3}) +
+                 neighbor_offsets)
+                        .Reshape({num_phase_cells * 27, 3});
+        core::Tensor buf_indices, masks;
+        cell_hashset.Find(neighbor_keys, buf_indices, masks);
+        core::Tensor neighbors =
+                buf_to_compact.IndexGet({buf_indices.To(core::Int64)});
+        neighbors.IndexSet({masks.LogicalNot()},
+                           core::Tensor::Init<int64_t>(-1, host));
+
+        kernel::pointcloud::PoissonDiskSampleCellsCPU(
+                points, splits, members, cells,
+                neighbors.Reshape({num_phase_cells, 27}), counts, accepted,
+                radius);
+    }
+
+    core::Tensor indices = accepted.NonZero().Reshape({-1}).To(device_);
+    for (auto &kv : point_attr_) {
+        pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({indices}));
+    }
+    return pcd_down;
+}
+
 void PointCloud::EstimateNormals(
         const int max_knn /* = 30*/,
         const utility::optional<double> radius /*= utility::nullopt*/) {
@@ -598,6 +941,27 @@ PointCloud PointCloud::FromLegacy(
     return pcd;
 }
 
+PointCloud PointCloud::FromLegacyView(
+        open3d::geometry::PointCloud &pcd_legacy) {
+    geometry::PointCloud pcd(core::Device("CPU:0"));
+    if (pcd_legacy.HasPoints()) {
+        pcd.SetPointPositions(
+                core::eigen_converter::EigenVector3dVectorAsTensor(
+                        pcd_legacy.points_));
+    } else {
+        utility::LogWarning("Creating from an empty legacy PointCloud.");
+    }
+    if (pcd_legacy.HasColors()) {
+        pcd.SetPointColors(core::eigen_converter::EigenVector3dVectorAsTensor(
+                pcd_legacy.colors_));
+    }
+    if (pcd_legacy.HasNormals()) {
+        pcd.SetPointNormals(core::eigen_converter::EigenVector3dVectorAsTensor(
+                pcd_legacy.normals_));
+    }
+    return pcd;
+}
+
 open3d::geometry::PointCloud PointCloud::ToLegacy() const {
     open3d::geometry::PointCloud pcd_legacy;
     if (HasPointPositions()) {
@@ -34,6 +34,7 @@
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/hashmap/HashMap.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/BoundingVolume.h"
 #include "open3d/t/geometry/DrawableGeometry.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
@@ -311,12 +312,120 @@ public:
     /// \return Rotated point cloud
     PointCloud &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Select points by a boolean mask. All attributes are selected
+    /// consistently.
+    /// \param boolean_mask Bool tensor of shape {N} on the same device as the
+    /// point cloud.
+    /// \param invert If true, select the points where the mask is false.
+    /// \return The selected points, in their original order.
+    PointCloud SelectByMask(const core::Tensor &boolean_mask,
+                            bool invert = false) const;
+
+    /// \brief Select points by their indices. All attributes are selected
+    /// consistently.
+    /// \param indices Int32 or Int64 tensor of shape {K} on the same device
+    /// as the point cloud.
+    /// \param invert If true, select the points not in \p indices.
+    /// \param remove_duplicates If true, repeated indices select the point
+    /// only once.
+    /// \return The selected points. Without \p invert and
+    /// \p remove_duplicates the points follow the order of \p indices,
+    /// otherwise their original order.
+    PointCloud SelectByIndex(const core::Tensor &indices,
+                             bool invert = false,
+                             bool remove_duplicates = false) const;
+
+    /// \brief Crops the point cloud to the points inside an axis aligned
+    /// box, boundary included.
+    /// \param aabb The box, on the same device as the point cloud.
+    /// \param invert If true, keep the points outside the box instead.
+    PointCloud Crop(const AxisAlignedBoundingBox &aabb,
+                    bool invert = false) const;
+
+    /// \brief Crops the point cloud to the points inside an oriented box,
+    /// boundary included.
+    /// \param obb The box, on the same device as the point cloud.
+    /// \param invert If true, keep the points outside the box instead.
+    PointCloud Crop(const OrientedBoundingBox &obb, bool invert = false) const;
+
+    /// Returns the axis aligned bounding box of the points.
+    AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const;
+
+    /// Returns an oriented bounding box of the points, aligned with their
+    /// principal axes.
+    OrientedBoundingBox GetOrientedBoundingBox() const;
+
     /// \brief Downsamples a point cloud with a specified voxel size.
     /// \param voxel_size Voxel size. A positive number.
     PointCloud VoxelDownSample(double voxel_size,
                                const core::HashBackendType &backend =
                                        core::HashBackendType::Default) const;
 
+    /// Per-voxel attribute reduction used in VoxelDownSample.
+    enum class VoxelReductionType {
+        /// Average the floating point attributes of the points in a voxel.
+        /// Integer and Bool attributes take the value of the point with the
+        /// smallest index.
+        Mean = 0,
+        /// Keep the point closest to the mean position of a voxel.
+        CentroidNearest = 1,
+        /// Keep the point with the largest "intensities" value of a voxel.
+        MaxIntensity = 2,
+        /// Keep the most frequent "labels" value of a voxel, and reduce the
+        /// other attributes as Mean over the points carrying that label.
+        MajorityLabel = 3
+    };
+
+    /// \brief Downsamples a point cloud with a specified voxel size, reducing
+    /// all attributes of the points falling into the same voxel.
+    ///
+    /// Voxels are hashed with core::HashSet, points are grouped per voxel with
+    /// a parallel counting sort, and every attribute is reduced per voxel in
+    /// parallel. All attributes stay in sync with the positions.
+    ///
+    /// \param voxel_size Voxel size. A positive number.
+    /// \param reduction Attribute reduction applied to each voxel.
+    /// \param backend Hash backend used to index the voxels.
+    PointCloud VoxelDownSample(double voxel_size,
+                               const VoxelReductionType &reduction,
+                               const core::HashBackendType &backend =
+                                       core::HashBackendType::Default) const;
+
+    /// \brief Downsamples a point cloud with farthest point sampling (FPS).
+    ///
+    /// Selects \p num_samples points, each farthest from the previously
+    /// selected ones. The sampling runs on CPU in parallel; point clouds on
+    /// other devices are copied to CPU for sampling.
+    ///
+    /// \param num_samples Number of points to keep, in (0, N].
+    /// \param start_index Index of the first selected point.
+    /// \param voxel_size If positive, points are first bucketed into voxels
+    /// of this size, and FPS runs over the point closest to each voxel
+    /// centroid. This approximate mode is much faster on large point clouds.
+    /// \param backend Hash backend used to index the voxels.
+    PointCloud FarthestPointDownSample(
+            int64_t num_samples,
+            int64_t start_index = 0,
+            double voxel_size = 0.0,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default) const;
+
+    /// \brief Downsamples a point cloud with Poisson-disk sampling, i.e.
+    /// keeps a subset of points such that no two points are closer than
+    /// \p radius.
+    ///
+    /// Points are bucketed into core::HashSet grid cells of size \p radius,
+    /// and cells are sampled greedily in parallel phases in which no two cells
+    /// are neighbors. Points are visited in a pseudo-random but reproducible
+    /// order. The sampling runs on CPU.
+    ///
+    /// \param radius Minimum distance between two kept points.
+    /// \param backend Hash backend used to index the grid cells.
+    PointCloud PoissonDiskDownSample(double radius,
+                                     const core::HashBackendType &backend =
+                                             core::HashBackendType::Default)
+            const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -419,6 +528,18 @@ public:
             core::Dtype dtype = core::Float32,
             const core::Device &device = core::Device("CPU:0"));
 
+    /// \brief Create a PointCloud that shares memory with a legacy Open3D
+    /// PointCloud, without copying.
+    ///
+    /// Positions, colors and normals are wrapped as Float64 tensors on CPU:0.
+    /// \p pcd_legacy must outlive the returned point cloud, and its point,
+    /// color and normal vectors must not be resized while the point cloud is
+    /// in use. Modifying the attributes in place, e.g. Transform(), also
+    /// modifies \p pcd_legacy. Use FromLegacy() for an independent copy.
+    ///
+    /// \param pcd_legacy Legacy Open3D PointCloud.
+    static PointCloud FromLegacyView(open3d::geometry::PointCloud &pcd_legacy);
+
     /// Convert to a legacy Open3D PointCloud.
     open3d::geometry::PointCloud ToLegacy() const;
 
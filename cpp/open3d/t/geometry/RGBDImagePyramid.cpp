@@ -0,0 +1,197 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RGBDImagePyramid.h"
+
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#include "open3d/t/geometry/kernel/Image.h"
+#include "open3d/utility/Tracing.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+struct RGBDImagePyramid::Impl {
+    int64_t n_levels_;
+    Image color_;
+    std::vector<core::Tensor> intrinsics_;
+    std::vector<Image> depth_;
+    std::vector<Image> vertex_map_;
+
+    std::once_flag normal_map_flag_;
+    std::vector<Image> normal_map_;
+    std::once_flag intensity_flag_;
+    std::vector<Image> intensity_;
+    std::once_flag intensity_gradients_flag_;
+    std::vector<std::pair<Image, Image>> intensity_gradients_;
+    std::once_flag depth_gradients_flag_;
+    std::vector<std::pair<Image, Image>> depth_gradients_;
+
+    int64_t CheckLevel(int64_t level) const {
+        if (level < 0 || level >= n_levels_) {
+            utility::LogError("Level {} out of range [0, {}).", level,
+                              n_levels_);
+        }
+        return level;
+    }
+};
+
+RGBDImagePyramid::RGBDImagePyramid(const RGBDImage &rgbd,
+                                   const core::Tensor &intrinsics,
+                                   int64_t n_levels,
+                                   float depth_scale,
+                                   float depth_max,
+                                   float depth_diff)
+    : impl_(std::make_shared<Impl>()) {
+    OPEN3D_TRACE_ZONE("geometry", "RGBDImagePyramid");
+    if (n_levels <= 0) {
+        utility::LogError("Expected a positive number of levels, but got {}.",
+                          n_levels);
+    }
+    core::AssertTensorShape(intrinsics, {3, 3});
+
+    impl_->n_levels_ = n_levels;
+    impl_->color_ = rgbd.color_;
+    impl_->intrinsics_.resize(n_levels);
+    impl_->depth_.resize(n_levels);
+    impl_->vertex_map_.resize(n_levels);
+
+    // Clone so that the caller's intrinsics are not scaled in place.
+    core::Tensor intrinsics_curr =
+            intrinsics.To(core::Device("CPU:0"), core::Float64).Clone();
+
+    Image depth_curr =
+            rgbd.depth_.ClipTransform(depth_scale, 0, depth_max, NAN);
+    Image vertex_map_curr = depth_curr.CreateVertexMap(intrinsics_curr, NAN);
+    for (int64_t i = 0; i < n_levels; ++i) {
+        const int64_t level = n_levels - 1 - i;
+        impl_->intrinsics_[level] = intrinsics_curr.Clone();
+        impl_->depth_[level] = depth_curr;
+        impl_->vertex_map_[level] = vertex_map_curr;
+        if (i == n_levels - 1) break;
+
+        intrinsics_curr /= 2;
+        intrinsics_curr[-1][-1] = 1;
+
+        const int64_t rows = depth_curr.GetRows() / 2;
+        const int64_t cols = depth_curr.GetCols() / 2;
+        core::Tensor depth_down = core::Tensor::Empty(
+                {rows, cols, 1}, core::Float32, depth_curr.GetDevice());
+        core::Tensor vertex_map_down = core::Tensor::Empty(
+                {rows, cols, 3}, core::Float32, depth_curr.GetDevice());
+        kernel::image::PyrDownDepthVertexMap(
+                depth_curr.AsTensor(), depth_down, vertex_map_down,
+                intrinsics_curr, depth_diff * 2, NAN);
+        depth_curr = Image(depth_down);
+        vertex_map_curr = Image(vertex_map_down);
+    }
+}
+
+int64_t RGBDImagePyramid::GetNumLevels() const { return impl_->n_levels_; }
+
+core::Device RGBDImagePyramid::GetDevice() const {
+    return impl_->depth_[0].GetDevice();
+}
+
+const core::Tensor &RGBDImagePyramid::GetIntrinsics(int64_t level) const {
+    return impl_->intrinsics_[impl_->CheckLevel(level)];
+}
+
+const Image &RGBDImagePyramid::GetDepth(int64_t level) const {
+    return impl_->depth_[impl_->CheckLevel(level)];
+}
+
+const Image &RGBDImagePyramid::GetVertexMap(int64_t level) const {
+    return impl_->vertex_map_[impl_->CheckLevel(level)];
+}
+
+const Image &RGBDImagePyramid::GetNormalMap(int64_t level) const {
+    Impl &impl = *impl_;
+    std::call_once(impl.normal_map_flag_, [&impl]() {
+        OPEN3D_TRACE_ZONE("geometry", "RGBDImagePyramid normal maps");
+        impl.normal_map_.resize(impl.n_levels_);
+        for (int64_t i = 0; i < impl.n_levels_; ++i) {
+            Image depth_smooth = impl.depth_[i].FilterBilateral(5, 5, 10);
+            impl.normal_map_[i] =
+                    depth_smooth.CreateVertexMap(impl.intrinsics_[i], NAN)
+                            .CreateNormalMap(NAN);
+        }
+    });
+    return impl.normal_map_[impl.CheckLevel(level)];
+}
+
+const Image &RGBDImagePyramid::GetIntensity(int64_t level) const {
+    Impl &impl = *impl_;
+    std::call_once(impl.intensity_flag_, [&impl]() {
+        OPEN3D_TRACE_ZONE("geometry", "RGBDImagePyramid intensity");
+        if (impl.color_.IsEmpty()) {
+            utility::LogError(
+                    "A color image is required for the intensity pyramid.");
+        }
+        impl.intensity_.resize(impl.n_levels_);
+        Image intensity_curr = impl.color_.RGBToGray().To(core::Float32);
+        for (int64_t i = impl.n_levels_ - 1; i >= 0; --i) {
+            impl.intensity_[i] = intensity_curr;
+            if (i != 0) {
+                intensity_curr = intensity_curr.PyrDown();
+            }
+        }
+    });
+    return impl.intensity_[impl.CheckLevel(level)];
+}
+
+const std::pair<Image, Image> &RGBDImagePyramid::GetIntensityGradients(
+        int64_t level) const {
+    Impl &impl = *impl_;
+    std::call_once(impl.intensity_gradients_flag_, [this, &impl]() {
+        OPEN3D_TRACE_ZONE("geometry", "RGBDImagePyramid intensity gradients");
+        impl.intensity_gradients_.resize(impl.n_levels_);
+        for (int64_t i = 0; i < impl.n_levels_; ++i) {
+            impl.intensity_gradients_[i] = GetIntensity(i).FilterSobel();
+        }
+    });
+    return impl.intensity_gradients_[impl.CheckLevel(level)];
+}
+
+const std::pair<Image, Image> &RGBDImagePyramid::GetDepthGradients(
+        int64_t level) const {
+    Impl &impl = *impl_;
+    std::call_once(impl.depth_gradients_flag_, [&impl]() {
+        OPEN3D_TRACE_ZONE("geometry", "RGBDImagePyramid depth gradients");
+        impl.depth_gradients_.resize(impl.n_levels_);
+        for (int64_t i = 0; i < impl.n_levels_; ++i) {
+            impl.depth_gradients_[i] = impl.depth_[i].FilterSobel();
+        }
+    });
+    return impl.depth_gradients_[impl.CheckLevel(level)];
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/RGBDImage.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class RGBDImagePyramid
+///
+/// \brief Multi-resolution representation of an RGBD frame for multi-scale
+/// RGBD odometry. Levels are ordered from coarse (level 0) to fine (level
+/// GetNumLevels() - 1), matching the order of the convergence criteria.
+///
+/// The metric depth and vertex map of every level are computed on
+/// construction; each coarser level is down sampled and unprojected in a
+/// single pass. Normal maps, intensity images and image gradients are computed
+/// on first access and cached, so that a frame used as the source of one
+/// odometry call and as the target of the next one is preprocessed only once.
+/// Accessors are thread safe. Copies are shallow and share the cache.
+class RGBDImagePyramid {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param rgbd RGBD image. The color image may be empty if only depth
+    /// based odometry is used.
+    /// \param intrinsics (3, 3) intrinsic matrix of the full resolution.
+    /// \param n_levels Number of pyramid levels.
+    /// \param depth_scale Converts depth pixel values to meters by dividing
+    /// the scale factor.
+    /// \param depth_max Max depth to truncate depth image with noisy
+    /// measurements.
+    /// \param depth_diff Depth difference threshold used to filter projective
+    /// associations. Twice the value is used to down sample depth.
+    RGBDImagePyramid(const RGBDImage &rgbd,
+                     const core::Tensor &intrinsics,
+                     int64_t n_levels = 3,
+                     float depth_scale = 1000.0f,
+                     float depth_max = 3.0f,
+                     float depth_diff = 0.07f);
+
+    int64_t GetNumLevels() const;
+
+    /// Device of the image data.
+    core::Device GetDevice() const;
+
+    /// (3, 3) Float64 intrinsic matrix on CPU of \p level.
+    const core::Tensor &GetIntrinsics(int64_t level) const;
+
+    /// Float32 depth in meters of \p level, invalid pixels are NaN.
+    const Image &GetDepth(int64_t level) const;
+
+    /// (rows, cols, 3) Float32 vertex map of \p level, invalid pixels are NaN.
+    const Image &GetVertexMap(int64_t level) const;
+
+    /// (rows, cols, 3) Float32 normal map of \p level, estimated from the
+    /// bilateral filtered depth. Computed for all levels on first access.
+    const Image &GetNormalMap(int64_t level) const;
+
+    /// Float32 intensity of \p level. Computed for all levels on first
+    /// access. Requires a color image.
+    const Image &GetIntensity(int64_t level) const;
+
+    /// Sobel gradients (dx, dy) of GetIntensity(level). Computed for all
+    /// levels on first access.
+    const std::pair<Image, Image> &GetIntensityGradients(int64_t level) const;
+
+    /// Sobel gradients (dx, dy) of GetDepth(level). Computed for all levels on
+    /// first access.
+    const std::pair<Image, Image> &GetDepthGradients(int64_t level) const;
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
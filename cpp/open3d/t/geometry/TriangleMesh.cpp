@@ -27,15 +27,21 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 
 #include <Eigen/Core>
+#include <cmath>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
 
 namespace open3d {
 namespace t {
@@ -164,6 +170,693 @@ TriangleMesh &TriangleMesh::Rotate(const core::Tensor &R,
     return *this;
 }
 
+TriangleMesh TriangleMesh::SelectByMask(const core::Tensor &vertex_mask) const {
+    core::AssertTensorShape(vertex_mask, {GetVertexPositions().GetLength()});
+    core::AssertTensorDtype(vertex_mask, core::Bool);
+    core::AssertTensorDevice(vertex_mask, GetDevice());
+
+    TriangleMesh mesh(device_);
+    const core::Tensor vertex_indices = vertex_mask.NonZero().Reshape({-1});
+    for (const auto &kv : vertex_attr_) {
+        mesh.SetVertexAttr(kv.first, kv.second.IndexGet({vertex_indices}));
+    }
+    if (!HasTriangleIndices()) {
+        return mesh;
+    }
+
+    core::Tensor remapped, triangle_mask;
+    kernel::trianglemesh::SelectTrianglesByVertexMask(
+            GetTriangleIndices().To(core::Int64), vertex_mask, remapped,
+            triangle_mask);
+    const core::Tensor triangle_indices = triangle_mask.NonZero().Reshape({-1});
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first == "indices") {
+            mesh.SetTriangleIndices(remapped.IndexGet({triangle_indices})
+                                            .To(kv.second.GetDtype()));
+        } else {
+            mesh.SetTriangleAttr(kv.first,
+                                 kv.second.IndexGet({triangle_indices}));
+        }
+    }
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::SelectByIndex(const core::Tensor &indices) const {
+    core::AssertTensorShape(indices, {utility::nullopt});
+    core::AssertTensorDtypes(indices, {core::Int32, core::Int64});
+    core::AssertTensorDevice(indices, GetDevice());
+
+    // IndexSet does not support Bool, mark the indices in UInt8.
+    core::Tensor mask = core::Tensor::Zeros({GetVertexPositions().GetLength()},
+                                            core::UInt8, GetDevice());
+    mask.IndexSet({indices.To(core::Int64)},
+                  core::Tensor::Ones({indices.GetLength()}, core::UInt8,
+                                     GetDevice()));
+    return SelectByMask(mask.To(core::Bool));
+}
+
+TriangleMesh TriangleMesh::Crop(const AxisAlignedBoundingBox &aabb,
+                                bool invert) const {
+    core::AssertTensorDevice(aabb.GetMinBound(), GetDevice());
+    core::Tensor mask =
+            aabb.GetPointMaskWithinBoundingBox(GetVertexPositions());
+    return SelectByMask(invert ? mask.LogicalNot() : mask);
+}
+
+TriangleMesh TriangleMesh::Crop(const OrientedBoundingBox &obb,
+                                bool invert) const {
+    core::AssertTensorDevice(obb.GetCenter(), GetDevice());
+    core::Tensor mask = obb.GetPointMaskWithinBoundingBox(GetVertexPositions());
+    return SelectByMask(invert ? mask.LogicalNot() : mask);
+}
+
+AxisAlignedBoundingBox TriangleMesh::GetAxisAlignedBoundingBox() const {
+    return AxisAlignedBoundingBox::CreateFromPoints(GetVertexPositions());
+}
+
+OrientedBoundingBox TriangleMesh::GetOrientedBoundingBox() const {
+    return OrientedBoundingBox::CreateFromPoints(GetVertexPositions());
+}
+
+TriangleMesh TriangleMesh::SimplifyVertexClustering(
+        double voxel_size, const core::HashBackendType &backend) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    TriangleMesh mesh(device_);
+    if (!HasVertexPositions()) {
+        utility::LogWarning("TriangleMesh has no vertices.");
+        return mesh;
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+
+    core::Tensor keys = (positions / voxel_size).Floor().To(core::Int64);
+    core::HashSet hashset(keys.GetLength(), core::Int64, {3}, device_, backend);
+    core::Tensor cluster_ids = CompactHashIndices(hashset, keys);
+    const int64_t num_clusters = hashset.Size();
+
+    core::Tensor splits, members;
+    kernel::pointcloud::GroupByVoxel(cluster_ids, num_clusters, splits,
+                                     members);
+    core::Tensor means;
+    kernel::pointcloud::VoxelMean(splits, members, positions, utility::nullopt,
+                                  means);
+    for (const auto &kv : vertex_attr_) {
+        if (kv.first == "positions") {
+            continue;
+        }
+        core::Tensor reduced;
+        kernel::pointcloud::VoxelMean(splits, members, kv.second,
+                                      utility::nullopt, reduced);
+        mesh.SetVertexAttr(kv.first, reduced);
+    }
+
+    if (!HasTriangleIndices()) {
+        mesh.SetVertexPositions(means);
+        return mesh;
+    }
+    const core::Tensor triangles = GetTriangleIndices().To(core::Int64);
+
+    // Group the triangle corners by cluster to sum the quadrics of all
+    // triangles incident to a cluster without atomics.
+    core::Tensor corner_splits, corner_members;
+    kernel::pointcloud::GroupByVoxel(
+            cluster_ids.IndexGet({triangles.Reshape({-1})}), num_clusters,
+            corner_splits, corner_members);
+    core::Tensor cluster_positions;
+    kernel::trianglemesh::ClusterQuadricPositions(
+            positions, triangles, corner_splits, corner_members, means,
+            std::sqrt(3.0) * voxel_size, cluster_positions);
+    mesh.SetVertexPositions(cluster_positions);
+
+    core::Tensor clustered, valid;
+    kernel::trianglemesh::ClusterTriangles(triangles, cluster_ids, clustered,
+                                           valid);
+    core::Tensor candidates = valid.NonZero().Reshape({-1});
+    core::Tensor kept = candidates;
+    if (candidates.GetLength() > 0) {
+        core::HashSet triangle_hashset(candidates.GetLength(), core::Int64,
+                                       {3}, device_, backend);
+        core::Tensor buf_indices, masks;
+        triangle_hashset.Insert(clustered.IndexGet({candidates}), buf_indices,
+                                masks);
+        kept = candidates.IndexGet({masks});
+    }
+    mesh.SetTriangleIndices(clustered.IndexGet({kept}).To(
+            GetTriangleIndices().GetDtype()));
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first != "indices") {
+            mesh.SetTriangleAttr(kv.first, kv.second.IndexGet({kept}));
+        }
+    }
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::SimplifyQuadricDecimation(
+        double target_reduction,
+        double maximum_error,
+        double boundary_weight) const {
+    if (target_reduction < 0 || target_reduction >= 1) {
+        utility::LogError("target_reduction must be in [0, 1), but got {}.",
+                          target_reduction);
+    }
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        utility::LogWarning("TriangleMesh has no vertices or triangles.");
+        return Clone();
+    }
+
+    static const core::Device host("CPU:0");
+    core::Tensor vertices =
+            GetVertexPositions().To(host, core::Float64, /*copy=*/true);
+    core::Tensor triangles =
+            GetTriangleIndices().To(host, core::Int64, /*copy=*/true);
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t target_number_of_triangles = static_cast<int64_t>(
+            std::ceil((1 - target_reduction) * triangles.GetLength()));
+
+    core::Tensor vertex_mask, triangle_mask;
+    kernel::trianglemesh::SimplifyQuadricDecimationCPU(
+            vertices, triangles, target_number_of_triangles, maximum_error,
+            boundary_weight, vertex_mask, triangle_mask);
+
+    core::Tensor vertex_indices = vertex_mask.NonZero().Reshape({-1});
+    core::Tensor triangle_indices = triangle_mask.NonZero().Reshape({-1});
+    core::Tensor vertex_remap =
+            core::Tensor::Full({num_vertices}, -1, core::Int64, host);
+    vertex_remap.IndexSet({vertex_indices},
+                          core::Tensor::Arange(0, vertex_indices.GetLength(),
+                                               1, core::Int64, host));
+    core::Tensor new_triangles =
+            vertex_remap
+                    .IndexGet({triangles.IndexGet({triangle_indices})
+                                       .Reshape({-1})})
+                    .Reshape({-1, 3});
+
+    TriangleMesh mesh(device_);
+    const core::Tensor vertex_indices_d = vertex_indices.To(device_);
+    const core::Tensor triangle_indices_d = triangle_indices.To(device_);
+    for (const auto &kv : vertex_attr_) {
+        if (kv.first == "positions") {
+            mesh.SetVertexPositions(
+                    vertices.IndexGet({vertex_indices})
+                            .To(device_, kv.second.GetDtype()));
+        } else {
+            mesh.SetVertexAttr(kv.first,
+                               kv.second.IndexGet({vertex_indices_d}));
+        }
+    }
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first == "indices") {
+            mesh.SetTriangleIndices(
+                    new_triangles.To(device_, kv.second.GetDtype()));
+        } else {
+            mesh.SetTriangleAttr(kv.first,
+                                 kv.second.IndexGet({triangle_indices_d}));
+        }
+    }
+    return mesh;
+}
+
+/// Legacy mesh with only the vertex positions and triangle indices, which is
+/// all the intersection tests need.
+static open3d::geometry::TriangleMesh ToLegacyPositionsAndIndices(
+        const TriangleMesh &mesh) {
+    open3d::geometry::TriangleMesh mesh_legacy;
+    if (mesh.HasVertexPositions()) {
+        mesh_legacy.vertices_ =
+                core::eigen_converter::TensorToEigenVector3dVector(
+                        mesh.GetVertexPositions());
+    }
+    if (mesh.HasTriangleIndices()) {
+        mesh_legacy.triangles_ =
+                core::eigen_converter::TensorToEigenVector3iVector(
+                        mesh.GetTriangleIndices());
+    }
+    return mesh_legacy;
+}
+
+core::Tensor TriangleMesh::GetSelfIntersectingTriangles() const {
+    std::vector<Eigen::Vector2i> pairs =
+            ToLegacyPositionsAndIndices(*this).GetSelfIntersectingTriangles();
+    return core::eigen_converter::EigenVector2iVectorToTensor(
+            pairs, core::Int64, device_);
+}
+
+bool TriangleMesh::IsSelfIntersecting() const {
+    return ToLegacyPositionsAndIndices(*this).IsSelfIntersecting();
+}
+
+bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
+    if (!HasTriangleIndices() || !other.HasTriangleIndices()) {
+        return false;
+    }
+    return ToLegacyPositionsAndIndices(*this).IsIntersecting(
+            ToLegacyPositionsAndIndices(other));
+}
+
+/// Int64 triangle indices of \p mesh, or an empty (0, 3) tensor.
+static core::Tensor GetTriangleIndicesInt64(const TriangleMesh &mesh) {
+    if (!mesh.HasTriangleIndices()) {
+        return core::Tensor::Empty({0, 3}, core::Int64, mesh.GetDevice());
+    }
+    return mesh.GetTriangleIndices().To(core::Int64);
+}
+
+std::tuple<core::Tensor, core::Tensor> TriangleMesh::ComputeVertexAdjacency()
+        const {
+    const int64_t num_vertices =
+            HasVertexPositions() ? GetVertexPositions().GetLength() : 0;
+    core::Tensor splits, neighbors;
+    kernel::trianglemesh::ComputeVertexAdjacency(
+            GetTriangleIndicesInt64(*this), num_vertices, splits, neighbors);
+    return std::make_tuple(splits, neighbors);
+}
+
+/// Runs \p number_of_passes passes of a vertex filter over the positions of
+/// \p mesh, and over its vertex normals and colors if they are present and
+/// of a float dtype. Each attribute has two buffers, and every pass calls
+/// filter_pass(pass, splits, neighbors, values, filtered) to write all of
+/// filtered from values before the buffers are swapped.
+template <typename FilterPassFunc>
+static TriangleMesh FilterVertexAttributes(const TriangleMesh &mesh,
+                                           int number_of_passes,
+                                           FilterPassFunc filter_pass) {
+    TriangleMesh filtered_mesh = mesh.Clone();
+    if (!mesh.HasVertexPositions() || number_of_passes <= 0) {
+        return filtered_mesh;
+    }
+    core::Tensor splits, neighbors;
+    std::tie(splits, neighbors) = mesh.ComputeVertexAdjacency();
+
+    const int64_t num_vertices = mesh.GetVertexPositions().GetLength();
+    std::vector<std::string> keys = {"positions"};
+    for (const std::string key : {"normals", "colors"}) {
+        if (!mesh.HasVertexAttr(key)) continue;
+        const core::Tensor &attr = mesh.GetVertexAttr(key);
+        if ((attr.GetDtype() == core::Float32 ||
+             attr.GetDtype() == core::Float64) &&
+            attr.NumDims() == 2 && attr.GetLength() == num_vertices) {
+            keys.push_back(key);
+        }
+    }
+
+    std::vector<core::Tensor> values, filtered;
+    for (const std::string &key : keys) {
+        values.push_back(filtered_mesh.GetVertexAttr(key).Contiguous());
+        filtered.push_back(core::Tensor::Empty(values.back().GetShape(),
+                                               values.back().GetDtype(),
+                                               values.back().GetDevice()));
+    }
+    for (int pass = 0; pass < number_of_passes; ++pass) {
+        filter_pass(pass, splits, neighbors, values, filtered);
+        std::swap(values, filtered);
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+        filtered_mesh.SetVertexAttr(keys[i], values[i]);
+    }
+    return filtered_mesh;
+}
+
+TriangleMesh TriangleMesh::FilterSharpen(int number_of_iterations,
+                                         double strength) const {
+    return FilterVertexAttributes(
+            *this, number_of_iterations,
+            [&](int, const core::Tensor &splits, const core::Tensor &neighbors,
+                const std::vector<core::Tensor> &values,
+                std::vector<core::Tensor> &filtered) {
+                for (size_t i = 0; i < values.size(); ++i) {
+                    kernel::trianglemesh::FilterSharpen(
+                            splits, neighbors, values[i], strength,
+                            filtered[i]);
+                }
+            });
+}
+
+TriangleMesh TriangleMesh::FilterSmoothSimple(int number_of_iterations) const {
+    return FilterVertexAttributes(
+            *this, number_of_iterations,
+            [&](int, const core::Tensor &splits, const core::Tensor &neighbors,
+                const std::vector<core::Tensor> &values,
+                std::vector<core::Tensor> &filtered) {
+                for (size_t i = 0; i < values.size(); ++i) {
+                    kernel::trianglemesh::FilterSmoothSimple(
+                            splits, neighbors, values[i], filtered[i]);
+                }
+            });
+}
+
+/// Laplacian smoothing passes with the step sizes in \p steps applied in
+/// turn. The weights are recomputed from the current positions in each pass.
+static TriangleMesh FilterSmoothLaplacianPasses(
+        const TriangleMesh &mesh,
+        int number_of_passes,
+        const std::vector<double> &steps,
+        bool use_cotangent_weights) {
+    const core::Tensor triangles = GetTriangleIndicesInt64(mesh);
+    return FilterVertexAttributes(
+            mesh, number_of_passes,
+            [&](int pass, const core::Tensor &splits,
+                const core::Tensor &neighbors,
+                const std::vector<core::Tensor> &values,
+                std::vector<core::Tensor> &filtered) {
+                // values[0] holds the positions.
+                core::Tensor weights;
+                if (use_cotangent_weights) {
+                    kernel::trianglemesh::ComputeCotangentWeights(
+                            values[0], triangles, splits, neighbors, weights);
+                } else {
+                    kernel::trianglemesh::ComputeInverseDistanceWeights(
+                            values[0], splits, neighbors, weights);
+                }
+                const double step = steps[pass % steps.size()];
+                for (size_t i = 0; i < values.size(); ++i) {
+                    kernel::trianglemesh::FilterSmoothLaplacian(
+                            splits, neighbors, weights, values[i], step,
+                            filtered[i]);
+                }
+            });
+}
+
+TriangleMesh TriangleMesh::FilterSmoothLaplacian(
+        int number_of_iterations,
+        double lambda,
+        bool use_cotangent_weights) const {
+    return FilterSmoothLaplacianPasses(*this, number_of_iterations, {lambda},
+                                       use_cotangent_weights);
+}
+
+TriangleMesh TriangleMesh::FilterSmoothTaubin(
+        int number_of_iterations,
+        double lambda,
+        double mu,
+        bool use_cotangent_weights) const {
+    return FilterSmoothLaplacianPasses(*this, 2 * number_of_iterations,
+                                       {lambda, mu}, use_cotangent_weights);
+}
+
+/// Groups the triangle corners (3 * triangle + k) of \p triangles by vertex.
+static void GroupCornersByVertex(const core::Tensor &triangles,
+                                 int64_t num_vertices,
+                                 core::Tensor &corner_splits,
+                                 core::Tensor &corner_members) {
+    kernel::pointcloud::GroupByVoxel(
+            triangles.Reshape({triangles.NumElements()}), num_vertices,
+            corner_splits, corner_members);
+}
+
+TriangleMesh &TriangleMesh::ComputeTriangleNormals(bool normalized) {
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        utility::LogWarning("TriangleMesh has no vertices or triangles.");
+        return *this;
+    }
+    core::Tensor normals;
+    kernel::trianglemesh::ComputeTriangleNormals(
+            GetVertexPositions(), GetTriangleIndicesInt64(*this), normalized,
+            normals);
+    SetTriangleNormals(normals);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized,
+                                                 bool angle_weighted) {
+    if (!HasVertexPositions()) {
+        utility::LogWarning("TriangleMesh has no vertices.");
+        return *this;
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    const core::Tensor triangles = GetTriangleIndicesInt64(*this);
+    core::Tensor corner_splits, corner_members, normals;
+    GroupCornersByVertex(triangles, positions.GetLength(), corner_splits,
+                         corner_members);
+    kernel::trianglemesh::ComputeVertexNormals(positions, triangles,
+                                               corner_splits, corner_members,
+                                               angle_weighted, normalized,
+                                               normals);
+    SetVertexNormals(normals);
+    return *this;
+}
+
+core::Tensor TriangleMesh::ComputeVertexAreas() const {
+    if (!HasVertexPositions()) {
+        return core::Tensor::Empty({0}, core::Float32, device_);
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    const core::Tensor triangles = GetTriangleIndicesInt64(*this);
+    core::Tensor corner_splits, corner_members, areas;
+    GroupCornersByVertex(triangles, positions.GetLength(), corner_splits,
+                         corner_members);
+    kernel::trianglemesh::ComputeVertexAreas(
+            positions, triangles, corner_splits, corner_members, areas);
+    return areas;
+}
+
+std::tuple<core::Tensor, core::Tensor> TriangleMesh::ComputeVertexCurvatures()
+        const {
+    if (!HasVertexPositions()) {
+        return std::make_tuple(
+                core::Tensor::Empty({0}, core::Float32, device_),
+                core::Tensor::Empty({0}, core::Float32, device_));
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    const core::Tensor triangles = GetTriangleIndicesInt64(*this);
+    core::Tensor corner_splits, corner_members, mean, gaussian;
+    GroupCornersByVertex(triangles, positions.GetLength(), corner_splits,
+                         corner_members);
+    kernel::trianglemesh::ComputeVertexCurvatures(positions, triangles,
+                                                  corner_splits,
+                                                  corner_members, mean,
+                                                  gaussian);
+    return std::make_tuple(mean, gaussian);
+}
+
+/// Returns for each row of the Int32 or Int64 \p keys the index of the
+/// first row with the same key.
+static core::Tensor FirstOccurrences(const core::Tensor &keys,
+                                     const core::HashBackendType &backend) {
+    const core::Device device = keys.GetDevice();
+    const int64_t n = keys.GetLength();
+    core::HashSet hashset(n, keys.GetDtype(), {keys.GetShape(1)}, device,
+                          backend);
+    const core::Tensor ids = CompactHashIndices(hashset, keys);
+    core::Tensor splits, members, first;
+    kernel::pointcloud::GroupByVoxel(ids, hashset.Size(), splits, members);
+    // With equal scores the smallest member of each group wins.
+    kernel::pointcloud::VoxelArgMax(
+            splits, members, core::Tensor::Zeros({n}, core::UInt8, device),
+            first);
+    return first.IndexGet({ids});
+}
+
+/// Returns the indices of the rows that are the first of their key, in order.
+static core::Tensor FirstOccurrenceIndices(const core::Tensor &first) {
+    const int64_t n = first.GetLength();
+    return first
+            .Eq(core::Tensor::Arange(0, n, 1, core::Int64, first.GetDevice()))
+            .NonZero()
+            .Reshape({-1});
+}
+
+/// Copy of \p mesh with only the triangles \p triangle_indices.
+static TriangleMesh SelectTriangles(const TriangleMesh &mesh,
+                                    const core::Tensor &triangle_indices) {
+    TriangleMesh selected(mesh.GetDevice());
+    for (const auto &kv : mesh.GetVertexAttr()) {
+        selected.SetVertexAttr(kv.first, kv.second.Clone());
+    }
+    for (const auto &kv : mesh.GetTriangleAttr()) {
+        selected.SetTriangleAttr(kv.first,
+                                 kv.second.IndexGet({triangle_indices}));
+    }
+    return selected;
+}
+
+TriangleMesh TriangleMesh::RemoveDuplicatedVertices(
+        const core::HashBackendType &backend) const {
+    if (!HasVertexPositions() || GetVertexPositions().GetLength() == 0) {
+        return Clone();
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    core::AssertTensorShape(positions, {utility::nullopt, 3});
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    const int64_t num_vertices = positions.GetLength();
+
+    // Hash the bit patterns of the positions. Adding zero turns -0 into +0,
+    // which compare equal, and gives a contiguous copy to reinterpret.
+    core::Tensor values = positions.Add(0.0);
+    const core::Tensor keys(
+            values.GetShape(), values.GetStrides(), values.GetDataPtr(),
+            values.GetDtype() == core::Float32 ? core::Int32 : core::Int64,
+            values.GetBlob());
+    const core::Tensor first = FirstOccurrences(keys, backend);
+    const core::Tensor kept = FirstOccurrenceIndices(first);
+
+    core::Tensor compact =
+            core::Tensor::Empty({num_vertices}, core::Int64, device_);
+    compact.IndexSet({kept}, core::Tensor::Arange(0, kept.GetLength(), 1,
+                                                  core::Int64, device_));
+    const core::Tensor remap = compact.IndexGet({first});
+
+    TriangleMesh mesh(device_);
+    for (const auto &kv : vertex_attr_) {
+        mesh.SetVertexAttr(kv.first, kv.second.IndexGet({kept}));
+    }
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first == "indices") {
+            const core::Tensor triangles = kv.second.To(core::Int64);
+            mesh.SetTriangleIndices(
+                    remap.IndexGet({triangles.Reshape({-1})})
+                            .Reshape(triangles.GetShape())
+                            .To(kv.second.GetDtype()));
+        } else {
+            mesh.SetTriangleAttr(kv.first, kv.second.Clone());
+        }
+    }
+    utility::LogDebug(
+            "[RemoveDuplicatedVertices] {:d} vertices have been removed.",
+            num_vertices - kept.GetLength());
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::RemoveDuplicatedTriangles(
+        const core::HashBackendType &backend) const {
+    if (!HasVertexPositions() || !HasTriangleIndices() ||
+        GetTriangleIndices().GetLength() == 0) {
+        return Clone();
+    }
+    const int64_t num_triangles = GetTriangleIndices().GetLength();
+
+    // Rotate the smallest index of each triangle to the front, keeping the
+    // orientation, so that duplicates have identical keys.
+    core::Tensor keys, valid;
+    kernel::trianglemesh::ClusterTriangles(
+            GetTriangleIndicesInt64(*this),
+            core::Tensor::Arange(0, GetVertexPositions().GetLength(), 1,
+                                 core::Int64, device_),
+            keys, valid);
+    const core::Tensor kept =
+            FirstOccurrenceIndices(FirstOccurrences(keys, backend));
+    utility::LogDebug(
+            "[RemoveDuplicatedTriangles] {:d} triangles have been removed.",
+            num_triangles - kept.GetLength());
+    return SelectTriangles(*this, kept);
+}
+
+TriangleMesh TriangleMesh::RemoveUnreferencedVertices() const {
+    if (!HasVertexPositions()) {
+        return Clone();
+    }
+    const core::Tensor triangles = GetTriangleIndicesInt64(*this);
+    if (triangles.GetLength() == 0) {
+        return SelectByMask(core::Tensor::Zeros(
+                {GetVertexPositions().GetLength()}, core::Bool, device_));
+    }
+    return SelectByIndex(triangles.Reshape({-1}));
+}
+
+TriangleMesh TriangleMesh::RemoveDegenerateTriangles() const {
+    if (!HasTriangleIndices()) {
+        return Clone();
+    }
+    const core::Tensor &triangles = GetTriangleIndices();
+    const core::Tensor v0 = triangles.Slice(1, 0, 1);
+    const core::Tensor v1 = triangles.Slice(1, 1, 2);
+    const core::Tensor v2 = triangles.Slice(1, 2, 3);
+    const core::Tensor valid = v0.Ne(v1)
+                                       .LogicalAnd(v1.Ne(v2))
+                                       .LogicalAnd(v0.Ne(v2))
+                                       .Reshape({-1});
+    return SelectTriangles(*this, valid.NonZero().Reshape({-1}));
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+TriangleMesh::ComputeEdgeToTriangles() const {
+    const int64_t num_vertices =
+            HasVertexPositions() ? GetVertexPositions().GetLength() : 0;
+    core::Tensor edges, splits, edge_triangles;
+    kernel::trianglemesh::ComputeEdgeTriangles(GetTriangleIndicesInt64(*this),
+                                               num_vertices, edges, splits,
+                                               edge_triangles);
+    return std::make_tuple(edges, splits, edge_triangles);
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+TriangleMesh::ClusterConnectedTriangles() const {
+    const core::Tensor triangles = GetTriangleIndicesInt64(*this);
+    const int64_t num_triangles = triangles.GetLength();
+    if (!HasVertexPositions() || num_triangles == 0) {
+        return std::make_tuple(
+                core::Tensor::Empty({0}, core::Int64, device_),
+                core::Tensor::Empty({0}, core::Int64, device_),
+                core::Tensor::Empty({0}, core::Float64, device_));
+    }
+    core::Tensor edges, splits, edge_triangles, labels;
+    std::tie(edges, splits, edge_triangles) = ComputeEdgeToTriangles();
+    kernel::trianglemesh::LabelConnectedTriangles(splits, edge_triangles,
+                                                  num_triangles, labels);
+
+    // The label of a cluster is its smallest triangle, so numbering the
+    // labels in order numbers the clusters by their first triangle.
+    const core::Tensor roots = FirstOccurrenceIndices(labels);
+    const int64_t num_clusters = roots.GetLength();
+    core::Tensor compact =
+            core::Tensor::Empty({num_triangles}, core::Int64, device_);
+    compact.IndexSet({roots}, core::Tensor::Arange(0, num_clusters, 1,
+                                                   core::Int64, device_));
+    const core::Tensor clusters = compact.IndexGet({labels});
+
+    core::Tensor cluster_splits, cluster_members, normals, mean_areas;
+    kernel::pointcloud::GroupByVoxel(clusters, num_clusters, cluster_splits,
+                                     cluster_members);
+    const core::Tensor counts = cluster_splits.Slice(0, 1, num_clusters + 1) -
+                                cluster_splits.Slice(0, 0, num_clusters);
+    kernel::trianglemesh::ComputeTriangleNormals(
+            GetVertexPositions(), triangles, /*normalized=*/false, normals);
+    normals = normals.To(core::Float64);
+    const core::Tensor areas = (normals * normals).Sum({1}).Sqrt() * 0.5;
+    kernel::pointcloud::VoxelMean(cluster_splits, cluster_members, areas,
+                                  utility::nullopt, mean_areas);
+    return std::make_tuple(clusters, counts,
+                           mean_areas * counts.To(core::Float64));
+}
+
+core::Tensor TriangleMesh::GetNonManifoldEdges(
+        bool allow_boundary_edges) const {
+    core::Tensor edges, splits, edge_triangles;
+    std::tie(edges, splits, edge_triangles) = ComputeEdgeToTriangles();
+    const int64_t num_edges = edges.GetLength();
+    const core::Tensor counts =
+            splits.Slice(0, 1, num_edges + 1) - splits.Slice(0, 0, num_edges);
+    const core::Tensor mask =
+            allow_boundary_edges ? counts.Gt(2) : counts.Ne(2);
+    return edges.IndexGet({mask});
+}
+
+bool TriangleMesh::IsEdgeManifold(bool allow_boundary_edges) const {
+    return GetNonManifoldEdges(allow_boundary_edges).GetLength() == 0;
+}
+
+core::Tensor TriangleMesh::GetNonManifoldVertices() const {
+    if (!HasVertexPositions()) {
+        return core::Tensor::Empty({0}, core::Int64, device_);
+    }
+    const core::Tensor triangles = GetTriangleIndicesInt64(*this);
+    core::Tensor corner_splits, corner_members, non_manifold;
+    GroupCornersByVertex(triangles, GetVertexPositions().GetLength(),
+                         corner_splits, corner_members);
+    kernel::trianglemesh::ComputeNonManifoldVertices(
+            triangles, corner_splits, corner_members, non_manifold);
+    return non_manifold.NonZero().Reshape({-1});
+}
+
+bool TriangleMesh::IsVertexManifold() const {
+    return GetNonManifoldVertices().GetLength() == 0;
+}
+
+bool TriangleMesh::IsWatertight() const {
+    return IsEdgeManifold(false) && IsVertexManifold() && !IsSelfIntersecting();
+}
+
 geometry::TriangleMesh TriangleMesh::FromLegacy(
         const open3d::geometry::TriangleMesh &mesh_legacy,
         core::Dtype float_dtype,
@@ -208,6 +901,38 @@ geometry::TriangleMesh TriangleMesh::FromLegacy(
     return mesh;
 }
 
+geometry::TriangleMesh TriangleMesh::FromLegacyView(
+        open3d::geometry::TriangleMesh &mesh_legacy) {
+    TriangleMesh mesh(core::Device("CPU:0"));
+    if (mesh_legacy.HasVertices()) {
+        mesh.SetVertexPositions(
+                core::eigen_converter::EigenVector3dVectorAsTensor(
+                        mesh_legacy.vertices_));
+    } else {
+        utility::LogWarning("Creating from empty legacy TriangleMesh.");
+    }
+    if (mesh_legacy.HasVertexColors()) {
+        mesh.SetVertexColors(core::eigen_converter::EigenVector3dVectorAsTensor(
+                mesh_legacy.vertex_colors_));
+    }
+    if (mesh_legacy.HasVertexNormals()) {
+        mesh.SetVertexNormals(
+                core::eigen_converter::EigenVector3dVectorAsTensor(
+                        mesh_legacy.vertex_normals_));
+    }
+    if (mesh_legacy.HasTriangles()) {
+        mesh.SetTriangleIndices(
+                core::eigen_converter::EigenVector3iVectorAsTensor(
+                        mesh_legacy.triangles_));
+    }
+    if (mesh_legacy.HasTriangleNormals()) {
+        mesh.SetTriangleNormals(
+                core::eigen_converter::EigenVector3dVectorAsTensor(
+                        mesh_legacy.triangle_normals_));
+    }
+    return mesh;
+}
+
 open3d::geometry::TriangleMesh TriangleMesh::ToLegacy() const {
     open3d::geometry::TriangleMesh mesh_legacy;
     if (HasVertexPositions()) {
@@ -26,9 +26,14 @@
 
 #pragma once
 
+#include <limits>
+#include <tuple>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/hashmap/HashMap.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/BoundingVolume.h"
 #include "open3d/t/geometry/DrawableGeometry.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/TensorMap.h"
@@ -428,6 +433,285 @@ public:
     /// \return Rotated TriangleMesh
     TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Select the vertices with a boolean mask, and the triangles whose
+    /// three vertices are selected.
+    ///
+    /// The selected vertices are compacted in their original order and the
+    /// triangle indices are remapped accordingly. Vertex and triangle
+    /// attributes are selected consistently.
+    ///
+    /// \param vertex_mask Bool tensor of shape {num_vertices} on the same
+    /// device as the mesh.
+    /// \return The selected TriangleMesh.
+    TriangleMesh SelectByMask(const core::Tensor &vertex_mask) const;
+
+    /// \brief Select the vertices with the given indices, and the triangles
+    /// whose three vertices are selected. Same as SelectByMask(), repeated
+    /// indices select a vertex once.
+    ///
+    /// \param indices Int32 or Int64 vertex indices of shape {K} on the same
+    /// device as the mesh.
+    /// \return The selected TriangleMesh.
+    TriangleMesh SelectByIndex(const core::Tensor &indices) const;
+
+    /// \brief Crops the mesh to the vertices inside an axis aligned box,
+    /// boundary included, and the triangles between them.
+    /// \param aabb The box, on the same device as the mesh.
+    /// \param invert If true, keep the vertices outside the box instead.
+    TriangleMesh Crop(const AxisAlignedBoundingBox &aabb,
+                      bool invert = false) const;
+
+    /// \brief Crops the mesh to the vertices inside an oriented box,
+    /// boundary included, and the triangles between them.
+    /// \param obb The box, on the same device as the mesh.
+    /// \param invert If true, keep the vertices outside the box instead.
+    TriangleMesh Crop(const OrientedBoundingBox &obb,
+                      bool invert = false) const;
+
+    /// Returns the axis aligned bounding box of the vertices.
+    AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const;
+
+    /// Returns an oriented bounding box of the vertices, aligned with their
+    /// principal axes.
+    OrientedBoundingBox GetOrientedBoundingBox() const;
+
+    /// \brief Simplifies the mesh by clustering the vertices on a voxel grid.
+    ///
+    /// All vertices falling into the same voxel are merged into a single
+    /// vertex placed at the minimum of the summed quadric error of the
+    /// incident triangle planes, or at the mean position where the quadric is
+    /// singular. Other floating point vertex attributes are averaged, integer
+    /// and Bool ones take the value of the vertex with the smallest index.
+    /// Degenerate and duplicated triangles are removed. Runs in parallel on
+    /// CPU and CUDA.
+    ///
+    /// \param voxel_size The size of the voxels used for clustering.
+    /// \param backend The hash map backend used to find the voxels.
+    /// \return The simplified TriangleMesh.
+    TriangleMesh SimplifyVertexClustering(
+            double voxel_size,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default) const;
+
+    /// \brief Simplifies the mesh with quadric error edge collapses.
+    ///
+    /// The mesh is split into spatial cells that are decimated in parallel.
+    /// Vertices whose neighborhood crosses a cell border are locked for the
+    /// round, and the grid is shifted and coarsened over the rounds so that
+    /// the borders get simplified as well. The surviving vertices keep their
+    /// attributes other than positions. Runs on CPU, meshes on other devices
+    /// are copied to CPU and back.
+    ///
+    /// \param target_reduction The fraction of triangles to remove, in
+    /// [0, 1). E.g. 0.9 keeps 10% of the triangles.
+    /// \param maximum_error Edges with a larger quadric error are not
+    /// collapsed, even if the target is not reached yet.
+    /// \param boundary_weight Weight of the quadrics keeping open boundaries
+    /// in place.
+    /// \return The simplified TriangleMesh.
+    TriangleMesh SimplifyQuadricDecimation(
+            double target_reduction,
+            double maximum_error = std::numeric_limits<double>::infinity(),
+            double boundary_weight = 1.0) const;
+
+    /// \brief Returns the pairs of intersecting triangles of the mesh.
+    ///
+    /// Triangles sharing a vertex are not tested. Candidate pairs are found by
+    /// a parallel traversal of a bounding volume hierarchy over the
+    /// triangles. Runs on CPU, meshes on other devices are copied to CPU.
+    ///
+    /// \return (K, 2) Int64 tensor of triangle indices (i, j) with i < j,
+    /// sorted, on the device of the mesh.
+    core::Tensor GetSelfIntersectingTriangles() const;
+
+    /// Tests if the mesh is self-intersecting. Stops at the first intersecting
+    /// triangle pair.
+    bool IsSelfIntersecting() const;
+
+    /// Tests if the mesh intersects \p other. Traverses the bounding volume
+    /// hierarchies of both meshes and stops at the first intersecting
+    /// triangle pair.
+    bool IsIntersecting(const TriangleMesh &other) const;
+
+    /// \brief Computes the vertex adjacency of the mesh in compressed sparse
+    /// row (CSR) layout.
+    ///
+    /// The neighbors of vertex i are neighbors[splits[i]:splits[i + 1]],
+    /// sorted and without duplicates. Built with a parallel counting sort of
+    /// the triangle edges on the device of the mesh.
+    ///
+    /// \return Tuple of (N + 1,) Int64 splits and (E,) Int64 neighbors.
+    std::tuple<core::Tensor, core::Tensor> ComputeVertexAdjacency() const;
+
+    /// \brief Sharpens the mesh with v_o = v_i + strength * sum_n (v_i - v_n).
+    ///
+    /// Filters the vertex positions, and the vertex normals and colors if
+    /// present. All vertices are updated in parallel from the values of the
+    /// previous iteration.
+    ///
+    /// \param number_of_iterations Number of times the filter is applied.
+    /// \param strength Strength of the filter.
+    TriangleMesh FilterSharpen(int number_of_iterations, double strength) const;
+
+    /// \brief Smooths the mesh by replacing each vertex with the average of
+    /// itself and its neighbors.
+    ///
+    /// Filters the same attributes as FilterSharpen().
+    ///
+    /// \param number_of_iterations Number of times the filter is applied.
+    TriangleMesh FilterSmoothSimple(int number_of_iterations) const;
+
+    /// \brief Smooths the mesh with v_o = v_i + lambda * (sum_n w_n v_n -
+    /// v_i), where the weights w_n are normalized to sum to one.
+    ///
+    /// The weights are recomputed from the current positions in every
+    /// iteration. Filters the same attributes as FilterSharpen().
+    ///
+    /// \param number_of_iterations Number of times the filter is applied.
+    /// \param lambda Step size of the filter.
+    /// \param use_cotangent_weights If true, uses cotangent weights (negative
+    /// weights are clamped to zero), otherwise inverse neighbor distances.
+    TriangleMesh FilterSmoothLaplacian(
+            int number_of_iterations,
+            double lambda,
+            bool use_cotangent_weights = false) const;
+
+    /// \brief Smooths the mesh with Taubin's lambda/mu filter, which shrinks
+    /// the mesh less than Laplacian smoothing.
+    ///
+    /// Each iteration applies a Laplacian step with \p lambda followed by one
+    /// with \p mu. Filters the same attributes as FilterSharpen().
+    ///
+    /// \param number_of_iterations Number of times the filter is applied.
+    /// \param lambda Step size of the smoothing step.
+    /// \param mu Step size of the inflating step, should be negative and
+    /// larger in magnitude than \p lambda.
+    /// \param use_cotangent_weights If true, uses cotangent weights, otherwise
+    /// inverse neighbor distances.
+    TriangleMesh FilterSmoothTaubin(int number_of_iterations,
+                                    double lambda = 0.5,
+                                    double mu = -0.53,
+                                    bool use_cotangent_weights = false) const;
+
+    /// \brief Computes the triangle normals from the vertex positions and
+    /// sets them as the "normals" triangle attribute.
+    ///
+    /// \param normalized If true, the normals are normalized. Degenerate
+    /// triangles get (0, 0, 1).
+    TriangleMesh &ComputeTriangleNormals(bool normalized = true);
+
+    /// \brief Computes the vertex normals from the vertex positions and sets
+    /// them as the "normals" vertex attribute.
+    ///
+    /// The triangle corners are grouped by vertex with a counting sort, and
+    /// every vertex gathers the normals of its incident triangles in
+    /// parallel, without atomics.
+    ///
+    /// \param normalized If true, the normals are normalized. Vertices
+    /// without a valid incident triangle get (0, 0, 1).
+    /// \param angle_weighted If true, the unit triangle normals are weighted
+    /// by the corner angles, otherwise by the triangle areas.
+    TriangleMesh &ComputeVertexNormals(bool normalized = true,
+                                       bool angle_weighted = false);
+
+    /// Returns the barycentric area of each vertex, a third of the area of
+    /// its incident triangles, as an {N} tensor of the vertex dtype.
+    core::Tensor ComputeVertexAreas() const;
+
+    /// \brief Estimates the mean and Gaussian curvature of each vertex.
+    ///
+    /// The mean curvature is computed from the cotangent Laplacian and is
+    /// positive where the surface bends away from the vertex normal, e.g.
+    /// 1 / r on a sphere of radius r with outward normals. The Gaussian
+    /// curvature is the angle deficit over the barycentric area, and is only
+    /// meaningful for vertices not on a boundary.
+    ///
+    /// \return Tuple of {N} tensors of the vertex dtype with the mean and the
+    /// Gaussian curvatures.
+    std::tuple<core::Tensor, core::Tensor> ComputeVertexCurvatures() const;
+
+    /// \brief Returns the mesh without duplicated vertices, i.e. vertices
+    /// with identical positions.
+    ///
+    /// The positions are inserted into a hash set by their bit patterns. The
+    /// first vertex of each position is kept with its attributes, in the
+    /// original order, and the triangles are remapped to it.
+    ///
+    /// \param backend The hash map backend used to find the duplicates.
+    TriangleMesh RemoveDuplicatedVertices(
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default) const;
+
+    /// \brief Returns the mesh without duplicated triangles, i.e. triangles
+    /// that reference the same three vertices in the same cyclic order.
+    ///
+    /// The first triangle of each set of duplicates is kept with its
+    /// attributes, in the original order.
+    ///
+    /// \param backend The hash map backend used to find the duplicates.
+    TriangleMesh RemoveDuplicatedTriangles(
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default) const;
+
+    /// Returns the mesh without the vertices that are not referenced by any
+    /// triangle.
+    TriangleMesh RemoveUnreferencedVertices() const;
+
+    /// Returns the mesh without the triangles that reference a vertex more
+    /// than once. They are usually left over by RemoveDuplicatedVertices().
+    TriangleMesh RemoveDegenerateTriangles() const;
+
+    /// \brief Computes the triangles of every undirected edge of the mesh.
+    ///
+    /// The half-edges are sorted by their edge keys (v0, v1) with a parallel
+    /// counting sort, which replaces the hash map of edges of the legacy
+    /// GetEdgeToTrianglesMap().
+    ///
+    /// \return Tuple of (E, 2) Int64 edges with v0 <= v1 sorted by (v0, v1),
+    /// (E + 1,) Int64 splits and (3T,) Int64 triangle indices. The sorted
+    /// triangles of edge i are triangles[splits[i]:splits[i + 1]].
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    ComputeEdgeToTriangles() const;
+
+    /// \brief Clusters the triangles that are connected through edges.
+    ///
+    /// Uses a parallel union-find over the edges. Clusters are numbered in
+    /// the order of their first triangle, as in the legacy
+    /// ClusterConnectedTriangles().
+    ///
+    /// \return Tuple of the (T,) Int64 cluster index of each triangle, the
+    /// (C,) Int64 number of triangles of each cluster and the (C,) Float64
+    /// surface area of each cluster.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    ClusterConnectedTriangles() const;
+
+    /// \brief Returns the non-manifold edges of the mesh, i.e. the edges with
+    /// more than two triangles.
+    ///
+    /// \param allow_boundary_edges If false, the boundary edges, which have a
+    /// single triangle, are returned as well.
+    /// \return (K, 2) Int64 tensor of edges (v0, v1) with v0 <= v1.
+    core::Tensor GetNonManifoldEdges(bool allow_boundary_edges = true) const;
+
+    /// Tests if every edge has one or two triangles, or exactly two if
+    /// \p allow_boundary_edges is false.
+    bool IsEdgeManifold(bool allow_boundary_edges = true) const;
+
+    /// \brief Returns the non-manifold vertices of the mesh.
+    ///
+    /// A vertex is manifold if its incident triangles are connected through
+    /// edges containing the vertex. Each vertex is tested in parallel.
+    ///
+    /// \return (K,) Int64 tensor of vertex indices.
+    core::Tensor GetNonManifoldVertices() const;
+
+    /// Tests if all vertices of the mesh are manifold.
+    bool IsVertexManifold() const;
+
+    /// Tests if the mesh is edge manifold without boundary edges, vertex
+    /// manifold and not self-intersecting.
+    bool IsWatertight() const;
+
     core::Device GetDevice() const { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
@@ -443,6 +727,19 @@ public:
             core::Dtype int_dtype = core::Int64,
             const core::Device &device = core::Device("CPU:0"));
 
+    /// \brief Create a TriangleMesh that shares memory with a legacy Open3D
+    /// TriangleMesh, without copying.
+    ///
+    /// Vertex and triangle attributes are wrapped as Float64 tensors, and
+    /// triangle indices as an Int32 tensor, all on CPU:0. \p mesh_legacy must
+    /// outlive the returned mesh, and its attribute vectors must not be
+    /// resized while the mesh is in use. Modifying the attributes in place
+    /// also modifies \p mesh_legacy. Use FromLegacy() for an independent copy.
+    ///
+    /// \param mesh_legacy Legacy Open3D TriangleMesh.
+    static geometry::TriangleMesh FromLegacyView(
+            open3d::geometry::TriangleMesh &mesh_legacy);
+
     /// Convert to a legacy Open3D TriangleMesh.
     open3d::geometry::TriangleMesh ToLegacy() const;
 
@@ -28,6 +28,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/hashmap/HashSet.h"
 
 namespace open3d {
 namespace t {
@@ -92,6 +93,32 @@ inline void CheckBlockCoorinates(const core::Tensor& block_coords) {
     }
 }
 
+/// Returns a lookup table from the buffer indices of \p hashset to the index
+/// of the entry among the active entries, i.e. a compact index in
+/// [0, Size()). Inactive buffer indices map to -1.
+inline core::Tensor BufferToCompactIndices(const core::HashSet& hashset) {
+    const core::Device device = hashset.GetDevice();
+    core::Tensor active_indices = hashset.GetActiveIndices().To(core::Int64);
+    core::Tensor buf_to_compact = core::Tensor::Full(
+            {hashset.GetCapacity()}, -1, core::Int64, device);
+    buf_to_compact.IndexSet(
+            {active_indices},
+            core::Tensor::Arange(0, active_indices.GetLength(), 1, core::Int64,
+                                 device));
+    return buf_to_compact;
+}
+
+/// Inserts \p keys into \p hashset and returns for each key the compact index
+/// of its entry.
+inline core::Tensor CompactHashIndices(core::HashSet& hashset,
+                                       const core::Tensor& keys) {
+    core::Tensor buf_indices, masks;
+    hashset.Insert(keys, buf_indices, masks);
+    hashset.Find(keys, buf_indices, masks);
+    return BufferToCompactIndices(hashset).IndexGet(
+            {buf_indices.To(core::Int64)});
+}
+
 /// TODO(wei): find a proper place for such functionalities
 inline core::Tensor InverseTransformation(const core::Tensor& T) {
     core::AssertTensorShape(T, {4, 4});
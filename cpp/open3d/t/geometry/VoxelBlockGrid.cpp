@@ -32,8 +32,11 @@
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
+#include "open3d/t/io/HashMapIO.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace t {
@@ -236,6 +239,7 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
         float depth_scale,
         float depth_max,
         float trunc_voxel_multiplier) {
+    OPEN3D_TRACE_ZONE("voxel_block_grid", "GetUniqueBlockCoordinates");
     AssertInitialized();
     CheckDepthTensor(depth.AsTensor());
     CheckIntrinsicTensor(intrinsic);
@@ -266,6 +270,7 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
 
 core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
         const PointCloud &pcd, float trunc_voxel_multiplier) {
+    OPEN3D_TRACE_ZONE("voxel_block_grid", "GetUniqueBlockCoordinates");
     AssertInitialized();
     core::Tensor positions = pcd.GetPointPositions();
 
@@ -286,6 +291,31 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
     return block_coords;
 }
 
+int64_t VoxelBlockGrid::EraseBlocks(const core::Tensor &block_coords) {
+    AssertInitialized();
+    CheckBlockCoorinates(block_coords);
+
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Find(block_coords, buf_indices, masks);
+    core::Tensor erased_indices = buf_indices.IndexGet({masks}).To(core::Int64);
+    const int64_t n = erased_indices.GetLength();
+    if (n == 0) {
+        return 0;
+    }
+
+    // Freed buffers are reused as they are by Activate, so clear them before
+    // the blocks are released.
+    for (core::Tensor &value : block_hashmap_->GetValueTensors()) {
+        core::SizeVector shape = value.GetShape();
+        shape[0] = n;
+        value.IndexSet({erased_indices},
+                       core::Tensor::Zeros(shape, value.GetDtype(),
+                                           value.GetDevice()));
+    }
+    core::Tensor erased = block_hashmap_->Erase(block_coords);
+    return erased.To(core::Int64).Sum({0}).Item<int64_t>();
+}
+
 void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
                                const Image &depth,
                                const core::Tensor &intrinsic,
@@ -303,6 +333,7 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
                                const core::Tensor &extrinsic,
                                float depth_scale,
                                float depth_max) {
+    OPEN3D_TRACE_ZONE("voxel_block_grid", "Integrate");
     AssertInitialized();
     bool integrate_color = color.AsTensor().NumElements() > 0;
 
@@ -315,8 +346,13 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
     CheckExtrinsicTensor(extrinsic);
 
     core::Tensor buf_indices, masks;
-    block_hashmap_->Activate(block_coords, buf_indices, masks);
-    block_hashmap_->Find(block_coords, buf_indices, masks);
+    {
+        OPEN3D_TRACE_ZONE("voxel_block_grid", "Activate blocks");
+        block_hashmap_->Activate(block_coords, buf_indices, masks);
+        block_hashmap_->Find(block_coords, buf_indices, masks);
+    }
+    OPEN3D_TRACE_COUNTER("voxel_block_grid", "Active blocks",
+                         block_hashmap_->Size());
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
@@ -340,6 +376,7 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
                                   float depth_min,
                                   float depth_max,
                                   float weight_threshold) {
+    OPEN3D_TRACE_ZONE("voxel_block_grid", "RayCast");
     AssertInitialized();
     CheckBlockCoorinates(block_coords);
     CheckIntrinsicTensor(intrinsic);
@@ -407,6 +444,7 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
 
 PointCloud VoxelBlockGrid::ExtractPointCloud(int estimated_number,
                                              float weight_threshold) {
+    OPEN3D_TRACE_ZONE("voxel_block_grid", "ExtractPointCloud");
     AssertInitialized();
     core::Tensor active_buf_indices;
     block_hashmap_->GetActiveIndices(active_buf_indices);
@@ -438,6 +476,7 @@ PointCloud VoxelBlockGrid::ExtractPointCloud(int estimated_number,
 
 TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(int estimated_number,
                                                  float weight_threshold) {
+    OPEN3D_TRACE_ZONE("voxel_block_grid", "ExtractTriangleMesh");
     AssertInitialized();
     core::Tensor active_buf_indices_i32 = block_hashmap_->GetActiveIndices();
     core::Tensor active_nb_buf_indices, active_nb_masks;
@@ -594,6 +633,78 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
     return vbg;
 }
 
+void VoxelBlockGrid::SaveChunked(
+        const std::string &file_name,
+        const utility::optional<core::Tensor> &block_coords,
+        bool compressed) const {
+    AssertInitialized();
+
+    // Attribute names in the order of the hash map values.
+    std::vector<std::string> attr_names(name_attr_map_.size());
+    for (auto &it : name_attr_map_) {
+        attr_names[it.second] = it.first;
+    }
+
+    std::unordered_map<std::string, std::string> metadata;
+    metadata["voxel_size"] = fmt::format("{:.9g}", voxel_size_);
+    metadata["block_resolution"] = std::to_string(block_resolution_);
+    metadata["attr_names"] = utility::JoinStrings(attr_names, ",");
+    t::io::WriteHashMapChunked(file_name, *block_hashmap_, block_coords,
+                               compressed, metadata);
+}
+
+VoxelBlockGrid VoxelBlockGrid::LoadChunked(
+        const std::string &file_name,
+        const core::Device &device,
+        const utility::optional<core::Tensor> &block_range) {
+    std::unordered_map<std::string, std::string> metadata =
+            t::io::ReadHashMapChunkedMetadata(file_name);
+    if (metadata.count("attr_names") == 0 ||
+        metadata.count("voxel_size") == 0 ||
+        metadata.count("block_resolution") == 0) {
+        utility::LogError(
+                "Voxel block grid metadata not found in {}, not a valid file "
+                "for voxel block grids.",
+                file_name);
+    }
+
+    core::HashMap block_hashmap =
+            t::io::ReadHashMapChunked(file_name, device, block_range);
+
+    std::vector<std::string> attr_names =
+            utility::SplitString(metadata.at("attr_names"), ",");
+    std::vector<core::Tensor> values = block_hashmap.GetValueTensors();
+    if (attr_names.size() != values.size()) {
+        utility::LogError("Expected {} attributes, but got {}.",
+                          attr_names.size(), values.size());
+    }
+
+    std::vector<core::Dtype> attr_dtypes;
+    std::vector<core::SizeVector> attr_channels;
+    for (const core::Tensor &value : values) {
+        attr_dtypes.push_back(value.GetDtype());
+        // capacity, res, res, res
+        core::SizeVector value_shape = value.GetShape();
+        attr_channels.emplace_back(value_shape.begin() + 4, value_shape.end());
+    }
+
+    VoxelBlockGrid vbg(attr_names, attr_dtypes, attr_channels,
+                       std::stof(metadata.at("voxel_size")),
+                       std::stoll(metadata.at("block_resolution")), 1, device);
+    vbg.block_hashmap_ = std::make_shared<core::HashMap>(block_hashmap);
+    return vbg;
+}
+
+void VoxelBlockGrid::UpdateFromChunked(
+        const std::string &file_name,
+        const utility::optional<core::Tensor> &block_range) {
+    AssertInitialized();
+    // Erase through EraseBlocks, which clears the freed blocks.
+    EraseBlocks(t::io::ReadHashMapChunkedErasedKeys(file_name, block_range)
+                        .To(block_hashmap_->GetDevice()));
+    t::io::ReadHashMapChunked(file_name, *block_hashmap_, block_range);
+}
+
 void VoxelBlockGrid::AssertInitialized() const {
     if (block_hashmap_ == nullptr) {
         utility::LogError("VoxelBlockGrid not initialized.");
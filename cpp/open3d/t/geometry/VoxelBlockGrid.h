@@ -33,6 +33,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace t {
@@ -139,6 +140,12 @@ public:
     core::Tensor GetUniqueBlockCoordinates(const PointCloud &pcd,
                                            float trunc_voxel_multiplier = 4.0);
 
+    /// Remove the blocks at \p block_coords (N, 3) Int32 from the hash map and
+    /// reset their voxels, e.g. to rebuild them after camera poses changed.
+    /// Coordinates that are not active are ignored.
+    /// \return Number of erased blocks.
+    int64_t EraseBlocks(const core::Tensor &block_coords);
+
     /// Specific operation for TSDF volumes.
     /// Integrate an RGB-D frame in the selected block coordinates using pinhole
     /// camera model.
@@ -214,6 +221,42 @@ public:
     /// Load a voxel block grid from a .npz file.
     static VoxelBlockGrid Load(const std::string &file_name);
 
+    /// Save a voxel block grid to a chunked, LZF compressed file that can be
+    /// partially loaded. Blocks are written in spatially coherent chunks.
+    /// \param file_name Output file name.
+    /// \param block_coords Optional (N, 3) Int32 block coordinates to save,
+    /// e.g. the blocks touched or erased since the last save, to write a delta
+    /// that is applied with UpdateFromChunked(). Blocks that are not active are
+    /// recorded as erased. All the active blocks by default.
+    /// \param compressed Whether to compress the chunks.
+    void SaveChunked(
+            const std::string &file_name,
+            const utility::optional<core::Tensor> &block_coords =
+                    utility::nullopt,
+            bool compressed = true) const;
+
+    /// Load a voxel block grid from a file written by SaveChunked().
+    /// \param file_name Input file name.
+    /// \param device The device to load the voxel block grid to.
+    /// \param block_range Optional (2, 3) tensor of inclusive lower and upper
+    /// block coordinates. Only the blocks in the range are loaded, and chunks
+    /// outside of the range are not read.
+    static VoxelBlockGrid LoadChunked(
+            const std::string &file_name,
+            const core::Device &device = core::Device("CPU:0"),
+            const utility::optional<core::Tensor> &block_range =
+                    utility::nullopt);
+
+    /// Insert or overwrite the blocks stored in a file written by
+    /// SaveChunked(), e.g. a delta of the blocks touched since a checkpoint,
+    /// and erase the blocks it records as erased.
+    /// \param file_name Input file name.
+    /// \param block_range Optional (2, 3) tensor of inclusive lower and upper
+    /// block coordinates to restrict the update to.
+    void UpdateFromChunked(const std::string &file_name,
+                           const utility::optional<core::Tensor> &block_range =
+                                   utility::nullopt);
+
 private:
     void AssertInitialized() const;
 
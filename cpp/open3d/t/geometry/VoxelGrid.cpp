@@ -0,0 +1,343 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <algorithm>
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+VoxelGrid::VoxelGrid(double voxel_size,
+                     const core::Tensor &origin,
+                     const core::Device &device,
+                     int64_t init_capacity)
+    : Geometry(Geometry::GeometryType::VoxelGrid, 3),
+      device_(device),
+      voxel_size_(voxel_size) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel size must be positive, but got {}",
+                          voxel_size);
+    }
+    if (origin.NumElements() == 0) {
+        origin_ = core::Tensor::Zeros({3}, core::Float64, device);
+    } else {
+        core::AssertTensorShape(origin, {3});
+        origin_ = origin.To(device, core::Float64, /*copy=*/true);
+    }
+    voxel_set_ = std::make_shared<core::HashSet>(
+            std::max<int64_t>(init_capacity, 1), core::Int32,
+            core::SizeVector{3}, device);
+}
+
+VoxelGrid VoxelGrid::To(const core::Device &device, bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return *this;
+    }
+    VoxelGrid voxel_grid(voxel_size_, origin_, device);
+    voxel_grid.voxel_set_ =
+            std::make_shared<core::HashSet>(voxel_set_->To(device, true));
+    return voxel_grid;
+}
+
+VoxelGrid &VoxelGrid::Clear() {
+    voxel_set_->Clear();
+    return *this;
+}
+
+core::Tensor VoxelGrid::GetVoxelIndices() const {
+    if (IsEmpty()) {
+        return core::Tensor::Empty({0, 3}, core::Int32, device_);
+    }
+    return voxel_set_->GetKeyTensor().IndexGet(
+            {voxel_set_->GetActiveIndices().To(core::Int64)});
+}
+
+core::Tensor VoxelGrid::GetVoxelCenters() const {
+    return ((GetVoxelIndices().To(core::Float64) + 0.5) * voxel_size_ +
+            origin_.Reshape({1, 3}))
+            .To(core::Float32);
+}
+
+core::Tensor VoxelGrid::ComputeVoxelIndices(const core::Tensor &points) const {
+    core::AssertTensorDevice(points, device_);
+    core::Tensor voxel_indices;
+    kernel::voxel_grid::ComputeVoxelIndices(points, origin_, voxel_size_,
+                                            voxel_indices);
+    return voxel_indices;
+}
+
+core::Tensor VoxelGrid::ContainsVoxels(
+        const core::Tensor &voxel_indices) const {
+    core::AssertTensorShape(voxel_indices, {utility::nullopt, 3});
+    core::AssertTensorDtype(voxel_indices, core::Int32);
+    core::AssertTensorDevice(voxel_indices, device_);
+    if (voxel_indices.GetLength() == 0 || IsEmpty()) {
+        return core::Tensor::Zeros({voxel_indices.GetLength()}, core::Bool,
+                                   device_);
+    }
+    return voxel_set_->Find(voxel_indices.Contiguous()).second;
+}
+
+core::Tensor VoxelGrid::CheckIfIncluded(const core::Tensor &points) const {
+    return ContainsVoxels(ComputeVoxelIndices(points));
+}
+
+VoxelGrid &VoxelGrid::InsertVoxels(const core::Tensor &voxel_indices) {
+    core::AssertTensorShape(voxel_indices, {utility::nullopt, 3});
+    core::AssertTensorDtype(voxel_indices, core::Int32);
+    core::AssertTensorDevice(voxel_indices, device_);
+    if (voxel_indices.GetLength() > 0) {
+        voxel_set_->Insert(voxel_indices.Contiguous());
+    }
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::EraseVoxels(const core::Tensor &voxel_indices) {
+    core::AssertTensorShape(voxel_indices, {utility::nullopt, 3});
+    core::AssertTensorDtype(voxel_indices, core::Int32);
+    core::AssertTensorDevice(voxel_indices, device_);
+    if (voxel_indices.GetLength() > 0 && !IsEmpty()) {
+        voxel_set_->Erase(voxel_indices.Contiguous());
+    }
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::InsertPoints(const core::Tensor &points) {
+    return InsertVoxels(ComputeVoxelIndices(points));
+}
+
+VoxelGrid &VoxelGrid::InsertTriangleMesh(const TriangleMesh &mesh) {
+    if (!mesh.HasVertexPositions() || !mesh.HasTriangleIndices()) {
+        return *this;
+    }
+    const core::Tensor &vertices = mesh.GetVertexPositions();
+    core::AssertTensorDevice(vertices, device_);
+    core::Tensor voxel_indices;
+    kernel::voxel_grid::RasterizeTriangles(
+            vertices, mesh.GetTriangleIndices().To(core::Int64), origin_,
+            voxel_size_, voxel_indices);
+    return InsertVoxels(voxel_indices);
+}
+
+void VoxelGrid::AssertSameGrid(const VoxelGrid &other) const {
+    if (other.device_ != device_) {
+        utility::LogError("Voxel grids are on different devices {} and {}.",
+                          device_.ToString(), other.device_.ToString());
+    }
+    if (other.voxel_size_ != voxel_size_ || !other.origin_.AllEqual(origin_)) {
+        utility::LogError(
+                "Voxel grids must have the same voxel size and origin, but "
+                "got {} and {}.",
+                ToString(), other.ToString());
+    }
+}
+
+VoxelGrid VoxelGrid::EmptyLike(int64_t init_capacity) const {
+    return VoxelGrid(voxel_size_, origin_, device_, init_capacity);
+}
+
+VoxelGrid VoxelGrid::Union(const VoxelGrid &other) const {
+    AssertSameGrid(other);
+    VoxelGrid result = Clone();
+    result.InsertVoxels(other.GetVoxelIndices());
+    return result;
+}
+
+VoxelGrid VoxelGrid::Intersect(const VoxelGrid &other) const {
+    AssertSameGrid(other);
+    const core::Tensor voxel_indices = GetVoxelIndices();
+    const core::Tensor mask = other.ContainsVoxels(voxel_indices);
+    VoxelGrid result = EmptyLike(voxel_indices.GetLength());
+    result.InsertVoxels(voxel_indices.IndexGet({mask}));
+    return result;
+}
+
+VoxelGrid VoxelGrid::Subtract(const VoxelGrid &other) const {
+    AssertSameGrid(other);
+    const core::Tensor voxel_indices = GetVoxelIndices();
+    const core::Tensor mask = other.ContainsVoxels(voxel_indices).LogicalNot();
+    VoxelGrid result = EmptyLike(voxel_indices.GetLength());
+    result.InsertVoxels(voxel_indices.IndexGet({mask}));
+    return result;
+}
+
+core::Tensor VoxelGrid::GetNeighborIndices(
+        const core::Tensor &voxel_indices) const {
+    std::vector<int> offsets;
+    offsets.reserve(27 * 3);
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                offsets.insert(offsets.end(), {dx, dy, dz});
+            }
+        }
+    }
+    const int64_t n = voxel_indices.GetLength();
+    return (voxel_indices.Reshape({n, 1, 3}) +
+            core::Tensor(offsets, {1, 27, 3}, core::Int32, device_))
+            .Reshape({27 * n, 3});
+}
+
+VoxelGrid &VoxelGrid::Dilate(int iterations) {
+    for (int i = 0; i < iterations && !IsEmpty(); ++i) {
+        InsertVoxels(GetNeighborIndices(GetVoxelIndices()));
+    }
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::Erode(int iterations) {
+    for (int i = 0; i < iterations && !IsEmpty(); ++i) {
+        const core::Tensor voxel_indices = GetVoxelIndices();
+        const int64_t n = voxel_indices.GetLength();
+        // A voxel stays if all of its 27 neighborhood is occupied.
+        const core::Tensor keep =
+                ContainsVoxels(GetNeighborIndices(voxel_indices))
+                        .Reshape({n, 27})
+                        .To(core::Int32)
+                        .Sum({1})
+                        .Eq(27);
+        EraseVoxels(voxel_indices.IndexGet({keep.LogicalNot()}));
+    }
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveDepthMap(const Image &depth,
+                                    const core::Tensor &intrinsic,
+                                    const core::Tensor &extrinsic,
+                                    float depth_scale,
+                                    bool keep_voxels_outside_image) {
+    if (IsEmpty()) {
+        return *this;
+    }
+    const core::Tensor voxel_indices = GetVoxelIndices();
+    core::Tensor carve_mask;
+    kernel::voxel_grid::ComputeCarveMask(
+            voxel_indices, depth.AsTensor(), intrinsic, extrinsic, origin_,
+            voxel_size_, depth_scale, /*is_depth=*/true,
+            keep_voxels_outside_image, carve_mask);
+    return EraseVoxels(voxel_indices.IndexGet({carve_mask}));
+}
+
+VoxelGrid &VoxelGrid::CarveSilhouette(const Image &mask,
+                                      const core::Tensor &intrinsic,
+                                      const core::Tensor &extrinsic,
+                                      bool keep_voxels_outside_image) {
+    if (IsEmpty()) {
+        return *this;
+    }
+    const core::Tensor voxel_indices = GetVoxelIndices();
+    core::Tensor carve_mask;
+    kernel::voxel_grid::ComputeCarveMask(
+            voxel_indices, mask.AsTensor(), intrinsic, extrinsic, origin_,
+            voxel_size_, /*depth_scale=*/1.0f, /*is_depth=*/false,
+            keep_voxels_outside_image, carve_mask);
+    return EraseVoxels(voxel_indices.IndexGet({carve_mask}));
+}
+
+std::string VoxelGrid::ToString() const {
+    return fmt::format(
+            "VoxelGrid on {} [{} voxels, voxel size: {}, origin: {}].",
+            device_.ToString(), NumVoxels(), voxel_size_,
+            origin_.ToString(/*with_suffix=*/false));
+}
+
+VoxelGrid VoxelGrid::CreateFromPointCloud(const PointCloud &pcd,
+                                          double voxel_size) {
+    const core::Tensor &points = pcd.GetPointPositions();
+    const core::Device device = points.GetDevice();
+    if (points.GetLength() == 0) {
+        return VoxelGrid(voxel_size, core::Tensor(), device);
+    }
+    const core::Tensor origin =
+            points.Min({0}).To(core::Float64) - 0.5 * voxel_size;
+    VoxelGrid voxel_grid(voxel_size, origin, device, points.GetLength());
+    voxel_grid.InsertPoints(points);
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::CreateFromTriangleMesh(const TriangleMesh &mesh,
+                                            double voxel_size) {
+    const core::Device device = mesh.GetDevice();
+    if (!mesh.HasVertexPositions() ||
+        mesh.GetVertexPositions().GetLength() == 0) {
+        return VoxelGrid(voxel_size, core::Tensor(), device);
+    }
+    const core::Tensor origin =
+            mesh.GetMinBound().To(core::Float64) - 0.5 * voxel_size;
+    VoxelGrid voxel_grid(voxel_size, origin, device);
+    voxel_grid.InsertTriangleMesh(mesh);
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::FromLegacy(const open3d::geometry::VoxelGrid &voxel_grid,
+                                const core::Device &device) {
+    const int64_t n = static_cast<int64_t>(voxel_grid.voxels_.size());
+    const Eigen::Vector3d &origin = voxel_grid.origin_;
+    VoxelGrid result(voxel_grid.voxel_size_,
+                     core::Tensor::Init<double>(
+                             {origin(0), origin(1), origin(2)}, device),
+                     device, n);
+    if (n > 0) {
+        std::vector<int> voxel_indices;
+        voxel_indices.reserve(3 * n);
+        for (const auto &it : voxel_grid.voxels_) {
+            const Eigen::Vector3i &index = it.first;
+            voxel_indices.insert(voxel_indices.end(),
+                                 {index(0), index(1), index(2)});
+        }
+        result.InsertVoxels(
+                core::Tensor(voxel_indices, {n, 3}, core::Int32, device));
+    }
+    return result;
+}
+
+open3d::geometry::VoxelGrid VoxelGrid::ToLegacy() const {
+    open3d::geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = voxel_size_;
+    const core::Tensor origin = origin_.To(core::Device("CPU:0"));
+    const double *origin_ptr = origin.GetDataPtr<double>();
+    voxel_grid.origin_ =
+            Eigen::Vector3d(origin_ptr[0], origin_ptr[1], origin_ptr[2]);
+    const core::Tensor voxel_indices =
+            GetVoxelIndices().To(core::Device("CPU:0")).Contiguous();
+    const int *indices_ptr = voxel_indices.GetDataPtr<int>();
+    for (int64_t i = 0; i < voxel_indices.GetLength(); ++i) {
+        voxel_grid.AddVoxel(open3d::geometry::Voxel(Eigen::Vector3i(
+                indices_ptr[3 * i], indices_ptr[3 * i + 1],
+                indices_ptr[3 * i + 2])));
+    }
+    return voxel_grid;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
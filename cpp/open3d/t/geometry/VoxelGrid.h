@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/Geometry.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class VoxelGrid
+/// \brief A sparse occupancy grid of cubic voxels.
+///
+/// Voxel (i, j, k) covers [origin + (i, j, k) * voxel_size,
+/// origin + (i + 1, j + 1, k + 1) * voxel_size). The Int32 indices of the
+/// occupied voxels are stored in a core::HashSet on the device of the grid,
+/// so that creation, membership queries, boolean operations, morphology and
+/// carving are bulk parallel operations on the whole set.
+class VoxelGrid : public Geometry {
+public:
+    /// Construct an empty voxel grid.
+    /// \param voxel_size Side length of the voxels.
+    /// \param origin Float64 tensor of shape {3}, the corner of voxel
+    /// (0, 0, 0). The zero vector by default.
+    /// \param device The device of the grid.
+    /// \param init_capacity Initial capacity of the hash set.
+    VoxelGrid(double voxel_size = 1.0,
+              const core::Tensor &origin = core::Tensor(),
+              const core::Device &device = core::Device("CPU:0"),
+              int64_t init_capacity = 1024);
+
+    virtual ~VoxelGrid() override {}
+
+    /// Returns the device of the voxel grid.
+    core::Device GetDevice() const { return device_; }
+
+    double GetVoxelSize() const { return voxel_size_; }
+
+    /// Returns the Float64 origin of shape {3} on the device of the grid.
+    core::Tensor GetOrigin() const { return origin_; }
+
+    /// Returns the number of occupied voxels.
+    int64_t NumVoxels() const { return voxel_set_->Size(); }
+
+    /// Transfer the voxel grid to a specified device.
+    /// \param device The targeted device to convert to.
+    /// \param copy If true, a new grid is always created; if false, the copy
+    /// is avoided when the original grid is already on the targeted device.
+    VoxelGrid To(const core::Device &device, bool copy = false) const;
+
+    /// Returns copy of the voxel grid on the same device.
+    VoxelGrid Clone() const { return To(GetDevice(), /*copy=*/true); }
+
+    /// Remove all voxels.
+    VoxelGrid &Clear() override;
+
+    /// Returns true iff no voxel is occupied.
+    bool IsEmpty() const override { return NumVoxels() == 0; }
+
+    /// Returns the (N, 3) Int32 indices of the occupied voxels, in no
+    /// particular order.
+    core::Tensor GetVoxelIndices() const;
+
+    /// Returns the (N, 3) Float32 centers of the occupied voxels, in the
+    /// order of GetVoxelIndices().
+    core::Tensor GetVoxelCenters() const;
+
+    /// Returns the (N, 3) Int32 indices of the voxels containing \p points.
+    /// \param points A Float32 or Float64 tensor of shape {N, 3}.
+    core::Tensor ComputeVoxelIndices(const core::Tensor &points) const;
+
+    /// Returns a Bool tensor of shape {N} that is true for the occupied
+    /// voxels among the (N, 3) Int32 \p voxel_indices.
+    core::Tensor ContainsVoxels(const core::Tensor &voxel_indices) const;
+
+    /// Returns a Bool tensor of shape {N} that is true for the \p points in
+    /// an occupied voxel.
+    /// \param points A Float32 or Float64 tensor of shape {N, 3}.
+    core::Tensor CheckIfIncluded(const core::Tensor &points) const;
+
+    /// Occupy the voxels at the (N, 3) Int32 \p voxel_indices.
+    VoxelGrid &InsertVoxels(const core::Tensor &voxel_indices);
+
+    /// Free the voxels at the (N, 3) Int32 \p voxel_indices. Voxels that are
+    /// not occupied are ignored.
+    VoxelGrid &EraseVoxels(const core::Tensor &voxel_indices);
+
+    /// Occupy the voxels containing the (N, 3) Float32 or Float64 \p points.
+    VoxelGrid &InsertPoints(const core::Tensor &points);
+
+    /// Occupy the voxels intersecting the triangles of \p mesh.
+    VoxelGrid &InsertTriangleMesh(const TriangleMesh &mesh);
+
+    /// Returns the voxels occupied in this grid or in \p other. Both grids
+    /// must have the same voxel size, origin and device.
+    VoxelGrid Union(const VoxelGrid &other) const;
+
+    /// Returns the voxels occupied in both this grid and \p other.
+    VoxelGrid Intersect(const VoxelGrid &other) const;
+
+    /// Returns the voxels occupied in this grid but not in \p other.
+    VoxelGrid Subtract(const VoxelGrid &other) const;
+
+    /// Occupy the 26 neighbors of every occupied voxel, \p iterations times.
+    VoxelGrid &Dilate(int iterations = 1);
+
+    /// Free every voxel that has a free voxel among its 26 neighbors,
+    /// \p iterations times.
+    VoxelGrid &Erode(int iterations = 1);
+
+    /// Free the voxels none of whose corners projects to a pixel of
+    /// \p depth whose depth is valid and not larger than that of the corner,
+    /// like the legacy VoxelGrid::CarveDepthMap.
+    /// \param depth Single channel depth image.
+    /// \param intrinsic Pinhole camera intrinsic matrix of shape {3, 3}.
+    /// \param extrinsic World to camera transformation of shape {4, 4}.
+    /// \param depth_scale Scale that converts the depth values to meters.
+    /// \param keep_voxels_outside_image If true, voxels with a corner that
+    /// does not project into the image are kept.
+    VoxelGrid &CarveDepthMap(const Image &depth,
+                             const core::Tensor &intrinsic,
+                             const core::Tensor &extrinsic,
+                             float depth_scale = 1000.0f,
+                             bool keep_voxels_outside_image = false);
+
+    /// Free the voxels none of whose corners projects into the silhouette,
+    /// the pixels of \p mask that are larger than 0, like the legacy
+    /// VoxelGrid::CarveSilhouette.
+    /// \param mask Single channel silhouette mask.
+    /// \param intrinsic Pinhole camera intrinsic matrix of shape {3, 3}.
+    /// \param extrinsic World to camera transformation of shape {4, 4}.
+    /// \param keep_voxels_outside_image If true, voxels with a corner that
+    /// does not project into the image are kept.
+    VoxelGrid &CarveSilhouette(const Image &mask,
+                               const core::Tensor &intrinsic,
+                               const core::Tensor &extrinsic,
+                               bool keep_voxels_outside_image = false);
+
+    /// Text description.
+    std::string ToString() const;
+
+    /// Creates a voxel grid with the voxels containing the points of \p pcd.
+    /// As in the legacy VoxelGrid, the origin is half a voxel below the
+    /// minimum bound of the points.
+    static VoxelGrid CreateFromPointCloud(const PointCloud &pcd,
+                                          double voxel_size);
+
+    /// Creates a voxel grid with the voxels intersecting the triangles of
+    /// \p mesh. As in the legacy VoxelGrid, the origin is half a voxel below
+    /// the minimum bound of the vertices.
+    static VoxelGrid CreateFromTriangleMesh(const TriangleMesh &mesh,
+                                            double voxel_size);
+
+    /// Create a VoxelGrid from a legacy VoxelGrid. Voxel colors are dropped.
+    static VoxelGrid FromLegacy(
+            const open3d::geometry::VoxelGrid &voxel_grid,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Convert to a legacy VoxelGrid without colors.
+    open3d::geometry::VoxelGrid ToLegacy() const;
+
+private:
+    /// Raises an error if \p other is not on the same grid.
+    void AssertSameGrid(const VoxelGrid &other) const;
+
+    /// Returns the (27 N, 3) indices of the 3 x 3 x 3 neighborhoods of the
+    /// (N, 3) \p voxel_indices. Rows 27 i to 27 i + 26 are the neighborhood
+    /// of voxel i.
+    core::Tensor GetNeighborIndices(const core::Tensor &voxel_indices) const;
+
+    /// Returns an empty grid with the same voxel size, origin and device.
+    VoxelGrid EmptyLike(int64_t init_capacity) const;
+
+    core::Device device_ = core::Device("CPU:0");
+    double voxel_size_;
+    core::Tensor origin_;
+    std::shared_ptr<core::HashSet> voxel_set_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "open3d/core/hashmap/DeviceHashBackend.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+
+/// \class BlockLookupTable
+///
+/// Dense table of the buffer indices of the active blocks over their bounding
+/// box, used by CPU ray casting in place of hash map queries. It only reads
+/// the keys and active indices of the map, so it works with any CPU hash
+/// backend. A coarse occupancy grid with kCoarseFactor^3 blocks per cell lets
+/// rays jump over empty space. Nothing is built if the bounding box holds more
+/// than kMaxTableSize blocks, in which case IsValid() returns false and the
+/// caller has to query the hash map itself.
+class BlockLookupTable {
+public:
+    static constexpr int kCoarseFactor = 4;
+    static constexpr int64_t kMaxTableSize = 1 << 24;
+
+    /// \param hashmap CPU hash map with MiniVec<int, 3> block coordinates as
+    /// keys.
+    /// \param block_size Edge length of a block in meters.
+    BlockLookupTable(core::DeviceHashBackend& hashmap, float block_size)
+        : block_size_(block_size) {
+        int64_t n = hashmap.Size();
+        if (n == 0) {
+            valid_ = true;
+            return;
+        }
+        std::vector<core::buf_index_t> active_buf_indices(n);
+        n = hashmap.GetActiveIndices(active_buf_indices.data());
+        const int* key_buffer_ptr =
+                static_cast<const int*>(hashmap.GetKeyBuffer().GetDataPtr());
+
+        int max_key[3];
+        for (int d = 0; d < 3; ++d) {
+            min_key_[d] = max_key[d] =
+                    key_buffer_ptr[3 * active_buf_indices[0] + d];
+        }
+        for (int64_t i = 1; i < n; ++i) {
+            const int* key = key_buffer_ptr + 3 * active_buf_indices[i];
+            for (int d = 0; d < 3; ++d) {
+                min_key_[d] = std::min(min_key_[d], key[d]);
+                max_key[d] = std::max(max_key[d], key[d]);
+            }
+        }
+        int64_t table_size = 1;
+        for (int d = 0; d < 3; ++d) {
+            shape_[d] = max_key[d] - min_key_[d] + 1;
+            coarse_shape_[d] = (shape_[d] + kCoarseFactor - 1) / kCoarseFactor;
+            table_size *= shape_[d];
+        }
+        if (table_size > kMaxTableSize) {
+            return;
+        }
+
+        table_.assign(table_size, -1);
+        coarse_occupancy_.assign(
+                coarse_shape_[0] * coarse_shape_[1] * coarse_shape_[2], 0);
+        for (int64_t i = 0; i < n; ++i) {
+            const int* key = key_buffer_ptr + 3 * active_buf_indices[i];
+            int x = key[0] - min_key_[0];
+            int y = key[1] - min_key_[1];
+            int z = key[2] - min_key_[2];
+            table_[(int64_t(z) * shape_[1] + y) * shape_[0] + x] =
+                    static_cast<int>(active_buf_indices[i]);
+            coarse_occupancy_[(z / kCoarseFactor * coarse_shape_[1] +
+                               y / kCoarseFactor) *
+                                      coarse_shape_[0] +
+                              x / kCoarseFactor] = 1;
+        }
+        valid_ = true;
+    }
+
+    bool IsValid() const { return valid_; }
+
+    /// Buffer index of block (x, y, z), or -1 if it is not active.
+    int Find(int x, int y, int z) const {
+        x -= min_key_[0];
+        y -= min_key_[1];
+        z -= min_key_[2];
+        if (x < 0 || y < 0 || z < 0 || x >= shape_[0] || y >= shape_[1] ||
+            z >= shape_[2]) {
+            return -1;
+        }
+        return table_[(int64_t(z) * shape_[1] + y) * shape_[0] + x];
+    }
+
+    /// If the point at \p t on the ray o + t * d lies in an empty coarse
+    /// cell, returns where the ray leaves that cell; otherwise returns \p t.
+    float ExitEmptyCell(float x_o,
+                        float y_o,
+                        float z_o,
+                        float x_d,
+                        float y_d,
+                        float z_d,
+                        float t) const {
+        if (!IsValid()) {
+            return t;
+        }
+        const float o[3] = {x_o, y_o, z_o};
+        const float dir[3] = {x_d, y_d, z_d};
+        int cell[3];
+        bool inside = true;
+        for (int d = 0; d < 3; ++d) {
+            int block = static_cast<int>(
+                    std::floor((o[d] + t * dir[d]) / block_size_));
+            int offset = block - min_key_[d];
+            // Floor division, so that cells stay aligned outside of the box.
+            cell[d] = (offset >= 0 ? offset : offset - kCoarseFactor + 1) /
+                      kCoarseFactor;
+            inside = inside && cell[d] >= 0 && cell[d] < coarse_shape_[d];
+        }
+        if (inside && coarse_occupancy_[(cell[2] * coarse_shape_[1] + cell[1]) *
+                                                coarse_shape_[0] +
+                                        cell[0]]) {
+            return t;
+        }
+
+        float t_exit = t;
+        bool first = true;
+        for (int d = 0; d < 3; ++d) {
+            if (dir[d] == 0) {
+                continue;
+            }
+            int bound = min_key_[d] +
+                        (cell[d] + (dir[d] > 0 ? 1 : 0)) * kCoarseFactor;
+            float t_d = (bound * block_size_ - o[d]) / dir[d];
+            t_exit = first ? t_d : std::min(t_exit, t_d);
+            first = false;
+        }
+        return std::max(t_exit, t);
+    }
+
+private:
+    float block_size_;
+    bool valid_ = false;
+    int min_key_[3] = {0, 0, 0};
+    int shape_[3] = {0, 0, 0};
+    int coarse_shape_[3] = {0, 0, 0};
+    std::vector<int> table_;
+    std::vector<uint8_t> coarse_occupancy_;
+};
+
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
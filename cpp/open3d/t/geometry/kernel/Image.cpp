@@ -64,6 +64,27 @@ void PyrDownDepth(const core::Tensor &src,
     }
 }
 
+void PyrDownDepthVertexMap(const core::Tensor &src,
+                           core::Tensor &dst_depth,
+                           core::Tensor &dst_vertex,
+                           const core::Tensor &intrinsics,
+                           float diff_threshold,
+                           float invalid_fill) {
+    core::Device device = src.GetDevice();
+    static const core::Device host("CPU:0");
+
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        PyrDownDepthVertexMapCPU(src, dst_depth, dst_vertex, intrinsics_d,
+                                 diff_threshold, invalid_fill);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(PyrDownDepthVertexMapCUDA, src, dst_depth, dst_vertex,
+                  intrinsics_d, diff_threshold, invalid_fill);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void CreateVertexMap(const core::Tensor &src,
                      core::Tensor &dst,
                      const core::Tensor &intrinsics,
@@ -46,6 +46,13 @@ void PyrDownDepth(const core::Tensor &src,
                   float diff_threshold,
                   float invalid_fill);
 
+void PyrDownDepthVertexMap(const core::Tensor &src,
+                           core::Tensor &dst_depth,
+                           core::Tensor &dst_vertex,
+                           const core::Tensor &intrinsics,
+                           float diff_threshold,
+                           float invalid_fill);
+
 void CreateVertexMap(const core::Tensor &src,
                      core::Tensor &dst,
                      const core::Tensor &intrinsics,
@@ -73,6 +80,13 @@ void PyrDownDepthCPU(const core::Tensor &src,
                      float diff_threshold,
                      float invalid_fill);
 
+void PyrDownDepthVertexMapCPU(const core::Tensor &src,
+                              core::Tensor &dst_depth,
+                              core::Tensor &dst_vertex,
+                              const core::Tensor &intrinsics,
+                              float diff_threshold,
+                              float invalid_fill);
+
 void CreateVertexMapCPU(const core::Tensor &src,
                         core::Tensor &dst,
                         const core::Tensor &intrinsics,
@@ -101,6 +115,13 @@ void PyrDownDepthCUDA(const core::Tensor &src,
                       float diff_threshold,
                       float invalid_fill);
 
+void PyrDownDepthVertexMapCUDA(const core::Tensor &src,
+                               core::Tensor &dst_depth,
+                               core::Tensor &dst_vertex,
+                               const core::Tensor &intrinsics,
+                               float diff_threshold,
+                               float invalid_fill);
+
 void CreateVertexMapCUDA(const core::Tensor &src,
                          core::Tensor &dst,
                          const core::Tensor &intrinsics,
@@ -150,6 +150,97 @@ void PyrDownDepthCPU
             });
 }
 
+// Fuses PyrDownDepth and CreateVertexMap on the down sampled depth, so that
+// every level of a depth pyramid is read and written in a single pass.
+#ifdef __CUDACC__
+void PyrDownDepthVertexMapCUDA
+#else
+void PyrDownDepthVertexMapCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst_depth,
+         core::Tensor& dst_vertex,
+         const core::Tensor& intrinsics,
+         float depth_diff,
+         float invalid_fill) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer depth_indexer(dst_depth, 2);
+    NDArrayIndexer vertex_indexer(dst_vertex, 2);
+    TransformIndexer ti(intrinsics, core::Tensor::Eye(4, core::Float64,
+                                                      core::Device("CPU:0")));
+
+    int rows = src_indexer.GetShape(0);
+    int cols = src_indexer.GetShape(1);
+
+    int rows_down = depth_indexer.GetShape(0);
+    int cols_down = depth_indexer.GetShape(1);
+    int n = rows_down * cols_down;
+
+    const int gkernel_size = 5;
+    const int gkernel_size_2 = gkernel_size / 2;
+    const float gweights[3] = {0.375f, 0.25f, 0.0625f};
+
+#ifndef __CUDACC__
+    using std::abs;
+    using std::max;
+    using std::min;
+#endif
+
+    core::ParallelFor(
+            src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                auto is_invalid = [invalid_fill] OPEN3D_DEVICE(float v) {
+                    if (isinf(invalid_fill)) return isinf(v);
+                    if (isnan(invalid_fill)) return isnan(v);
+                    return v == invalid_fill;
+                };
+
+                int y = workload_idx / cols_down;
+                int x = workload_idx % cols_down;
+
+                int y_src = 2 * y;
+                int x_src = 2 * x;
+
+                float d = invalid_fill;
+                float v_center = *src_indexer.GetDataPtr<float>(x_src, y_src);
+                if (v_center != invalid_fill) {
+                    int x_min = max(0, x_src - gkernel_size_2);
+                    int y_min = max(0, y_src - gkernel_size_2);
+
+                    int x_max = min(cols - 1, x_src + gkernel_size_2);
+                    int y_max = min(rows - 1, y_src + gkernel_size_2);
+
+                    float v_sum = 0;
+                    float w_sum = 0;
+                    for (int yk = y_min; yk <= y_max; ++yk) {
+                        for (int xk = x_min; xk <= x_max; ++xk) {
+                            float v = *src_indexer.GetDataPtr<float>(xk, yk);
+                            int dy = abs(yk - y_src);
+                            int dx = abs(xk - x_src);
+
+                            if (v != invalid_fill &&
+                                abs(v - v_center) < depth_diff) {
+                                float w = gweights[dx] * gweights[dy];
+                                v_sum += w * v;
+                                w_sum += w;
+                            }
+                        }
+                    }
+                    d = w_sum == 0 ? invalid_fill : v_sum / w_sum;
+                }
+                *depth_indexer.GetDataPtr<float>(x, y) = d;
+
+                float* vertex = vertex_indexer.GetDataPtr<float>(x, y);
+                if (!is_invalid(d)) {
+                    ti.Unproject(static_cast<float>(x), static_cast<float>(y),
+                                 d, vertex + 0, vertex + 1, vertex + 2);
+                } else {
+                    vertex[0] = invalid_fill;
+                    vertex[1] = invalid_fill;
+                    vertex[2] = invalid_fill;
+                }
+            });
+}
+
 #ifdef __CUDACC__
 void CreateVertexMapCUDA
 #else
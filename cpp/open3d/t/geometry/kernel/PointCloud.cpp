@@ -31,6 +31,7 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -120,6 +121,132 @@ void Project(
     }
 }
 
+void GroupByVoxel(const core::Tensor& voxel_indices,
+                  int64_t num_voxels,
+                  core::Tensor& splits,
+                  core::Tensor& members) {
+    core::AssertTensorShape(voxel_indices, {utility::nullopt});
+    core::AssertTensorDtype(voxel_indices, core::Int64);
+
+    core::Tensor voxel_indices_contiguous = voxel_indices.Contiguous();
+    core::Device::DeviceType device_type = voxel_indices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        GroupByVoxelCPU(voxel_indices_contiguous, num_voxels, splits, members);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(GroupByVoxelCUDA, voxel_indices_contiguous, num_voxels,
+                  splits, members);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void VoxelMean(
+        const core::Tensor& splits,
+        const core::Tensor& members,
+        const core::Tensor& values,
+        const utility::optional<std::reference_wrapper<const core::Tensor>>
+                mask,
+        core::Tensor& reduced) {
+    const core::Device device = values.GetDevice();
+    core::AssertTensorDevice(splits, device);
+    core::AssertTensorDevice(members, device);
+    if (mask.has_value()) {
+        core::AssertTensorDevice(mask.value(), device);
+        core::AssertTensorDtype(mask.value(), core::Bool);
+    }
+
+    core::Tensor values_contiguous = values.Contiguous();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        VoxelMeanCPU(splits, members, values_contiguous, mask, reduced);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(VoxelMeanCUDA, splits, members, values_contiguous, mask,
+                  reduced);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void VoxelArgMax(const core::Tensor& splits,
+                 const core::Tensor& members,
+                 const core::Tensor& scores,
+                 core::Tensor& indices) {
+    const core::Device device = scores.GetDevice();
+    core::AssertTensorDevice(splits, device);
+    core::AssertTensorDevice(members, device);
+    core::AssertTensorShape(scores, {members.GetLength()});
+
+    core::Tensor scores_contiguous = scores.Contiguous();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        VoxelArgMaxCPU(splits, members, scores_contiguous, indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(VoxelArgMaxCUDA, splits, members, scores_contiguous, indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void GetPointMaskWithinAABB(const core::Tensor& points,
+                            const core::Tensor& min_bound,
+                            const core::Tensor& max_bound,
+                            core::Tensor& mask) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorShape(min_bound, {3});
+    core::AssertTensorShape(max_bound, {3});
+
+    // Only the bounds are copied to the host, they are passed to the kernel
+    // by value.
+    static const core::Device host("CPU:0");
+    const core::Tensor min_bound_d =
+            min_bound.To(host, core::Float64).Contiguous();
+    const core::Tensor max_bound_d =
+            max_bound.To(host, core::Float64).Contiguous();
+    const core::Tensor points_contiguous = points.Contiguous();
+
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        GetPointMaskWithinAABBCPU(points_contiguous, min_bound_d, max_bound_d,
+                                  mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(GetPointMaskWithinAABBCUDA, points_contiguous, min_bound_d,
+                  max_bound_d, mask);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void GetPointMaskWithinOBB(const core::Tensor& points,
+                           const core::Tensor& center,
+                           const core::Tensor& rotation,
+                           const core::Tensor& extent,
+                           core::Tensor& mask) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorShape(center, {3});
+    core::AssertTensorShape(rotation, {3, 3});
+    core::AssertTensorShape(extent, {3});
+
+    static const core::Device host("CPU:0");
+    const core::Tensor center_d = center.To(host, core::Float64).Contiguous();
+    const core::Tensor rotation_d =
+            rotation.To(host, core::Float64).Contiguous();
+    const core::Tensor extent_d = extent.To(host, core::Float64).Contiguous();
+    const core::Tensor points_contiguous = points.Contiguous();
+
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        GetPointMaskWithinOBBCPU(points_contiguous, center_d, rotation_d,
+                                 extent_d, mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(GetPointMaskWithinOBBCUDA, points_contiguous, center_d,
+                  rotation_d, extent_d, mask);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
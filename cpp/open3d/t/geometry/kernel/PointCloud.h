@@ -57,6 +57,54 @@ void Project(
         float depth_scale,
         float depth_max);
 
+/// Group points by their (compact) voxel index with a counting sort.
+///
+/// \param voxel_indices Int64 tensor of shape {N} with values in
+/// [0, num_voxels).
+/// \param num_voxels Number of voxels.
+/// \param splits Output Int64 tensor of shape {num_voxels + 1}. Points of
+/// voxel i are members[splits[i]:splits[i + 1]].
+/// \param members Output Int64 tensor of shape {N} holding point indices.
+void GroupByVoxel(const core::Tensor& voxel_indices,
+                  int64_t num_voxels,
+                  core::Tensor& splits,
+                  core::Tensor& members);
+
+/// Average a per-point attribute over each voxel group. Integer and Bool
+/// attributes, e.g. labels, take the value of the point with the smallest
+/// index instead. If \p mask is provided, only points with a true mask
+/// contribute.
+void VoxelMean(
+        const core::Tensor& splits,
+        const core::Tensor& members,
+        const core::Tensor& values,
+        const utility::optional<std::reference_wrapper<const core::Tensor>>
+                mask,
+        core::Tensor& reduced);
+
+/// Select the point with the largest score in each voxel group. Ties are
+/// broken by the smaller point index.
+void VoxelArgMax(const core::Tensor& splits,
+                 const core::Tensor& members,
+                 const core::Tensor& scores,
+                 core::Tensor& indices);
+
+/// Computes a Bool mask of shape {N} that is true for the points inside the
+/// axis aligned box [min_bound, max_bound], boundary included.
+void GetPointMaskWithinAABB(const core::Tensor& points,
+                            const core::Tensor& min_bound,
+                            const core::Tensor& max_bound,
+                            core::Tensor& mask);
+
+/// Computes a Bool mask of shape {N} that is true for the points inside the
+/// oriented box, boundary included. The columns of \p rotation are the box
+/// axes and \p extent holds the full lengths along those axes.
+void GetPointMaskWithinOBB(const core::Tensor& points,
+                           const core::Tensor& center,
+                           const core::Tensor& rotation,
+                           const core::Tensor& extent,
+                           core::Tensor& mask);
+
 void UnprojectCPU(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -69,6 +117,17 @@ void UnprojectCPU(
         float depth_max,
         int64_t stride);
 
+void GetPointMaskWithinAABBCPU(const core::Tensor& points,
+                               const core::Tensor& min_bound,
+                               const core::Tensor& max_bound,
+                               core::Tensor& mask);
+
+void GetPointMaskWithinOBBCPU(const core::Tensor& points,
+                              const core::Tensor& center,
+                              const core::Tensor& rotation,
+                              const core::Tensor& extent,
+                              core::Tensor& mask);
+
 void ProjectCPU(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -79,7 +138,66 @@ void ProjectCPU(
         float depth_scale,
         float depth_max);
 
+void GroupByVoxelCPU(const core::Tensor& voxel_indices,
+                     int64_t num_voxels,
+                     core::Tensor& splits,
+                     core::Tensor& members);
+
+void VoxelMeanCPU(
+        const core::Tensor& splits,
+        const core::Tensor& members,
+        const core::Tensor& values,
+        const utility::optional<std::reference_wrapper<const core::Tensor>>
+                mask,
+        core::Tensor& reduced);
+
+void VoxelArgMaxCPU(const core::Tensor& splits,
+                    const core::Tensor& members,
+                    const core::Tensor& scores,
+                    core::Tensor& indices);
+
+/// Farthest point sampling over a contiguous {N, 3} point tensor on CPU.
+/// Returns the Int64 indices of the \p num_samples selected points, starting
+/// from \p start_index.
+void FarthestPointDownSampleCPU(const core::Tensor& points,
+                                int64_t num_samples,
+                                int64_t start_index,
+                                core::Tensor& indices);
+
+/// Greedy Poisson-disk sampling of one phase of grid cells of size \p radius
+/// on CPU. \p cells holds the compact indices of the cells of the phase, and
+/// \p neighbors the {cells.GetLength(), 27} compact indices of their
+/// neighboring cells (-1 if empty). Accepted points are moved to the front of
+/// each cell's range in \p members, counted in \p counts, and flagged in
+/// \p accepted.
+void PoissonDiskSampleCellsCPU(const core::Tensor& points,
+                               const core::Tensor& splits,
+                               core::Tensor& members,
+                               const core::Tensor& cells,
+                               const core::Tensor& neighbors,
+                               core::Tensor& counts,
+                               core::Tensor& accepted,
+                               double radius);
+
 #ifdef BUILD_CUDA_MODULE
+void GroupByVoxelCUDA(const core::Tensor& voxel_indices,
+                      int64_t num_voxels,
+                      core::Tensor& splits,
+                      core::Tensor& members);
+
+void VoxelMeanCUDA(
+        const core::Tensor& splits,
+        const core::Tensor& members,
+        const core::Tensor& values,
+        const utility::optional<std::reference_wrapper<const core::Tensor>>
+                mask,
+        core::Tensor& reduced);
+
+void VoxelArgMaxCUDA(const core::Tensor& splits,
+                     const core::Tensor& members,
+                     const core::Tensor& scores,
+                     core::Tensor& indices);
+
 void UnprojectCUDA(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -92,6 +210,17 @@ void UnprojectCUDA(
         float depth_max,
         int64_t stride);
 
+void GetPointMaskWithinAABBCUDA(const core::Tensor& points,
+                                const core::Tensor& min_bound,
+                                const core::Tensor& max_bound,
+                                core::Tensor& mask);
+
+void GetPointMaskWithinOBBCUDA(const core::Tensor& points,
+                               const core::Tensor& center,
+                               const core::Tensor& rotation,
+                               const core::Tensor& extent,
+                               core::Tensor& mask);
+
 void ProjectCUDA(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
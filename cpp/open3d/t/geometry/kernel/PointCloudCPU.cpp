@@ -24,7 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -97,6 +102,184 @@ void ProjectCPU(
     });
 }
 
+template <typename scalar_t>
+static void FarthestPointDownSampleCPU_(const scalar_t* points_ptr,
+                                        int64_t n,
+                                        int64_t num_samples,
+                                        int64_t start_index,
+                                        int64_t* indices_ptr) {
+    // Structure of arrays, so that the distance update is a unit-stride loop
+    // the compiler can vectorize.
+    std::vector<scalar_t> xs(n), ys(n), zs(n);
+    std::vector<scalar_t> min_dists(n, std::numeric_limits<scalar_t>::max());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        xs[i] = points_ptr[3 * i + 0];
+        ys[i] = points_ptr[3 * i + 1];
+        zs[i] = points_ptr[3 * i + 2];
+    }
+
+    // One contiguous block per thread. With a static schedule each block
+    // stays on the same thread across iterations, and so in its cache.
+    const int64_t num_blocks = std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(), n));
+    const int64_t block_size = (n + num_blocks - 1) / num_blocks;
+    std::vector<scalar_t> block_max(num_blocks);
+    std::vector<int64_t> block_argmax(num_blocks);
+
+    const scalar_t* xs_ptr = xs.data();
+    const scalar_t* ys_ptr = ys.data();
+    const scalar_t* zs_ptr = zs.data();
+    scalar_t* min_dists_ptr = min_dists.data();
+
+    int64_t selected = start_index;
+    indices_ptr[0] = selected;
+    for (int64_t k = 1; k < num_samples; ++k) {
+        const scalar_t sx = xs_ptr[selected];
+        const scalar_t sy = ys_ptr[selected];
+        const scalar_t sz = zs_ptr[selected];
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            const int64_t begin = b * block_size;
+            const int64_t end = std::min(begin + block_size, n);
+
+            for (int64_t i = begin; i < end; ++i) {
+                const scalar_t dx = xs_ptr[i] - sx;
+                const scalar_t dy = ys_ptr[i] - sy;
+                const scalar_t dz = zs_ptr[i] - sz;
+                const scalar_t dist = dx * dx + dy * dy + dz * dz;
+                min_dists_ptr[i] =
+                        dist < min_dists_ptr[i] ? dist : min_dists_ptr[i];
+            }
+
+            scalar_t max_dist = -1;
+            for (int64_t i = begin; i < end; ++i) {
+                max_dist = min_dists_ptr[i] > max_dist ? min_dists_ptr[i]
+                                                       : max_dist;
+            }
+            int64_t max_idx = begin;
+            for (int64_t i = begin; i < end; ++i) {
+                if (min_dists_ptr[i] == max_dist) {
+                    max_idx = i;
+                    break;
+                }
+            }
+            block_max[b] = max_dist;
+            block_argmax[b] = max_idx;
+        }
+
+        // The first maximum wins, so the result does not depend on the number
+        // of threads.
+        int64_t best_block = 0;
+        for (int64_t b = 1; b < num_blocks; ++b) {
+            if (block_max[b] > block_max[best_block]) {
+                best_block = b;
+            }
+        }
+        selected = block_argmax[best_block];
+        indices_ptr[k] = selected;
+    }
+}
+
+void FarthestPointDownSampleCPU(const core::Tensor& points,
+                                int64_t num_samples,
+                                int64_t start_index,
+                                core::Tensor& indices) {
+    indices = core::Tensor::Empty({num_samples}, core::Int64,
+                                  points.GetDevice());
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        FarthestPointDownSampleCPU_(points.GetDataPtr<scalar_t>(),
+                                    points.GetLength(), num_samples,
+                                    start_index, indices.GetDataPtr<int64_t>());
+    });
+}
+
+/// SplitMix64 finalizer, used as a reproducible random visiting priority.
+static inline uint64_t PoissonDiskPriority(int64_t point_idx) {
+    uint64_t z = static_cast<uint64_t>(point_idx) +
+                 UINT64_C(0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+    return z ^ (z >> 31);
+}
+
+void PoissonDiskSampleCellsCPU(const core::Tensor& points,
+                               const core::Tensor& splits,
+                               core::Tensor& members,
+                               const core::Tensor& cells,
+                               const core::Tensor& neighbors,
+                               core::Tensor& counts,
+                               core::Tensor& accepted,
+                               double radius) {
+    const int64_t num_cells = cells.GetLength();
+    const int64_t num_neighbors = neighbors.GetShape(1);
+
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    int64_t* members_ptr = members.GetDataPtr<int64_t>();
+    const int64_t* cells_ptr = cells.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    bool* accepted_ptr = accepted.GetDataPtr<bool>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t radius2 = static_cast<scalar_t>(radius * radius);
+
+        core::ParallelFor(
+                core::Device("CPU:0"), num_cells, [&](int64_t workload_idx) {
+                    const int64_t cell = cells_ptr[workload_idx];
+                    const int64_t begin = splits_ptr[cell];
+                    const int64_t end = splits_ptr[cell + 1];
+                    std::sort(members_ptr + begin, members_ptr + end,
+                              [](int64_t a, int64_t b) {
+                                  const uint64_t pa = PoissonDiskPriority(a);
+                                  const uint64_t pb = PoissonDiskPriority(b);
+                                  return pa < pb || (pa == pb && a < b);
+                              });
+
+                    // Accepted samples of a cell are kept at the front of its
+                    // member range. Neighbors belong to other phases, so their
+                    // ranges are not modified concurrently.
+                    const int64_t* cell_neighbors =
+                            neighbors_ptr + workload_idx * num_neighbors;
+                    for (int64_t k = begin; k < end; ++k) {
+                        const int64_t point_idx = members_ptr[k];
+                        const scalar_t* p = points_ptr + 3 * point_idx;
+
+                        bool is_free = true;
+                        for (int64_t j = 0; j < num_neighbors && is_free;
+                             ++j) {
+                            const int64_t nb = cell_neighbors[j];
+                            if (nb < 0) continue;
+                            const int64_t nb_begin = splits_ptr[nb];
+                            const int64_t nb_end = nb_begin + counts_ptr[nb];
+                            for (int64_t l = nb_begin; l < nb_end; ++l) {
+                                const scalar_t* q =
+                                        points_ptr + 3 * members_ptr[l];
+                                const scalar_t dx = p[0] - q[0];
+                                const scalar_t dy = p[1] - q[1];
+                                const scalar_t dz = p[2] - q[2];
+                                if (dx * dx + dy * dy + dz * dz < radius2) {
+                                    is_free = false;
+                                    break;
+                                }
+                            }
+                        }
+
+                        if (is_free) {
+                            const int64_t slot = begin + counts_ptr[cell];
+                            std::swap(members_ptr[slot], members_ptr[k]);
+                            counts_ptr[cell] += 1;
+                            accepted_ptr[point_idx] = true;
+                        }
+                    }
+                });
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -42,6 +42,13 @@
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/utility/Logging.h"
 
+#if defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#else
+#include "open3d/utility/ParallelScan.h"
+#endif
+
 namespace open3d {
 namespace t {
 namespace geometry {
@@ -858,6 +865,246 @@ void EstimateColorGradientsUsingKNNSearchCPU
     core::cuda::Synchronize(points.GetDevice());
 }
 
+#if defined(__CUDACC__)
+void GetPointMaskWithinAABBCUDA
+#else
+void GetPointMaskWithinAABBCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& min_bound,
+         const core::Tensor& max_bound,
+         core::Tensor& mask) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    mask = core::Tensor::Empty({n}, core::Bool, device);
+    bool* mask_ptr = mask.GetDataPtr<bool>();
+
+    const double* min_ptr = min_bound.GetDataPtr<double>();
+    const double* max_ptr = max_bound.GetDataPtr<double>();
+    const double min_x = min_ptr[0], min_y = min_ptr[1], min_z = min_ptr[2];
+    const double max_x = max_ptr[0], max_y = max_ptr[1], max_z = max_ptr[2];
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const double x = points_ptr[3 * workload_idx + 0];
+            const double y = points_ptr[3 * workload_idx + 1];
+            const double z = points_ptr[3 * workload_idx + 2];
+            mask_ptr[workload_idx] = x >= min_x && x <= max_x && y >= min_y &&
+                                     y <= max_y && z >= min_z && z <= max_z;
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void GetPointMaskWithinOBBCUDA
+#else
+void GetPointMaskWithinOBBCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& center,
+         const core::Tensor& rotation,
+         const core::Tensor& extent,
+         core::Tensor& mask) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    mask = core::Tensor::Empty({n}, core::Bool, device);
+    bool* mask_ptr = mask.GetDataPtr<bool>();
+
+    const double* c = center.GetDataPtr<double>();
+    const double* R = rotation.GetDataPtr<double>();
+    const double* e = extent.GetDataPtr<double>();
+    const double cx = c[0], cy = c[1], cz = c[2];
+    // Rows of R^T, i.e. the box axes.
+    const double ax0 = R[0], ax1 = R[3], ax2 = R[6];
+    const double ay0 = R[1], ay1 = R[4], ay2 = R[7];
+    const double az0 = R[2], az1 = R[5], az2 = R[8];
+    const double hx = e[0] * 0.5, hy = e[1] * 0.5, hz = e[2] * 0.5;
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const double dx = points_ptr[3 * workload_idx + 0] - cx;
+            const double dy = points_ptr[3 * workload_idx + 1] - cy;
+            const double dz = points_ptr[3 * workload_idx + 2] - cz;
+            const double lx = ax0 * dx + ax1 * dy + ax2 * dz;
+            const double ly = ay0 * dx + ay1 * dy + ay2 * dz;
+            const double lz = az0 * dx + az1 * dy + az2 * dz;
+            mask_ptr[workload_idx] = abs(lx) <= hx && abs(ly) <= hy &&
+                                     abs(lz) <= hz;
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void GroupByVoxelCUDA
+#else
+void GroupByVoxelCPU
+#endif
+        (const core::Tensor& voxel_indices,
+         int64_t num_voxels,
+         core::Tensor& splits,
+         core::Tensor& members) {
+    const core::Device device = voxel_indices.GetDevice();
+    const int64_t n = voxel_indices.GetLength();
+    const int64_t* voxel_indices_ptr = voxel_indices.GetDataPtr<int64_t>();
+
+    // Counting sort: histogram -> prefix sum -> scatter.
+    core::Tensor counts =
+            core::Tensor::Zeros({num_voxels}, core::Int64, device);
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t voxel_idx = voxel_indices_ptr[workload_idx];
+#if defined(__CUDACC__)
+        atomicAdd(reinterpret_cast<unsigned long long*>(counts_ptr + voxel_idx),
+                  1ULL);
+#else
+#pragma omp atomic
+        counts_ptr[voxel_idx] += 1;
+#endif
+    });
+
+    splits = core::Tensor::Zeros({num_voxels + 1}, core::Int64, device);
+    int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, counts_ptr, counts_ptr + num_voxels,
+                           splits_ptr + 1);
+#else
+    utility::InclusivePrefixSum(counts_ptr, counts_ptr + num_voxels,
+                                splits_ptr + 1);
+#endif
+
+    // Reuse counts as per-voxel write cursors.
+    counts.AsRvalue() = splits.Slice(0, 0, num_voxels);
+    members = core::Tensor::Empty({n}, core::Int64, device);
+    int64_t* members_ptr = members.GetDataPtr<int64_t>();
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t voxel_idx = voxel_indices_ptr[workload_idx];
+        int64_t offset;
+#if defined(__CUDACC__)
+        offset = static_cast<int64_t>(atomicAdd(
+                reinterpret_cast<unsigned long long*>(counts_ptr + voxel_idx),
+                1ULL));
+#else
+#pragma omp atomic capture
+        offset = counts_ptr[voxel_idx]++;
+#endif
+        members_ptr[offset] = workload_idx;
+    });
+}
+
+#if defined(__CUDACC__)
+void VoxelMeanCUDA
+#else
+void VoxelMeanCPU
+#endif
+        (const core::Tensor& splits,
+         const core::Tensor& members,
+         const core::Tensor& values,
+         const utility::optional<std::reference_wrapper<const core::Tensor>>
+                 mask,
+         core::Tensor& reduced) {
+    const core::Device device = values.GetDevice();
+    const int64_t num_voxels = splits.GetLength() - 1;
+    const int64_t n = values.GetLength();
+    const int64_t channels = n == 0 ? 0 : values.NumElements() / n;
+
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    const int64_t* members_ptr = members.GetDataPtr<int64_t>();
+    const bool* mask_ptr =
+            mask.has_value() ? mask.value().get().GetDataPtr<bool>() : nullptr;
+
+    core::SizeVector reduced_shape = values.GetShape();
+    reduced_shape[0] = num_voxels;
+    reduced = core::Tensor::Empty(reduced_shape, values.GetDtype(), device);
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* reduced_ptr = reduced.GetDataPtr<scalar_t>();
+        const bool is_float = std::is_floating_point<scalar_t>::value;
+
+        core::ParallelFor(
+                device, num_voxels * channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t voxel_idx = workload_idx / channels;
+                    int64_t c = workload_idx % channels;
+
+                    double sum = 0;
+                    int64_t count = 0;
+                    // Scatter order is not deterministic, the first point is
+                    // the one with the smallest index.
+                    int64_t first_idx = -1;
+                    for (int64_t k = splits_ptr[voxel_idx];
+                         k < splits_ptr[voxel_idx + 1]; ++k) {
+                        int64_t point_idx = members_ptr[k];
+                        if (mask_ptr != nullptr && !mask_ptr[point_idx]) {
+                            continue;
+                        }
+                        if (first_idx < 0 || point_idx < first_idx) {
+                            first_idx = point_idx;
+                        }
+                        sum += static_cast<double>(
+                                values_ptr[point_idx * channels + c]);
+                        ++count;
+                    }
+                    if (is_float) {
+                        reduced_ptr[workload_idx] = static_cast<scalar_t>(
+                                count > 0 ? sum / count : 0);
+                    } else if (first_idx >= 0) {
+                        // The mean of labels, ids or flags is not one of
+                        // their values, keep the value of the first point.
+                        reduced_ptr[workload_idx] =
+                                values_ptr[first_idx * channels + c];
+                    } else {
+                        reduced_ptr[workload_idx] = scalar_t(0);
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void VoxelArgMaxCUDA
+#else
+void VoxelArgMaxCPU
+#endif
+        (const core::Tensor& splits,
+         const core::Tensor& members,
+         const core::Tensor& scores,
+         core::Tensor& indices) {
+    const core::Device device = scores.GetDevice();
+    const int64_t num_voxels = splits.GetLength() - 1;
+
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    const int64_t* members_ptr = members.GetDataPtr<int64_t>();
+
+    indices = core::Tensor::Empty({num_voxels}, core::Int64, device);
+    int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+
+    DISPATCH_DTYPE_TO_TEMPLATE(scores.GetDtype(), [&]() {
+        const scalar_t* scores_ptr = scores.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_voxels, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t begin = splits_ptr[workload_idx];
+                    int64_t end = splits_ptr[workload_idx + 1];
+
+                    int64_t best_idx = members_ptr[begin];
+                    scalar_t best_score = scores_ptr[best_idx];
+                    for (int64_t k = begin + 1; k < end; ++k) {
+                        int64_t point_idx = members_ptr[k];
+                        scalar_t score = scores_ptr[point_idx];
+                        // Scatter order is not deterministic, break ties by
+                        // the smaller point index.
+                        if (score > best_score ||
+                            (score == best_score && point_idx < best_idx)) {
+                            best_score = score;
+                            best_idx = point_idx;
+                        }
+                    }
+                    indices_ptr[workload_idx] = best_idx;
+                });
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -33,6 +33,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Utility.h"
+#include "open3d/t/geometry/kernel/BlockLookupTable.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/TSDFVoxel.h"
@@ -1180,10 +1181,25 @@ void RayCastCPU
     }
     auto hashmap_impl = cuda_hashmap->GetImpl();
 #else
-    auto cpu_hashmap =
-            std::dynamic_pointer_cast<core::TBBHashBackend<Key, Hash, Eq>>(
-                    hashmap);
-    auto hashmap_impl = *cpu_hashmap->GetImpl();
+    BlockLookupTable lookup_table(*hashmap, voxel_size * block_resolution);
+    const BlockLookupTable* lookup_table_ptr = &lookup_table;
+
+    // The TBB map is only queried when the lookup table is too large to
+    // build.
+    const tbb::concurrent_unordered_map<Key, core::buf_index_t, Hash, Eq>*
+            hashmap_impl = nullptr;
+    if (!lookup_table.IsValid()) {
+        auto cpu_hashmap =
+                std::dynamic_pointer_cast<core::TBBHashBackend<Key, Hash, Eq>>(
+                        hashmap);
+        if (cpu_hashmap == nullptr) {
+            utility::LogError(
+                    "Unsupported backend: the active blocks span too large a "
+                    "region for the lookup table, and CPU raycasting can only "
+                    "query the hash map directly with TBB.");
+        }
+        hashmap_impl = cpu_hashmap->GetImpl().get();
+    }
 #endif
 
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
@@ -1233,6 +1249,23 @@ void RayCastCPU
         core::ParallelFor(
                 hashmap->GetDevice(), rows * cols,
                 [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    // Buffer index of the block, or -1 if it is not active.
+                    auto FindBlock = [&] OPEN3D_DEVICE(const Key& key) -> int {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+                        auto iter = hashmap_impl.find(key);
+                        if (iter == hashmap_impl.end()) return -1;
+                        return iter->second;
+#else
+                        if (lookup_table_ptr->IsValid()) {
+                            return lookup_table_ptr->Find(key[0], key[1],
+                                                          key[2]);
+                        }
+                        auto iter = hashmap_impl->find(key);
+                        if (iter == hashmap_impl->end()) return -1;
+                        return iter->second;
+#endif
+                    };
+
                     auto GetVoxelAtP =
                             [&] OPEN3D_DEVICE(int x_b, int y_b, int z_b,
                                               int x_v, int y_v, int z_v,
@@ -1255,9 +1288,8 @@ void RayCastCPU
                             int block_addr =
                                     cache.Check(key[0], key[1], key[2]);
                             if (block_addr < 0) {
-                                auto iter = hashmap_impl.find(key);
-                                if (iter == hashmap_impl.end()) return nullptr;
-                                block_addr = iter->second;
+                                block_addr = FindBlock(key);
+                                if (block_addr < 0) return nullptr;
                                 cache.Update(key[0], key[1], key[2],
                                              block_addr);
                             }
@@ -1285,9 +1317,8 @@ void RayCastCPU
                         Key key(x_b, y_b, z_b);
                         int block_addr = cache.Check(x_b, y_b, z_b);
                         if (block_addr < 0) {
-                            auto iter = hashmap_impl.find(key);
-                            if (iter == hashmap_impl.end()) return nullptr;
-                            block_addr = iter->second;
+                            block_addr = FindBlock(key);
+                            if (block_addr < 0) return nullptr;
                             cache.Update(x_b, y_b, z_b, block_addr);
                         }
 
@@ -1421,9 +1452,8 @@ void RayCastCPU
 
                             int block_addr = cache.Check(x_b, y_b, z_b);
                             if (block_addr < 0) {
-                                auto iter = hashmap_impl.find(key);
-                                if (iter == hashmap_impl.end()) return;
-                                block_addr = iter->second;
+                                block_addr = FindBlock(key);
+                                if (block_addr < 0) return;
                                 cache.Update(x_b, y_b, z_b, block_addr);
                             }
 
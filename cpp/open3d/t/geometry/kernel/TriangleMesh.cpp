@@ -0,0 +1,516 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+void ClusterTriangles(const core::Tensor& triangles,
+                      const core::Tensor& cluster_ids,
+                      core::Tensor& clustered_triangles,
+                      core::Tensor& valid) {
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+    core::AssertTensorDtype(cluster_ids, core::Int64);
+    core::AssertTensorDevice(cluster_ids, triangles.GetDevice());
+
+    const core::Tensor triangles_c = triangles.Contiguous();
+    const core::Tensor cluster_ids_c = cluster_ids.Contiguous();
+
+    const core::Device::DeviceType device_type =
+            triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ClusterTrianglesCPU(triangles_c, cluster_ids_c, clustered_triangles,
+                            valid);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ClusterTrianglesCUDA, triangles_c, cluster_ids_c,
+                  clustered_triangles, valid);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ClusterQuadricPositions(const core::Tensor& positions,
+                             const core::Tensor& triangles,
+                             const core::Tensor& corner_splits,
+                             const core::Tensor& corner_members,
+                             const core::Tensor& cluster_means,
+                             double max_distance,
+                             core::Tensor& cluster_positions) {
+    const core::Device device = positions.GetDevice();
+    core::AssertTensorShape(positions, {utility::nullopt, 3});
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+    core::AssertTensorDevice(triangles, device);
+    core::AssertTensorDtype(corner_splits, core::Int64);
+    core::AssertTensorDevice(corner_splits, device);
+    core::AssertTensorDtype(corner_members, core::Int64);
+    core::AssertTensorDevice(corner_members, device);
+    core::AssertTensorShape(cluster_means, {corner_splits.GetLength() - 1, 3});
+    core::AssertTensorDtype(cluster_means, positions.GetDtype());
+    core::AssertTensorDevice(cluster_means, device);
+
+    const core::Tensor positions_c = positions.Contiguous();
+    const core::Tensor triangles_c = triangles.Contiguous();
+    const core::Tensor cluster_means_c = cluster_means.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ClusterQuadricPositionsCPU(positions_c, triangles_c, corner_splits,
+                                   corner_members, cluster_means_c,
+                                   max_distance, cluster_positions);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ClusterQuadricPositionsCUDA, positions_c, triangles_c,
+                  corner_splits, corner_members, cluster_means_c,
+                  max_distance, cluster_positions);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SelectTrianglesByVertexMask(const core::Tensor& triangles,
+                                 const core::Tensor& vertex_mask,
+                                 core::Tensor& remapped_triangles,
+                                 core::Tensor& triangle_mask) {
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+    core::AssertTensorDtype(vertex_mask, core::Bool);
+    core::AssertTensorDevice(vertex_mask, triangles.GetDevice());
+
+    const core::Tensor triangles_c = triangles.Contiguous();
+    const core::Tensor vertex_mask_c = vertex_mask.Contiguous();
+
+    const core::Device::DeviceType device_type =
+            triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SelectTrianglesByVertexMaskCPU(triangles_c, vertex_mask_c,
+                                       remapped_triangles, triangle_mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SelectTrianglesByVertexMaskCUDA, triangles_c, vertex_mask_c,
+                  remapped_triangles, triangle_mask);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeVertexAdjacency(const core::Tensor& triangles,
+                            int64_t num_vertices,
+                            core::Tensor& splits,
+                            core::Tensor& neighbors) {
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+
+    const core::Tensor triangles_c = triangles.Contiguous();
+
+    const core::Device::DeviceType device_type =
+            triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexAdjacencyCPU(triangles_c, num_vertices, splits, neighbors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVertexAdjacencyCUDA, triangles_c, num_vertices,
+                  splits, neighbors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+/// Checks the adjacency from ComputeVertexAdjacency of \p num_vertices
+/// vertices.
+static void AssertAdjacency(const core::Tensor& splits,
+                            const core::Tensor& neighbors,
+                            int64_t num_vertices,
+                            const core::Device& device) {
+    core::AssertTensorShape(splits, {num_vertices + 1});
+    core::AssertTensorDtype(splits, core::Int64);
+    core::AssertTensorDevice(splits, device);
+    core::AssertTensorDtype(neighbors, core::Int64);
+    core::AssertTensorDevice(neighbors, device);
+    if (!splits.IsContiguous() || !neighbors.IsContiguous()) {
+        utility::LogError("Adjacency tensors must be contiguous.");
+    }
+}
+
+void ComputeInverseDistanceWeights(const core::Tensor& positions,
+                                   const core::Tensor& splits,
+                                   const core::Tensor& neighbors,
+                                   core::Tensor& weights) {
+    const core::Device device = positions.GetDevice();
+    core::AssertTensorShape(positions, {utility::nullopt, 3});
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    AssertAdjacency(splits, neighbors, positions.GetLength(), device);
+
+    const core::Tensor positions_c = positions.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeInverseDistanceWeightsCPU(positions_c, splits, neighbors,
+                                         weights);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeInverseDistanceWeightsCUDA, positions_c, splits,
+                  neighbors, weights);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeCotangentWeights(const core::Tensor& positions,
+                             const core::Tensor& triangles,
+                             const core::Tensor& splits,
+                             const core::Tensor& neighbors,
+                             core::Tensor& weights) {
+    const core::Device device = positions.GetDevice();
+    core::AssertTensorShape(positions, {utility::nullopt, 3});
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+    core::AssertTensorDevice(triangles, device);
+    AssertAdjacency(splits, neighbors, positions.GetLength(), device);
+
+    const core::Tensor positions_c = positions.Contiguous();
+    const core::Tensor triangles_c = triangles.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeCotangentWeightsCPU(positions_c, triangles_c, splits,
+                                   neighbors, weights);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeCotangentWeightsCUDA, positions_c, triangles_c,
+                  splits, neighbors, weights);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+/// Checks the input and the preallocated output of the filters.
+static void AssertFilterValues(const core::Tensor& values,
+                               const core::Tensor& filtered) {
+    core::AssertTensorDtypes(values, {core::Float32, core::Float64});
+    if (values.NumDims() != 2) {
+        utility::LogError("Expected values of shape {N, C}, but got {}.",
+                          values.GetShape().ToString());
+    }
+    core::AssertTensorShape(filtered, values.GetShape());
+    core::AssertTensorDtype(filtered, values.GetDtype());
+    core::AssertTensorDevice(filtered, values.GetDevice());
+    if (!filtered.IsContiguous()) {
+        utility::LogError("filtered must be contiguous.");
+    }
+    if (filtered.GetDataPtr() == values.GetDataPtr()) {
+        utility::LogError("filtered must not alias values.");
+    }
+}
+
+void FilterSharpen(const core::Tensor& splits,
+                   const core::Tensor& neighbors,
+                   const core::Tensor& values,
+                   double strength,
+                   core::Tensor& filtered) {
+    const core::Device device = values.GetDevice();
+    AssertFilterValues(values, filtered);
+    AssertAdjacency(splits, neighbors, values.GetLength(), device);
+
+    const core::Tensor values_c = values.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterSharpenCPU(splits, neighbors, values_c, strength, filtered);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterSharpenCUDA, splits, neighbors, values_c, strength,
+                  filtered);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterSmoothSimple(const core::Tensor& splits,
+                        const core::Tensor& neighbors,
+                        const core::Tensor& values,
+                        core::Tensor& filtered) {
+    const core::Device device = values.GetDevice();
+    AssertFilterValues(values, filtered);
+    AssertAdjacency(splits, neighbors, values.GetLength(), device);
+
+    const core::Tensor values_c = values.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterSmoothSimpleCPU(splits, neighbors, values_c, filtered);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterSmoothSimpleCUDA, splits, neighbors, values_c,
+                  filtered);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterSmoothLaplacian(const core::Tensor& splits,
+                           const core::Tensor& neighbors,
+                           const core::Tensor& weights,
+                           const core::Tensor& values,
+                           double lambda,
+                           core::Tensor& filtered) {
+    const core::Device device = values.GetDevice();
+    AssertFilterValues(values, filtered);
+    AssertAdjacency(splits, neighbors, values.GetLength(), device);
+    core::AssertTensorShape(weights, neighbors.GetShape());
+    core::AssertTensorDtype(weights, core::Float64);
+    core::AssertTensorDevice(weights, device);
+
+    const core::Tensor values_c = values.Contiguous();
+    const core::Tensor weights_c = weights.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterSmoothLaplacianCPU(splits, neighbors, weights_c, values_c,
+                                 lambda, filtered);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterSmoothLaplacianCUDA, splits, neighbors, weights_c,
+                  values_c, lambda, filtered);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeTriangleNormals(const core::Tensor& positions,
+                            const core::Tensor& triangles,
+                            bool normalized,
+                            core::Tensor& normals) {
+    const core::Device device = positions.GetDevice();
+    core::AssertTensorShape(positions, {utility::nullopt, 3});
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+    core::AssertTensorDevice(triangles, device);
+
+    const core::Tensor positions_c = positions.Contiguous();
+    const core::Tensor triangles_c = triangles.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleNormalsCPU(positions_c, triangles_c, normalized,
+                                  normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeTriangleNormalsCUDA, positions_c, triangles_c,
+                  normalized, normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+/// Checks the inputs of the kernels that gather the triangle corners of each
+/// vertex.
+static void AssertVertexCorners(const core::Tensor& positions,
+                                const core::Tensor& triangles,
+                                const core::Tensor& corner_splits,
+                                const core::Tensor& corner_members) {
+    const core::Device device = positions.GetDevice();
+    core::AssertTensorShape(positions, {utility::nullopt, 3});
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+    core::AssertTensorDevice(triangles, device);
+    core::AssertTensorShape(corner_splits, {positions.GetLength() + 1});
+    core::AssertTensorDtype(corner_splits, core::Int64);
+    core::AssertTensorDevice(corner_splits, device);
+    core::AssertTensorShape(corner_members, {triangles.NumElements()});
+    core::AssertTensorDtype(corner_members, core::Int64);
+    core::AssertTensorDevice(corner_members, device);
+}
+
+void ComputeVertexNormals(const core::Tensor& positions,
+                          const core::Tensor& triangles,
+                          const core::Tensor& corner_splits,
+                          const core::Tensor& corner_members,
+                          bool angle_weighted,
+                          bool normalized,
+                          core::Tensor& normals) {
+    AssertVertexCorners(positions, triangles, corner_splits, corner_members);
+
+    const core::Tensor positions_c = positions.Contiguous();
+    const core::Tensor triangles_c = triangles.Contiguous();
+    const core::Tensor corner_splits_c = corner_splits.Contiguous();
+    const core::Tensor corner_members_c = corner_members.Contiguous();
+
+    const core::Device::DeviceType device_type =
+            positions.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexNormalsCPU(positions_c, triangles_c, corner_splits_c,
+                                corner_members_c, angle_weighted, normalized,
+                                normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVertexNormalsCUDA, positions_c, triangles_c,
+                  corner_splits_c, corner_members_c, angle_weighted,
+                  normalized, normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeVertexAreas(const core::Tensor& positions,
+                        const core::Tensor& triangles,
+                        const core::Tensor& corner_splits,
+                        const core::Tensor& corner_members,
+                        core::Tensor& areas) {
+    AssertVertexCorners(positions, triangles, corner_splits, corner_members);
+
+    const core::Tensor positions_c = positions.Contiguous();
+    const core::Tensor triangles_c = triangles.Contiguous();
+    const core::Tensor corner_splits_c = corner_splits.Contiguous();
+    const core::Tensor corner_members_c = corner_members.Contiguous();
+
+    const core::Device::DeviceType device_type =
+            positions.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexAreasCPU(positions_c, triangles_c, corner_splits_c,
+                              corner_members_c, areas);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVertexAreasCUDA, positions_c, triangles_c,
+                  corner_splits_c, corner_members_c, areas);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeVertexCurvatures(const core::Tensor& positions,
+                             const core::Tensor& triangles,
+                             const core::Tensor& corner_splits,
+                             const core::Tensor& corner_members,
+                             core::Tensor& mean_curvatures,
+                             core::Tensor& gaussian_curvatures) {
+    AssertVertexCorners(positions, triangles, corner_splits, corner_members);
+
+    const core::Tensor positions_c = positions.Contiguous();
+    const core::Tensor triangles_c = triangles.Contiguous();
+    const core::Tensor corner_splits_c = corner_splits.Contiguous();
+    const core::Tensor corner_members_c = corner_members.Contiguous();
+
+    const core::Device::DeviceType device_type =
+            positions.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexCurvaturesCPU(positions_c, triangles_c, corner_splits_c,
+                                   corner_members_c, mean_curvatures,
+                                   gaussian_curvatures);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVertexCurvaturesCUDA, positions_c, triangles_c,
+                  corner_splits_c, corner_members_c, mean_curvatures,
+                  gaussian_curvatures);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeEdgeTriangles(const core::Tensor& triangles,
+                          int64_t num_vertices,
+                          core::Tensor& edges,
+                          core::Tensor& splits,
+                          core::Tensor& edge_triangles) {
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+
+    const core::Tensor triangles_c = triangles.Contiguous();
+
+    const core::Device::DeviceType device_type =
+            triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeEdgeTrianglesCPU(triangles_c, num_vertices, edges, splits,
+                                edge_triangles);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeEdgeTrianglesCUDA, triangles_c, num_vertices, edges,
+                  splits, edge_triangles);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void LabelConnectedTriangles(const core::Tensor& splits,
+                             const core::Tensor& edge_triangles,
+                             int64_t num_triangles,
+                             core::Tensor& labels) {
+    const core::Device device = splits.GetDevice();
+    core::AssertTensorDtype(splits, core::Int64);
+    core::AssertTensorShape(edge_triangles, {3 * num_triangles});
+    core::AssertTensorDtype(edge_triangles, core::Int64);
+    core::AssertTensorDevice(edge_triangles, device);
+
+    const core::Tensor splits_c = splits.Contiguous();
+    const core::Tensor edge_triangles_c = edge_triangles.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        LabelConnectedTrianglesCPU(splits_c, edge_triangles_c, num_triangles,
+                                   labels);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(LabelConnectedTrianglesCUDA, splits_c, edge_triangles_c,
+                  num_triangles, labels);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeNonManifoldVertices(const core::Tensor& triangles,
+                                const core::Tensor& corner_splits,
+                                const core::Tensor& corner_members,
+                                core::Tensor& non_manifold) {
+    const core::Device device = triangles.GetDevice();
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+    core::AssertTensorDtype(corner_splits, core::Int64);
+    core::AssertTensorDevice(corner_splits, device);
+    core::AssertTensorShape(corner_members, {triangles.NumElements()});
+    core::AssertTensorDtype(corner_members, core::Int64);
+    core::AssertTensorDevice(corner_members, device);
+
+    const core::Tensor triangles_c = triangles.Contiguous();
+    const core::Tensor corner_splits_c = corner_splits.Contiguous();
+    const core::Tensor corner_members_c = corner_members.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeNonManifoldVerticesCPU(triangles_c, corner_splits_c,
+                                      corner_members_c, non_manifold);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeNonManifoldVerticesCUDA, triangles_c,
+                  corner_splits_c, corner_members_c, non_manifold);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
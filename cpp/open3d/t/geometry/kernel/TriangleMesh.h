@@ -0,0 +1,501 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Maps the triangles to vertex clusters. Each output triangle is rotated so
+/// that its smallest index comes first, keeping the orientation. Triangles
+/// with two or more corners in the same cluster are marked as invalid.
+///
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param cluster_ids Int64 cluster index of each vertex, shape {N}.
+/// \param clustered_triangles Output Int64 tensor of shape {T, 3}.
+/// \param valid Output Bool tensor of shape {T}.
+void ClusterTriangles(const core::Tensor& triangles,
+                      const core::Tensor& cluster_ids,
+                      core::Tensor& clustered_triangles,
+                      core::Tensor& valid);
+
+/// Computes a representative position per vertex cluster by minimizing the
+/// sum of the area-weighted plane quadrics of the triangles incident to the
+/// cluster. Falls back to \p cluster_means if the quadric is singular or if
+/// the minimum lies farther than \p max_distance from the mean.
+///
+/// \param positions Float32 or Float64 vertex positions of shape {N, 3}.
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param corner_splits Int64 {M + 1} offsets of each cluster in
+/// \p corner_members.
+/// \param corner_members Int64 {3T} triangle corners (3 * triangle + k)
+/// grouped by cluster.
+/// \param cluster_means Mean vertex positions of shape {M, 3}.
+/// \param max_distance Maximum distance from the quadric minimum to the mean.
+/// \param cluster_positions Output positions of shape {M, 3}.
+void ClusterQuadricPositions(const core::Tensor& positions,
+                             const core::Tensor& triangles,
+                             const core::Tensor& corner_splits,
+                             const core::Tensor& corner_members,
+                             const core::Tensor& cluster_means,
+                             double max_distance,
+                             core::Tensor& cluster_positions);
+
+/// Keeps the triangles whose three vertices are selected by \p vertex_mask
+/// and remaps their indices to the compacted vertex list, computed with a
+/// prefix sum over the mask.
+///
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param vertex_mask Bool tensor of shape {N}.
+/// \param remapped_triangles Output Int64 tensor of shape {T, 3}. Only the
+/// rows of the kept triangles are valid.
+/// \param triangle_mask Output Bool tensor of shape {T}.
+void SelectTrianglesByVertexMask(const core::Tensor& triangles,
+                                 const core::Tensor& vertex_mask,
+                                 core::Tensor& remapped_triangles,
+                                 core::Tensor& triangle_mask);
+
+/// Builds the vertex adjacency of a triangle mesh in compressed sparse row
+/// form. The directed edges of the triangles are grouped by source vertex
+/// with a counting sort, then the targets of each vertex are sorted and
+/// deduplicated in parallel.
+///
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param num_vertices Number of vertices N.
+/// \param splits Output Int64 tensor of shape {N + 1}. The neighbors of
+/// vertex i are neighbors[splits[i]:splits[i + 1]].
+/// \param neighbors Output Int64 tensor of the sorted neighbor indices.
+void ComputeVertexAdjacency(const core::Tensor& triangles,
+                            int64_t num_vertices,
+                            core::Tensor& splits,
+                            core::Tensor& neighbors);
+
+/// Computes the weight 1 / (|p_i - p_j| + 1e-12) of every adjacency entry
+/// (i, j).
+///
+/// \param positions Float32 or Float64 vertex positions of shape {N, 3}.
+/// \param splits Adjacency offsets from ComputeVertexAdjacency.
+/// \param neighbors Adjacency entries from ComputeVertexAdjacency.
+/// \param weights Output Float64 tensor with one weight per entry.
+void ComputeInverseDistanceWeights(const core::Tensor& positions,
+                                   const core::Tensor& splits,
+                                   const core::Tensor& neighbors,
+                                   core::Tensor& weights);
+
+/// Computes the cotangent weight (cot(a) + cot(b)) / 2 of every adjacency
+/// entry (i, j), where a and b are the angles opposite to the edge in its
+/// triangles. Boundary edges have a single angle.
+///
+/// \param positions Float32 or Float64 vertex positions of shape {N, 3}.
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param splits Adjacency offsets from ComputeVertexAdjacency.
+/// \param neighbors Adjacency entries from ComputeVertexAdjacency.
+/// \param weights Output Float64 tensor with one weight per entry.
+void ComputeCotangentWeights(const core::Tensor& positions,
+                             const core::Tensor& triangles,
+                             const core::Tensor& splits,
+                             const core::Tensor& neighbors,
+                             core::Tensor& weights);
+
+/// One pass of sharpening, v_o = v_i + strength * (|N| v_i - sum_n v_n).
+///
+/// \param splits Adjacency offsets from ComputeVertexAdjacency.
+/// \param neighbors Adjacency entries from ComputeVertexAdjacency.
+/// \param values Float32 or Float64 vertex attribute of shape {N, C}.
+/// \param strength Strength of the filter.
+/// \param filtered Preallocated output of the same shape and dtype as
+/// \p values. Must not alias \p values.
+void FilterSharpen(const core::Tensor& splits,
+                   const core::Tensor& neighbors,
+                   const core::Tensor& values,
+                   double strength,
+                   core::Tensor& filtered);
+
+/// One pass of neighborhood averaging, v_o = (v_i + sum_n v_n) / (|N| + 1).
+/// Arguments as in FilterSharpen.
+void FilterSmoothSimple(const core::Tensor& splits,
+                        const core::Tensor& neighbors,
+                        const core::Tensor& values,
+                        core::Tensor& filtered);
+
+/// One pass of weighted Laplacian smoothing,
+/// v_o = v_i + lambda * (sum_n w_n v_n / sum_n w_n - v_i). Negative weights
+/// are clamped to zero, and vertices with a zero total weight are kept.
+///
+/// \param weights Float64 weight of every adjacency entry.
+/// \param lambda Smoothing parameter.
+/// Other arguments as in FilterSharpen.
+void FilterSmoothLaplacian(const core::Tensor& splits,
+                           const core::Tensor& neighbors,
+                           const core::Tensor& weights,
+                           const core::Tensor& values,
+                           double lambda,
+                           core::Tensor& filtered);
+
+/// Computes the triangle normals (p1 - p0) x (p2 - p0).
+///
+/// \param positions Float32 or Float64 vertex positions of shape {N, 3}.
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param normalized If true, the normals are normalized. Degenerate
+/// triangles get (0, 0, 1).
+/// \param normals Output tensor of shape {T, 3} and the dtype of
+/// \p positions.
+void ComputeTriangleNormals(const core::Tensor& positions,
+                            const core::Tensor& triangles,
+                            bool normalized,
+                            core::Tensor& normals);
+
+/// Computes the vertex normals by gathering the normals of the incident
+/// triangles of each vertex, without atomics.
+///
+/// \param positions Float32 or Float64 vertex positions of shape {N, 3}.
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param corner_splits Int64 {N + 1} offsets of each vertex in
+/// \p corner_members.
+/// \param corner_members Int64 {3T} triangle corners (3 * triangle + k)
+/// grouped by vertex.
+/// \param angle_weighted If true, the unit triangle normals are weighted by
+/// the corner angles, otherwise by the triangle areas.
+/// \param normalized If true, the normals are normalized. Vertices without
+/// a valid incident triangle get (0, 0, 1).
+/// \param normals Output tensor of shape {N, 3} and the dtype of
+/// \p positions.
+void ComputeVertexNormals(const core::Tensor& positions,
+                          const core::Tensor& triangles,
+                          const core::Tensor& corner_splits,
+                          const core::Tensor& corner_members,
+                          bool angle_weighted,
+                          bool normalized,
+                          core::Tensor& normals);
+
+/// Computes the barycentric area of each vertex, a third of the area of its
+/// incident triangles.
+///
+/// \param positions Float32 or Float64 vertex positions of shape {N, 3}.
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param corner_splits Corner offsets, as in ComputeVertexNormals.
+/// \param corner_members Corners grouped by vertex, as in
+/// ComputeVertexNormals.
+/// \param areas Output tensor of shape {N} and the dtype of \p positions.
+void ComputeVertexAreas(const core::Tensor& positions,
+                        const core::Tensor& triangles,
+                        const core::Tensor& corner_splits,
+                        const core::Tensor& corner_members,
+                        core::Tensor& areas);
+
+/// Estimates the curvatures of each vertex over its barycentric area A. The
+/// mean curvature is |sum_j (cot a + cot b)(p_i - p_j)| / 4A, signed
+/// positive where the surface bends away from the area weighted normal. The
+/// Gaussian curvature is the angle deficit (2 pi - sum of angles) / A, which
+/// is only meaningful for interior vertices.
+///
+/// \param positions Float32 or Float64 vertex positions of shape {N, 3}.
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param corner_splits Corner offsets, as in ComputeVertexNormals.
+/// \param corner_members Corners grouped by vertex, as in
+/// ComputeVertexNormals.
+/// \param mean_curvatures Output tensor of shape {N} and the dtype of
+/// \p positions.
+/// \param gaussian_curvatures Output tensor of shape {N} and the dtype of
+/// \p positions.
+void ComputeVertexCurvatures(const core::Tensor& positions,
+                             const core::Tensor& triangles,
+                             const core::Tensor& corner_splits,
+                             const core::Tensor& corner_members,
+                             core::Tensor& mean_curvatures,
+                             core::Tensor& gaussian_curvatures);
+
+/// Groups the half-edges of the triangles by their undirected edge. The
+/// half-edges are counting sorted by their smaller vertex, then sorted by
+/// their larger vertex in parallel per vertex, so the edges come out sorted
+/// by (v0, v1).
+///
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param num_vertices Number of vertices N.
+/// \param edges Output Int64 tensor of shape {E, 2} with v0 <= v1.
+/// \param splits Output Int64 tensor of shape {E + 1}. The triangles of edge
+/// i are edge_triangles[splits[i]:splits[i + 1]].
+/// \param edge_triangles Output Int64 tensor of shape {3T} with the sorted
+/// triangle indices of each edge.
+void ComputeEdgeTriangles(const core::Tensor& triangles,
+                          int64_t num_vertices,
+                          core::Tensor& edges,
+                          core::Tensor& splits,
+                          core::Tensor& edge_triangles);
+
+/// Labels the triangles that are connected through edges with a lock-free
+/// parallel union-find. Sets are always linked under their smaller root, so
+/// the label of a triangle is the smallest triangle index of its component.
+///
+/// \param splits Edge offsets from ComputeEdgeTriangles.
+/// \param edge_triangles Triangles of the edges from ComputeEdgeTriangles.
+/// \param num_triangles Number of triangles T.
+/// \param labels Output Int64 tensor of shape {T}.
+void LabelConnectedTriangles(const core::Tensor& splits,
+                             const core::Tensor& edge_triangles,
+                             int64_t num_triangles,
+                             core::Tensor& labels);
+
+/// Finds the vertices whose incident triangles are not connected through
+/// edges that contain the vertex, e.g. two cones touching at their tips.
+/// Triangles that reference the vertex more than once are ignored.
+///
+/// \param triangles Int64 triangle indices of shape {T, 3}.
+/// \param corner_splits Corner offsets, as in ComputeVertexNormals.
+/// \param corner_members Corners grouped by vertex, as in
+/// ComputeVertexNormals.
+/// \param non_manifold Output Bool tensor of shape {N}.
+void ComputeNonManifoldVertices(const core::Tensor& triangles,
+                                const core::Tensor& corner_splits,
+                                const core::Tensor& corner_members,
+                                core::Tensor& non_manifold);
+
+void ClusterTrianglesCPU(const core::Tensor& triangles,
+                         const core::Tensor& cluster_ids,
+                         core::Tensor& clustered_triangles,
+                         core::Tensor& valid);
+
+void ClusterQuadricPositionsCPU(const core::Tensor& positions,
+                                const core::Tensor& triangles,
+                                const core::Tensor& corner_splits,
+                                const core::Tensor& corner_members,
+                                const core::Tensor& cluster_means,
+                                double max_distance,
+                                core::Tensor& cluster_positions);
+
+void SelectTrianglesByVertexMaskCPU(const core::Tensor& triangles,
+                                    const core::Tensor& vertex_mask,
+                                    core::Tensor& remapped_triangles,
+                                    core::Tensor& triangle_mask);
+
+void ComputeVertexAdjacencyCPU(const core::Tensor& triangles,
+                               int64_t num_vertices,
+                               core::Tensor& splits,
+                               core::Tensor& neighbors);
+
+void ComputeInverseDistanceWeightsCPU(const core::Tensor& positions,
+                                      const core::Tensor& splits,
+                                      const core::Tensor& neighbors,
+                                      core::Tensor& weights);
+
+void ComputeCotangentWeightsCPU(const core::Tensor& positions,
+                                const core::Tensor& triangles,
+                                const core::Tensor& splits,
+                                const core::Tensor& neighbors,
+                                core::Tensor& weights);
+
+void FilterSharpenCPU(const core::Tensor& splits,
+                      const core::Tensor& neighbors,
+                      const core::Tensor& values,
+                      double strength,
+                      core::Tensor& filtered);
+
+void FilterSmoothSimpleCPU(const core::Tensor& splits,
+                           const core::Tensor& neighbors,
+                           const core::Tensor& values,
+                           core::Tensor& filtered);
+
+void FilterSmoothLaplacianCPU(const core::Tensor& splits,
+                              const core::Tensor& neighbors,
+                              const core::Tensor& weights,
+                              const core::Tensor& values,
+                              double lambda,
+                              core::Tensor& filtered);
+
+void ComputeTriangleNormalsCPU(const core::Tensor& positions,
+                               const core::Tensor& triangles,
+                               bool normalized,
+                               core::Tensor& normals);
+
+void ComputeVertexNormalsCPU(const core::Tensor& positions,
+                             const core::Tensor& triangles,
+                             const core::Tensor& corner_splits,
+                             const core::Tensor& corner_members,
+                             bool angle_weighted,
+                             bool normalized,
+                             core::Tensor& normals);
+
+void ComputeVertexAreasCPU(const core::Tensor& positions,
+                           const core::Tensor& triangles,
+                           const core::Tensor& corner_splits,
+                           const core::Tensor& corner_members,
+                           core::Tensor& areas);
+
+void ComputeVertexCurvaturesCPU(const core::Tensor& positions,
+                                const core::Tensor& triangles,
+                                const core::Tensor& corner_splits,
+                                const core::Tensor& corner_members,
+                                core::Tensor& mean_curvatures,
+                                core::Tensor& gaussian_curvatures);
+
+void ComputeEdgeTrianglesCPU(const core::Tensor& triangles,
+                             int64_t num_vertices,
+                             core::Tensor& edges,
+                             core::Tensor& splits,
+                             core::Tensor& edge_triangles);
+
+void LabelConnectedTrianglesCPU(const core::Tensor& splits,
+                                const core::Tensor& edge_triangles,
+                                int64_t num_triangles,
+                                core::Tensor& labels);
+
+void ComputeNonManifoldVerticesCPU(const core::Tensor& triangles,
+                                   const core::Tensor& corner_splits,
+                                   const core::Tensor& corner_members,
+                                   core::Tensor& non_manifold);
+
+/// Quadric error edge-collapse decimation on CPU. The bounding box is split
+/// into cells that are decimated in parallel. A vertex is only collapsed if
+/// its whole one-ring lies in its own cell, so cells never touch the same
+/// vertices or triangles. The cell grid is shifted between rounds to release
+/// the locked borders, and coarsened when a round stalls, down to a single
+/// cell which is equivalent to the serial greedy algorithm.
+///
+/// \param vertices Float64 vertex positions of shape {N, 3}. Updated in
+/// place with the collapsed positions.
+/// \param triangles Int64 triangle indices of shape {T, 3}. Updated in place
+/// with the collapsed connectivity.
+/// \param target_number_of_triangles Number of triangles to stop at.
+/// \param maximum_error Edges with a larger quadric error are not collapsed.
+/// \param boundary_weight Weight of the quadrics that keep boundary edges in
+/// place.
+/// \param vertex_mask Output Bool tensor of shape {N}, true for the vertices
+/// that were not collapsed.
+/// \param triangle_mask Output Bool tensor of shape {T}, true for the
+/// triangles that were not removed.
+void SimplifyQuadricDecimationCPU(core::Tensor& vertices,
+                                  core::Tensor& triangles,
+                                  int64_t target_number_of_triangles,
+                                  double maximum_error,
+                                  double boundary_weight,
+                                  core::Tensor& vertex_mask,
+                                  core::Tensor& triangle_mask);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeTriangleNormalsCUDA(const core::Tensor& positions,
+                                const core::Tensor& triangles,
+                                bool normalized,
+                                core::Tensor& normals);
+
+void ComputeVertexNormalsCUDA(const core::Tensor& positions,
+                              const core::Tensor& triangles,
+                              const core::Tensor& corner_splits,
+                              const core::Tensor& corner_members,
+                              bool angle_weighted,
+                              bool normalized,
+                              core::Tensor& normals);
+
+void ComputeVertexAreasCUDA(const core::Tensor& positions,
+                            const core::Tensor& triangles,
+                            const core::Tensor& corner_splits,
+                            const core::Tensor& corner_members,
+                            core::Tensor& areas);
+
+void ComputeVertexCurvaturesCUDA(const core::Tensor& positions,
+                                 const core::Tensor& triangles,
+                                 const core::Tensor& corner_splits,
+                                 const core::Tensor& corner_members,
+                                 core::Tensor& mean_curvatures,
+                                 core::Tensor& gaussian_curvatures);
+
+void ComputeVertexAdjacencyCUDA(const core::Tensor& triangles,
+                                int64_t num_vertices,
+                                core::Tensor& splits,
+                                core::Tensor& neighbors);
+
+void ComputeInverseDistanceWeightsCUDA(const core::Tensor& positions,
+                                       const core::Tensor& splits,
+                                       const core::Tensor& neighbors,
+                                       core::Tensor& weights);
+
+void ComputeCotangentWeightsCUDA(const core::Tensor& positions,
+                                 const core::Tensor& triangles,
+                                 const core::Tensor& splits,
+                                 const core::Tensor& neighbors,
+                                 core::Tensor& weights);
+
+void FilterSharpenCUDA(const core::Tensor& splits,
+                       const core::Tensor& neighbors,
+                       const core::Tensor& values,
+                       double strength,
+                       core::Tensor& filtered);
+
+void FilterSmoothSimpleCUDA(const core::Tensor& splits,
+                            const core::Tensor& neighbors,
+                            const core::Tensor& values,
+                            core::Tensor& filtered);
+
+void FilterSmoothLaplacianCUDA(const core::Tensor& splits,
+                               const core::Tensor& neighbors,
+                               const core::Tensor& weights,
+                               const core::Tensor& values,
+                               double lambda,
+                               core::Tensor& filtered);
+
+void SelectTrianglesByVertexMaskCUDA(const core::Tensor& triangles,
+                                     const core::Tensor& vertex_mask,
+                                     core::Tensor& remapped_triangles,
+                                     core::Tensor& triangle_mask);
+
+void ClusterTrianglesCUDA(const core::Tensor& triangles,
+                          const core::Tensor& cluster_ids,
+                          core::Tensor& clustered_triangles,
+                          core::Tensor& valid);
+
+void ClusterQuadricPositionsCUDA(const core::Tensor& positions,
+                                 const core::Tensor& triangles,
+                                 const core::Tensor& corner_splits,
+                                 const core::Tensor& corner_members,
+                                 const core::Tensor& cluster_means,
+                                 double max_distance,
+                                 core::Tensor& cluster_positions);
+void ComputeEdgeTrianglesCUDA(const core::Tensor& triangles,
+                              int64_t num_vertices,
+                              core::Tensor& edges,
+                              core::Tensor& splits,
+                              core::Tensor& edge_triangles);
+
+void LabelConnectedTrianglesCUDA(const core::Tensor& splits,
+                                 const core::Tensor& edge_triangles,
+                                 int64_t num_triangles,
+                                 core::Tensor& labels);
+
+void ComputeNonManifoldVerticesCUDA(const core::Tensor& triangles,
+                                    const core::Tensor& corner_splits,
+                                    const core::Tensor& corner_members,
+                                    core::Tensor& non_manifold);
+#endif
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
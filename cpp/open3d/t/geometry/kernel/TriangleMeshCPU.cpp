@@ -0,0 +1,521 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/t/geometry/kernel/TriangleMeshImpl.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+namespace {
+
+/// Error quadric, see geometry/TriangleMeshSimplification.cpp.
+class Quadric {
+public:
+    Quadric() {
+        A_.fill(0);
+        b_.fill(0);
+        c_ = 0;
+    }
+
+    Quadric(const Eigen::Vector4d& plane, double weight) {
+        Eigen::Vector3d n = plane.head<3>();
+        A_ = weight * n * n.transpose();
+        b_ = weight * plane(3) * n;
+        c_ = weight * plane(3) * plane(3);
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        A_ += other.A_;
+        b_ += other.b_;
+        c_ += other.c_;
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& other) const {
+        Quadric res;
+        res.A_ = A_ + other.A_;
+        res.b_ = b_ + other.b_;
+        res.c_ = c_ + other.c_;
+        return res;
+    }
+
+    double Eval(const Eigen::Vector3d& v) const {
+        return v.dot(A_ * v) + 2 * b_.dot(v) + c_;
+    }
+
+    bool IsInvertible() const { return std::fabs(A_.determinant()) > 1e-4; }
+
+    Eigen::Vector3d Minimum() const { return -A_.ldlt().solve(b_); }
+
+    Eigen::Matrix3d A_;
+    Eigen::Vector3d b_;
+    double c_;
+};
+
+typedef Eigen::Matrix<int64_t, 2, 1> Edge;
+typedef std::tuple<double, int64_t, int64_t> CostEdge;
+
+/// Shared state of the partitioned decimation. Within a round, a cell only
+/// reads and writes the vertices it owns and the triangles incident to its
+/// unlocked vertices, so the cells can be processed concurrently.
+struct DecimationState {
+    double* vertices;
+    int64_t* triangles;
+    bool* vertex_alive;
+    bool* triangle_alive;
+    std::vector<std::vector<int64_t>> vert_to_tris;
+    std::vector<Quadric> quadrics;
+    std::vector<uint8_t> locked;
+    double maximum_error;
+
+    Eigen::Map<Eigen::Vector3d> Vertex(int64_t vidx) {
+        return Eigen::Map<Eigen::Vector3d>(vertices + 3 * vidx);
+    }
+
+    bool HasVertex(int64_t tidx, int64_t vidx) const {
+        return triangles[3 * tidx + 0] == vidx ||
+               triangles[3 * tidx + 1] == vidx ||
+               triangles[3 * tidx + 2] == vidx;
+    }
+};
+
+/// Returns the plane (normal, offset) and the area of a triangle. Degenerate
+/// triangles give a zero plane.
+static std::pair<Eigen::Vector4d, double> TrianglePlane(
+        const Eigen::Vector3d& v0,
+        const Eigen::Vector3d& v1,
+        const Eigen::Vector3d& v2) {
+    Eigen::Vector3d n = (v1 - v0).cross(v2 - v0);
+    double norm = n.norm();
+    if (norm == 0) {
+        return std::make_pair(Eigen::Vector4d::Zero().eval(), 0.0);
+    }
+    n /= norm;
+    return std::make_pair(Eigen::Vector4d(n(0), n(1), n(2), -n.dot(v0)),
+                          0.5 * norm);
+}
+
+/// Collapses the cheapest edges between unlocked vertices of one cell until
+/// \p budget triangles are removed. Returns the number of removed triangles.
+static int64_t DecimateCell(DecimationState& state,
+                            const int64_t* members,
+                            int64_t num_members,
+                            int64_t budget) {
+    std::unordered_map<Edge, Eigen::Vector3d, utility::hash_eigen<Edge>> vbars;
+    std::unordered_map<Edge, double, utility::hash_eigen<Edge>> costs;
+    auto CostEdgeComp = [](const CostEdge& a, const CostEdge& b) {
+        return std::get<0>(a) > std::get<0>(b);
+    };
+    std::priority_queue<CostEdge, std::vector<CostEdge>, decltype(CostEdgeComp)>
+            queue(CostEdgeComp);
+
+    auto AddEdge = [&](int64_t vidx0, int64_t vidx1, bool update) {
+        if (state.locked[vidx0] || state.locked[vidx1]) {
+            return;
+        }
+        Edge edge(std::min(vidx0, vidx1), std::max(vidx0, vidx1));
+        if (!update && vbars.count(edge) != 0) {
+            return;
+        }
+        Quadric Qbar = state.quadrics[edge(0)] + state.quadrics[edge(1)];
+        double cost;
+        Eigen::Vector3d vbar;
+        if (Qbar.IsInvertible()) {
+            vbar = Qbar.Minimum();
+            cost = Qbar.Eval(vbar);
+        } else {
+            const Eigen::Vector3d v0 = state.Vertex(edge(0));
+            const Eigen::Vector3d v1 = state.Vertex(edge(1));
+            const Eigen::Vector3d vmid = (v0 + v1) / 2;
+            double cost0 = Qbar.Eval(v0);
+            double cost1 = Qbar.Eval(v1);
+            double costmid = Qbar.Eval(vmid);
+            cost = std::min(cost0, std::min(cost1, costmid));
+            if (cost == costmid) {
+                vbar = vmid;
+            } else if (cost == cost0) {
+                vbar = v0;
+            } else {
+                vbar = v1;
+            }
+        }
+        vbars[edge] = vbar;
+        costs[edge] = cost;
+        queue.push(CostEdge(cost, edge(0), edge(1)));
+    };
+
+    auto AddTriangleEdges = [&](int64_t tidx, int64_t vidx, bool update) {
+        const int64_t* tria = state.triangles + 3 * tidx;
+        for (int k = 0; k < 3; ++k) {
+            int64_t a = tria[k];
+            int64_t b = tria[(k + 1) % 3];
+            if (a == vidx || b == vidx) {
+                AddEdge(a, b, update);
+            }
+        }
+    };
+
+    for (int64_t i = 0; i < num_members; ++i) {
+        int64_t vidx = members[i];
+        if (!state.vertex_alive[vidx] || state.locked[vidx]) {
+            continue;
+        }
+        for (int64_t tidx : state.vert_to_tris[vidx]) {
+            if (state.triangle_alive[tidx]) {
+                AddTriangleEdges(tidx, vidx, false);
+            }
+        }
+    }
+
+    int64_t removed = 0;
+    while (removed < budget && !queue.empty()) {
+        double cost;
+        int64_t vidx0, vidx1;
+        std::tie(cost, vidx0, vidx1) = queue.top();
+        queue.pop();
+
+        if (cost > state.maximum_error) {
+            break;
+        }
+
+        // Skip stale entries of edges that were updated or collapsed.
+        Edge edge(vidx0, vidx1);
+        if (!state.vertex_alive[vidx0] || !state.vertex_alive[vidx1] ||
+            cost != costs[edge]) {
+            continue;
+        }
+        const Eigen::Vector3d vbar = vbars[edge];
+
+        // Avoid flipping triangle normals.
+        bool flipped = false;
+        for (int64_t tidx : state.vert_to_tris[vidx1]) {
+            if (!state.triangle_alive[tidx] || state.HasVertex(tidx, vidx0)) {
+                continue;
+            }
+            const int64_t* tria = state.triangles + 3 * tidx;
+            Eigen::Vector3d verts[3] = {state.Vertex(tria[0]),
+                                        state.Vertex(tria[1]),
+                                        state.Vertex(tria[2])};
+            Eigen::Vector3d norm_before =
+                    (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+            for (int k = 0; k < 3; ++k) {
+                if (tria[k] == vidx1) {
+                    verts[k] = vbar;
+                }
+            }
+            Eigen::Vector3d norm_after =
+                    (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+            if (norm_before.dot(norm_after) < 0) {
+                flipped = true;
+                break;
+            }
+        }
+        if (flipped) {
+            continue;
+        }
+
+        // Connect the triangles of vidx1 to vidx0, or remove them if they
+        // contain the collapsed edge.
+        for (int64_t tidx : state.vert_to_tris[vidx1]) {
+            if (!state.triangle_alive[tidx]) {
+                continue;
+            }
+            if (state.HasVertex(tidx, vidx0)) {
+                state.triangle_alive[tidx] = false;
+                ++removed;
+                continue;
+            }
+            int64_t* tria = state.triangles + 3 * tidx;
+            for (int k = 0; k < 3; ++k) {
+                if (tria[k] == vidx1) {
+                    tria[k] = vidx0;
+                }
+            }
+            state.vert_to_tris[vidx0].push_back(tidx);
+        }
+        std::vector<int64_t>().swap(state.vert_to_tris[vidx1]);
+
+        state.Vertex(vidx0) = vbar;
+        state.quadrics[vidx0] += state.quadrics[vidx1];
+        state.vertex_alive[vidx1] = false;
+
+        for (int64_t tidx : state.vert_to_tris[vidx0]) {
+            if (state.triangle_alive[tidx]) {
+                AddTriangleEdges(tidx, vidx0, true);
+            }
+        }
+    }
+    return removed;
+}
+
+}  // namespace
+
+void SimplifyQuadricDecimationCPU(core::Tensor& vertices,
+                                  core::Tensor& triangles,
+                                  int64_t target_number_of_triangles,
+                                  double maximum_error,
+                                  double boundary_weight,
+                                  core::Tensor& vertex_mask,
+                                  core::Tensor& triangle_mask) {
+    const core::Device device = vertices.GetDevice();
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t num_triangles = triangles.GetLength();
+
+    vertex_mask = core::Tensor::Full({num_vertices}, true, core::Bool, device);
+    triangle_mask =
+            core::Tensor::Full({num_triangles}, true, core::Bool, device);
+
+    DecimationState state;
+    state.vertices = vertices.GetDataPtr<double>();
+    state.triangles = triangles.GetDataPtr<int64_t>();
+    state.vertex_alive = vertex_mask.GetDataPtr<bool>();
+    state.triangle_alive = triangle_mask.GetDataPtr<bool>();
+    state.vert_to_tris.resize(num_vertices);
+    state.quadrics.resize(num_vertices);
+    state.locked.resize(num_vertices, 0);
+    state.maximum_error = maximum_error;
+
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        for (int k = 0; k < 3; ++k) {
+            state.vert_to_tris[state.triangles[3 * tidx + k]].push_back(tidx);
+        }
+    }
+
+    // Per vertex quadrics of the incident triangle planes. Boundary edges,
+    // i.e. edges with a single incident triangle, add a perpendicular plane
+    // to keep the boundary in place.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        const std::vector<int64_t>& tris = state.vert_to_tris[vidx];
+        for (int64_t tidx : tris) {
+            const int64_t* tria = state.triangles + 3 * tidx;
+            const Eigen::Vector3d v0 = state.Vertex(tria[0]);
+            const Eigen::Vector3d v1 = state.Vertex(tria[1]);
+            const Eigen::Vector3d v2 = state.Vertex(tria[2]);
+            auto plane_area = TrianglePlane(v0, v1, v2);
+            state.quadrics[vidx] +=
+                    Quadric(plane_area.first, plane_area.second);
+
+            for (int k = 0; k < 3; ++k) {
+                int64_t a = tria[k];
+                int64_t b = tria[(k + 1) % 3];
+                if (a != vidx && b != vidx) {
+                    continue;
+                }
+                int64_t other = a == vidx ? b : a;
+                int count = 0;
+                for (int64_t tidx2 : tris) {
+                    count += state.HasVertex(tidx2, other) ? 1 : 0;
+                }
+                if (count != 1) {
+                    continue;
+                }
+                const Eigen::Vector3d va = state.Vertex(a);
+                const Eigen::Vector3d tri_normal = plane_area.first.head<3>();
+                Eigen::Vector3d n = (state.Vertex(b) - va).cross(tri_normal);
+                double norm = n.norm();
+                if (norm == 0) {
+                    continue;
+                }
+                n /= norm;
+                Eigen::Vector4d plane(n(0), n(1), n(2), -n.dot(va));
+                state.quadrics[vidx] +=
+                        Quadric(plane, plane_area.second * boundary_weight);
+            }
+        }
+    }
+
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::max());
+    Eigen::Vector3d max_bound = -min_bound;
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        min_bound = min_bound.cwiseMin(state.Vertex(vidx));
+        max_bound = max_bound.cwiseMax(state.Vertex(vidx));
+    }
+    const double extent = num_vertices > 0 ? (max_bound - min_bound).maxCoeff()
+                                           : 0;
+
+    // A few cells per thread for load balancing, but not so many that the
+    // locked borders dominate.
+    const int num_threads = utility::EstimateMaxThreads();
+    int64_t cells_per_axis = std::max<int64_t>(
+            1, std::min(static_cast<int64_t>(
+                                std::ceil(std::cbrt(8.0 * num_threads))),
+                        static_cast<int64_t>(
+                                std::cbrt(num_vertices / 64.0))));
+    if (extent == 0) {
+        cells_per_axis = 1;
+    }
+
+    std::vector<int64_t> cell_of(num_vertices);
+    std::vector<int64_t> cell_splits;
+    std::vector<int64_t> cell_members(num_vertices);
+    std::vector<int64_t> cell_removed;
+
+    int64_t num_alive = num_triangles;
+    int64_t round = 0;
+    int64_t needed_at_pair_start = 0;
+    int64_t removed_in_pair = 0;
+    while (num_alive > target_number_of_triangles) {
+        const int64_t needed = num_alive - target_number_of_triangles;
+        const bool single_cell = cells_per_axis == 1;
+        // Shift the grid by half a cell every other round.
+        const double offset = (round % 2) * 0.5;
+        const double cell_size = extent / cells_per_axis;
+        const int64_t dim = cells_per_axis + 1;
+        const int64_t num_cells = single_cell ? 1 : dim * dim * dim;
+        if (round % 2 == 0) {
+            needed_at_pair_start = needed;
+            removed_in_pair = 0;
+        }
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+            if (single_cell) {
+                cell_of[vidx] = 0;
+                continue;
+            }
+            int64_t cell = 0;
+            for (int d = 2; d >= 0; --d) {
+                double coord = (state.vertices[3 * vidx + d] - min_bound(d)) /
+                               cell_size;
+                int64_t key = static_cast<int64_t>(std::floor(coord + offset));
+                key = std::max<int64_t>(0, std::min(key, dim - 1));
+                cell = cell * dim + key;
+            }
+            cell_of[vidx] = cell;
+        }
+
+        // A vertex is locked if its one-ring leaves its cell.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+            uint8_t locked = 0;
+            for (int64_t tidx : state.vert_to_tris[vidx]) {
+                if (!state.triangle_alive[tidx]) {
+                    continue;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    if (cell_of[state.triangles[3 * tidx + k]] !=
+                        cell_of[vidx]) {
+                        locked = 1;
+                    }
+                }
+            }
+            state.locked[vidx] = locked;
+        }
+
+        // Group the vertices by cell with a counting sort.
+        cell_splits.assign(num_cells + 1, 0);
+        for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+            ++cell_splits[cell_of[vidx] + 1];
+        }
+        for (int64_t c = 0; c < num_cells; ++c) {
+            cell_splits[c + 1] += cell_splits[c];
+        }
+        {
+            std::vector<int64_t> fill(cell_splits.begin(),
+                                      cell_splits.end() - 1);
+            for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+                cell_members[fill[cell_of[vidx]]++] = vidx;
+            }
+        }
+
+        const double ratio = static_cast<double>(needed) / num_alive;
+        cell_removed.assign(num_cells, 0);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t c = 0; c < num_cells; ++c) {
+            const int64_t begin = cell_splits[c];
+            const int64_t end = cell_splits[c + 1];
+            if (begin == end) {
+                continue;
+            }
+            int64_t budget = needed;
+            if (!single_cell) {
+                // Each triangle is counted by its three corners.
+                int64_t corners = 0;
+                for (int64_t i = begin; i < end; ++i) {
+                    int64_t vidx = cell_members[i];
+                    if (state.locked[vidx]) {
+                        continue;
+                    }
+                    for (int64_t tidx : state.vert_to_tris[vidx]) {
+                        corners += state.triangle_alive[tidx] ? 1 : 0;
+                    }
+                }
+                budget = static_cast<int64_t>(std::ceil(ratio * corners / 3.0));
+            }
+            if (budget > 0) {
+                cell_removed[c] =
+                        DecimateCell(state, cell_members.data() + begin,
+                                     end - begin, budget);
+            }
+        }
+
+        int64_t removed = 0;
+        for (int64_t c = 0; c < num_cells; ++c) {
+            removed += cell_removed[c];
+        }
+        num_alive -= removed;
+        removed_in_pair += removed;
+
+        if (single_cell) {
+            // The whole mesh is one cell, the greedy pass either reached the
+            // target or ran out of valid collapses.
+            break;
+        } else if (round % 2 == 1 &&
+                   removed_in_pair < needed_at_pair_start / 10 + 1) {
+            // Both grid offsets made little progress, the cells are too
+            // small compared to the remaining budget.
+            cells_per_axis /= 2;
+            round = -1;
+        }
+        ++round;
+    }
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,1230 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+#if defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#else
+#include "open3d/utility/ParallelScan.h"
+#endif
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+#if defined(__CUDACC__)
+void ClusterTrianglesCUDA
+#else
+void ClusterTrianglesCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& cluster_ids,
+         core::Tensor& clustered_triangles,
+         core::Tensor& valid) {
+    const core::Device device = triangles.GetDevice();
+    const int64_t n = triangles.GetLength();
+
+    clustered_triangles = core::Tensor::Empty({n, 3}, core::Int64, device);
+    valid = core::Tensor::Empty({n}, core::Bool, device);
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* cluster_ids_ptr = cluster_ids.GetDataPtr<int64_t>();
+    int64_t* clustered_ptr = clustered_triangles.GetDataPtr<int64_t>();
+    bool* valid_ptr = valid.GetDataPtr<bool>();
+
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t c0 = cluster_ids_ptr[triangles_ptr[3 * workload_idx + 0]];
+        int64_t c1 = cluster_ids_ptr[triangles_ptr[3 * workload_idx + 1]];
+        int64_t c2 = cluster_ids_ptr[triangles_ptr[3 * workload_idx + 2]];
+
+        // Rotate the smallest index to the front so that duplicated faces
+        // with the same orientation have identical keys.
+        if (c1 < c0 && c1 < c2) {
+            int64_t tmp = c0;
+            c0 = c1;
+            c1 = c2;
+            c2 = tmp;
+        } else if (c2 < c0 && c2 < c1) {
+            int64_t tmp = c2;
+            c2 = c1;
+            c1 = c0;
+            c0 = tmp;
+        }
+
+        clustered_ptr[3 * workload_idx + 0] = c0;
+        clustered_ptr[3 * workload_idx + 1] = c1;
+        clustered_ptr[3 * workload_idx + 2] = c2;
+        valid_ptr[workload_idx] = c0 != c1 && c1 != c2 && c0 != c2;
+    });
+}
+
+#if defined(__CUDACC__)
+void ClusterQuadricPositionsCUDA
+#else
+void ClusterQuadricPositionsCPU
+#endif
+        (const core::Tensor& positions,
+         const core::Tensor& triangles,
+         const core::Tensor& corner_splits,
+         const core::Tensor& corner_members,
+         const core::Tensor& cluster_means,
+         double max_distance,
+         core::Tensor& cluster_positions) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_clusters = corner_splits.GetLength() - 1;
+
+    cluster_positions = core::Tensor::Empty({num_clusters, 3},
+                                            positions.GetDtype(), device);
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* splits_ptr = corner_splits.GetDataPtr<int64_t>();
+    const int64_t* members_ptr = corner_members.GetDataPtr<int64_t>();
+    const double max_distance2 = max_distance * max_distance;
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(positions.GetDtype(), [&]() {
+        const scalar_t* positions_ptr = positions.GetDataPtr<scalar_t>();
+        const scalar_t* means_ptr = cluster_means.GetDataPtr<scalar_t>();
+        scalar_t* cluster_positions_ptr =
+                cluster_positions.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(
+                device, num_clusters,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    // Symmetric A (a00, a01, a02, a11, a12, a22) and b of
+                    // the quadric x^T A x + 2 b^T x + c.
+                    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+                    double b0 = 0, b1 = 0, b2 = 0;
+                    for (int64_t k = splits_ptr[workload_idx];
+                         k < splits_ptr[workload_idx + 1]; ++k) {
+                        const int64_t* tri = triangles_ptr + 3 *
+                                (members_ptr[k] / 3);
+                        const scalar_t* p0 = positions_ptr + 3 * tri[0];
+                        const scalar_t* p1 = positions_ptr + 3 * tri[1];
+                        const scalar_t* p2 = positions_ptr + 3 * tri[2];
+
+                        double e1x = p1[0] - p0[0], e1y = p1[1] - p0[1],
+                               e1z = p1[2] - p0[2];
+                        double e2x = p2[0] - p0[0], e2y = p2[1] - p0[1],
+                               e2z = p2[2] - p0[2];
+                        double nx = e1y * e2z - e1z * e2y;
+                        double ny = e1z * e2x - e1x * e2z;
+                        double nz = e1x * e2y - e1y * e2x;
+                        double norm = sqrt(nx * nx + ny * ny + nz * nz);
+                        if (norm == 0) {
+                            continue;
+                        }
+                        // Area weight is norm / 2, normal is n / norm.
+                        double w = 0.5 / norm;
+                        double d = -(nx * p0[0] + ny * p0[1] + nz * p0[2]);
+                        a00 += w * nx * nx;
+                        a01 += w * nx * ny;
+                        a02 += w * nx * nz;
+                        a11 += w * ny * ny;
+                        a12 += w * ny * nz;
+                        a22 += w * nz * nz;
+                        b0 += w * d * nx;
+                        b1 += w * d * ny;
+                        b2 += w * d * nz;
+                    }
+
+                    const scalar_t* mean = means_ptr + 3 * workload_idx;
+                    scalar_t* out = cluster_positions_ptr + 3 * workload_idx;
+                    out[0] = mean[0];
+                    out[1] = mean[1];
+                    out[2] = mean[2];
+
+                    // Solve A x = -b with the adjugate. Flat and sharp-edge
+                    // clusters give a (near) singular A and keep the mean.
+                    double c00 = a11 * a22 - a12 * a12;
+                    double c01 = a02 * a12 - a01 * a22;
+                    double c02 = a01 * a12 - a02 * a11;
+                    double c11 = a00 * a22 - a02 * a02;
+                    double c12 = a01 * a02 - a00 * a12;
+                    double c22 = a00 * a11 - a01 * a01;
+                    double det = a00 * c00 + a01 * c01 + a02 * c02;
+                    double trace = a00 + a11 + a22;
+                    if (trace <= 0 || det <= 1e-6 * trace * trace * trace) {
+                        return;
+                    }
+                    double x = -(c00 * b0 + c01 * b1 + c02 * b2) / det;
+                    double y = -(c01 * b0 + c11 * b1 + c12 * b2) / det;
+                    double z = -(c02 * b0 + c12 * b1 + c22 * b2) / det;
+                    double dx = x - mean[0], dy = y - mean[1], dz = z - mean[2];
+                    if (dx * dx + dy * dy + dz * dz > max_distance2) {
+                        return;
+                    }
+                    out[0] = static_cast<scalar_t>(x);
+                    out[1] = static_cast<scalar_t>(y);
+                    out[2] = static_cast<scalar_t>(z);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SelectTrianglesByVertexMaskCUDA
+#else
+void SelectTrianglesByVertexMaskCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& vertex_mask,
+         core::Tensor& remapped_triangles,
+         core::Tensor& triangle_mask) {
+    const core::Device device = triangles.GetDevice();
+    const int64_t num_vertices = vertex_mask.GetLength();
+    const int64_t n = triangles.GetLength();
+
+    // The new index of a selected vertex is the number of selected vertices
+    // before it.
+    core::Tensor counts = vertex_mask.To(core::Int64);
+    core::Tensor remap =
+            core::Tensor::Empty({num_vertices}, core::Int64, device);
+    const int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    int64_t* remap_ptr = remap.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, counts_ptr,
+                           counts_ptr + num_vertices, remap_ptr);
+#else
+    utility::InclusivePrefixSum(counts_ptr, counts_ptr + num_vertices,
+                                remap_ptr);
+#endif
+
+    remapped_triangles = core::Tensor::Empty({n, 3}, core::Int64, device);
+    triangle_mask = core::Tensor::Empty({n}, core::Bool, device);
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const bool* vertex_mask_ptr = vertex_mask.GetDataPtr<bool>();
+    int64_t* remapped_ptr = remapped_triangles.GetDataPtr<int64_t>();
+    bool* triangle_mask_ptr = triangle_mask.GetDataPtr<bool>();
+
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        bool keep = true;
+        for (int k = 0; k < 3; ++k) {
+            int64_t vidx = triangles_ptr[3 * workload_idx + k];
+            keep = keep && vertex_mask_ptr[vidx];
+            remapped_ptr[3 * workload_idx + k] = remap_ptr[vidx] - 1;
+        }
+        triangle_mask_ptr[workload_idx] = keep;
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexAdjacencyCUDA
+#else
+void ComputeVertexAdjacencyCPU
+#endif
+        (const core::Tensor& triangles,
+         int64_t num_vertices,
+         core::Tensor& splits,
+         core::Tensor& neighbors) {
+    const core::Device device = triangles.GetDevice();
+    const int64_t num_corners = triangles.NumElements();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+
+    // Counting sort of the directed edges by source vertex. Each corner emits
+    // the edges to the two other corners of its triangle.
+    core::Tensor counts =
+            core::Tensor::Zeros({num_vertices}, core::Int64, device);
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_corners, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t vidx = triangles_ptr[workload_idx];
+#if defined(__CUDACC__)
+                atomicAdd(reinterpret_cast<unsigned long long*>(counts_ptr +
+                                                                vidx),
+                          2ULL);
+#else
+#pragma omp atomic
+                counts_ptr[vidx] += 2;
+#endif
+            });
+
+    core::Tensor edge_splits =
+            core::Tensor::Zeros({num_vertices + 1}, core::Int64, device);
+    int64_t* edge_splits_ptr = edge_splits.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, counts_ptr,
+                           counts_ptr + num_vertices, edge_splits_ptr + 1);
+#else
+    utility::InclusivePrefixSum(counts_ptr, counts_ptr + num_vertices,
+                                edge_splits_ptr + 1);
+#endif
+
+    // Reuse counts as per-vertex write cursors.
+    counts.AsRvalue() = edge_splits.Slice(0, 0, num_vertices);
+    core::Tensor targets =
+            core::Tensor::Empty({2 * num_corners}, core::Int64, device);
+    int64_t* targets_ptr = targets.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_corners, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t tidx = workload_idx / 3;
+                const int64_t k = workload_idx % 3;
+                const int64_t vidx = triangles_ptr[workload_idx];
+                int64_t offset;
+#if defined(__CUDACC__)
+                offset = static_cast<int64_t>(atomicAdd(
+                        reinterpret_cast<unsigned long long*>(counts_ptr +
+                                                              vidx),
+                        2ULL));
+#else
+#pragma omp atomic capture
+                {
+                    offset = counts_ptr[vidx];
+                    counts_ptr[vidx] += 2;
+                }
+#endif
+                targets_ptr[offset] = triangles_ptr[3 * tidx + (k + 1) % 3];
+                targets_ptr[offset + 1] = triangles_ptr[3 * tidx + (k + 2) % 3];
+            });
+
+    // Sort and deduplicate the targets of each vertex in place.
+    core::Tensor degrees =
+            core::Tensor::Empty({num_vertices}, core::Int64, device);
+    int64_t* degrees_ptr = degrees.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t* begin = targets_ptr + edge_splits_ptr[workload_idx];
+                const int64_t size = edge_splits_ptr[workload_idx + 1] -
+                                     edge_splits_ptr[workload_idx];
+#if defined(__CUDACC__)
+                for (int64_t i = 1; i < size; ++i) {
+                    const int64_t value = begin[i];
+                    int64_t j = i - 1;
+                    for (; j >= 0 && begin[j] > value; --j) {
+                        begin[j + 1] = begin[j];
+                    }
+                    begin[j + 1] = value;
+                }
+#else
+                std::sort(begin, begin + size);
+#endif
+                int64_t degree = 0;
+                for (int64_t i = 0; i < size; ++i) {
+                    if (degree == 0 || begin[i] != begin[degree - 1]) {
+                        begin[degree++] = begin[i];
+                    }
+                }
+                degrees_ptr[workload_idx] = degree;
+            });
+
+    splits = core::Tensor::Zeros({num_vertices + 1}, core::Int64, device);
+    int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, degrees_ptr,
+                           degrees_ptr + num_vertices, splits_ptr + 1);
+#else
+    utility::InclusivePrefixSum(degrees_ptr, degrees_ptr + num_vertices,
+                                splits_ptr + 1);
+#endif
+
+    const int64_t num_neighbors = splits[num_vertices].Item<int64_t>();
+    neighbors = core::Tensor::Empty({num_neighbors}, core::Int64, device);
+    int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t* src =
+                        targets_ptr + edge_splits_ptr[workload_idx];
+                int64_t* dst = neighbors_ptr + splits_ptr[workload_idx];
+                for (int64_t i = 0; i < degrees_ptr[workload_idx]; ++i) {
+                    dst[i] = src[i];
+                }
+            });
+}
+
+#if defined(__CUDACC__)
+void ComputeInverseDistanceWeightsCUDA
+#else
+void ComputeInverseDistanceWeightsCPU
+#endif
+        (const core::Tensor& positions,
+         const core::Tensor& splits,
+         const core::Tensor& neighbors,
+         core::Tensor& weights) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_vertices = positions.GetLength();
+    weights = core::Tensor::Empty({neighbors.GetLength()}, core::Float64,
+                                  device);
+
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    double* weights_ptr = weights.GetDataPtr<double>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(positions.GetDtype(), [&]() {
+        const scalar_t* positions_ptr = positions.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t* p = positions_ptr + 3 * workload_idx;
+                    for (int64_t idx = splits_ptr[workload_idx];
+                         idx < splits_ptr[workload_idx + 1]; ++idx) {
+                        const scalar_t* q =
+                                positions_ptr + 3 * neighbors_ptr[idx];
+                        const double dx = double(p[0]) - double(q[0]);
+                        const double dy = double(p[1]) - double(q[1]);
+                        const double dz = double(p[2]) - double(q[2]);
+                        weights_ptr[idx] =
+                                1.0 / (sqrt(dx * dx + dy * dy + dz * dz) +
+                                       1e-12);
+                    }
+                });
+    });
+}
+
+/// Returns the position of \p target in the sorted neighbors of \p vidx.
+OPEN3D_HOST_DEVICE inline int64_t FindNeighbor(const int64_t* splits_ptr,
+                                               const int64_t* neighbors_ptr,
+                                               int64_t vidx,
+                                               int64_t target) {
+    int64_t lo = splits_ptr[vidx];
+    int64_t hi = splits_ptr[vidx + 1];
+    while (lo < hi) {
+        const int64_t mid = lo + (hi - lo) / 2;
+        if (neighbors_ptr[mid] < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+#if defined(__CUDACC__)
+void ComputeCotangentWeightsCUDA
+#else
+void ComputeCotangentWeightsCPU
+#endif
+        (const core::Tensor& positions,
+         const core::Tensor& triangles,
+         const core::Tensor& splits,
+         const core::Tensor& neighbors,
+         core::Tensor& weights) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_corners = triangles.NumElements();
+    weights = core::Tensor::Zeros({neighbors.GetLength()}, core::Float64,
+                                  device);
+
+    // The weights are accumulated with atomics, which cannot be used inside
+    // the dtype dispatch macro on CPU, so read the positions as Float64.
+    const core::Tensor positions_d = positions.To(core::Float64);
+    const double* positions_ptr = positions_d.GetDataPtr<double>();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    double* weights_ptr = weights.GetDataPtr<double>();
+    // Each corner adds half the cotangent of its angle to the opposite edge,
+    // in both directions.
+    core::ParallelFor(
+            device, num_corners, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t tidx = workload_idx / 3;
+                const int64_t k = workload_idx % 3;
+                const int64_t v0 = triangles_ptr[workload_idx];
+                const int64_t v1 = triangles_ptr[3 * tidx + (k + 1) % 3];
+                const int64_t v2 = triangles_ptr[3 * tidx + (k + 2) % 3];
+                const double* p0 = positions_ptr + 3 * v0;
+                const double* p1 = positions_ptr + 3 * v1;
+                const double* p2 = positions_ptr + 3 * v2;
+
+                double e1[3], e2[3];
+                for (int d = 0; d < 3; ++d) {
+                    e1[d] = p1[d] - p0[d];
+                    e2[d] = p2[d] - p0[d];
+                }
+                const double dot =
+                        e1[0] * e2[0] + e1[1] * e2[1] + e1[2] * e2[2];
+                const double cx = e1[1] * e2[2] - e1[2] * e2[1];
+                const double cy = e1[2] * e2[0] - e1[0] * e2[2];
+                const double cz = e1[0] * e2[1] - e1[1] * e2[0];
+                const double cross_norm = sqrt(cx * cx + cy * cy + cz * cz);
+                if (cross_norm <= 0) {
+                    return;
+                }
+                const double half_cot = 0.5 * dot / cross_norm;
+
+                double* w12 = weights_ptr +
+                              FindNeighbor(splits_ptr, neighbors_ptr, v1, v2);
+                double* w21 = weights_ptr +
+                              FindNeighbor(splits_ptr, neighbors_ptr, v2, v1);
+#if defined(__CUDACC__)
+                atomicAdd(w12, half_cot);
+                atomicAdd(w21, half_cot);
+#else
+#pragma omp atomic
+                *w12 += half_cot;
+#pragma omp atomic
+                *w21 += half_cot;
+#endif
+            });
+}
+
+#if defined(__CUDACC__)
+void FilterSharpenCUDA
+#else
+void FilterSharpenCPU
+#endif
+        (const core::Tensor& splits,
+         const core::Tensor& neighbors,
+         const core::Tensor& values,
+         double strength,
+         core::Tensor& filtered) {
+    const core::Device device = values.GetDevice();
+    const int64_t num_vertices = values.GetLength();
+    const int64_t num_channels = values.GetShape(1);
+
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* filtered_ptr = filtered.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_vertices * num_channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t vidx = workload_idx / num_channels;
+                    const int64_t c = workload_idx % num_channels;
+                    double sum = 0;
+                    for (int64_t idx = splits_ptr[vidx];
+                         idx < splits_ptr[vidx + 1]; ++idx) {
+                        sum += values_ptr[neighbors_ptr[idx] * num_channels +
+                                          c];
+                    }
+                    const double degree =
+                            double(splits_ptr[vidx + 1] - splits_ptr[vidx]);
+                    const double value = values_ptr[workload_idx];
+                    filtered_ptr[workload_idx] = static_cast<scalar_t>(
+                            value + strength * (value * degree - sum));
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void FilterSmoothSimpleCUDA
+#else
+void FilterSmoothSimpleCPU
+#endif
+        (const core::Tensor& splits,
+         const core::Tensor& neighbors,
+         const core::Tensor& values,
+         core::Tensor& filtered) {
+    const core::Device device = values.GetDevice();
+    const int64_t num_vertices = values.GetLength();
+    const int64_t num_channels = values.GetShape(1);
+
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* filtered_ptr = filtered.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_vertices * num_channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t vidx = workload_idx / num_channels;
+                    const int64_t c = workload_idx % num_channels;
+                    double sum = values_ptr[workload_idx];
+                    for (int64_t idx = splits_ptr[vidx];
+                         idx < splits_ptr[vidx + 1]; ++idx) {
+                        sum += values_ptr[neighbors_ptr[idx] * num_channels +
+                                          c];
+                    }
+                    const double degree =
+                            double(splits_ptr[vidx + 1] - splits_ptr[vidx]);
+                    filtered_ptr[workload_idx] =
+                            static_cast<scalar_t>(sum / (degree + 1));
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void FilterSmoothLaplacianCUDA
+#else
+void FilterSmoothLaplacianCPU
+#endif
+        (const core::Tensor& splits,
+         const core::Tensor& neighbors,
+         const core::Tensor& weights,
+         const core::Tensor& values,
+         double lambda,
+         core::Tensor& filtered) {
+    const core::Device device = values.GetDevice();
+    const int64_t num_vertices = values.GetLength();
+    const int64_t num_channels = values.GetShape(1);
+
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    const double* weights_ptr = weights.GetDataPtr<double>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* filtered_ptr = filtered.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_vertices * num_channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t vidx = workload_idx / num_channels;
+                    const int64_t c = workload_idx % num_channels;
+                    double sum = 0;
+                    double total_weight = 0;
+                    for (int64_t idx = splits_ptr[vidx];
+                         idx < splits_ptr[vidx + 1]; ++idx) {
+                        const double weight =
+                                weights_ptr[idx] > 0 ? weights_ptr[idx] : 0;
+                        sum += weight * values_ptr[neighbors_ptr[idx] *
+                                                           num_channels +
+                                                   c];
+                        total_weight += weight;
+                    }
+                    const double value = values_ptr[workload_idx];
+                    filtered_ptr[workload_idx] =
+                            total_weight > 0
+                                    ? static_cast<scalar_t>(
+                                              value +
+                                              lambda * (sum / total_weight -
+                                                        value))
+                                    : static_cast<scalar_t>(value);
+                });
+    });
+}
+
+/// Edges e1 = p1 - p0 and e2 = p2 - p0 of triangle corner \p corner
+/// (3 * triangle + k), where p0 is the corner vertex and p1, p2 follow it in
+/// the triangle, so that e1 x e2 is the triangle normal scaled by twice the
+/// area.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void GetCornerEdges(const scalar_t* positions_ptr,
+                                              const int64_t* triangles_ptr,
+                                              int64_t corner,
+                                              double* e1,
+                                              double* e2) {
+    const int64_t tidx = corner / 3;
+    const int64_t k = corner % 3;
+    const scalar_t* p0 = positions_ptr + 3 * triangles_ptr[corner];
+    const scalar_t* p1 =
+            positions_ptr + 3 * triangles_ptr[3 * tidx + (k + 1) % 3];
+    const scalar_t* p2 =
+            positions_ptr + 3 * triangles_ptr[3 * tidx + (k + 2) % 3];
+    for (int d = 0; d < 3; ++d) {
+        e1[d] = double(p1[d]) - double(p0[d]);
+        e2[d] = double(p2[d]) - double(p0[d]);
+    }
+}
+
+OPEN3D_HOST_DEVICE inline void Cross3(const double* a,
+                                      const double* b,
+                                      double* c) {
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+OPEN3D_HOST_DEVICE inline double Dot3(const double* a, const double* b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/// Writes \p n to \p out, normalized if \p normalized. Zero vectors become
+/// (0, 0, 1) like in the legacy TriangleMesh.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void StoreNormal(const double* n,
+                                           bool normalized,
+                                           scalar_t* out) {
+    double scale = 1;
+    if (normalized) {
+        const double norm = sqrt(Dot3(n, n));
+        if (!(norm > 0)) {
+            out[0] = 0;
+            out[1] = 0;
+            out[2] = 1;
+            return;
+        }
+        scale = 1 / norm;
+    }
+    for (int d = 0; d < 3; ++d) {
+        out[d] = static_cast<scalar_t>(n[d] * scale);
+    }
+}
+
+#if defined(__CUDACC__)
+void ComputeTriangleNormalsCUDA
+#else
+void ComputeTriangleNormalsCPU
+#endif
+        (const core::Tensor& positions,
+         const core::Tensor& triangles,
+         bool normalized,
+         core::Tensor& normals) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_triangles = triangles.GetLength();
+    normals = core::Tensor::Empty({num_triangles, 3}, positions.GetDtype(),
+                                  device);
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(positions.GetDtype(), [&]() {
+        const scalar_t* positions_ptr = positions.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    double e1[3], e2[3], n[3];
+                    GetCornerEdges(positions_ptr, triangles_ptr,
+                                   3 * workload_idx, e1, e2);
+                    Cross3(e1, e2, n);
+                    StoreNormal(n, normalized, normals_ptr + 3 * workload_idx);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexNormalsCUDA
+#else
+void ComputeVertexNormalsCPU
+#endif
+        (const core::Tensor& positions,
+         const core::Tensor& triangles,
+         const core::Tensor& corner_splits,
+         const core::Tensor& corner_members,
+         bool angle_weighted,
+         bool normalized,
+         core::Tensor& normals) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_vertices = positions.GetLength();
+    normals = core::Tensor::Empty({num_vertices, 3}, positions.GetDtype(),
+                                  device);
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* splits_ptr = corner_splits.GetDataPtr<int64_t>();
+    const int64_t* members_ptr = corner_members.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(positions.GetDtype(), [&]() {
+        const scalar_t* positions_ptr = positions.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        // Each vertex gathers its incident corners, so no atomics are needed.
+        core::ParallelFor(
+                device, num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    double n[3] = {0, 0, 0};
+                    for (int64_t idx = splits_ptr[workload_idx];
+                         idx < splits_ptr[workload_idx + 1]; ++idx) {
+                        double e1[3], e2[3], c[3];
+                        GetCornerEdges(positions_ptr, triangles_ptr,
+                                       members_ptr[idx], e1, e2);
+                        Cross3(e1, e2, c);
+                        double weight = 1;
+                        if (angle_weighted) {
+                            const double c_norm = sqrt(Dot3(c, c));
+                            if (!(c_norm > 0)) continue;
+                            weight = atan2(c_norm, Dot3(e1, e2)) / c_norm;
+                        }
+                        for (int d = 0; d < 3; ++d) {
+                            n[d] += weight * c[d];
+                        }
+                    }
+                    StoreNormal(n, normalized, normals_ptr + 3 * workload_idx);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexAreasCUDA
+#else
+void ComputeVertexAreasCPU
+#endif
+        (const core::Tensor& positions,
+         const core::Tensor& triangles,
+         const core::Tensor& corner_splits,
+         const core::Tensor& corner_members,
+         core::Tensor& areas) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_vertices = positions.GetLength();
+    areas = core::Tensor::Empty({num_vertices}, positions.GetDtype(), device);
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* splits_ptr = corner_splits.GetDataPtr<int64_t>();
+    const int64_t* members_ptr = corner_members.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(positions.GetDtype(), [&]() {
+        const scalar_t* positions_ptr = positions.GetDataPtr<scalar_t>();
+        scalar_t* areas_ptr = areas.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    double area = 0;
+                    for (int64_t idx = splits_ptr[workload_idx];
+                         idx < splits_ptr[workload_idx + 1]; ++idx) {
+                        double e1[3], e2[3], c[3];
+                        GetCornerEdges(positions_ptr, triangles_ptr,
+                                       members_ptr[idx], e1, e2);
+                        Cross3(e1, e2, c);
+                        area += sqrt(Dot3(c, c)) / 6;
+                    }
+                    areas_ptr[workload_idx] = static_cast<scalar_t>(area);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexCurvaturesCUDA
+#else
+void ComputeVertexCurvaturesCPU
+#endif
+        (const core::Tensor& positions,
+         const core::Tensor& triangles,
+         const core::Tensor& corner_splits,
+         const core::Tensor& corner_members,
+         core::Tensor& mean_curvatures,
+         core::Tensor& gaussian_curvatures) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_vertices = positions.GetLength();
+    mean_curvatures =
+            core::Tensor::Empty({num_vertices}, positions.GetDtype(), device);
+    gaussian_curvatures =
+            core::Tensor::Empty({num_vertices}, positions.GetDtype(), device);
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* splits_ptr = corner_splits.GetDataPtr<int64_t>();
+    const int64_t* members_ptr = corner_members.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(positions.GetDtype(), [&]() {
+        const scalar_t* positions_ptr = positions.GetDataPtr<scalar_t>();
+        scalar_t* mean_ptr = mean_curvatures.GetDataPtr<scalar_t>();
+        scalar_t* gaussian_ptr = gaussian_curvatures.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    // Barycentric area, angle sum, area weighted normal and
+                    // the cotangent Laplacian sum_j (cot a + cot b)(p_i - p_j)
+                    // of the vertex.
+                    double area = 0;
+                    double angle_sum = 0;
+                    double n[3] = {0, 0, 0};
+                    double laplacian[3] = {0, 0, 0};
+                    for (int64_t idx = splits_ptr[workload_idx];
+                         idx < splits_ptr[workload_idx + 1]; ++idx) {
+                        double e1[3], e2[3], c[3];
+                        GetCornerEdges(positions_ptr, triangles_ptr,
+                                       members_ptr[idx], e1, e2);
+                        Cross3(e1, e2, c);
+                        const double c_norm = sqrt(Dot3(c, c));
+                        if (!(c_norm > 0)) continue;
+                        area += c_norm / 6;
+                        angle_sum += atan2(c_norm, Dot3(e1, e2));
+                        // Cotangents of the angles at p1 and p2, which are
+                        // opposite to the edges (p0, p2) and (p0, p1).
+                        double f[3];
+                        for (int d = 0; d < 3; ++d) {
+                            f[d] = e2[d] - e1[d];
+                        }
+                        const double cot1 = -Dot3(e1, f) / c_norm;
+                        const double cot2 = Dot3(e2, f) / c_norm;
+                        for (int d = 0; d < 3; ++d) {
+                            n[d] += c[d];
+                            laplacian[d] -= cot2 * e1[d] + cot1 * e2[d];
+                        }
+                    }
+                    double mean = 0;
+                    double gaussian = 0;
+                    if (area > 0) {
+                        const double sign = Dot3(laplacian, n) < 0 ? -1 : 1;
+                        mean = sign * sqrt(Dot3(laplacian, laplacian)) /
+                               (4 * area);
+                        gaussian = (2 * 3.14159265358979323846 - angle_sum) /
+                                   area;
+                    }
+                    mean_ptr[workload_idx] = static_cast<scalar_t>(mean);
+                    gaussian_ptr[workload_idx] =
+                            static_cast<scalar_t>(gaussian);
+                });
+    });
+}
+
+/// Returns the half-edge after \p half_edge in its triangle.
+OPEN3D_HOST_DEVICE inline int64_t NextHalfEdge(int64_t half_edge) {
+    return half_edge % 3 == 2 ? half_edge - 2 : half_edge + 1;
+}
+
+#if defined(__CUDACC__)
+void ComputeEdgeTrianglesCUDA
+#else
+void ComputeEdgeTrianglesCPU
+#endif
+        (const core::Tensor& triangles,
+         int64_t num_vertices,
+         core::Tensor& edges,
+         core::Tensor& splits,
+         core::Tensor& edge_triangles) {
+    const core::Device device = triangles.GetDevice();
+    const int64_t num_half_edges = triangles.NumElements();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+
+    // Counting sort of the half-edges by their smaller vertex. Half-edge
+    // 3 * t + k goes from corner k to corner (k + 1) % 3 of triangle t.
+    core::Tensor counts =
+            core::Tensor::Zeros({num_vertices}, core::Int64, device);
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_half_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t v0 = triangles_ptr[workload_idx];
+                const int64_t v1 = triangles_ptr[NextHalfEdge(workload_idx)];
+                const int64_t vidx = v0 < v1 ? v0 : v1;
+#if defined(__CUDACC__)
+                atomicAdd(reinterpret_cast<unsigned long long*>(counts_ptr +
+                                                                vidx),
+                          1ULL);
+#else
+#pragma omp atomic
+                counts_ptr[vidx] += 1;
+#endif
+            });
+
+    core::Tensor bucket_splits =
+            core::Tensor::Zeros({num_vertices + 1}, core::Int64, device);
+    int64_t* bucket_splits_ptr = bucket_splits.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, counts_ptr,
+                           counts_ptr + num_vertices, bucket_splits_ptr + 1);
+#else
+    utility::InclusivePrefixSum(counts_ptr, counts_ptr + num_vertices,
+                                bucket_splits_ptr + 1);
+#endif
+
+    // Reuse counts as per-vertex write cursors.
+    counts.AsRvalue() = bucket_splits.Slice(0, 0, num_vertices);
+    core::Tensor half_edges =
+            core::Tensor::Empty({num_half_edges}, core::Int64, device);
+    int64_t* half_edges_ptr = half_edges.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_half_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t v0 = triangles_ptr[workload_idx];
+                const int64_t v1 = triangles_ptr[NextHalfEdge(workload_idx)];
+                const int64_t vidx = v0 < v1 ? v0 : v1;
+                int64_t offset;
+#if defined(__CUDACC__)
+                offset = static_cast<int64_t>(atomicAdd(
+                        reinterpret_cast<unsigned long long*>(counts_ptr +
+                                                              vidx),
+                        1ULL));
+#else
+#pragma omp atomic capture
+                offset = counts_ptr[vidx]++;
+#endif
+                half_edges_ptr[offset] = workload_idx;
+            });
+
+    // Sort the half-edges of each vertex by (larger vertex, half-edge), so
+    // the triangles of an edge are sorted too.
+    core::ParallelFor(
+            device, num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                auto less = [=](int64_t a, int64_t b) {
+                    const int64_t a0 = triangles_ptr[a];
+                    const int64_t a1 = triangles_ptr[NextHalfEdge(a)];
+                    const int64_t b0 = triangles_ptr[b];
+                    const int64_t b1 = triangles_ptr[NextHalfEdge(b)];
+                    const int64_t a_max = a0 < a1 ? a1 : a0;
+                    const int64_t b_max = b0 < b1 ? b1 : b0;
+                    return a_max < b_max || (a_max == b_max && a < b);
+                };
+                int64_t* begin =
+                        half_edges_ptr + bucket_splits_ptr[workload_idx];
+                const int64_t size = bucket_splits_ptr[workload_idx + 1] -
+                                     bucket_splits_ptr[workload_idx];
+#if defined(__CUDACC__)
+                for (int64_t i = 1; i < size; ++i) {
+                    const int64_t value = begin[i];
+                    int64_t j = i - 1;
+                    for (; j >= 0 && less(value, begin[j]); --j) {
+                        begin[j + 1] = begin[j];
+                    }
+                    begin[j + 1] = value;
+                }
+#else
+                std::sort(begin, begin + size, less);
+#endif
+            });
+
+    // The first half-edge of every edge starts a new edge index.
+    core::Tensor is_first =
+            core::Tensor::Empty({num_half_edges}, core::Int64, device);
+    int64_t* is_first_ptr = is_first.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_half_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                if (workload_idx == 0) {
+                    is_first_ptr[workload_idx] = 1;
+                    return;
+                }
+                const int64_t a = half_edges_ptr[workload_idx - 1];
+                const int64_t b = half_edges_ptr[workload_idx];
+                const int64_t a0 = triangles_ptr[a];
+                const int64_t a1 = triangles_ptr[NextHalfEdge(a)];
+                const int64_t b0 = triangles_ptr[b];
+                const int64_t b1 = triangles_ptr[NextHalfEdge(b)];
+                const bool same = (a0 < a1 ? a0 : a1) == (b0 < b1 ? b0 : b1) &&
+                                  (a0 < a1 ? a1 : a0) == (b0 < b1 ? b1 : b0);
+                is_first_ptr[workload_idx] = same ? 0 : 1;
+            });
+    core::Tensor edge_ids =
+            core::Tensor::Empty({num_half_edges}, core::Int64, device);
+    int64_t* edge_ids_ptr = edge_ids.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, is_first_ptr,
+                           is_first_ptr + num_half_edges, edge_ids_ptr);
+#else
+    utility::InclusivePrefixSum(is_first_ptr, is_first_ptr + num_half_edges,
+                                edge_ids_ptr);
+#endif
+
+    const int64_t num_edges =
+            num_half_edges > 0
+                    ? edge_ids[num_half_edges - 1].Item<int64_t>()
+                    : 0;
+    edges = core::Tensor::Empty({num_edges, 2}, core::Int64, device);
+    splits = core::Tensor::Full({num_edges + 1}, num_half_edges, core::Int64,
+                                device);
+    edge_triangles = core::Tensor::Empty({num_half_edges}, core::Int64, device);
+    int64_t* edges_ptr = edges.GetDataPtr<int64_t>();
+    int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    int64_t* edge_triangles_ptr = edge_triangles.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_half_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t half_edge = half_edges_ptr[workload_idx];
+                edge_triangles_ptr[workload_idx] = half_edge / 3;
+                if (!is_first_ptr[workload_idx]) {
+                    return;
+                }
+                const int64_t edge = edge_ids_ptr[workload_idx] - 1;
+                const int64_t v0 = triangles_ptr[half_edge];
+                const int64_t v1 = triangles_ptr[NextHalfEdge(half_edge)];
+                edges_ptr[2 * edge + 0] = v0 < v1 ? v0 : v1;
+                edges_ptr[2 * edge + 1] = v0 < v1 ? v1 : v0;
+                splits_ptr[edge] = workload_idx;
+            });
+}
+
+#if defined(__CUDACC__)
+/// Parent pointers of the parallel union-find.
+using UnionFindParent = int64_t;
+
+OPEN3D_DEVICE inline int64_t LoadParent(UnionFindParent* parents, int64_t idx) {
+    return *reinterpret_cast<volatile int64_t*>(parents + idx);
+}
+
+OPEN3D_DEVICE inline void StoreParent(UnionFindParent* parents,
+                                      int64_t idx,
+                                      int64_t parent) {
+    *reinterpret_cast<volatile int64_t*>(parents + idx) = parent;
+}
+
+/// Links \p root under \p parent if \p root is still a root.
+OPEN3D_DEVICE inline bool LinkRoot(UnionFindParent* parents,
+                                   int64_t root,
+                                   int64_t parent) {
+    return atomicCAS(reinterpret_cast<unsigned long long*>(parents + root),
+                     static_cast<unsigned long long>(root),
+                     static_cast<unsigned long long>(parent)) ==
+           static_cast<unsigned long long>(root);
+}
+#else
+/// Parent pointers of the parallel union-find.
+using UnionFindParent = std::atomic<int64_t>;
+
+inline int64_t LoadParent(UnionFindParent* parents, int64_t idx) {
+    return parents[idx].load(std::memory_order_relaxed);
+}
+
+inline void StoreParent(UnionFindParent* parents,
+                        int64_t idx,
+                        int64_t parent) {
+    parents[idx].store(parent, std::memory_order_relaxed);
+}
+
+/// Links \p root under \p parent if \p root is still a root.
+inline bool LinkRoot(UnionFindParent* parents, int64_t root, int64_t parent) {
+    return parents[root].compare_exchange_strong(root, parent);
+}
+#endif
+
+/// Returns the root of \p idx and halves the path to it. Only non-roots are
+/// redirected, and only to one of their ancestors, so this is safe to run
+/// concurrently with LinkRoot.
+OPEN3D_DEVICE inline int64_t FindRoot(UnionFindParent* parents, int64_t idx) {
+    while (true) {
+        const int64_t parent = LoadParent(parents, idx);
+        if (parent == idx) {
+            return idx;
+        }
+        const int64_t grandparent = LoadParent(parents, parent);
+        if (grandparent == parent) {
+            return parent;
+        }
+        StoreParent(parents, idx, grandparent);
+        idx = grandparent;
+    }
+}
+
+#if defined(__CUDACC__)
+void LabelConnectedTrianglesCUDA
+#else
+void LabelConnectedTrianglesCPU
+#endif
+        (const core::Tensor& splits,
+         const core::Tensor& edge_triangles,
+         int64_t num_triangles,
+         core::Tensor& labels) {
+    const core::Device device = splits.GetDevice();
+    const int64_t num_edges = splits.GetLength() - 1;
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    const int64_t* edge_triangles_ptr = edge_triangles.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::Tensor parent_buffer =
+            core::Tensor::Empty({num_triangles}, core::Int64, device);
+    UnionFindParent* parents = parent_buffer.GetDataPtr<int64_t>();
+#else
+    std::vector<UnionFindParent> parent_buffer(num_triangles);
+    UnionFindParent* parents = parent_buffer.data();
+#endif
+    core::ParallelFor(
+            device, num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                StoreParent(parents, workload_idx, workload_idx);
+            });
+
+    // Union the triangles of every edge with its first triangle. The larger
+    // root is always linked under the smaller one, which keeps the smallest
+    // triangle of each set as its root.
+    core::ParallelFor(
+            device, num_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t first =
+                        edge_triangles_ptr[splits_ptr[workload_idx]];
+                for (int64_t k = splits_ptr[workload_idx] + 1;
+                     k < splits_ptr[workload_idx + 1]; ++k) {
+                    int64_t a = first;
+                    int64_t b = edge_triangles_ptr[k];
+                    while (true) {
+                        a = FindRoot(parents, a);
+                        b = FindRoot(parents, b);
+                        if (a == b) {
+                            break;
+                        }
+                        if (a > b) {
+                            const int64_t tmp = a;
+                            a = b;
+                            b = tmp;
+                        }
+                        if (LinkRoot(parents, b, a)) {
+                            break;
+                        }
+                    }
+                }
+            });
+
+    labels = core::Tensor::Empty({num_triangles}, core::Int64, device);
+    int64_t* labels_ptr = labels.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                labels_ptr[workload_idx] = FindRoot(parents, workload_idx);
+            });
+}
+
+/// Returns the root of \p idx in a serial union-find, halving the path.
+OPEN3D_HOST_DEVICE inline int64_t FindLocalRoot(int64_t* parents, int64_t idx) {
+    while (parents[idx] != idx) {
+        parents[idx] = parents[parents[idx]];
+        idx = parents[idx];
+    }
+    return idx;
+}
+
+#if defined(__CUDACC__)
+void ComputeNonManifoldVerticesCUDA
+#else
+void ComputeNonManifoldVerticesCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& corner_splits,
+         const core::Tensor& corner_members,
+         core::Tensor& non_manifold) {
+    const core::Device device = triangles.GetDevice();
+    const int64_t num_vertices = corner_splits.GetLength() - 1;
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* splits_ptr = corner_splits.GetDataPtr<int64_t>();
+    const int64_t* members_ptr = corner_members.GetDataPtr<int64_t>();
+
+    // Each vertex runs a union-find over its incident triangles in its own
+    // range of the scratch buffer.
+    core::Tensor scratch = core::Tensor::Empty({corner_members.GetLength()},
+                                               core::Int64, device);
+    int64_t* scratch_ptr = scratch.GetDataPtr<int64_t>();
+    non_manifold = core::Tensor::Empty({num_vertices}, core::Bool, device);
+    bool* non_manifold_ptr = non_manifold.GetDataPtr<bool>();
+
+    core::ParallelFor(
+            device, num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t begin = splits_ptr[workload_idx];
+                const int64_t size = splits_ptr[workload_idx + 1] - begin;
+                int64_t* parents = scratch_ptr + begin;
+                // The two other corners of triangle i of the vertex, or -1
+                // if the triangle references the vertex more than once.
+                auto link_vertex = [=](int64_t i, int64_t k) -> int64_t {
+                    const int64_t corner = members_ptr[begin + i];
+                    const int64_t* tri = triangles_ptr + 3 * (corner / 3);
+                    const int64_t a = tri[(corner % 3 + 1) % 3];
+                    const int64_t b = tri[(corner % 3 + 2) % 3];
+                    if (a == workload_idx || b == workload_idx) {
+                        return -1;
+                    }
+                    return k == 0 ? a : b;
+                };
+                for (int64_t i = 0; i < size; ++i) {
+                    parents[i] = i;
+                }
+                for (int64_t i = 0; i < size; ++i) {
+                    const int64_t a = link_vertex(i, 0);
+                    if (a < 0) continue;
+                    const int64_t b = link_vertex(i, 1);
+                    for (int64_t j = 0; j < i; ++j) {
+                        const int64_t c = link_vertex(j, 0);
+                        if (c < 0) continue;
+                        const int64_t d = link_vertex(j, 1);
+                        if (a == c || a == d || b == c || b == d) {
+                            const int64_t ri = FindLocalRoot(parents, i);
+                            const int64_t rj = FindLocalRoot(parents, j);
+                            parents[ri > rj ? ri : rj] = ri < rj ? ri : rj;
+                        }
+                    }
+                }
+                int64_t num_fans = 0;
+                for (int64_t i = 0; i < size; ++i) {
+                    if (link_vertex(i, 0) >= 0 &&
+                        FindLocalRoot(parents, i) == i) {
+                        ++num_fans;
+                    }
+                }
+                non_manifold_ptr[workload_idx] = num_fans > 1;
+            });
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
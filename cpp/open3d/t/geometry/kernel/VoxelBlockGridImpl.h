@@ -26,6 +26,13 @@
 
 #include <atomic>
 #include <cmath>
+#include <vector>
+
+#ifndef __CUDACC__
+#include <tbb/blocked_range.h>
+#include <tbb/blocked_range2d.h>
+#include <tbb/parallel_for.h>
+#endif
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -34,6 +41,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Dispatch.h"
 #include "open3d/t/geometry/Utility.h"
+#include "open3d/t/geometry/kernel/BlockLookupTable.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
@@ -155,6 +163,66 @@ inline OPEN3D_DEVICE void DeviceGetNormal(
     if (vzp >= 0 && vzn >= 0) n[2] = tsdf_base_ptr[vzp] - tsdf_base_ptr[vzn];
 };
 
+/// Fuses the observation at pixel (u, v) into the voxel at \p linear_idx,
+/// whose depth in the camera frame is \p zc.
+template <typename input_depth_t,
+          typename input_color_t,
+          typename tsdf_t,
+          typename weight_t,
+          typename color_t>
+inline OPEN3D_DEVICE void DeviceIntegrateVoxel(
+        float zc,
+        float u,
+        float v,
+        index_t linear_idx,
+        const ArrayIndexer& depth_indexer,
+        const ArrayIndexer& color_indexer,
+        tsdf_t* tsdf_base_ptr,
+        weight_t* weight_base_ptr,
+        color_t* color_base_ptr,
+        float sdf_trunc,
+        float depth_scale,
+        float depth_max,
+        float color_multiplier) {
+    if (!depth_indexer.InBoundary(u, v)) {
+        return;
+    }
+
+    index_t ui = static_cast<index_t>(u);
+    index_t vi = static_cast<index_t>(v);
+
+    // Associate image workload and compute SDF and TSDF.
+    float depth =
+            *depth_indexer.GetDataPtr<input_depth_t>(ui, vi) / depth_scale;
+
+    float sdf = depth - zc;
+    if (depth <= 0 || depth > depth_max || zc <= 0 || sdf < -sdf_trunc) {
+        return;
+    }
+    sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
+    sdf /= sdf_trunc;
+
+    tsdf_t* tsdf_ptr = tsdf_base_ptr + linear_idx;
+    weight_t* weight_ptr = weight_base_ptr + linear_idx;
+
+    float inv_wsum = 1.0f / (*weight_ptr + 1);
+    float weight = *weight_ptr;
+    *tsdf_ptr = (weight * (*tsdf_ptr) + sdf) * inv_wsum;
+
+    if (color_base_ptr) {
+        color_t* color_ptr = color_base_ptr + 3 * linear_idx;
+        input_color_t* input_color_ptr =
+                color_indexer.GetDataPtr<input_color_t>(ui, vi);
+
+        for (index_t i = 0; i < 3; ++i) {
+            color_ptr[i] = (weight * color_ptr[i] +
+                            input_color_ptr[i] * color_multiplier) *
+                           inv_wsum;
+        }
+    }
+    *weight_ptr = weight + 1;
+}
+
 template <typename input_depth_t,
           typename input_color_t,
           typename tsdf_t,
@@ -217,6 +285,7 @@ void IntegrateCPU
         }
     }
 
+#if defined(__CUDACC__)
     index_t n = indices.GetLength() * resolution3;
     core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
         // Natural index (0, N) -> (block_idx, voxel_idx)
@@ -248,50 +317,71 @@ void IntegrateCPU
 
         // coordinate in image (in pixel)
         transform_indexer.Project(xc, yc, zc, &u, &v);
-        if (!depth_indexer.InBoundary(u, v)) {
-            return;
-        }
-
-        index_t ui = static_cast<index_t>(u);
-        index_t vi = static_cast<index_t>(v);
-
-        // Associate image workload and compute SDF and
-        // TSDF.
-        float depth =
-                *depth_indexer.GetDataPtr<input_depth_t>(ui, vi) / depth_scale;
-
-        float sdf = depth - zc;
-        if (depth <= 0 || depth > depth_max || zc <= 0 || sdf < -sdf_trunc) {
-            return;
-        }
-        sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
-        sdf /= sdf_trunc;
 
         index_t linear_idx = block_idx * resolution3 + voxel_idx;
-
-        tsdf_t* tsdf_ptr = tsdf_base_ptr + linear_idx;
-        weight_t* weight_ptr = weight_base_ptr + linear_idx;
-
-        float inv_wsum = 1.0f / (*weight_ptr + 1);
-        float weight = *weight_ptr;
-        *tsdf_ptr = (weight * (*tsdf_ptr) + sdf) * inv_wsum;
-
-        if (integrate_color) {
-            color_t* color_ptr = color_base_ptr + 3 * linear_idx;
-            input_color_t* input_color_ptr =
-                    color_indexer.GetDataPtr<input_color_t>(ui, vi);
-
-            for (index_t i = 0; i < 3; ++i) {
-                color_ptr[i] = (weight * color_ptr[i] +
-                                input_color_ptr[i] * color_multiplier) *
-                               inv_wsum;
-            }
-        }
-        *weight_ptr = weight + 1;
+        DeviceIntegrateVoxel<input_depth_t, input_color_t, tsdf_t, weight_t,
+                             color_t>(
+                zc, u, v, linear_idx, depth_indexer, color_indexer,
+                tsdf_base_ptr, weight_base_ptr, color_base_ptr, sdf_trunc,
+                depth_scale, depth_max, color_multiplier);
     });
 
-#if defined(__CUDACC__)
     core::cuda::Synchronize();
+#else
+    // On CPU a task integrates whole blocks. The voxels of a row are first
+    // transformed and projected in a branch free loop that the compiler can
+    // vectorize, then the depth lookups and updates run on the results.
+    index_t n_blocks = indices.GetLength();
+    tbb::parallel_for(
+            tbb::blocked_range<index_t>(0, n_blocks),
+            [&](const tbb::blocked_range<index_t>& range) {
+                std::vector<float> zc_row(resolution);
+                std::vector<float> u_row(resolution);
+                std::vector<float> v_row(resolution);
+                float* zc_ptr = zc_row.data();
+                float* u_ptr = u_row.data();
+                float* v_ptr = v_row.data();
+
+                for (index_t i = range.begin(); i < range.end(); ++i) {
+                    index_t block_idx = indices_ptr[i];
+                    index_t* block_key_ptr =
+                            block_keys_indexer.GetDataPtr<index_t>(block_idx);
+                    index_t x0 = block_key_ptr[0] * resolution;
+                    index_t y0 = block_key_ptr[1] * resolution;
+                    index_t z0 = block_key_ptr[2] * resolution;
+
+                    for (index_t zv = 0; zv < resolution; ++zv) {
+                        for (index_t yv = 0; yv < resolution; ++yv) {
+                            float y = static_cast<float>(y0 + yv);
+                            float z = static_cast<float>(z0 + zv);
+                            for (index_t xv = 0; xv < resolution; ++xv) {
+                                float xc, yc;
+                                transform_indexer.RigidTransform(
+                                        static_cast<float>(x0 + xv), y, z, &xc,
+                                        &yc, zc_ptr + xv);
+                                transform_indexer.Project(xc, yc, zc_ptr[xv],
+                                                          u_ptr + xv,
+                                                          v_ptr + xv);
+                            }
+
+                            index_t row_idx =
+                                    block_idx * resolution3 +
+                                    zv * resolution2 + yv * resolution;
+                            for (index_t xv = 0; xv < resolution; ++xv) {
+                                DeviceIntegrateVoxel<input_depth_t,
+                                                     input_color_t, tsdf_t,
+                                                     weight_t, color_t>(
+                                        zc_ptr[xv], u_ptr[xv], v_ptr[xv],
+                                        row_idx + xv, depth_indexer,
+                                        color_indexer, tsdf_base_ptr,
+                                        weight_base_ptr, color_base_ptr,
+                                        sdf_trunc, depth_scale, depth_max,
+                                        color_multiplier);
+                            }
+                        }
+                    }
+                }
+            });
 #endif
 }
 
@@ -352,14 +442,26 @@ void RayCastCPU
     }
     auto hashmap_impl = cuda_hashmap->GetImpl();
 #else
-    auto cpu_hashmap =
-            std::dynamic_pointer_cast<core::TBBHashBackend<Key, Hash, Eq>>(
-                    device_hashmap);
-    if (cpu_hashmap == nullptr) {
-        utility::LogError(
-                "Unsupported backend: CPU raycasting only supports TBB.");
+    BlockLookupTable lookup_table(*device_hashmap,
+                                  voxel_size * block_resolution);
+    const BlockLookupTable* lookup_table_ptr = &lookup_table;
+
+    // The TBB map is only queried when the lookup table is too large to
+    // build. Captured by pointer to avoid copying the map into the kernel.
+    const tbb::concurrent_unordered_map<Key, core::buf_index_t, Hash, Eq>*
+            hashmap_impl = nullptr;
+    if (!lookup_table.IsValid()) {
+        auto cpu_hashmap =
+                std::dynamic_pointer_cast<core::TBBHashBackend<Key, Hash, Eq>>(
+                        device_hashmap);
+        if (cpu_hashmap == nullptr) {
+            utility::LogError(
+                    "Unsupported backend: the active blocks span too large a "
+                    "region for the lookup table, and CPU raycasting can only "
+                    "query the hash map directly with TBB.");
+        }
+        hashmap_impl = cpu_hashmap->GetImpl().get();
     }
-    auto hashmap_impl = *cpu_hashmap->GetImpl();
 #endif
 
     core::Device device = hashmap->GetDevice();
@@ -461,9 +563,33 @@ void RayCastCPU
 #ifndef __CUDACC__
     using std::max;
     using std::sqrt;
+
 #endif
 
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+    auto raycast_pixel = [=] OPEN3D_DEVICE(index_t workload_idx) {
+        auto FindBlock = [&] OPEN3D_DEVICE(index_t x_b, index_t y_b,
+                                           index_t z_b,
+                                           MiniVecCache & cache) -> index_t {
+            index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
+            if (block_buf_idx >= 0) return block_buf_idx;
+#if defined(__CUDACC__)
+            auto iter = hashmap_impl.find(Key(x_b, y_b, z_b));
+            if (iter == hashmap_impl.end()) return -1;
+            block_buf_idx = iter->second;
+#else
+            if (lookup_table_ptr->IsValid()) {
+                block_buf_idx = lookup_table_ptr->Find(x_b, y_b, z_b);
+                if (block_buf_idx < 0) return -1;
+            } else {
+                auto iter = hashmap_impl->find(Key(x_b, y_b, z_b));
+                if (iter == hashmap_impl->end()) return -1;
+                block_buf_idx = iter->second;
+            }
+#endif
+            cache.Update(x_b, y_b, z_b, block_buf_idx);
+            return block_buf_idx;
+        };
+
         auto GetLinearIdxAtP = [&] OPEN3D_DEVICE(
                                        index_t x_b, index_t y_b, index_t z_b,
                                        index_t x_v, index_t y_v, index_t z_v,
@@ -481,15 +607,9 @@ void RayCastCPU
                 return block_buf_idx * resolution3 + z_v * resolution2 +
                        y_v * block_resolution + x_v;
             } else {
-                Key key(x_b + dx_b, y_b + dy_b, z_b + dz_b);
-
-                index_t block_buf_idx = cache.Check(key[0], key[1], key[2]);
-                if (block_buf_idx < 0) {
-                    auto iter = hashmap_impl.find(key);
-                    if (iter == hashmap_impl.end()) return -1;
-                    block_buf_idx = iter->second;
-                    cache.Update(key[0], key[1], key[2], block_buf_idx);
-                }
+                index_t block_buf_idx = FindBlock(x_b + dx_b, y_b + dy_b,
+                                                  z_b + dz_b, cache);
+                if (block_buf_idx < 0) return -1;
 
                 return block_buf_idx * resolution3 + z_vn * resolution2 +
                        y_vn * block_resolution + x_vn;
@@ -509,14 +629,8 @@ void RayCastCPU
             index_t y_b = static_cast<index_t>(floorf(y_g / block_size));
             index_t z_b = static_cast<index_t>(floorf(z_g / block_size));
 
-            Key key(x_b, y_b, z_b);
-            index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
-            if (block_buf_idx < 0) {
-                auto iter = hashmap_impl.find(key);
-                if (iter == hashmap_impl.end()) return -1;
-                block_buf_idx = iter->second;
-                cache.Update(x_b, y_b, z_b, block_buf_idx);
-            }
+            index_t block_buf_idx = FindBlock(x_b, y_b, z_b, cache);
+            if (block_buf_idx < 0) return -1;
 
             // Voxel coordinate and look up
             index_t x_v = index_t((x_g - x_b * block_size) / voxel_size);
@@ -662,7 +776,17 @@ void RayCastCPU
 
             if (linear_idx < 0) {
                 t_prev = t;
-                t += block_size;
+#ifndef __CUDACC__
+                // Take the steps through an empty coarse cell at once. They
+                // land on the same samples as stepping block by block.
+                float t_exit = lookup_table_ptr->ExitEmptyCell(
+                        x_o, y_o, z_o, x_d, y_d, z_d, t);
+                if (t_exit > t + block_size) {
+                    t_prev += (std::ceil((t_exit - t) / block_size) - 1) *
+                              block_size;
+                }
+#endif
+                t = t_prev + block_size;
             } else {
                 tsdf_prev = tsdf;
                 tsdf = tsdf_base_ptr[linear_idx];
@@ -705,15 +829,8 @@ void RayCastCPU
             float y_v = (y_g - float(y_b) * block_size) / voxel_size;
             float z_v = (z_g - float(z_b) * block_size) / voxel_size;
 
-            Key key(x_b, y_b, z_b);
-
-            index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
-            if (block_buf_idx < 0) {
-                auto iter = hashmap_impl.find(key);
-                if (iter == hashmap_impl.end()) return;
-                block_buf_idx = iter->second;
-                cache.Update(x_b, y_b, z_b, block_buf_idx);
-            }
+            index_t block_buf_idx = FindBlock(x_b, y_b, z_b, cache);
+            if (block_buf_idx < 0) return;
 
             index_t x_v_floor = static_cast<index_t>(floorf(x_v));
             index_t y_v_floor = static_cast<index_t>(floorf(y_v));
@@ -803,10 +920,25 @@ void RayCastCPU
                 }
             }
         }  // surface-found
-    });
+    };
 
 #if defined(__CUDACC__)
+    core::ParallelFor(device, n, raycast_pixel);
     core::cuda::Synchronize();
+#else
+    // The cost of a ray varies a lot across the image, so the image is split
+    // into tiles matching the range map that idle threads steal.
+    tbb::parallel_for(
+            tbb::blocked_range2d<index_t>(0, rows, 8, 0, cols, 8),
+            [&](const tbb::blocked_range2d<index_t>& tile) {
+                for (index_t y = tile.rows().begin(); y < tile.rows().end();
+                     ++y) {
+                    for (index_t x = tile.cols().begin();
+                         x < tile.cols().end(); ++x) {
+                        raycast_pixel(y * cols + x);
+                    }
+                }
+            });
 #endif
 }
 
@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+void ComputeVoxelIndices(const core::Tensor& points,
+                         const core::Tensor& origin,
+                         double voxel_size,
+                         core::Tensor& voxel_indices) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorShape(origin, {3});
+    core::AssertTensorDtype(origin, core::Float64);
+
+    const core::Tensor points_c = points.Contiguous();
+
+    const core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVoxelIndicesCPU(points_c, origin, voxel_size, voxel_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVoxelIndicesCUDA, points_c, origin, voxel_size,
+                  voxel_indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RasterizeTriangles(const core::Tensor& vertices,
+                        const core::Tensor& triangles,
+                        const core::Tensor& origin,
+                        double voxel_size,
+                        core::Tensor& voxel_indices) {
+    const core::Device device = vertices.GetDevice();
+    core::AssertTensorShape(vertices, {utility::nullopt, 3});
+    core::AssertTensorDtypes(vertices, {core::Float32, core::Float64});
+    core::AssertTensorShape(triangles, {utility::nullopt, 3});
+    core::AssertTensorDtype(triangles, core::Int64);
+    core::AssertTensorDevice(triangles, device);
+    core::AssertTensorShape(origin, {3});
+    core::AssertTensorDtype(origin, core::Float64);
+
+    const core::Tensor vertices_c = vertices.Contiguous();
+    const core::Tensor triangles_c = triangles.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RasterizeTrianglesCPU(vertices_c, triangles_c, origin, voxel_size,
+                              voxel_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RasterizeTrianglesCUDA, vertices_c, triangles_c, origin,
+                  voxel_size, voxel_indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeCarveMask(const core::Tensor& voxel_indices,
+                      const core::Tensor& image,
+                      const core::Tensor& intrinsic,
+                      const core::Tensor& extrinsic,
+                      const core::Tensor& origin,
+                      double voxel_size,
+                      float depth_scale,
+                      bool is_depth,
+                      bool keep_voxels_outside_image,
+                      core::Tensor& carve_mask) {
+    const core::Device device = voxel_indices.GetDevice();
+    core::AssertTensorShape(voxel_indices, {utility::nullopt, 3});
+    core::AssertTensorDtype(voxel_indices, core::Int32);
+    core::AssertTensorDevice(image, device);
+    core::AssertTensorShape(origin, {3});
+    core::AssertTensorDtype(origin, core::Float64);
+    if (image.NumDims() != 2 &&
+        !(image.NumDims() == 3 && image.GetShape(2) == 1)) {
+        utility::LogError("Expected a single channel image, but got shape {}.",
+                          image.GetShape());
+    }
+
+    const core::Tensor voxel_indices_c = voxel_indices.Contiguous();
+    const core::Tensor image_c = image.Contiguous();
+    // The projection is set up on the host.
+    const core::Device host("CPU:0");
+    const core::Tensor intrinsic_host =
+            intrinsic.To(host, core::Float64).Contiguous();
+    const core::Tensor extrinsic_host =
+            extrinsic.To(host, core::Float64).Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeCarveMaskCPU(voxel_indices_c, image_c, intrinsic_host,
+                            extrinsic_host, origin, voxel_size, depth_scale,
+                            is_depth, keep_voxels_outside_image, carve_mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeCarveMaskCUDA, voxel_indices_c, image_c,
+                  intrinsic_host, extrinsic_host, origin, voxel_size,
+                  depth_scale, is_depth, keep_voxels_outside_image,
+                  carve_mask);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+/// Computes the (N, 3) Int32 indices of the voxels that contain the (N, 3)
+/// \p points, for a grid with the Float64 \p origin and \p voxel_size.
+void ComputeVoxelIndices(const core::Tensor& points,
+                         const core::Tensor& origin,
+                         double voxel_size,
+                         core::Tensor& voxel_indices);
+
+/// Computes the (M, 3) Int32 indices of the voxels that intersect the
+/// triangles, with duplicates for voxels intersected by several triangles.
+void RasterizeTriangles(const core::Tensor& vertices,
+                        const core::Tensor& triangles,
+                        const core::Tensor& origin,
+                        double voxel_size,
+                        core::Tensor& voxel_indices);
+
+/// Computes a Bool mask of the voxels to carve: the voxels none of whose
+/// corners projects in front of the depth, or into the silhouette if
+/// \p is_depth is false.
+void ComputeCarveMask(const core::Tensor& voxel_indices,
+                      const core::Tensor& image,
+                      const core::Tensor& intrinsic,
+                      const core::Tensor& extrinsic,
+                      const core::Tensor& origin,
+                      double voxel_size,
+                      float depth_scale,
+                      bool is_depth,
+                      bool keep_voxels_outside_image,
+                      core::Tensor& carve_mask);
+
+void ComputeVoxelIndicesCPU(const core::Tensor& points,
+                            const core::Tensor& origin,
+                            double voxel_size,
+                            core::Tensor& voxel_indices);
+
+void RasterizeTrianglesCPU(const core::Tensor& vertices,
+                           const core::Tensor& triangles,
+                           const core::Tensor& origin,
+                           double voxel_size,
+                           core::Tensor& voxel_indices);
+
+void ComputeCarveMaskCPU(const core::Tensor& voxel_indices,
+                         const core::Tensor& image,
+                         const core::Tensor& intrinsic,
+                         const core::Tensor& extrinsic,
+                         const core::Tensor& origin,
+                         double voxel_size,
+                         float depth_scale,
+                         bool is_depth,
+                         bool keep_voxels_outside_image,
+                         core::Tensor& carve_mask);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeVoxelIndicesCUDA(const core::Tensor& points,
+                             const core::Tensor& origin,
+                             double voxel_size,
+                             core::Tensor& voxel_indices);
+
+void RasterizeTrianglesCUDA(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            const core::Tensor& origin,
+                            double voxel_size,
+                            core::Tensor& voxel_indices);
+
+void ComputeCarveMaskCUDA(const core::Tensor& voxel_indices,
+                          const core::Tensor& image,
+                          const core::Tensor& intrinsic,
+                          const core::Tensor& extrinsic,
+                          const core::Tensor& origin,
+                          double voxel_size,
+                          float depth_scale,
+                          bool is_depth,
+                          bool keep_voxels_outside_image,
+                          core::Tensor& carve_mask);
+#endif
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
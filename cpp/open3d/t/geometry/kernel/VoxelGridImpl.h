@@ -0,0 +1,340 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryIndexer.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+
+#if defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#else
+#include "open3d/utility/ParallelScan.h"
+#endif
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+/// Separating axis test of the triangle \p v against the box of half size
+/// \p half_size centered at the origin (T. Akenine-Moeller, "Fast 3D
+/// Triangle-Box Overlap Testing", 2001). Touching counts as overlap.
+OPEN3D_HOST_DEVICE inline bool TriangleBoxOverlap(const double v[3][3],
+                                                  double half_size) {
+    double e[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            e[i][k] = v[(i + 1) % 3][k] - v[i][k];
+        }
+    }
+    // Projects the triangle on the axis and tests it against the box.
+    auto separated = [&](double a0, double a1, double a2) {
+        double p_min = INFINITY, p_max = -INFINITY;
+        for (int i = 0; i < 3; ++i) {
+            const double p = a0 * v[i][0] + a1 * v[i][1] + a2 * v[i][2];
+            p_min = p < p_min ? p : p_min;
+            p_max = p > p_max ? p : p_max;
+        }
+        const double r =
+                half_size * (std::abs(a0) + std::abs(a1) + std::abs(a2));
+        return p_min > r || p_max < -r;
+    };
+    // Cross products of the box axes with the triangle edges.
+    for (int i = 0; i < 3; ++i) {
+        if (separated(0, -e[i][2], e[i][1]) ||
+            separated(e[i][2], 0, -e[i][0]) ||
+            separated(-e[i][1], e[i][0], 0)) {
+            return false;
+        }
+    }
+    // Box axes.
+    if (separated(1, 0, 0) || separated(0, 1, 0) || separated(0, 0, 1)) {
+        return false;
+    }
+    // Triangle normal.
+    return !separated(e[0][1] * e[1][2] - e[0][2] * e[1][1],
+                      e[0][2] * e[1][0] - e[0][0] * e[1][2],
+                      e[0][0] * e[1][1] - e[0][1] * e[1][0]);
+}
+
+/// Loads the corners of a triangle in voxel units, and the range of voxels of
+/// its bounding box.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void LoadTriangle(const scalar_t* vertices_ptr,
+                                            const int64_t* triangle,
+                                            double ox,
+                                            double oy,
+                                            double oz,
+                                            double inv_voxel_size,
+                                            double v[3][3],
+                                            int lo[3],
+                                            int hi[3]) {
+    const double o[3] = {ox, oy, oz};
+    for (int i = 0; i < 3; ++i) {
+        const scalar_t* vertex = vertices_ptr + 3 * triangle[i];
+        for (int k = 0; k < 3; ++k) {
+            v[i][k] = (vertex[k] - o[k]) * inv_voxel_size;
+        }
+    }
+    for (int k = 0; k < 3; ++k) {
+        const double v_min = fmin(v[0][k], fmin(v[1][k], v[2][k]));
+        const double v_max = fmax(v[0][k], fmax(v[1][k], v[2][k]));
+        lo[k] = static_cast<int>(floor(v_min));
+        hi[k] = static_cast<int>(floor(v_max));
+    }
+}
+
+/// Bilinear interpolation of a single channel image like
+/// geometry::Image::FloatValueAt, for \p u, \p v inside the image.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline float BilinearValueAt(const scalar_t* image_ptr,
+                                                int64_t rows,
+                                                int64_t cols,
+                                                float u,
+                                                float v) {
+    int64_t ui = static_cast<int64_t>(u);
+    int64_t vi = static_cast<int64_t>(v);
+    ui = ui < cols - 2 ? ui : cols - 2;
+    vi = vi < rows - 2 ? vi : rows - 2;
+    ui = ui > 0 ? ui : 0;
+    vi = vi > 0 ? vi : 0;
+    const int64_t ui1 = ui + 1 < cols ? ui + 1 : ui;
+    const int64_t vi1 = vi + 1 < rows ? vi + 1 : vi;
+    const float pu = u - ui;
+    const float pv = v - vi;
+    const float v00 = static_cast<float>(image_ptr[vi * cols + ui]);
+    const float v01 = static_cast<float>(image_ptr[vi1 * cols + ui]);
+    const float v10 = static_cast<float>(image_ptr[vi * cols + ui1]);
+    const float v11 = static_cast<float>(image_ptr[vi1 * cols + ui1]);
+    return (v00 * (1 - pv) + v01 * pv) * (1 - pu) +
+           (v10 * (1 - pv) + v11 * pv) * pu;
+}
+
+#if defined(__CUDACC__)
+void ComputeVoxelIndicesCUDA
+#else
+void ComputeVoxelIndicesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& origin,
+         double voxel_size,
+         core::Tensor& voxel_indices) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const core::Tensor origin_host = origin.To(core::Device("CPU:0"));
+    const double* origin_ptr = origin_host.GetDataPtr<double>();
+    const double ox = origin_ptr[0], oy = origin_ptr[1], oz = origin_ptr[2];
+    const double inv_voxel_size = 1.0 / voxel_size;
+
+    voxel_indices = core::Tensor::Empty({n, 3}, core::Int32, device);
+    int* indices_ptr = voxel_indices.GetDataPtr<int>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t* point = points_ptr + 3 * workload_idx;
+                    int* index = indices_ptr + 3 * workload_idx;
+                    index[0] = static_cast<int>(
+                            floor((point[0] - ox) * inv_voxel_size));
+                    index[1] = static_cast<int>(
+                            floor((point[1] - oy) * inv_voxel_size));
+                    index[2] = static_cast<int>(
+                            floor((point[2] - oz) * inv_voxel_size));
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void RasterizeTrianglesCUDA
+#else
+void RasterizeTrianglesCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         const core::Tensor& origin,
+         double voxel_size,
+         core::Tensor& voxel_indices) {
+    const core::Device device = vertices.GetDevice();
+    const int64_t n = triangles.GetLength();
+    const core::Tensor origin_host = origin.To(core::Device("CPU:0"));
+    const double* origin_ptr = origin_host.GetDataPtr<double>();
+    const double ox = origin_ptr[0], oy = origin_ptr[1], oz = origin_ptr[2];
+    const double inv_voxel_size = 1.0 / voxel_size;
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+
+    // Every triangle tests the voxels of its bounding box. The first pass
+    // counts them, the second writes the voxels that overlap the triangle to
+    // the range of the triangle.
+    core::Tensor counts = core::Tensor::Empty({n}, core::Int64, device);
+    core::Tensor splits = core::Tensor::Zeros({n + 1}, core::Int64, device);
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    core::Tensor candidates, mask;
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    double v[3][3];
+                    int lo[3], hi[3];
+                    LoadTriangle(vertices_ptr,
+                                 triangles_ptr + 3 * workload_idx, ox, oy, oz,
+                                 inv_voxel_size, v, lo, hi);
+                    counts_ptr[workload_idx] = int64_t(hi[0] - lo[0] + 1) *
+                                               (hi[1] - lo[1] + 1) *
+                                               (hi[2] - lo[2] + 1);
+                });
+#if defined(__CUDACC__)
+        thrust::inclusive_scan(thrust::device, counts_ptr, counts_ptr + n,
+                               splits_ptr + 1);
+#else
+        utility::InclusivePrefixSum(counts_ptr, counts_ptr + n,
+                                    splits_ptr + 1);
+#endif
+        const int64_t num_candidates = splits[n].Item<int64_t>();
+
+        candidates =
+                core::Tensor::Empty({num_candidates, 3}, core::Int32, device);
+        mask = core::Tensor::Empty({num_candidates}, core::Bool, device);
+        int* candidates_ptr = candidates.GetDataPtr<int>();
+        bool* mask_ptr = mask.GetDataPtr<bool>();
+
+        core::ParallelFor(
+                device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    double v[3][3];
+                    int lo[3], hi[3];
+                    LoadTriangle(vertices_ptr,
+                                 triangles_ptr + 3 * workload_idx, ox, oy, oz,
+                                 inv_voxel_size, v, lo, hi);
+                    int64_t offset = splits_ptr[workload_idx];
+                    for (int x = lo[0]; x <= hi[0]; ++x) {
+                        for (int y = lo[1]; y <= hi[1]; ++y) {
+                            for (int z = lo[2]; z <= hi[2]; ++z) {
+                                const double center[3] = {x + 0.5, y + 0.5,
+                                                          z + 0.5};
+                                double local[3][3];
+                                for (int i = 0; i < 3; ++i) {
+                                    for (int k = 0; k < 3; ++k) {
+                                        local[i][k] = v[i][k] - center[k];
+                                    }
+                                }
+                                int* candidate = candidates_ptr + 3 * offset;
+                                candidate[0] = x;
+                                candidate[1] = y;
+                                candidate[2] = z;
+                                mask_ptr[offset] =
+                                        TriangleBoxOverlap(local, 0.5);
+                                ++offset;
+                            }
+                        }
+                    }
+                });
+    });
+
+    voxel_indices = candidates.IndexGet({mask});
+}
+
+#if defined(__CUDACC__)
+void ComputeCarveMaskCUDA
+#else
+void ComputeCarveMaskCPU
+#endif
+        (const core::Tensor& voxel_indices,
+         const core::Tensor& image,
+         const core::Tensor& intrinsic,
+         const core::Tensor& extrinsic,
+         const core::Tensor& origin,
+         double voxel_size,
+         float depth_scale,
+         bool is_depth,
+         bool keep_voxels_outside_image,
+         core::Tensor& carve_mask) {
+    const core::Device device = voxel_indices.GetDevice();
+    const int64_t n = voxel_indices.GetLength();
+    const int64_t rows = image.GetShape(0);
+    const int64_t cols = image.GetShape(1);
+    const core::Tensor origin_host = origin.To(core::Device("CPU:0"));
+    const double* origin_ptr = origin_host.GetDataPtr<double>();
+    const double ox = origin_ptr[0], oy = origin_ptr[1], oz = origin_ptr[2];
+    const TransformIndexer transform(intrinsic, extrinsic);
+
+    const int* indices_ptr = voxel_indices.GetDataPtr<int>();
+    carve_mask = core::Tensor::Empty({n}, core::Bool, device);
+    bool* carve_ptr = carve_mask.GetDataPtr<bool>();
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(image.GetDtype(), [&]() {
+        const scalar_t* image_ptr = image.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int* index = indices_ptr + 3 * workload_idx;
+                    bool carve = true;
+                    for (int c = 0; c < 8 && carve; ++c) {
+                        const float x = static_cast<float>(
+                                ox + (index[0] + (c & 1)) * voxel_size);
+                        const float y = static_cast<float>(
+                                oy + (index[1] + ((c >> 1) & 1)) * voxel_size);
+                        const float z = static_cast<float>(
+                                oz + (index[2] + ((c >> 2) & 1)) * voxel_size);
+                        float xc, yc, zc, u, v;
+                        transform.RigidTransform(x, y, z, &xc, &yc, &zc);
+                        bool within_image = zc > 0;
+                        if (within_image) {
+                            transform.Project(xc, yc, zc, &u, &v);
+                            within_image = u >= 0 && u <= cols - 1 &&
+                                           v >= 0 && v <= rows - 1;
+                        }
+                        if (!within_image) {
+                            if (keep_voxels_outside_image) {
+                                carve = false;
+                            }
+                            continue;
+                        }
+                        const float value = BilinearValueAt(
+                                image_ptr, rows, cols, u, v);
+                        if (is_depth ? (value > 0 &&
+                                        zc >= value / depth_scale)
+                                     : value > 0) {
+                            carve = false;
+                        }
+                    }
+                    carve_ptr[workload_idx] = carve;
+                });
+    });
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
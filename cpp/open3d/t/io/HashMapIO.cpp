@@ -26,8 +26,19 @@
 
 #include "open3d/t/io/HashMapIO.h"
 
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+
+#include "open3d/core/TensorCheck.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+
 namespace open3d {
 namespace t {
 namespace io {
@@ -107,6 +118,573 @@ core::HashMap ReadHashMap(const std::string& file_name) {
 
     return hashmap;
 }
+
+// Layout of chunked hash map files. Values are stored in host byte order.
+//
+// Header:
+//   char[8]     magic "O3DHMAP\0"
+//   uint32      version
+//   uint32      flags, see kChunkedFlagLZF
+//   int64       number of entries
+//   uint32      number of metadata pairs, followed by (string, string) pairs
+//   string      key dtype, followed by the key element shape
+//   uint32      number of values, followed by (dtype, element shape) pairs
+//   int64       number of erased keys, followed by the raw keys (version 2)
+// Chunks, terminated by a chunk of 0 entries:
+//   int64       number of entries n
+//   int64[2D]   inclusive lower and upper bounds of the D key coordinates
+//   uint64[2]   raw and stored byte sizes of the keys and of each value
+//   bytes       the key and value blocks, LZF compressed if the stored size
+//               is smaller than the raw size
+// A string is a uint32 length followed by its characters. A shape is a uint32
+// number of dimensions followed by int64 dimensions.
+static constexpr char kChunkedMagic[8] = {'O', '3', 'D', 'H',
+                                          'M', 'A', 'P', '\0'};
+static constexpr uint32_t kChunkedVersion = 2;
+static constexpr uint32_t kChunkedFlagLZF = 1;
+// Target raw size of a chunk.
+static constexpr int64_t kChunkedChunkBytes = 1 << 24;
+
+struct ChunkedHashMapHeader {
+    uint32_t flags = 0;
+    int64_t num_entries = 0;
+    std::unordered_map<std::string, std::string> metadata;
+    core::Dtype key_dtype;
+    core::SizeVector key_element_shape;
+    std::vector<core::Dtype> value_dtypes;
+    std::vector<core::SizeVector> value_element_shapes;
+    // Keys erased since the checkpoint a delta is based on, on the host.
+    core::Tensor erased_keys;
+};
+
+template <typename T>
+static void WriteBinary(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void ReadBytes(std::ifstream& in, void* data, int64_t size) {
+    in.read(static_cast<char*>(data), size);
+    if (!in) {
+        utility::LogError("Unexpected end of chunked hash map file.");
+    }
+}
+
+template <typename T>
+static T ReadBinary(std::ifstream& in) {
+    T value;
+    ReadBytes(in, &value, sizeof(T));
+    return value;
+}
+
+static void WriteString(std::ofstream& out, const std::string& str) {
+    WriteBinary(out, static_cast<uint32_t>(str.size()));
+    out.write(str.data(), str.size());
+}
+
+static std::string ReadString(std::ifstream& in) {
+    std::string str(ReadBinary<uint32_t>(in), '\0');
+    ReadBytes(in, &str[0], str.size());
+    return str;
+}
+
+static void WriteShape(std::ofstream& out, const core::SizeVector& shape) {
+    WriteBinary(out, static_cast<uint32_t>(shape.size()));
+    for (int64_t dim : shape) {
+        WriteBinary(out, dim);
+    }
+}
+
+static core::SizeVector ReadShape(std::ifstream& in) {
+    core::SizeVector shape(ReadBinary<uint32_t>(in));
+    for (int64_t& dim : shape) {
+        dim = ReadBinary<int64_t>(in);
+    }
+    return shape;
+}
+
+static core::Dtype ReadDtype(std::ifstream& in) {
+    const std::string name = ReadString(in);
+    for (const core::Dtype& dtype :
+         {core::Float32, core::Float64, core::Int8, core::Int16, core::Int32,
+          core::Int64, core::UInt8, core::UInt16, core::UInt32, core::UInt64,
+          core::Bool}) {
+        if (dtype.ToString() == name) {
+            return dtype;
+        }
+    }
+    utility::LogError("Unsupported dtype {} in chunked hash map file.", name);
+}
+
+static ChunkedHashMapHeader ReadChunkedHeader(std::ifstream& in,
+                                              const std::string& file_name) {
+    char magic[sizeof(kChunkedMagic)];
+    in.read(magic, sizeof(kChunkedMagic));
+    if (!in || std::memcmp(magic, kChunkedMagic, sizeof(kChunkedMagic))) {
+        utility::LogError("{} is not a chunked hash map file.", file_name);
+    }
+    const uint32_t version = ReadBinary<uint32_t>(in);
+    // Version 1 files have no erased keys.
+    if (version < 1 || version > kChunkedVersion) {
+        utility::LogError("Unsupported chunked hash map version {} in {}.",
+                          version, file_name);
+    }
+
+    ChunkedHashMapHeader header;
+    header.flags = ReadBinary<uint32_t>(in);
+    header.num_entries = ReadBinary<int64_t>(in);
+    const uint32_t num_metadata = ReadBinary<uint32_t>(in);
+    for (uint32_t i = 0; i < num_metadata; ++i) {
+        std::string key = ReadString(in);
+        header.metadata[key] = ReadString(in);
+    }
+    header.key_dtype = ReadDtype(in);
+    header.key_element_shape = ReadShape(in);
+    const uint32_t num_values = ReadBinary<uint32_t>(in);
+    for (uint32_t i = 0; i < num_values; ++i) {
+        header.value_dtypes.push_back(ReadDtype(in));
+        header.value_element_shapes.push_back(ReadShape(in));
+    }
+
+    core::SizeVector erased_keys_shape{
+            version >= 2 ? ReadBinary<int64_t>(in) : int64_t(0)};
+    erased_keys_shape.insert(erased_keys_shape.end(),
+                             header.key_element_shape.begin(),
+                             header.key_element_shape.end());
+    header.erased_keys =
+            core::Tensor(erased_keys_shape, header.key_dtype, core::Device());
+    ReadBytes(in, header.erased_keys.GetDataPtr(),
+              header.erased_keys.NumElements() * header.key_dtype.ByteSize());
+    return header;
+}
+
+/// Interleaves the bits of the key coordinates, relative to the lower bound
+/// of all keys, so that sorting by the code groups nearby keys.
+static uint64_t MortonCode(const int64_t* key,
+                           const int64_t* key_min,
+                           int64_t dim) {
+    const int64_t bits = 64 / dim;
+    uint64_t code = 0;
+    for (int64_t b = 0; b < bits; ++b) {
+        for (int64_t d = 0; d < dim; ++d) {
+            const uint64_t coord = static_cast<uint64_t>(key[d] - key_min[d]);
+            code |= ((coord >> b) & 1) << (b * dim + d);
+        }
+    }
+    return code;
+}
+
+void WriteHashMapChunked(
+        const std::string& file_name,
+        const core::HashMap& hashmap,
+        const utility::optional<core::Tensor>& keys,
+        bool compressed,
+        const std::unordered_map<std::string, std::string>& metadata) {
+    const core::Device host("CPU:0");
+    const core::Tensor key_buffer = hashmap.GetKeyTensor();
+    const std::vector<core::Tensor> value_buffers = hashmap.GetValueTensors();
+
+    const core::Dtype key_dtype = key_buffer.GetDtype();
+    if (key_dtype != core::Int32 && key_dtype != core::Int64) {
+        utility::LogError(
+                "Chunked hash map files only support Int32 and Int64 keys, "
+                "but got {}.",
+                key_dtype.ToString());
+    }
+
+    // Buffer indices of the entries to write. Requested keys that are not
+    // in the hash map are recorded as erased.
+    core::Tensor buf_indices;
+    core::SizeVector erased_keys_shape = key_buffer.GetShape();
+    erased_keys_shape[0] = 0;
+    core::Tensor erased_keys(erased_keys_shape, key_dtype, host);
+    if (keys.has_value()) {
+        // Find() is not const, the copy shares the backend of hashmap.
+        core::HashMap hashmap_ref = hashmap;
+        const core::Tensor keys_device = keys.value().To(hashmap.GetDevice());
+        core::Tensor masks;
+        hashmap_ref.Find(keys_device, buf_indices, masks);
+        buf_indices = buf_indices.IndexGet({masks});
+        erased_keys = keys_device.IndexGet({masks.LogicalNot()})
+                              .To(host)
+                              .Contiguous();
+    } else {
+        hashmap.GetActiveIndices(buf_indices);
+    }
+    buf_indices = buf_indices.To(core::Int64);
+    const int64_t num_entries = buf_indices.GetLength();
+
+    // Keys are small compared to the values. Sort them on the host along a
+    // Morton curve, so that every chunk covers a compact range of keys.
+    const core::SizeVector key_buffer_shape = key_buffer.GetShape();
+    const core::SizeVector key_element_shape(key_buffer_shape.begin() + 1,
+                                             key_buffer_shape.end());
+    const int64_t dim = key_element_shape.NumElements();
+    const core::Tensor keys_host = key_buffer.IndexGet({buf_indices})
+                                           .To(host, core::Int64)
+                                           .Reshape({num_entries, dim})
+                                           .Contiguous();
+    const int64_t* keys_ptr = keys_host.GetDataPtr<int64_t>();
+
+    std::vector<int64_t> key_min(dim, std::numeric_limits<int64_t>::max());
+    for (int64_t i = 0; i < num_entries; ++i) {
+        for (int64_t d = 0; d < dim; ++d) {
+            key_min[d] = std::min(key_min[d], keys_ptr[i * dim + d]);
+        }
+    }
+    std::vector<std::pair<uint64_t, int64_t>> codes(num_entries);
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_entries; ++i) {
+        codes[i] = {MortonCode(keys_ptr + i * dim, key_min.data(), dim), i};
+    }
+    std::sort(codes.begin(), codes.end());
+    std::vector<int64_t> order(num_entries);
+    for (int64_t i = 0; i < num_entries; ++i) {
+        order[i] = codes[i].second;
+    }
+    const core::Tensor buf_indices_sorted = buf_indices.IndexGet(
+            {core::Tensor(order, {num_entries}, core::Int64, host)
+                     .To(hashmap.GetDevice())});
+
+    int64_t entry_bytes = key_dtype.ByteSize() * dim;
+    for (const core::Tensor& value_buffer : value_buffers) {
+        entry_bytes += value_buffer.GetDtype().ByteSize() *
+                       value_buffer.NumElements() / value_buffer.GetLength();
+    }
+    const int64_t chunk_capacity =
+            std::max<int64_t>(1, kChunkedChunkBytes / entry_bytes);
+
+    std::ofstream out(file_name, std::ios::binary);
+    if (!out) {
+        utility::LogError("Failed to open {} for writing.", file_name);
+    }
+
+    out.write(kChunkedMagic, sizeof(kChunkedMagic));
+    WriteBinary(out, kChunkedVersion);
+    WriteBinary(out, compressed ? kChunkedFlagLZF : uint32_t(0));
+    WriteBinary(out, num_entries);
+    // Sorted, so that the same content gives the same file.
+    const std::map<std::string, std::string> sorted_metadata(metadata.begin(),
+                                                             metadata.end());
+    WriteBinary(out, static_cast<uint32_t>(sorted_metadata.size()));
+    for (const auto& it : sorted_metadata) {
+        WriteString(out, it.first);
+        WriteString(out, it.second);
+    }
+    WriteString(out, key_dtype.ToString());
+    WriteShape(out, key_element_shape);
+    WriteBinary(out, static_cast<uint32_t>(value_buffers.size()));
+    for (const core::Tensor& value_buffer : value_buffers) {
+        WriteString(out, value_buffer.GetDtype().ToString());
+        const core::SizeVector value_buffer_shape = value_buffer.GetShape();
+        WriteShape(out, core::SizeVector(value_buffer_shape.begin() + 1,
+                                         value_buffer_shape.end()));
+    }
+    // Deltas erase few keys, they are stored uncompressed.
+    WriteBinary(out, erased_keys.GetLength());
+    out.write(static_cast<const char*>(erased_keys.GetDataPtr()),
+              erased_keys.NumElements() * key_dtype.ByteSize());
+
+    std::vector<std::vector<uint8_t>> compressed_blocks(1 +
+                                                        value_buffers.size());
+    for (int64_t start = 0; start < num_entries; start += chunk_capacity) {
+        const int64_t end = std::min(num_entries, start + chunk_capacity);
+        const core::Tensor chunk_buf_indices =
+                buf_indices_sorted.Slice(0, start, end);
+
+        std::vector<int64_t> bounds(2 * dim);
+        std::fill(bounds.begin(), bounds.begin() + dim,
+                  std::numeric_limits<int64_t>::max());
+        std::fill(bounds.begin() + dim, bounds.end(),
+                  std::numeric_limits<int64_t>::min());
+        for (int64_t i = start; i < end; ++i) {
+            for (int64_t d = 0; d < dim; ++d) {
+                const int64_t coord = keys_ptr[order[i] * dim + d];
+                bounds[d] = std::min(bounds[d], coord);
+                bounds[dim + d] = std::max(bounds[dim + d], coord);
+            }
+        }
+
+        // Only this chunk of keys and values is staged on the host.
+        std::vector<core::Tensor> blocks;
+        blocks.push_back(key_buffer.IndexGet({chunk_buf_indices})
+                                 .To(host)
+                                 .Contiguous());
+        for (const core::Tensor& value_buffer : value_buffers) {
+            blocks.push_back(value_buffer.IndexGet({chunk_buf_indices})
+                                     .To(host)
+                                     .Contiguous());
+        }
+
+        std::vector<uint64_t> raw_sizes(blocks.size());
+        std::vector<uint64_t> stored_sizes(blocks.size());
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            raw_sizes[b] = blocks[b].NumElements() *
+                           blocks[b].GetDtype().ByteSize();
+            stored_sizes[b] = raw_sizes[b];
+            if (compressed && raw_sizes[b] > 1) {
+                // lzf_compress returns 0 when the output would not be smaller
+                // than the input, the block is then stored as is.
+                compressed_blocks[b].resize(raw_sizes[b] - 1);
+                const unsigned int compressed_size = lzf_compress(
+                        blocks[b].GetDataPtr(), raw_sizes[b],
+                        compressed_blocks[b].data(), raw_sizes[b] - 1);
+                if (compressed_size > 0) {
+                    stored_sizes[b] = compressed_size;
+                }
+            }
+        }
+
+        WriteBinary(out, end - start);
+        out.write(reinterpret_cast<const char*>(bounds.data()),
+                  bounds.size() * sizeof(int64_t));
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            WriteBinary(out, raw_sizes[b]);
+            WriteBinary(out, stored_sizes[b]);
+        }
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            const char* data =
+                    stored_sizes[b] < raw_sizes[b]
+                            ? reinterpret_cast<const char*>(
+                                      compressed_blocks[b].data())
+                            : static_cast<const char*>(blocks[b].GetDataPtr());
+            out.write(data, stored_sizes[b]);
+        }
+    }
+    WriteBinary(out, int64_t(0));
+
+    if (!out) {
+        utility::LogError("Failed to write chunked hash map to {}.", file_name);
+    }
+}
+
+/// Inserts entries, overwriting the values of keys that already exist.
+static void UpsertEntries(core::HashMap& hashmap,
+                          const core::Tensor& keys,
+                          const std::vector<core::Tensor>& values) {
+    core::Tensor buf_indices, masks;
+    hashmap.Insert(keys, values, buf_indices, masks);
+
+    const core::Tensor existing = masks.LogicalNot();
+    if (!existing.Any()) {
+        return;
+    }
+    hashmap.Find(keys.IndexGet({existing}), buf_indices, masks);
+    const core::Tensor existing_buf_indices = buf_indices.To(core::Int64);
+    std::vector<core::Tensor> value_buffers = hashmap.GetValueTensors();
+    for (size_t i = 0; i < values.size(); ++i) {
+        value_buffers[i].IndexSet({existing_buf_indices},
+                                  values[i].IndexGet({existing}));
+    }
+}
+
+/// Returns a host Bool mask of the keys within the inclusive key range.
+static core::Tensor MaskKeysInRange(const core::Tensor& keys,
+                                    const int64_t* range_ptr,
+                                    int64_t dim) {
+    const core::Device host("CPU:0");
+    const int64_t n = keys.GetLength();
+    const core::Tensor keys_i64 =
+            keys.To(host, core::Int64).Reshape({n, dim}).Contiguous();
+    const int64_t* keys_ptr = keys_i64.GetDataPtr<int64_t>();
+    core::Tensor mask({n}, core::Bool, host);
+    bool* mask_ptr = mask.GetDataPtr<bool>();
+    for (int64_t i = 0; i < n; ++i) {
+        mask_ptr[i] = true;
+        for (int64_t d = 0; d < dim; ++d) {
+            const int64_t coord = keys_ptr[i * dim + d];
+            mask_ptr[i] = mask_ptr[i] && coord >= range_ptr[d] &&
+                          coord <= range_ptr[dim + d];
+        }
+    }
+    return mask;
+}
+
+/// Returns the erased keys of the file that are within the key range.
+static core::Tensor ErasedKeysInRange(
+        const ChunkedHashMapHeader& header,
+        const utility::optional<core::Tensor>& key_range) {
+    if (!key_range.has_value() || header.erased_keys.GetLength() == 0) {
+        return header.erased_keys;
+    }
+    const int64_t dim = header.key_element_shape.NumElements();
+    core::AssertTensorShape(key_range.value(), {2, dim});
+    const core::Device host("CPU:0");
+    const core::Tensor range =
+            key_range.value().To(host, core::Int64).Contiguous();
+    return header.erased_keys.IndexGet({MaskKeysInRange(
+            header.erased_keys, range.GetDataPtr<int64_t>(), dim)});
+}
+
+/// Reads the chunks following the header. Chunks whose key bounds do not
+/// overlap the key range are skipped without being read. If hashmap is null,
+/// only counts the entries of the overlapping chunks.
+static int64_t ReadChunks(std::ifstream& in,
+                          const ChunkedHashMapHeader& header,
+                          const utility::optional<core::Tensor>& key_range,
+                          core::HashMap* hashmap) {
+    const core::Device host("CPU:0");
+    const int64_t dim = header.key_element_shape.NumElements();
+
+    core::Tensor range;
+    if (key_range.has_value()) {
+        core::AssertTensorShape(key_range.value(), {2, dim});
+        range = key_range.value().To(host, core::Int64).Contiguous();
+    }
+    const int64_t* range_ptr =
+            key_range.has_value() ? range.GetDataPtr<int64_t>() : nullptr;
+
+    std::vector<core::Dtype> block_dtypes{header.key_dtype};
+    std::vector<core::SizeVector> block_element_shapes{
+            header.key_element_shape};
+    block_dtypes.insert(block_dtypes.end(), header.value_dtypes.begin(),
+                        header.value_dtypes.end());
+    block_element_shapes.insert(block_element_shapes.end(),
+                                header.value_element_shapes.begin(),
+                                header.value_element_shapes.end());
+    const size_t num_blocks = block_dtypes.size();
+
+    int64_t num_read = 0;
+    std::vector<int64_t> bounds(2 * dim);
+    std::vector<uint64_t> raw_sizes(num_blocks), stored_sizes(num_blocks);
+    std::vector<uint8_t> compressed_block;
+    while (true) {
+        const int64_t n = ReadBinary<int64_t>(in);
+        if (n == 0) {
+            break;
+        }
+        ReadBytes(in, bounds.data(), bounds.size() * sizeof(int64_t));
+        uint64_t chunk_bytes = 0;
+        for (size_t b = 0; b < num_blocks; ++b) {
+            raw_sizes[b] = ReadBinary<uint64_t>(in);
+            stored_sizes[b] = ReadBinary<uint64_t>(in);
+            chunk_bytes += stored_sizes[b];
+        }
+
+        bool overlaps = true;
+        for (int64_t d = 0; range_ptr && d < dim; ++d) {
+            overlaps = overlaps && bounds[dim + d] >= range_ptr[d] &&
+                       bounds[d] <= range_ptr[dim + d];
+        }
+        if (!overlaps || hashmap == nullptr) {
+            num_read += overlaps ? n : 0;
+            in.seekg(chunk_bytes, std::ios::cur);
+            continue;
+        }
+
+        std::vector<core::Tensor> blocks;
+        for (size_t b = 0; b < num_blocks; ++b) {
+            core::SizeVector shape{n};
+            shape.insert(shape.end(), block_element_shapes[b].begin(),
+                         block_element_shapes[b].end());
+            core::Tensor block(shape, block_dtypes[b], host);
+            const uint64_t expected_size =
+                    block.NumElements() * block_dtypes[b].ByteSize();
+            if (raw_sizes[b] != expected_size) {
+                utility::LogError(
+                        "Corrupted chunked hash map file: expected {} bytes "
+                        "in a block, but got {}.",
+                        expected_size, raw_sizes[b]);
+            }
+            if (stored_sizes[b] < raw_sizes[b]) {
+                compressed_block.resize(stored_sizes[b]);
+                ReadBytes(in, compressed_block.data(), stored_sizes[b]);
+                if (lzf_decompress(compressed_block.data(), stored_sizes[b],
+                                   block.GetDataPtr(),
+                                   raw_sizes[b]) != raw_sizes[b]) {
+                    utility::LogError(
+                            "Corrupted chunked hash map file: failed to "
+                            "decompress a block.");
+                }
+            } else {
+                ReadBytes(in, block.GetDataPtr(), raw_sizes[b]);
+            }
+            blocks.push_back(block);
+        }
+
+        core::Tensor keys = blocks[0];
+        std::vector<core::Tensor> values(blocks.begin() + 1, blocks.end());
+        if (range_ptr) {
+            const core::Tensor mask = MaskKeysInRange(keys, range_ptr, dim);
+            keys = keys.IndexGet({mask});
+            for (core::Tensor& value : values) {
+                value = value.IndexGet({mask});
+            }
+        }
+        if (keys.GetLength() == 0) {
+            continue;
+        }
+
+        const core::Device device = hashmap->GetDevice();
+        for (core::Tensor& value : values) {
+            value = value.To(device);
+        }
+        UpsertEntries(*hashmap, keys.To(device), values);
+        num_read += keys.GetLength();
+    }
+    return num_read;
+}
+
+core::HashMap ReadHashMapChunked(
+        const std::string& file_name,
+        const core::Device& device,
+        const utility::optional<core::Tensor>& key_range) {
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in) {
+        utility::LogError("Failed to open {}.", file_name);
+    }
+    const ChunkedHashMapHeader header = ReadChunkedHeader(in, file_name);
+
+    // For partial loads, size the hash map from the chunk headers instead of
+    // the total number of entries.
+    int64_t init_capacity = header.num_entries;
+    if (key_range.has_value()) {
+        const std::streampos chunks_begin = in.tellg();
+        init_capacity = ReadChunks(in, header, key_range, nullptr);
+        in.seekg(chunks_begin);
+    }
+
+    core::HashMap hashmap(std::max<int64_t>(init_capacity, 1),
+                          header.key_dtype, header.key_element_shape,
+                          header.value_dtypes, header.value_element_shapes,
+                          device);
+    ReadChunks(in, header, key_range, &hashmap);
+    return hashmap;
+}
+
+void ReadHashMapChunked(const std::string& file_name,
+                        core::HashMap& hashmap,
+                        const utility::optional<core::Tensor>& key_range) {
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in) {
+        utility::LogError("Failed to open {}.", file_name);
+    }
+    const ChunkedHashMapHeader header = ReadChunkedHeader(in, file_name);
+    const core::Tensor erased_keys = ErasedKeysInRange(header, key_range);
+    if (erased_keys.GetLength() > 0) {
+        hashmap.Erase(erased_keys.To(hashmap.GetDevice()));
+    }
+    ReadChunks(in, header, key_range, &hashmap);
+}
+
+std::unordered_map<std::string, std::string> ReadHashMapChunkedMetadata(
+        const std::string& file_name) {
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in) {
+        utility::LogError("Failed to open {}.", file_name);
+    }
+    return ReadChunkedHeader(in, file_name).metadata;
+}
+
+core::Tensor ReadHashMapChunkedErasedKeys(
+        const std::string& file_name,
+        const utility::optional<core::Tensor>& key_range) {
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in) {
+        utility::LogError("Failed to open {}.", file_name);
+    }
+    return ErasedKeysInRange(ReadChunkedHeader(in, file_name), key_range);
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -27,9 +27,11 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashMap.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace t {
@@ -47,6 +49,68 @@ core::HashMap ReadHashMap(const std::string& filename);
 /// \param hashmap HashMap to save.
 void WriteHashMap(const std::string& filename, const core::HashMap& hashmap);
 
+/// \brief Stream a hash map's entries to a chunked binary file.
+///
+/// Entries are written in chunks of about 16MB, ordered along a Morton curve
+/// of the keys. Only one chunk of values is gathered on the host at a time,
+/// and each chunk is optionally compressed with LZF. Every chunk stores the
+/// bounds of its keys, so readers can skip chunks outside a key range.
+///
+/// \param file_name The file name to write to.
+/// \param hashmap HashMap to save. Keys must be Int32 or Int64.
+/// \param keys If set, only the entries with these keys are written, e.g. the
+/// entries modified or erased since the last checkpoint. Keys absent from the
+/// hash map are recorded as erased. Otherwise all active entries are written.
+/// \param compressed If true, chunks are compressed with LZF. Chunks that do
+/// not compress are stored as is.
+/// \param metadata Optional string attributes stored in the file header.
+void WriteHashMapChunked(
+        const std::string& file_name,
+        const core::HashMap& hashmap,
+        const utility::optional<core::Tensor>& keys = utility::nullopt,
+        bool compressed = true,
+        const std::unordered_map<std::string, std::string>& metadata = {});
+
+/// \brief Read a chunked hash map file written by WriteHashMapChunked().
+///
+/// \param file_name The file name to read from.
+/// \param device The device of the returned hash map.
+/// \param key_range If set, a (2, D) integer tensor with the inclusive lower
+/// and upper bounds of the keys to load. Other entries are skipped, and
+/// chunks entirely outside the range are not decompressed.
+core::HashMap ReadHashMapChunked(
+        const std::string& file_name,
+        const core::Device& device = core::Device("CPU:0"),
+        const utility::optional<core::Tensor>& key_range = utility::nullopt);
+
+/// \brief Read a chunked hash map file into an existing hash map.
+///
+/// Keys that are not in \p hashmap are inserted, and the values of existing
+/// keys are overwritten. Keys recorded as erased are erased. Applying a full
+/// checkpoint followed by delta checkpoints in order restores the latest
+/// state.
+///
+/// \param file_name The file name to read from.
+/// \param hashmap The hash map to update. Its key and value dtypes and
+/// element shapes must match the file.
+/// \param key_range See ReadHashMapChunked().
+void ReadHashMapChunked(
+        const std::string& file_name,
+        core::HashMap& hashmap,
+        const utility::optional<core::Tensor>& key_range = utility::nullopt);
+
+/// Read the metadata stored in the header of a chunked hash map file.
+std::unordered_map<std::string, std::string> ReadHashMapChunkedMetadata(
+        const std::string& file_name);
+
+/// Read the keys recorded as erased in a chunked hash map file, on CPU.
+///
+/// \param file_name The file name to read from.
+/// \param key_range See ReadHashMapChunked().
+core::Tensor ReadHashMapChunkedErasedKeys(
+        const std::string& file_name,
+        const utility::optional<core::Tensor>& key_range = utility::nullopt);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -0,0 +1,510 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/color_map/ColorMapOptimizer.h"
+
+#include <Eigen/Sparse>
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+static const core::Device host("CPU:0");
+
+namespace {
+
+/// Images derived from the RGB-D images, on the mesh device.
+struct ColorMapImages {
+    std::vector<core::Tensor> gray_;
+    std::vector<core::Tensor> gray_dx_;
+    std::vector<core::Tensor> gray_dy_;
+    std::vector<core::Tensor> color_;
+    std::vector<core::Tensor> depth_;
+    std::vector<core::Tensor> mask_;
+};
+
+}  // namespace
+
+static ColorMapImages CreateColorMapImages(
+        const std::vector<geometry::RGBDImage>& images_rgbd,
+        const RigidOptimizerOption& option,
+        const core::Device& device) {
+    ColorMapImages images;
+    for (const geometry::RGBDImage& image_rgbd : images_rgbd) {
+        geometry::Image color = image_rgbd.color_.To(device).To(core::Float32);
+        geometry::Image gray = color.RGBToGray().FilterGaussian(3);
+        geometry::Image gray_dx, gray_dy;
+        std::tie(gray_dx, gray_dy) = gray.FilterSobel(3);
+
+        geometry::Image depth = image_rgbd.depth_.To(device).To(
+                core::Float32, /*copy=*/false, 1.0 / option.depth_scale_);
+        geometry::Image depth_dx, depth_dy;
+        std::tie(depth_dx, depth_dy) = depth.FilterSobel(3);
+        const core::Tensor gradient_sq =
+                depth_dx.AsTensor() * depth_dx.AsTensor() +
+                depth_dy.AsTensor() * depth_dy.AsTensor();
+        const double threshold =
+                option.depth_threshold_for_discontinuity_check_;
+        const int half_kernel_size =
+                option.half_dilation_kernel_size_for_discontinuity_map_;
+        geometry::Image mask(
+                gradient_sq.Gt(threshold * threshold).To(core::UInt8).Mul(255));
+        if (half_kernel_size > 0) {
+            mask = mask.Dilate(2 * half_kernel_size + 1);
+        }
+
+        images.gray_.push_back(gray.AsTensor());
+        images.gray_dx_.push_back(gray_dx.AsTensor());
+        images.gray_dy_.push_back(gray_dy.AsTensor());
+        images.color_.push_back(color.AsTensor());
+        images.depth_.push_back(depth.AsTensor());
+        images.mask_.push_back(mask.AsTensor());
+    }
+    return images;
+}
+
+/// Indices of the vertices visible in each image.
+static std::vector<core::Tensor> ComputeVisibleIndices(
+        const core::Tensor& vertices,
+        const ColorMapImages& images,
+        const core::Tensor& intrinsics,
+        const std::vector<core::Tensor>& extrinsics,
+        const RigidOptimizerOption& option) {
+    std::vector<core::Tensor> visible_indices;
+    for (size_t c = 0; c < extrinsics.size(); ++c) {
+        core::Tensor visibility;
+        kernel::color_map::ComputeVertexVisibility(
+                vertices, images.depth_[c], images.mask_[c], intrinsics,
+                extrinsics[c], visibility,
+                static_cast<float>(option.maximum_allowable_depth_),
+                static_cast<float>(
+                        option.depth_threshold_for_visibility_check_));
+        visible_indices.push_back(visibility.NonZero()[0]);
+    }
+    return visible_indices;
+}
+
+static float GetAnchorStep(const core::Tensor& image,
+                           const core::Tensor& warping_field) {
+    if (warping_field.NumElements() == 0) {
+        return 0;
+    }
+    return static_cast<float>(image.GetShape(0)) /
+           (warping_field.GetShape(0) - 1);
+}
+
+/// Same as ImageWarpingField::InitializeWarpingFields: anchors on a regular
+/// grid holding their own pixel position.
+static core::Tensor CreateWarpingField(int64_t rows,
+                                       int64_t cols,
+                                       int number_of_vertical_anchors,
+                                       const core::Device& device) {
+    if (number_of_vertical_anchors < 2) {
+        utility::LogError(
+                "Number of vertical anchors must be >= 2, but got {}.",
+                number_of_vertical_anchors);
+    }
+    const int64_t anchor_h = number_of_vertical_anchors;
+    const double anchor_step = static_cast<double>(rows) / (anchor_h - 1);
+    const int64_t anchor_w =
+            static_cast<int64_t>(std::ceil(cols / anchor_step) + 1);
+
+    core::Tensor warping_field =
+            core::Tensor::Empty({anchor_h, anchor_w, 2}, core::Float32, host);
+    float* warping_field_ptr = warping_field.GetDataPtr<float>();
+    for (int64_t j = 0; j < anchor_h; ++j) {
+        for (int64_t i = 0; i < anchor_w; ++i) {
+            warping_field_ptr[(i + j * anchor_w) * 2] = i * anchor_step;
+            warping_field_ptr[(i + j * anchor_w) * 2 + 1] = j * anchor_step;
+        }
+    }
+    return warping_field.To(device);
+}
+
+/// Averages the values of \p images at the projections of each vertex over
+/// the images it is visible in. \p warping_fields may be empty. Returns the
+/// (N, C) averages and the (N,) number of samples per vertex.
+static std::pair<core::Tensor, core::Tensor> AverageVertexValues(
+        const core::Tensor& vertices,
+        const std::vector<core::Tensor>& images,
+        const core::Tensor& intrinsics,
+        const std::vector<core::Tensor>& extrinsics,
+        const std::vector<core::Tensor>& visible_indices,
+        const std::vector<core::Tensor>& warping_fields,
+        int image_boundary_margin) {
+    const int64_t n = vertices.GetLength();
+    const int64_t channels = images.empty() ? 1 : images[0].GetShape(2);
+    core::Tensor value_sum = core::Tensor::Zeros({n, channels}, core::Float32,
+                                                 vertices.GetDevice());
+    core::Tensor weight_sum =
+            core::Tensor::Zeros({n}, core::Float32, vertices.GetDevice());
+    for (size_t c = 0; c < images.size(); ++c) {
+        const core::Tensor warping_field =
+                warping_fields.empty() ? core::Tensor() : warping_fields[c];
+        kernel::color_map::AccumulateVertexValues(
+                vertices, visible_indices[c], images[c], intrinsics,
+                extrinsics[c], warping_field, value_sum, weight_sum,
+                GetAnchorStep(images[c], warping_field),
+                image_boundary_margin);
+    }
+    core::Tensor average =
+            value_sum / weight_sum.Clip(1, std::numeric_limits<float>::max())
+                                .Reshape({n, 1});
+    return std::make_pair(average, weight_sum);
+}
+
+static core::Tensor ComputeProxyIntensity(
+        const core::Tensor& vertices,
+        const ColorMapImages& images,
+        const core::Tensor& intrinsics,
+        const std::vector<core::Tensor>& extrinsics,
+        const std::vector<core::Tensor>& visible_indices,
+        const std::vector<core::Tensor>& warping_fields,
+        int image_boundary_margin) {
+    return AverageVertexValues(vertices, images.gray_, intrinsics, extrinsics,
+                               visible_indices, warping_fields,
+                               image_boundary_margin)
+            .first.Reshape({vertices.GetLength()});
+}
+
+/// Same as SetGeometryColorAverage: colors each vertex with its average color
+/// over the images, and fills the invisible vertices with the average color of
+/// their nearest visible neighbors.
+static geometry::TriangleMesh ColorMesh(
+        const geometry::TriangleMesh& mesh,
+        const ColorMapImages& images,
+        const core::Tensor& intrinsics,
+        const std::vector<core::Tensor>& extrinsics,
+        const std::vector<core::Tensor>& visible_indices,
+        const std::vector<core::Tensor>& warping_fields,
+        const RigidOptimizerOption& option) {
+    const core::Tensor vertices =
+            mesh.GetVertexPositions().To(core::Float32).Contiguous();
+    core::Tensor colors, weight_sum;
+    std::tie(colors, weight_sum) = AverageVertexValues(
+            vertices, images.color_, intrinsics, extrinsics, visible_indices,
+            warping_fields, option.image_boundary_margin_);
+
+    const core::Tensor valid = weight_sum.Gt(0);
+    const core::Tensor valid_indices = valid.NonZero()[0];
+    const core::Tensor invalid_indices = valid.LogicalNot().NonZero()[0];
+    if (option.invisible_vertex_color_knn_ > 0 &&
+        valid_indices.GetLength() > 0 && invalid_indices.GetLength() > 0) {
+        core::nns::NearestNeighborSearch nns(
+                vertices.IndexGet({valid_indices}));
+        nns.KnnIndex();
+        core::Tensor neighbors;
+        std::tie(neighbors, std::ignore) =
+                nns.KnnSearch(vertices.IndexGet({invalid_indices}),
+                              option.invisible_vertex_color_knn_);
+        const int64_t knn = neighbors.GetShape(1);
+        const core::Tensor neighbor_colors =
+                colors.IndexGet({valid_indices})
+                        .IndexGet({neighbors.To(core::Int64).Reshape({-1})})
+                        .Reshape({invalid_indices.GetLength(), knn, 3});
+        colors.IndexSet({invalid_indices}, neighbor_colors.Mean({1}));
+    }
+
+    geometry::TriangleMesh colored_mesh = mesh.Clone();
+    colored_mesh.SetVertexColors(colors);
+    return colored_mesh;
+}
+
+/// Checks the inputs and returns the Float32 vertices and the Float64 host
+/// extrinsics.
+static std::pair<core::Tensor, std::vector<core::Tensor>> PrepareInputs(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<geometry::RGBDImage>& images_rgbd,
+        const core::Tensor& intrinsics,
+        const std::vector<core::Tensor>& extrinsics) {
+    if (!mesh.HasVertexPositions()) {
+        utility::LogError("The mesh has no vertices.");
+    }
+    if (images_rgbd.size() != extrinsics.size()) {
+        utility::LogError(
+                "The number of images ({}) and extrinsics ({}) mismatch.",
+                images_rgbd.size(), extrinsics.size());
+    }
+    core::AssertTensorShape(intrinsics, {3, 3});
+
+    std::vector<core::Tensor> extrinsics_d;
+    for (const core::Tensor& extrinsic : extrinsics) {
+        core::AssertTensorShape(extrinsic, {4, 4});
+        extrinsics_d.push_back(
+                extrinsic.To(host, core::Float64, /*copy=*/true));
+    }
+    return std::make_pair(
+            mesh.GetVertexPositions().To(core::Float32).Contiguous(),
+            extrinsics_d);
+}
+
+std::tuple<geometry::TriangleMesh, std::vector<core::Tensor>> RunRigidOptimizer(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<geometry::RGBDImage>& images_rgbd,
+        const core::Tensor& intrinsics,
+        const std::vector<core::Tensor>& extrinsics,
+        const RigidOptimizerOption& option) {
+    core::Tensor vertices;
+    std::vector<core::Tensor> opt_extrinsics;
+    std::tie(vertices, opt_extrinsics) =
+            PrepareInputs(mesh, images_rgbd, intrinsics, extrinsics);
+
+    utility::LogDebug("[ColorMapOptimization] CreateColorMapImages");
+    const ColorMapImages images =
+            CreateColorMapImages(images_rgbd, option, vertices.GetDevice());
+
+    utility::LogDebug("[ColorMapOptimization] ComputeVisibleIndices");
+    const std::vector<core::Tensor> visible_indices = ComputeVisibleIndices(
+            vertices, images, intrinsics, opt_extrinsics, option);
+
+    utility::LogDebug("[ColorMapOptimization] Rigid Optimization");
+    core::Tensor proxy_intensity = ComputeProxyIntensity(
+            vertices, images, intrinsics, opt_extrinsics, visible_indices, {},
+            option.image_boundary_margin_);
+    for (int itr = 0; itr < option.maximum_iteration_; ++itr) {
+        double residual = 0;
+        int64_t count = 0;
+        for (size_t c = 0; c < opt_extrinsics.size(); ++c) {
+            core::Tensor delta;
+            float residual_c;
+            int count_c;
+            try {
+                kernel::color_map::ComputeRigidColorMapResult(
+                        vertices, visible_indices[c], proxy_intensity,
+                        images.gray_[c], images.gray_dx_[c],
+                        images.gray_dy_[c], intrinsics, opt_extrinsics[c],
+                        delta, residual_c, count_c,
+                        option.image_boundary_margin_);
+            } catch (const std::runtime_error&) {
+                utility::LogWarning("Skipping image {} with a singular system.",
+                                    c);
+                continue;
+            }
+            opt_extrinsics[c] =
+                    kernel::PoseToTransformation(delta.To(host, core::Float64))
+                            .Matmul(opt_extrinsics[c]);
+            residual += residual_c;
+            count += count_c;
+        }
+        utility::LogDebug("[Iteration {:04d}] Residual error : {:.6f} ({})",
+                          itr + 1, residual, count);
+        proxy_intensity = ComputeProxyIntensity(
+                vertices, images, intrinsics, opt_extrinsics, visible_indices,
+                {}, option.image_boundary_margin_);
+    }
+
+    utility::LogDebug("[ColorMapOptimization] Set Mesh Color");
+    geometry::TriangleMesh colored_mesh =
+            ColorMesh(mesh, images, intrinsics, opt_extrinsics,
+                      visible_indices, {}, option);
+    return std::make_tuple(colored_mesh, opt_extrinsics);
+}
+
+/// Assembles the sparse linear system of an image from the block reduction of
+/// ComputeNonRigidColorMapSystem(), adds the warping field regularization and
+/// solves it. Returns false if the system is singular.
+static bool SolveNonRigidSystem(const core::Tensor& reduction,
+                                const core::Tensor& warping_field,
+                                const core::Tensor& warping_field_init,
+                                double regularizer_weight,
+                                Eigen::VectorXd& delta,
+                                double& residual,
+                                double& residual_reg) {
+    const core::Tensor reduction_d = reduction.To(host, core::Float64);
+    const core::Tensor flow = warping_field.To(host, core::Float64);
+    const core::Tensor flow_init = warping_field_init.To(host, core::Float64);
+    const double* A = reduction_d.GetDataPtr<double>();
+    const double* flow_ptr = flow.GetDataPtr<double>();
+    const double* flow_init_ptr = flow_init.GetDataPtr<double>();
+    const int64_t anchor_h = warping_field.GetShape(0);
+    const int64_t anchor_w = warping_field.GetShape(1);
+    const int64_t num_anchors = anchor_h * anchor_w;
+    const int64_t dim = 6 + 2 * num_anchors;
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    Eigen::VectorXd JTr(dim);
+    for (int j = 0, idx = 0; j < 6; ++j) {
+        for (int k = 0; k <= j; ++k, ++idx) {
+            triplets.emplace_back(j, k, A[idx]);
+            if (k != j) {
+                triplets.emplace_back(k, j, A[idx]);
+            }
+        }
+        JTr(j) = A[21 + j];
+    }
+    residual = A[27];
+
+    residual_reg = 0;
+    const double weight_sq = regularizer_weight * regularizer_weight;
+    for (int64_t a = 0; a < num_anchors; ++a) {
+        const double* block =
+                A + 29 + a * kernel::color_map::kNonRigidAnchorReductionSize;
+        const int64_t i = a % anchor_w;
+        const int64_t j = a / anchor_w;
+        for (int c = 0; c < 2; ++c) {
+            const int64_t row = 6 + 2 * a + c;
+            for (int p = 0; p < 6; ++p) {
+                triplets.emplace_back(row, p, block[c * 6 + p]);
+                triplets.emplace_back(p, row, block[c * 6 + p]);
+            }
+            for (int di = -1; di <= 1; ++di) {
+                for (int dj = -1; dj <= 1; ++dj) {
+                    const int64_t ni = i + di;
+                    const int64_t nj = j + dj;
+                    if (ni < 0 || ni >= anchor_w || nj < 0 || nj >= anchor_h) {
+                        continue;
+                    }
+                    const int slot = (di + 1) * 3 + (dj + 1);
+                    const int64_t col = 6 + 2 * (ni + nj * anchor_w);
+                    for (int d = 0; d < 2; ++d) {
+                        triplets.emplace_back(row, col + d,
+                                              block[12 + slot * 4 + c * 2 + d]);
+                    }
+                }
+            }
+
+            const double r = regularizer_weight *
+                             (flow_ptr[2 * a + c] - flow_init_ptr[2 * a + c]);
+            triplets.emplace_back(row, row, weight_sq);
+            JTr(row) = block[kernel::color_map::kNonRigidAnchorJtrOffset + c] +
+                       regularizer_weight * r;
+            residual_reg += r * r;
+        }
+    }
+
+    Eigen::SparseMatrix<double> JTJ(dim, dim);
+    JTJ.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(JTJ);
+    if (solver.info() != Eigen::Success) {
+        return false;
+    }
+    delta = solver.solve(-JTr);
+    return solver.info() == Eigen::Success;
+}
+
+std::tuple<geometry::TriangleMesh,
+           std::vector<core::Tensor>,
+           std::vector<core::Tensor>>
+RunNonRigidOptimizer(const geometry::TriangleMesh& mesh,
+                     const std::vector<geometry::RGBDImage>& images_rgbd,
+                     const core::Tensor& intrinsics,
+                     const std::vector<core::Tensor>& extrinsics,
+                     const NonRigidOptimizerOption& option) {
+    core::Tensor vertices;
+    std::vector<core::Tensor> opt_extrinsics;
+    std::tie(vertices, opt_extrinsics) =
+            PrepareInputs(mesh, images_rgbd, intrinsics, extrinsics);
+    const core::Device device = vertices.GetDevice();
+
+    utility::LogDebug("[ColorMapOptimization] CreateColorMapImages");
+    const ColorMapImages images =
+            CreateColorMapImages(images_rgbd, option, device);
+
+    utility::LogDebug("[ColorMapOptimization] ComputeVisibleIndices");
+    const std::vector<core::Tensor> visible_indices = ComputeVisibleIndices(
+            vertices, images, intrinsics, opt_extrinsics, option);
+
+    utility::LogDebug("[ColorMapOptimization] Non-Rigid Optimization");
+    std::vector<core::Tensor> warping_fields;
+    std::vector<core::Tensor> warping_fields_init;
+    for (const core::Tensor& gray : images.gray_) {
+        warping_fields_init.push_back(CreateWarpingField(
+                gray.GetShape(0), gray.GetShape(1),
+                option.number_of_vertical_anchors_, device));
+        warping_fields.push_back(warping_fields_init.back().Clone());
+    }
+
+    const int64_t n_vertex = vertices.GetLength();
+    core::Tensor proxy_intensity = ComputeProxyIntensity(
+            vertices, images, intrinsics, opt_extrinsics, visible_indices,
+            warping_fields, option.image_boundary_margin_);
+    for (int itr = 0; itr < option.maximum_iteration_; ++itr) {
+        double residual = 0;
+        double residual_reg = 0;
+        for (size_t c = 0; c < opt_extrinsics.size(); ++c) {
+            core::Tensor reduction;
+            kernel::color_map::ComputeNonRigidColorMapSystem(
+                    vertices, visible_indices[c], proxy_intensity,
+                    images.gray_[c], images.gray_dx_[c], images.gray_dy_[c],
+                    intrinsics, opt_extrinsics[c], warping_fields[c],
+                    reduction,
+                    GetAnchorStep(images.gray_[c], warping_fields[c]),
+                    option.image_boundary_margin_);
+
+            const double weight = option.non_rigid_anchor_point_weight_ *
+                                  visible_indices[c].GetLength() / n_vertex;
+            Eigen::VectorXd delta;
+            double residual_c, residual_reg_c;
+            if (!SolveNonRigidSystem(reduction, warping_fields[c],
+                                     warping_fields_init[c], weight, delta,
+                                     residual_c, residual_reg_c)) {
+                utility::LogWarning("Skipping image {} with a singular system.",
+                                    c);
+                continue;
+            }
+
+            const core::Tensor pose(std::vector<double>(delta.data(),
+                                                        delta.data() + 6),
+                                    {6}, core::Float64, host);
+            opt_extrinsics[c] = kernel::PoseToTransformation(pose).Matmul(
+                    opt_extrinsics[c]);
+            const core::Tensor flow_delta(
+                    std::vector<float>(delta.data() + 6,
+                                       delta.data() + delta.size()),
+                    warping_fields[c].GetShape(), core::Float32, device);
+            warping_fields[c] += flow_delta;
+
+            residual += residual_c;
+            residual_reg += residual_reg_c;
+        }
+        utility::LogDebug(
+                "[Iteration {:04d}] Residual error : {:.6f}, reg : {:.6f}",
+                itr + 1, residual, residual_reg);
+        proxy_intensity = ComputeProxyIntensity(
+                vertices, images, intrinsics, opt_extrinsics, visible_indices,
+                warping_fields, option.image_boundary_margin_);
+    }
+
+    utility::LogDebug("[ColorMapOptimization] Set Mesh Color");
+    geometry::TriangleMesh colored_mesh =
+            ColorMesh(mesh, images, intrinsics, opt_extrinsics,
+                      visible_indices, warping_fields, option);
+    return std::make_tuple(colored_mesh, opt_extrinsics, warping_fields);
+}
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file ColorMapOptimizer.h
+/// Tensor counterpart of pipelines/color_map. All the 4x4 extrinsics in this
+/// file, from params to returns, are Float64 world to camera transformations.
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+struct RigidOptimizerOption {
+    /// Number of iterations for optimization steps.
+    int maximum_iteration_ = 300;
+
+    /// Parameter to check the visibility of a point. Points with depth larger
+    /// than maximum_allowable_depth in a RGB-D will be marked as invisible for
+    /// the camera producing that RGB-D image.
+    double maximum_allowable_depth_ = 2.5;
+
+    /// Parameter to check the visibility of a point. When the difference of a
+    /// point's depth value in the RGB-D image and the point's depth value in
+    /// the 3D mesh is greater than depth_threshold_for_visibility_check, the
+    /// point is marked as invisible to the camera producing the RGB-D image.
+    double depth_threshold_for_visibility_check_ = 0.03;
+
+    /// Parameter to check the visibility of a point. Points where the depth
+    /// gradient magnitude is larger than this threshold are considered to be
+    /// invisible.
+    double depth_threshold_for_discontinuity_check_ = 0.1;
+
+    /// Half-kernel size of the dilation applied on the depth discontinuity
+    /// mask, to ignore points near the object boundary.
+    int half_dilation_kernel_size_for_discontinuity_map_ = 3;
+
+    /// If a projected 3D point onto a 2D image lies in the image border within
+    /// image_boundary_margin, the 3D point is considered invisible from the
+    /// camera producing the image.
+    int image_boundary_margin_ = 10;
+
+    /// If a vertex is invisible from all images, we assign the averaged color
+    /// of the k nearest visible vertices to fill the invisible vertex. Set to
+    /// 0 to disable this feature and all invisible vertices will be black.
+    int invisible_vertex_color_knn_ = 3;
+
+    /// Scale to convert the depth images to meters.
+    double depth_scale_ = 1000.0;
+};
+
+struct NonRigidOptimizerOption : public RigidOptimizerOption {
+    /// Number of vertical anchor points for image wrapping field. The number of
+    /// horizontal anchor points is computed automatically based on the number
+    /// of vertical anchor points.
+    int number_of_vertical_anchors_ = 16;
+
+    /// Additional regularization terms added to non-rigid regularization. A
+    /// higher value results gives more conservative updates.
+    double non_rigid_anchor_point_weight_ = 0.316;
+};
+
+/// \brief Optimizes the camera poses to maximize the photometric consistency
+/// of the mesh vertices, and colors the mesh with the optimized poses.
+///
+/// Each iteration accumulates the 6x6 linear system of every camera in a
+/// single parallel reduction over the vertices visible in that camera.
+///
+/// \param mesh The mesh to color, with Float32 vertex positions.
+/// \param images_rgbd RGB-D images on the mesh device. Color images are UInt8
+/// or Float32 RGB, depth images are UInt16 or Float32.
+/// \param intrinsics (3, 3) intrinsic matrix shared by all the images.
+/// \param extrinsics (4, 4) initial world to camera transformation per image.
+/// \param option Optimization options.
+/// \return The colored mesh and the optimized extrinsics.
+std::tuple<geometry::TriangleMesh, std::vector<core::Tensor>> RunRigidOptimizer(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<geometry::RGBDImage>& images_rgbd,
+        const core::Tensor& intrinsics,
+        const std::vector<core::Tensor>& extrinsics,
+        const RigidOptimizerOption& option);
+
+/// \brief Jointly optimizes the camera poses and a per-image anchor based
+/// warping field that corrects the image distortion.
+///
+/// The warping field of each image is updated with a sparse solve of its
+/// block linear system.
+///
+/// \return The colored mesh, the optimized extrinsics and the (Ah, Aw, 2)
+/// Float32 warping field of each image, holding the warped pixel position of
+/// each anchor. See RunRigidOptimizer() for the parameters.
+std::tuple<geometry::TriangleMesh,
+           std::vector<core::Tensor>,
+           std::vector<core::Tensor>>
+RunNonRigidOptimizer(const geometry::TriangleMesh& mesh,
+                     const std::vector<geometry::RGBDImage>& images_rgbd,
+                     const core::Tensor& intrinsics,
+                     const std::vector<core::Tensor>& extrinsics,
+                     const NonRigidOptimizerOption& option);
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,237 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+static const core::Device host("CPU:0");
+
+void ComputeVertexVisibility(const core::Tensor& vertices,
+                             const core::Tensor& depth,
+                             const core::Tensor& mask,
+                             const core::Tensor& intrinsics,
+                             const core::Tensor& extrinsics,
+                             core::Tensor& visibility,
+                             float depth_max,
+                             float depth_diff) {
+    const core::Device device = vertices.GetDevice();
+    core::AssertTensorShape(vertices, {utility::nullopt, 3});
+    core::AssertTensorDtype(vertices, core::Float32);
+    core::AssertTensorDtype(depth, core::Float32);
+    core::AssertTensorDtype(mask, core::UInt8);
+    core::AssertTensorDevice(depth, device);
+    core::AssertTensorDevice(mask, device);
+    core::AssertTensorShape(intrinsics, {3, 3});
+    core::AssertTensorShape(extrinsics, {4, 4});
+
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor extrinsics_d = extrinsics.To(host, core::Float64).Contiguous();
+    visibility = core::Tensor::Empty({vertices.GetLength()}, core::Bool,
+                                     device);
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ComputeVertexVisibilityCPU(vertices.Contiguous(), depth.Contiguous(),
+                                   mask.Contiguous(), intrinsics_d,
+                                   extrinsics_d, visibility, depth_max,
+                                   depth_diff);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVertexVisibilityCUDA, vertices.Contiguous(),
+                  depth.Contiguous(), mask.Contiguous(), intrinsics_d,
+                  extrinsics_d, visibility, depth_max, depth_diff);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void AccumulateVertexValues(const core::Tensor& vertices,
+                            const core::Tensor& visible_indices,
+                            const core::Tensor& image,
+                            const core::Tensor& intrinsics,
+                            const core::Tensor& extrinsics,
+                            const core::Tensor& warping_field,
+                            core::Tensor& value_sum,
+                            core::Tensor& weight_sum,
+                            float anchor_step,
+                            int image_boundary_margin) {
+    const core::Device device = vertices.GetDevice();
+    const int64_t n = vertices.GetLength();
+    core::AssertTensorShape(vertices, {utility::nullopt, 3});
+    core::AssertTensorDtype(vertices, core::Float32);
+    core::AssertTensorDtype(visible_indices, core::Int64);
+    core::AssertTensorDtype(image, core::Float32);
+    core::AssertTensorDevice(visible_indices, device);
+    core::AssertTensorDevice(image, device);
+    core::AssertTensorShape(value_sum, {n, image.GetShape(2)});
+    core::AssertTensorShape(weight_sum, {n});
+    core::AssertTensorDtype(value_sum, core::Float32);
+    core::AssertTensorDtype(weight_sum, core::Float32);
+    if (!value_sum.IsContiguous() || !weight_sum.IsContiguous()) {
+        utility::LogError("Accumulated values must be contiguous.");
+    }
+    if (warping_field.NumElements() > 0) {
+        core::AssertTensorShape(warping_field,
+                                {utility::nullopt, utility::nullopt, 2});
+        core::AssertTensorDtype(warping_field, core::Float32);
+        core::AssertTensorDevice(warping_field, device);
+    }
+
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor extrinsics_d = extrinsics.To(host, core::Float64).Contiguous();
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        AccumulateVertexValuesCPU(
+                vertices.Contiguous(), visible_indices.Contiguous(),
+                image.Contiguous(), intrinsics_d, extrinsics_d,
+                warping_field.Contiguous(), value_sum, weight_sum, anchor_step,
+                image_boundary_margin);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(AccumulateVertexValuesCUDA, vertices.Contiguous(),
+                  visible_indices.Contiguous(), image.Contiguous(),
+                  intrinsics_d, extrinsics_d, warping_field.Contiguous(),
+                  value_sum, weight_sum, anchor_step, image_boundary_margin);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+static void AssertColorMapSystemInputs(const core::Tensor& vertices,
+                                       const core::Tensor& visible_indices,
+                                       const core::Tensor& proxy_intensity,
+                                       const core::Tensor& intensity,
+                                       const core::Tensor& intensity_dx,
+                                       const core::Tensor& intensity_dy) {
+    const core::Device device = vertices.GetDevice();
+    core::AssertTensorShape(vertices, {utility::nullopt, 3});
+    core::AssertTensorDtype(vertices, core::Float32);
+    core::AssertTensorDtype(visible_indices, core::Int64);
+    core::AssertTensorShape(proxy_intensity, {vertices.GetLength()});
+    core::AssertTensorDtype(proxy_intensity, core::Float32);
+    core::AssertTensorDtype(intensity, core::Float32);
+    core::AssertTensorDtype(intensity_dx, core::Float32);
+    core::AssertTensorDtype(intensity_dy, core::Float32);
+    core::AssertTensorDevice(visible_indices, device);
+    core::AssertTensorDevice(proxy_intensity, device);
+    core::AssertTensorDevice(intensity, device);
+    core::AssertTensorDevice(intensity_dx, device);
+    core::AssertTensorDevice(intensity_dy, device);
+}
+
+void ComputeRigidColorMapResult(const core::Tensor& vertices,
+                                const core::Tensor& visible_indices,
+                                const core::Tensor& proxy_intensity,
+                                const core::Tensor& intensity,
+                                const core::Tensor& intensity_dx,
+                                const core::Tensor& intensity_dy,
+                                const core::Tensor& intrinsics,
+                                const core::Tensor& extrinsics,
+                                core::Tensor& delta,
+                                float& residual,
+                                int& count,
+                                int image_boundary_margin) {
+    AssertColorMapSystemInputs(vertices, visible_indices, proxy_intensity,
+                               intensity, intensity_dx, intensity_dy);
+    const core::Device device = vertices.GetDevice();
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor extrinsics_d = extrinsics.To(host, core::Float64).Contiguous();
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ComputeRigidColorMapResultCPU(
+                vertices.Contiguous(), visible_indices.Contiguous(),
+                proxy_intensity.Contiguous(), intensity.Contiguous(),
+                intensity_dx.Contiguous(), intensity_dy.Contiguous(),
+                intrinsics_d, extrinsics_d, delta, residual, count,
+                image_boundary_margin);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeRigidColorMapResultCUDA, vertices.Contiguous(),
+                  visible_indices.Contiguous(), proxy_intensity.Contiguous(),
+                  intensity.Contiguous(), intensity_dx.Contiguous(),
+                  intensity_dy.Contiguous(), intrinsics_d, extrinsics_d, delta,
+                  residual, count, image_boundary_margin);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void ComputeNonRigidColorMapSystem(const core::Tensor& vertices,
+                                   const core::Tensor& visible_indices,
+                                   const core::Tensor& proxy_intensity,
+                                   const core::Tensor& intensity,
+                                   const core::Tensor& intensity_dx,
+                                   const core::Tensor& intensity_dy,
+                                   const core::Tensor& intrinsics,
+                                   const core::Tensor& extrinsics,
+                                   const core::Tensor& warping_field,
+                                   core::Tensor& reduction,
+                                   float anchor_step,
+                                   int image_boundary_margin) {
+    AssertColorMapSystemInputs(vertices, visible_indices, proxy_intensity,
+                               intensity, intensity_dx, intensity_dy);
+    const core::Device device = vertices.GetDevice();
+    core::AssertTensorShape(warping_field,
+                            {utility::nullopt, utility::nullopt, 2});
+    core::AssertTensorDtype(warping_field, core::Float32);
+    core::AssertTensorDevice(warping_field, device);
+
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor extrinsics_d = extrinsics.To(host, core::Float64).Contiguous();
+    const int64_t num_anchors =
+            warping_field.GetShape(0) * warping_field.GetShape(1);
+    reduction = core::Tensor::Zeros(
+            {29 + num_anchors * kNonRigidAnchorReductionSize}, core::Float32,
+            device);
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ComputeNonRigidColorMapSystemCPU(
+                vertices.Contiguous(), visible_indices.Contiguous(),
+                proxy_intensity.Contiguous(), intensity.Contiguous(),
+                intensity_dx.Contiguous(), intensity_dy.Contiguous(),
+                intrinsics_d, extrinsics_d, warping_field.Contiguous(),
+                reduction, anchor_step, image_boundary_margin);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeNonRigidColorMapSystemCUDA, vertices.Contiguous(),
+                  visible_indices.Contiguous(), proxy_intensity.Contiguous(),
+                  intensity.Contiguous(), intensity_dx.Contiguous(),
+                  intensity_dy.Contiguous(), intrinsics_d, extrinsics_d,
+                  warping_field.Contiguous(), reduction, anchor_step,
+                  image_boundary_margin);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,252 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+/// Offset of the 2 Jtr elements in the reduction of
+/// ComputeNonRigidColorMapSystem() per anchor, after the 2x6 anchor-pose block
+/// and the 9 neighbor 2x2 anchor-anchor blocks of JtJ.
+constexpr int64_t kNonRigidAnchorJtrOffset = 12 + 9 * 4;
+
+/// Size of the reduction of ComputeNonRigidColorMapSystem() per anchor of the
+/// warping field: 2x6 anchor-pose block of JtJ, 9 neighbor 2x2 anchor-anchor
+/// blocks of JtJ and 2 elements of Jtr.
+constexpr int64_t kNonRigidAnchorReductionSize = kNonRigidAnchorJtrOffset + 2;
+
+/// \brief Marks the vertices that are visible in a depth image.
+///
+/// A vertex is visible if it projects into the image, its depth agrees with
+/// the sensor depth, the sensor depth is below \p depth_max and the vertex does
+/// not fall on a depth discontinuity.
+///
+/// \param vertices (N, 3) Float32 vertex positions.
+/// \param depth (H, W, 1) Float32 depth image in meters.
+/// \param mask (H, W, 1) UInt8 depth discontinuity mask, 255 at boundaries.
+/// \param intrinsics (3, 3) Float64 intrinsic matrix on CPU.
+/// \param extrinsics (4, 4) Float64 world to camera transformation on CPU.
+/// \param visibility Output (N,) Bool visibility.
+/// \param depth_max Maximum sensor depth of visible vertices.
+/// \param depth_diff Maximum difference between vertex and sensor depth.
+void ComputeVertexVisibility(const core::Tensor& vertices,
+                             const core::Tensor& depth,
+                             const core::Tensor& mask,
+                             const core::Tensor& intrinsics,
+                             const core::Tensor& extrinsics,
+                             core::Tensor& visibility,
+                             float depth_max,
+                             float depth_diff);
+
+/// \brief Adds the image values at the projections of the visible vertices.
+///
+/// \param vertices (N, 3) Float32 vertex positions.
+/// \param visible_indices (M,) Int64 indices of the vertices visible in the
+/// image, without duplicates.
+/// \param image (H, W, C) Float32 image.
+/// \param intrinsics (3, 3) Float64 intrinsic matrix on CPU.
+/// \param extrinsics (4, 4) Float64 world to camera transformation on CPU.
+/// \param warping_field (Ah, Aw, 2) Float32 image coordinates of the warping
+/// field anchors, or an empty tensor to disable warping.
+/// \param value_sum (N, C) Float32 sum of the values of each vertex, updated
+/// in place.
+/// \param weight_sum (N,) Float32 number of values of each vertex, updated in
+/// place.
+/// \param anchor_step Spacing of the warping field anchors in pixels.
+/// \param image_boundary_margin Margin in pixels of valid projections.
+void AccumulateVertexValues(const core::Tensor& vertices,
+                            const core::Tensor& visible_indices,
+                            const core::Tensor& image,
+                            const core::Tensor& intrinsics,
+                            const core::Tensor& extrinsics,
+                            const core::Tensor& warping_field,
+                            core::Tensor& value_sum,
+                            core::Tensor& weight_sum,
+                            float anchor_step,
+                            int image_boundary_margin);
+
+/// \brief Solves one Gauss-Newton step of the camera pose that aligns the
+/// image intensity with the proxy intensity of the visible vertices.
+///
+/// \param vertices (N, 3) Float32 vertex positions.
+/// \param visible_indices (M,) Int64 indices of the visible vertices.
+/// \param proxy_intensity (N,) Float32 target intensity of the vertices.
+/// \param intensity (H, W, 1) Float32 intensity image.
+/// \param intensity_dx (H, W, 1) Float32 intensity gradient along x.
+/// \param intensity_dy (H, W, 1) Float32 intensity gradient along y.
+/// \param intrinsics (3, 3) Float64 intrinsic matrix on CPU.
+/// \param extrinsics (4, 4) Float64 world to camera transformation on CPU.
+/// \param delta Output (6,) Float64 pose update on CPU, to be applied on the
+/// left of \p extrinsics.
+/// \param residual Output sum of squared residuals.
+/// \param count Output number of valid residuals.
+/// \param image_boundary_margin Margin in pixels of valid projections.
+void ComputeRigidColorMapResult(const core::Tensor& vertices,
+                                const core::Tensor& visible_indices,
+                                const core::Tensor& proxy_intensity,
+                                const core::Tensor& intensity,
+                                const core::Tensor& intensity_dx,
+                                const core::Tensor& intensity_dy,
+                                const core::Tensor& intrinsics,
+                                const core::Tensor& extrinsics,
+                                core::Tensor& delta,
+                                float& residual,
+                                int& count,
+                                int image_boundary_margin);
+
+/// \brief Builds the sparse normal equations of the camera pose and the
+/// warping field of one image.
+///
+/// The unknowns are the 6 pose parameters followed by the 2 coordinates of
+/// each anchor k = i + j * Aw. Each residual only involves the pose and the 4
+/// anchors of its cell, so the system is returned in blocks.
+///
+/// \param reduction Output Float32 tensor of shape
+/// (29 + Ah * Aw * kNonRigidAnchorReductionSize,). The first 29 elements hold
+/// the pose block as in DecodeAndSolve6x6(). For each anchor k follow the 2x6
+/// row-major JtJ block between anchor k and the pose, the 2x2 row-major JtJ
+/// blocks between anchor k and its neighbor (i + di, j + dj) at slot
+/// (di + 1) * 3 + (dj + 1), and the 2 Jtr elements of anchor k.
+/// \param anchor_step Spacing of the warping field anchors in pixels.
+/// See ComputeRigidColorMapResult() for the other parameters.
+void ComputeNonRigidColorMapSystem(const core::Tensor& vertices,
+                                   const core::Tensor& visible_indices,
+                                   const core::Tensor& proxy_intensity,
+                                   const core::Tensor& intensity,
+                                   const core::Tensor& intensity_dx,
+                                   const core::Tensor& intensity_dy,
+                                   const core::Tensor& intrinsics,
+                                   const core::Tensor& extrinsics,
+                                   const core::Tensor& warping_field,
+                                   core::Tensor& reduction,
+                                   float anchor_step,
+                                   int image_boundary_margin);
+
+void ComputeVertexVisibilityCPU(const core::Tensor& vertices,
+                                const core::Tensor& depth,
+                                const core::Tensor& mask,
+                                const core::Tensor& intrinsics,
+                                const core::Tensor& extrinsics,
+                                core::Tensor& visibility,
+                                float depth_max,
+                                float depth_diff);
+
+void AccumulateVertexValuesCPU(const core::Tensor& vertices,
+                               const core::Tensor& visible_indices,
+                               const core::Tensor& image,
+                               const core::Tensor& intrinsics,
+                               const core::Tensor& extrinsics,
+                               const core::Tensor& warping_field,
+                               core::Tensor& value_sum,
+                               core::Tensor& weight_sum,
+                               float anchor_step,
+                               int image_boundary_margin);
+
+void ComputeRigidColorMapResultCPU(const core::Tensor& vertices,
+                                   const core::Tensor& visible_indices,
+                                   const core::Tensor& proxy_intensity,
+                                   const core::Tensor& intensity,
+                                   const core::Tensor& intensity_dx,
+                                   const core::Tensor& intensity_dy,
+                                   const core::Tensor& intrinsics,
+                                   const core::Tensor& extrinsics,
+                                   core::Tensor& delta,
+                                   float& residual,
+                                   int& count,
+                                   int image_boundary_margin);
+
+void ComputeNonRigidColorMapSystemCPU(const core::Tensor& vertices,
+                                      const core::Tensor& visible_indices,
+                                      const core::Tensor& proxy_intensity,
+                                      const core::Tensor& intensity,
+                                      const core::Tensor& intensity_dx,
+                                      const core::Tensor& intensity_dy,
+                                      const core::Tensor& intrinsics,
+                                      const core::Tensor& extrinsics,
+                                      const core::Tensor& warping_field,
+                                      core::Tensor& reduction,
+                                      float anchor_step,
+                                      int image_boundary_margin);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeVertexVisibilityCUDA(const core::Tensor& vertices,
+                                 const core::Tensor& depth,
+                                 const core::Tensor& mask,
+                                 const core::Tensor& intrinsics,
+                                 const core::Tensor& extrinsics,
+                                 core::Tensor& visibility,
+                                 float depth_max,
+                                 float depth_diff);
+
+void AccumulateVertexValuesCUDA(const core::Tensor& vertices,
+                                const core::Tensor& visible_indices,
+                                const core::Tensor& image,
+                                const core::Tensor& intrinsics,
+                                const core::Tensor& extrinsics,
+                                const core::Tensor& warping_field,
+                                core::Tensor& value_sum,
+                                core::Tensor& weight_sum,
+                                float anchor_step,
+                                int image_boundary_margin);
+
+void ComputeRigidColorMapResultCUDA(const core::Tensor& vertices,
+                                    const core::Tensor& visible_indices,
+                                    const core::Tensor& proxy_intensity,
+                                    const core::Tensor& intensity,
+                                    const core::Tensor& intensity_dx,
+                                    const core::Tensor& intensity_dy,
+                                    const core::Tensor& intrinsics,
+                                    const core::Tensor& extrinsics,
+                                    core::Tensor& delta,
+                                    float& residual,
+                                    int& count,
+                                    int image_boundary_margin);
+
+void ComputeNonRigidColorMapSystemCUDA(const core::Tensor& vertices,
+                                       const core::Tensor& visible_indices,
+                                       const core::Tensor& proxy_intensity,
+                                       const core::Tensor& intensity,
+                                       const core::Tensor& intensity_dx,
+                                       const core::Tensor& intensity_dy,
+                                       const core::Tensor& intrinsics,
+                                       const core::Tensor& extrinsics,
+                                       const core::Tensor& warping_field,
+                                       core::Tensor& reduction,
+                                       float anchor_step,
+                                       int image_boundary_margin);
+#endif
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,195 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tbb/combinable.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
+#include "open3d/t/pipelines/kernel/ColorMapImpl.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+void ComputeRigidColorMapResultCPU(const core::Tensor& vertices,
+                                   const core::Tensor& visible_indices,
+                                   const core::Tensor& proxy_intensity,
+                                   const core::Tensor& intensity,
+                                   const core::Tensor& intensity_dx,
+                                   const core::Tensor& intensity_dy,
+                                   const core::Tensor& intrinsics,
+                                   const core::Tensor& extrinsics,
+                                   core::Tensor& delta,
+                                   float& residual,
+                                   int& count,
+                                   int image_boundary_margin) {
+    NDArrayIndexer intensity_indexer(intensity, 2);
+    NDArrayIndexer intensity_dx_indexer(intensity_dx, 2);
+    NDArrayIndexer intensity_dy_indexer(intensity_dy, 2);
+    TransformIndexer ti(intrinsics, extrinsics);
+
+    const float* vertices_ptr = vertices.GetDataPtr<float>();
+    const int64_t* visible_indices_ptr = visible_indices.GetDataPtr<int64_t>();
+    const float* proxy_intensity_ptr = proxy_intensity.GetDataPtr<float>();
+
+    const int n = static_cast<int>(visible_indices.GetLength());
+    std::vector<float> A_1x29(29, 0.0);
+
+#ifdef _MSC_VER
+    std::vector<float> zeros_29(29, 0.0);
+    A_1x29 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_29,
+            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     workload_idx++) {
+#else
+    float* A_reduction = A_1x29.data();
+#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+#endif
+                    float J[6];
+                    float r;
+
+                    bool valid = GetJacobianRigid(
+                            workload_idx, vertices_ptr, visible_indices_ptr,
+                            proxy_intensity_ptr, intensity_indexer,
+                            intensity_dx_indexer, intensity_dy_indexer, ti,
+                            image_boundary_margin, J, r);
+
+                    if (valid) {
+                        for (int i = 0, j = 0; j < 6; j++) {
+                            for (int k = 0; k <= j; k++) {
+                                A_reduction[i] += J[j] * J[k];
+                                i++;
+                            }
+                            A_reduction[21 + j] += J[j] * r;
+                        }
+                        A_reduction[27] += r * r;
+                        A_reduction[28] += 1;
+                    }
+                }
+#ifdef _MSC_VER
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<float> a, std::vector<float> b) {
+                std::vector<float> result(29);
+                for (int j = 0; j < 29; j++) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+    core::Tensor A_reduction_tensor(A_1x29, {29}, core::Float32,
+                                    vertices.GetDevice());
+    DecodeAndSolve6x6(A_reduction_tensor, delta, residual, count);
+}
+
+void ComputeNonRigidColorMapSystemCPU(const core::Tensor& vertices,
+                                      const core::Tensor& visible_indices,
+                                      const core::Tensor& proxy_intensity,
+                                      const core::Tensor& intensity,
+                                      const core::Tensor& intensity_dx,
+                                      const core::Tensor& intensity_dy,
+                                      const core::Tensor& intrinsics,
+                                      const core::Tensor& extrinsics,
+                                      const core::Tensor& warping_field,
+                                      core::Tensor& reduction,
+                                      float anchor_step,
+                                      int image_boundary_margin) {
+    NDArrayIndexer intensity_indexer(intensity, 2);
+    NDArrayIndexer intensity_dx_indexer(intensity_dx, 2);
+    NDArrayIndexer intensity_dy_indexer(intensity_dy, 2);
+    TransformIndexer ti(intrinsics, extrinsics);
+
+    const float* vertices_ptr = vertices.GetDataPtr<float>();
+    const int64_t* visible_indices_ptr = visible_indices.GetDataPtr<int64_t>();
+    const float* proxy_intensity_ptr = proxy_intensity.GetDataPtr<float>();
+    const float* warping_field_ptr = warping_field.GetDataPtr<float>();
+    const int64_t anchor_h = warping_field.GetShape(0);
+    const int64_t anchor_w = warping_field.GetShape(1);
+
+    const int64_t n = visible_indices.GetLength();
+    const int64_t reduction_size = reduction.GetLength();
+
+    // The anchor blocks are scattered, so every thread accumulates into its
+    // own buffer and the buffers are summed afterwards.
+    tbb::combinable<std::vector<float>> thread_reduction(
+            [&] { return std::vector<float>(reduction_size, 0); });
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, n),
+            [&](const tbb::blocked_range<int64_t>& range) {
+                float* A = thread_reduction.local().data();
+                for (int64_t workload_idx = range.begin();
+                     workload_idx < range.end(); ++workload_idx) {
+                    float J[14];
+                    int64_t i, j;
+                    float r;
+                    bool valid = GetJacobianNonRigid(
+                            workload_idx, vertices_ptr, visible_indices_ptr,
+                            proxy_intensity_ptr, intensity_indexer,
+                            intensity_dx_indexer, intensity_dy_indexer, ti,
+                            warping_field_ptr, anchor_h, anchor_w,
+                            anchor_step, image_boundary_margin, J, &i, &j, r);
+                    if (!valid) {
+                        continue;
+                    }
+
+                    for (int a = 0, idx = 0; a < 6; ++a) {
+                        for (int b = 0; b <= a; ++b) {
+                            A[idx++] += J[a] * J[b];
+                        }
+                        A[21 + a] += J[a] * r;
+                    }
+                    A[27] += r * r;
+                    A[28] += 1;
+
+                    for (int k = 0; k < 4; ++k) {
+                        AccumulateAnchor(A, J, r, k, i + k / 2, j + k % 2,
+                                         anchor_w);
+                    }
+                }
+            });
+
+    std::vector<float> A_reduction(reduction_size, 0);
+    thread_reduction.combine_each([&](const std::vector<float>& local) {
+        for (int64_t idx = 0; idx < reduction_size; ++idx) {
+            A_reduction[idx] += local[idx];
+        }
+    });
+    reduction = core::Tensor(A_reduction, {reduction_size}, core::Float32,
+                             vertices.GetDevice());
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
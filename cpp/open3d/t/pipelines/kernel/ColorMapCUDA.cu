@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/ColorMapImpl.h"
+#include "open3d/t/pipelines/kernel/Reduction6x6Impl.cuh"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+const int kThread1DUnit = 256;
+
+__global__ void ComputeRigidColorMapResultCUDAKernel(
+        const float* vertices_ptr,
+        const int64_t* visible_indices_ptr,
+        const float* proxy_intensity_ptr,
+        NDArrayIndexer intensity_indexer,
+        NDArrayIndexer intensity_dx_indexer,
+        NDArrayIndexer intensity_dy_indexer,
+        TransformIndexer ti,
+        const int n,
+        const int image_boundary_margin,
+        float* global_sum) {
+    __shared__ float local_sum0[kThread1DUnit];
+    __shared__ float local_sum1[kThread1DUnit];
+    __shared__ float local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    if (workload_idx >= n) return;
+
+    float J[6] = {0}, reduction[29] = {0};
+    float r = 0;
+
+    bool valid = GetJacobianRigid(
+            workload_idx, vertices_ptr, visible_indices_ptr,
+            proxy_intensity_ptr, intensity_indexer, intensity_dx_indexer,
+            intensity_dy_indexer, ti, image_boundary_margin, J, r);
+
+    if (valid) {
+        // Dump J, r into JtJ and Jtr
+        int i = 0;
+        for (int j = 0; j < 6; ++j) {
+            for (int k = 0; k <= j; ++k) {
+                reduction[i] += J[j] * J[k];
+                ++i;
+            }
+            reduction[21 + j] += J[j] * r;
+        }
+        reduction[27] += r * r;
+        reduction[28] += 1;
+    }
+
+    ReduceSum6x6LinearSystem<float, kThread1DUnit>(tid, valid, reduction,
+                                                   local_sum0, local_sum1,
+                                                   local_sum2, global_sum);
+}
+
+void ComputeRigidColorMapResultCUDA(const core::Tensor& vertices,
+                                    const core::Tensor& visible_indices,
+                                    const core::Tensor& proxy_intensity,
+                                    const core::Tensor& intensity,
+                                    const core::Tensor& intensity_dx,
+                                    const core::Tensor& intensity_dy,
+                                    const core::Tensor& intrinsics,
+                                    const core::Tensor& extrinsics,
+                                    core::Tensor& delta,
+                                    float& residual,
+                                    int& count,
+                                    int image_boundary_margin) {
+    NDArrayIndexer intensity_indexer(intensity, 2);
+    NDArrayIndexer intensity_dx_indexer(intensity_dx, 2);
+    NDArrayIndexer intensity_dy_indexer(intensity_dy, 2);
+    TransformIndexer ti(intrinsics, extrinsics);
+
+    const int n = static_cast<int>(visible_indices.GetLength());
+    core::Tensor global_sum =
+            core::Tensor::Zeros({29}, core::Float32, vertices.GetDevice());
+    if (n > 0) {
+        const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+        const dim3 threads(kThread1DUnit);
+        ComputeRigidColorMapResultCUDAKernel<<<blocks, threads, 0,
+                                               core::cuda::GetStream()>>>(
+                vertices.GetDataPtr<float>(),
+                visible_indices.GetDataPtr<int64_t>(),
+                proxy_intensity.GetDataPtr<float>(), intensity_indexer,
+                intensity_dx_indexer, intensity_dy_indexer, ti, n,
+                image_boundary_margin, global_sum.GetDataPtr<float>());
+    }
+    core::cuda::Synchronize();
+
+    DecodeAndSolve6x6(global_sum, delta, residual, count);
+}
+
+void ComputeNonRigidColorMapSystemCUDA(const core::Tensor& vertices,
+                                       const core::Tensor& visible_indices,
+                                       const core::Tensor& proxy_intensity,
+                                       const core::Tensor& intensity,
+                                       const core::Tensor& intensity_dx,
+                                       const core::Tensor& intensity_dy,
+                                       const core::Tensor& intrinsics,
+                                       const core::Tensor& extrinsics,
+                                       const core::Tensor& warping_field,
+                                       core::Tensor& reduction,
+                                       float anchor_step,
+                                       int image_boundary_margin) {
+    NDArrayIndexer intensity_indexer(intensity, 2);
+    NDArrayIndexer intensity_dx_indexer(intensity_dx, 2);
+    NDArrayIndexer intensity_dy_indexer(intensity_dy, 2);
+    TransformIndexer ti(intrinsics, extrinsics);
+
+    const float* vertices_ptr = vertices.GetDataPtr<float>();
+    const int64_t* visible_indices_ptr = visible_indices.GetDataPtr<int64_t>();
+    const float* proxy_intensity_ptr = proxy_intensity.GetDataPtr<float>();
+    const float* warping_field_ptr = warping_field.GetDataPtr<float>();
+    const int64_t anchor_h = warping_field.GetShape(0);
+    const int64_t anchor_w = warping_field.GetShape(1);
+    float* A = reduction.GetDataPtr<float>();
+
+    core::ParallelFor(
+            vertices.GetDevice(), visible_indices.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                float J[14];
+                int64_t i, j;
+                float r;
+                bool valid = GetJacobianNonRigid(
+                        workload_idx, vertices_ptr, visible_indices_ptr,
+                        proxy_intensity_ptr, intensity_indexer,
+                        intensity_dx_indexer, intensity_dy_indexer, ti,
+                        warping_field_ptr, anchor_h, anchor_w, anchor_step,
+                        image_boundary_margin, J, &i, &j, r);
+                if (!valid) {
+                    return;
+                }
+
+                for (int a = 0, idx = 0; a < 6; ++a) {
+                    for (int b = 0; b <= a; ++b) {
+                        atomicAdd(&A[idx++], J[a] * J[b]);
+                    }
+                    atomicAdd(&A[21 + a], J[a] * r);
+                }
+                atomicAdd(&A[27], r * r);
+                atomicAdd(&A[28], 1.0f);
+
+                for (int k = 0; k < 4; ++k) {
+                    AccumulateAnchor(A, J, r, k, i + k / 2, j + k % 2,
+                                     anchor_w);
+                }
+            });
+    core::cuda::Synchronize();
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,372 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryIndexer.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+using t::geometry::kernel::NDArrayIndexer;
+using t::geometry::kernel::TransformIndexer;
+
+/// Same as geometry::Image::TestImageBoundary.
+inline OPEN3D_HOST_DEVICE bool InImage(const NDArrayIndexer& indexer,
+                                       float u,
+                                       float v,
+                                       int margin) {
+    return u >= margin && u < indexer.GetShape(1) - margin && v >= margin &&
+           v < indexer.GetShape(0) - margin;
+}
+
+/// Bilinear interpolation of a single channel image, u and v must be within
+/// the image.
+inline OPEN3D_HOST_DEVICE float Interpolate(const NDArrayIndexer& indexer,
+                                            float u,
+                                            float v) {
+    const int64_t u0 = static_cast<int64_t>(u);
+    const int64_t v0 = static_cast<int64_t>(v);
+    const int64_t u1 = u0 + 1 < indexer.GetShape(1) ? u0 + 1 : u0;
+    const int64_t v1 = v0 + 1 < indexer.GetShape(0) ? v0 + 1 : v0;
+    const float pu = u - u0;
+    const float pv = v - v0;
+    return (1 - pu) * (1 - pv) * *indexer.GetDataPtr<float>(u0, v0) +
+           pu * (1 - pv) * *indexer.GetDataPtr<float>(u1, v0) +
+           (1 - pu) * pv * *indexer.GetDataPtr<float>(u0, v1) +
+           pu * pv * *indexer.GetDataPtr<float>(u1, v1);
+}
+
+/// Projects a vertex to the image. Returns the camera coordinates and pixel
+/// coordinates.
+inline OPEN3D_HOST_DEVICE void ProjectVertex(const TransformIndexer& ti,
+                                             const float* vertex,
+                                             float* xyz,
+                                             float* u,
+                                             float* v) {
+    ti.RigidTransform(vertex[0], vertex[1], vertex[2], &xyz[0], &xyz[1],
+                      &xyz[2]);
+    ti.Project(xyz[0], xyz[1], xyz[2], u, v);
+}
+
+/// Bilinear interpolation of the warping field anchors at (u, v). Also returns
+/// the anchor cell (i, j) and the interpolation weights (p, q) in the cell.
+/// Returns false if (u, v) is outside of the anchor grid.
+inline OPEN3D_HOST_DEVICE bool WarpPixel(const float* warping_field,
+                                         int64_t anchor_h,
+                                         int64_t anchor_w,
+                                         float anchor_step,
+                                         float u,
+                                         float v,
+                                         float* uu,
+                                         float* vv,
+                                         int64_t* i,
+                                         int64_t* j,
+                                         float* p,
+                                         float* q) {
+    *i = static_cast<int64_t>(u / anchor_step);
+    *j = static_cast<int64_t>(v / anchor_step);
+    if (*i < 0 || *j < 0 || *i >= anchor_w - 1 || *j >= anchor_h - 1) {
+        return false;
+    }
+    *p = (u - *i * anchor_step) / anchor_step;
+    *q = (v - *j * anchor_step) / anchor_step;
+    const float* f00 = warping_field + 2 * (*i + *j * anchor_w);
+    const float* f01 = f00 + 2 * anchor_w;
+    const float* f10 = f00 + 2;
+    const float* f11 = f01 + 2;
+    const float w00 = (1 - *p) * (1 - *q), w01 = (1 - *p) * *q;
+    const float w10 = *p * (1 - *q), w11 = *p * *q;
+    *uu = w00 * f00[0] + w01 * f01[0] + w10 * f10[0] + w11 * f11[0];
+    *vv = w00 * f00[1] + w01 * f01[1] + w10 * f10[1] + w11 * f11[1];
+    return true;
+}
+
+/// Jacobian of the intensity at the projection of a vertex with respect to
+/// the left-multiplied camera pose increment, given the intensity gradient
+/// (dIdx, dIdy) at the projection.
+inline OPEN3D_HOST_DEVICE void GetJacobianPose(const TransformIndexer& ti,
+                                               const float* xyz,
+                                               float dIdx,
+                                               float dIdy,
+                                               float* J) {
+    float fx, fy;
+    ti.GetFocalLength(&fx, &fy);
+    const float inv_z = 1.0f / xyz[2];
+    const float v0 = dIdx * fx * inv_z;
+    const float v1 = dIdy * fy * inv_z;
+    const float v2 = -(v0 * xyz[0] + v1 * xyz[1]) * inv_z;
+    J[0] = -xyz[2] * v1 + xyz[1] * v2;
+    J[1] = xyz[2] * v0 - xyz[0] * v2;
+    J[2] = -xyz[1] * v0 + xyz[0] * v1;
+    J[3] = v0;
+    J[4] = v1;
+    J[5] = v2;
+}
+
+OPEN3D_HOST_DEVICE inline bool GetJacobianRigid(
+        int64_t workload_idx,
+        const float* vertices_ptr,
+        const int64_t* visible_indices_ptr,
+        const float* proxy_intensity_ptr,
+        const NDArrayIndexer& intensity_indexer,
+        const NDArrayIndexer& intensity_dx_indexer,
+        const NDArrayIndexer& intensity_dy_indexer,
+        const TransformIndexer& ti,
+        int image_boundary_margin,
+        float* J,
+        float& r) {
+    const int64_t vertex_idx = visible_indices_ptr[workload_idx];
+    float xyz[3], u, v;
+    ProjectVertex(ti, vertices_ptr + 3 * vertex_idx, xyz, &u, &v);
+    if (!InImage(intensity_indexer, u, v, image_boundary_margin)) {
+        return false;
+    }
+
+    GetJacobianPose(ti, xyz, Interpolate(intensity_dx_indexer, u, v),
+                    Interpolate(intensity_dy_indexer, u, v), J);
+    r = Interpolate(intensity_indexer, u, v) - proxy_intensity_ptr[vertex_idx];
+    return true;
+}
+
+/// Jacobian of a residual with respect to the pose (J[0:6]) and to the 2
+/// coordinates of the 4 anchors of its cell (J[6:14]), in the order (i, j),
+/// (i, j + 1), (i + 1, j), (i + 1, j + 1).
+OPEN3D_HOST_DEVICE inline bool GetJacobianNonRigid(
+        int64_t workload_idx,
+        const float* vertices_ptr,
+        const int64_t* visible_indices_ptr,
+        const float* proxy_intensity_ptr,
+        const NDArrayIndexer& intensity_indexer,
+        const NDArrayIndexer& intensity_dx_indexer,
+        const NDArrayIndexer& intensity_dy_indexer,
+        const TransformIndexer& ti,
+        const float* warping_field_ptr,
+        int64_t anchor_h,
+        int64_t anchor_w,
+        float anchor_step,
+        int image_boundary_margin,
+        float* J,
+        int64_t* anchor_i,
+        int64_t* anchor_j,
+        float& r) {
+    const int64_t vertex_idx = visible_indices_ptr[workload_idx];
+    float xyz[3], u, v;
+    ProjectVertex(ti, vertices_ptr + 3 * vertex_idx, xyz, &u, &v);
+    if (!InImage(intensity_indexer, u, v, image_boundary_margin)) {
+        return false;
+    }
+
+    float uu, vv, p, q;
+    if (!WarpPixel(warping_field_ptr, anchor_h, anchor_w, anchor_step, u, v,
+                   &uu, &vv, anchor_i, anchor_j, &p, &q) ||
+        !InImage(intensity_indexer, uu, vv, image_boundary_margin)) {
+        return false;
+    }
+
+    // Gradient of the intensity at the warped pixel, chained through the
+    // derivatives of the warping field to the unwarped pixel.
+    const float dIdfx = Interpolate(intensity_dx_indexer, uu, vv);
+    const float dIdfy = Interpolate(intensity_dy_indexer, uu, vv);
+    const float* f00 =
+            warping_field_ptr + 2 * (*anchor_i + *anchor_j * anchor_w);
+    const float* f01 = f00 + 2 * anchor_w;
+    const float* f10 = f00 + 2;
+    const float* f11 = f01 + 2;
+    float dIdx = 0, dIdy = 0;
+    for (int c = 0; c < 2; ++c) {
+        const float dIdf = c == 0 ? dIdfx : dIdfy;
+        dIdx += dIdf *
+                ((f10[c] - f00[c]) * (1 - q) + (f11[c] - f01[c]) * q) /
+                anchor_step;
+        dIdy += dIdf *
+                ((f01[c] - f00[c]) * (1 - p) + (f11[c] - f10[c]) * p) /
+                anchor_step;
+    }
+    GetJacobianPose(ti, xyz, dIdx, dIdy, J);
+
+    const float weights[4] = {(1 - p) * (1 - q), (1 - p) * q, p * (1 - q),
+                              p * q};
+    for (int k = 0; k < 4; ++k) {
+        J[6 + 2 * k] = dIdfx * weights[k];
+        J[6 + 2 * k + 1] = dIdfy * weights[k];
+    }
+    r = Interpolate(intensity_indexer, uu, vv) -
+        proxy_intensity_ptr[vertex_idx];
+    return true;
+}
+
+/// Adds the contributions of a residual to the block of corner \p k of its
+/// anchor cell, located at anchor (i, j). \p J and \p r are as in
+/// GetJacobianNonRigid(). On CUDA the blocks are shared between threads and
+/// are accumulated atomically.
+OPEN3D_HOST_DEVICE inline void AccumulateAnchor(float* A,
+                                                const float* J,
+                                                float r,
+                                                int k,
+                                                int64_t i,
+                                                int64_t j,
+                                                int64_t anchor_w) {
+#if defined(__CUDA_ARCH__)
+#define OPEN3D_COLOR_MAP_ADD(X, Y) atomicAdd(X, Y)
+#else
+#define OPEN3D_COLOR_MAP_ADD(X, Y) (*(X) += (Y))
+#endif
+    float* block = A + 29 + (i + j * anchor_w) * kNonRigidAnchorReductionSize;
+    const float* J_k = J + 6 + 2 * k;
+    for (int c = 0; c < 2; ++c) {
+        for (int p = 0; p < 6; ++p) {
+            OPEN3D_COLOR_MAP_ADD(block + c * 6 + p, J_k[c] * J[p]);
+        }
+        for (int l = 0; l < 4; ++l) {
+            const int slot = (l / 2 - k / 2 + 1) * 3 + (l % 2 - k % 2 + 1);
+            for (int d = 0; d < 2; ++d) {
+                OPEN3D_COLOR_MAP_ADD(block + 12 + slot * 4 + c * 2 + d,
+                                     J_k[c] * J[6 + 2 * l + d]);
+            }
+        }
+        OPEN3D_COLOR_MAP_ADD(block + kNonRigidAnchorJtrOffset + c, J_k[c] * r);
+    }
+#undef OPEN3D_COLOR_MAP_ADD
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexVisibilityCUDA
+#else
+void ComputeVertexVisibilityCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& depth,
+         const core::Tensor& mask,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         core::Tensor& visibility,
+         float depth_max,
+         float depth_diff) {
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer mask_indexer(mask, 2);
+    TransformIndexer ti(intrinsics, extrinsics);
+
+    const float* vertices_ptr = vertices.GetDataPtr<float>();
+    bool* visibility_ptr = visibility.GetDataPtr<bool>();
+    core::ParallelFor(
+            vertices.GetDevice(), vertices.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                visibility_ptr[workload_idx] = false;
+                float xyz[3], u, v;
+                ProjectVertex(ti, vertices_ptr + 3 * workload_idx, xyz, &u, &v);
+                const float u_d = roundf(u), v_d = roundf(v);
+                if (xyz[2] < 0 || !InImage(depth_indexer, u_d, v_d, 0)) {
+                    return;
+                }
+                const int64_t ui = static_cast<int64_t>(u_d);
+                const int64_t vi = static_cast<int64_t>(v_d);
+                const float d_sensor = *depth_indexer.GetDataPtr<float>(ui, vi);
+                visibility_ptr[workload_idx] =
+                        d_sensor <= depth_max &&
+                        *mask_indexer.GetDataPtr<uint8_t>(ui, vi) != 255 &&
+                        abs(xyz[2] - d_sensor) < depth_diff;
+            });
+}
+
+#if defined(__CUDACC__)
+void AccumulateVertexValuesCUDA
+#else
+void AccumulateVertexValuesCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& visible_indices,
+         const core::Tensor& image,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         const core::Tensor& warping_field,
+         core::Tensor& value_sum,
+         core::Tensor& weight_sum,
+         float anchor_step,
+         int image_boundary_margin) {
+    NDArrayIndexer image_indexer(image, 2);
+    TransformIndexer ti(intrinsics, extrinsics);
+
+    const float* vertices_ptr = vertices.GetDataPtr<float>();
+    const int64_t* visible_indices_ptr = visible_indices.GetDataPtr<int64_t>();
+    const bool use_warping = warping_field.NumElements() > 0;
+    const float* warping_field_ptr =
+            use_warping ? warping_field.GetDataPtr<float>() : nullptr;
+    const int64_t anchor_h = use_warping ? warping_field.GetShape(0) : 0;
+    const int64_t anchor_w = use_warping ? warping_field.GetShape(1) : 0;
+    const int64_t channels = image.GetShape(2);
+    float* value_sum_ptr = value_sum.GetDataPtr<float>();
+    float* weight_sum_ptr = weight_sum.GetDataPtr<float>();
+
+    // Visible indices are unique, so every vertex is written by at most one
+    // workload.
+    core::ParallelFor(
+            vertices.GetDevice(), visible_indices.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t vertex_idx = visible_indices_ptr[workload_idx];
+                float xyz[3], u, v;
+                ProjectVertex(ti, vertices_ptr + 3 * vertex_idx, xyz, &u, &v);
+                if (!InImage(image_indexer, u, v, image_boundary_margin)) {
+                    return;
+                }
+                if (use_warping) {
+                    float uu, vv, p, q;
+                    int64_t i, j;
+                    if (!WarpPixel(warping_field_ptr, anchor_h, anchor_w,
+                                   anchor_step, u, v, &uu, &vv, &i, &j, &p,
+                                   &q)) {
+                        return;
+                    }
+                    u = uu;
+                    v = vv;
+                    if (!InImage(image_indexer, u, v, image_boundary_margin)) {
+                        return;
+                    }
+                }
+                const float* value = image_indexer.GetDataPtr<float>(
+                        static_cast<int64_t>(u), static_cast<int64_t>(v));
+                for (int64_t c = 0; c < channels; ++c) {
+                    value_sum_ptr[vertex_idx * channels + c] += value[c];
+                }
+                weight_sum_ptr[vertex_idx] += 1;
+            });
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -30,9 +30,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/RGBDImagePyramid.h"
 
 namespace open3d {
 namespace t {
@@ -141,7 +144,8 @@ public:
 /// RGBD images, and perform hierarchical odometry using specified \p
 /// method.
 /// Can be used for offline odometry where we do not expect to push performance
-/// to the extreme and not reuse vertex/normal map computed before.
+/// to the extreme and not reuse vertex/normal map computed before. For
+/// sequences, use the overload on RGBDImagePyramid.
 /// Input RGBD images hold a depth image (UInt16 or Float32) with a scale
 /// factor and a color image (UInt8 x 3).
 /// \param source Source RGBD image.
@@ -174,6 +178,32 @@ OdometryResult RGBDOdometryMultiScale(
         const Method method = Method::Hybrid,
         const OdometryLossParams& params = OdometryLossParams());
 
+/// \brief Perform hierarchical odometry using specified \p method on
+/// preprocessed RGBD image pyramids. Each pyramid caches its data, so in a
+/// sequence every frame is preprocessed once although it is used as both
+/// source and target.
+/// \param source Source pyramid.
+/// \param target Target pyramid, with the same number of levels and
+/// resolution as \p source. Its intrinsics are used for projection.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of core::Float64 on CPU.
+/// \param criteria_list Criteria used to define and terminate iterations, one
+/// per pyramid level from coarse to fine.
+/// \param method Method used to apply RGBD odometry.
+/// \param params Parameters used in loss function, including outlier rejection
+/// threshold and Huber norm parameters.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScale(
+        const t::geometry::RGBDImagePyramid& source,
+        const t::geometry::RGBDImagePyramid& target,
+        const core::Tensor& init_source_to_target =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+        const std::vector<OdometryConvergenceCriteria>& criteria_list = {10, 5,
+                                                                         3},
+        const Method method = Method::Hybrid,
+        const OdometryLossParams& params = OdometryLossParams());
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target, with
 /// inlier rmse and fitness.
 /// Performs one iteration of RGBD odometry using loss function
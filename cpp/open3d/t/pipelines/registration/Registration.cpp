@@ -33,6 +33,7 @@
 #include "open3d/t/pipelines/kernel/Registration.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace t {
@@ -44,6 +45,7 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
         open3d::core::nns::NearestNeighborSearch &target_nns,
         double max_correspondence_distance,
         const core::Tensor &transformation) {
+    OPEN3D_TRACE_ZONE("registration", "ICP correspondences");
     core::AssertTensorShape(transformation, {4, 4});
 
     core::Tensor transformation_host =
@@ -202,6 +204,7 @@ InitializePointCloudPyramidForMultiScaleICP(
         const double &max_correspondence_distance,
         const TransformationEstimation &estimation,
         const int64_t &num_iterations) {
+    OPEN3D_TRACE_ZONE("registration", "ICP pyramid");
     std::vector<t::geometry::PointCloud> source_down_pyramid(num_iterations);
     std::vector<t::geometry::PointCloud> target_down_pyramid(num_iterations);
 
@@ -256,6 +259,7 @@ static RegistrationResult DoSingleScaleIterationsICP(
         const core::Dtype &dtype) {
     RegistrationResult result;
     for (int j = 0; j < criteria.max_iteration_; j++) {
+        OPEN3D_TRACE_ZONE("registration", "ICP iteration");
         result = GetRegistrationResultAndCorrespondences(
                 source.GetPointPositions(), target_nns,
                 max_correspondence_distance, transformation);
@@ -263,17 +267,26 @@ static RegistrationResult DoSingleScaleIterationsICP(
         // Computing Transform between source and target, given
         // correspondences. ComputeTransformation returns {4,4} shaped
         // Float64 transformation tensor on CPU device.
-        core::Tensor update =
-                estimation
-                        .ComputeTransformation(source, target,
-                                               result.correspondences_)
-                        .To(core::Float64);
+        core::Tensor update;
+        {
+            OPEN3D_TRACE_ZONE("registration", "ICP reduce and solve");
+            update = estimation
+                             .ComputeTransformation(source, target,
+                                                    result.correspondences_)
+                             .To(core::Float64);
+        }
 
         // Multiply the transform to the cumulative transformation (update).
         transformation = update.Matmul(transformation);
 
         // Apply the transform on source pointcloud.
-        source.Transform(update);
+        {
+            OPEN3D_TRACE_ZONE("registration", "ICP transform source");
+            source.Transform(update);
+        }
+        OPEN3D_TRACE_COUNTER("registration", "ICP fitness", result.fitness_);
+        OPEN3D_TRACE_COUNTER("registration", "ICP inlier rmse",
+                             result.inlier_rmse_);
 
         utility::LogDebug(
                 " ICP Scale #{:d} Iteration #{:d}: Fitness {:.4f}, RMSE "
@@ -304,6 +317,7 @@ RegistrationResult MultiScaleICP(
         const std::vector<double> &max_correspondence_distances,
         const core::Tensor &init_source_to_target,
         const TransformationEstimation &estimation) {
+    OPEN3D_TRACE_ZONE("registration", "MultiScaleICP");
     core::AssertTensorDtypes(source.GetPointPositions(),
                              {core::Float64, core::Float32});
 
@@ -334,6 +348,7 @@ RegistrationResult MultiScaleICP(
 
     // ---- Iterating over different resolution scale START -------------------
     for (int64_t i = 0; i < num_iterations; ++i) {
+        OPEN3D_TRACE_ZONE("registration", "ICP scale");
         source_down_pyramid[i].Transform(transformation);
 
         // Initialize Neighbor Search.
@@ -0,0 +1,441 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/AsyncPipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "open3d/t/geometry/RGBDImagePyramid.h"
+#include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+constexpr int AsyncPipeline::kNumStages;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double MillisecondsSince(const Clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+}
+
+/// FIFO queue with a fixed capacity. Push blocks while the queue is full,
+/// which propagates back-pressure to the upstream stages.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity) {}
+
+    /// Returns false if the queue was closed before \p item could be added.
+    /// \p blocked_ms accumulates the time spent waiting for space.
+    bool Push(T&& item, double& blocked_ms) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (items_.size() >= capacity_ && !closed_) {
+            const Clock::time_point start = Clock::now();
+            not_full_.wait(lock, [this]() {
+                return items_.size() < capacity_ || closed_;
+            });
+            blocked_ms += MillisecondsSince(start);
+        }
+        if (closed_) {
+            return false;
+        }
+        items_.push_back(std::move(item));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /// Returns false once the queue is closed and drained.
+    bool Pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this]() { return !items_.empty() || closed_; });
+        if (items_.empty()) {
+            return false;
+        }
+        item = std::move(items_.front());
+        items_.pop_front();
+        not_full_.notify_one();
+        return true;
+    }
+
+    /// No more items can be pushed; the remaining ones can still be popped.
+    void Close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+    /// Closes the queue and discards the remaining items.
+    void Abort() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        items_.clear();
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+private:
+    size_t capacity_;
+    bool closed_ = false;
+    std::deque<T> items_;
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+};
+
+/// A frame travelling through the pipeline.
+struct Packet {
+    int64_t frame_id_ = 0;
+    Clock::time_point start_;
+    /// Raw depth and color on the model device.
+    t::geometry::Image depth_;
+    t::geometry::Image color_;
+    /// Tracking pyramid of the frame, built in the preprocess stage.
+    std::shared_ptr<t::geometry::RGBDImagePyramid> pyramid_;
+    std::array<double, AsyncPipeline::kNumStages> stage_ms_ = {};
+};
+
+}  // namespace
+
+struct AsyncPipeline::Impl {
+    Impl(Model& model,
+         const core::Tensor& intrinsics,
+         const AsyncPipelineParams& params)
+        : model_(model),
+          device_(model.voxel_grid_.GetHashMap().GetDevice()),
+          intrinsics_(intrinsics.To(core::Device("CPU:0"), core::Float64)),
+          params_(params) {}
+
+    void ReadStage(const FrameSource& source);
+    void PreprocessStage();
+    int64_t ModelStage(const FrameCallback& callback);
+
+    /// Records the first exception and stops the pipeline.
+    void Fail(std::exception_ptr exception);
+    /// Stops all stages and discards the frames in flight.
+    void Abort();
+    void AddBlockedTime(Stage stage, double ms);
+    void AddFrame(const Packet& packet);
+
+    Model& model_;
+    core::Device device_;
+    core::Tensor intrinsics_;
+    AsyncPipelineParams params_;
+    int64_t next_frame_id_ = 0;
+
+    /// Queues of the current Run(), guarded by queue_mutex_ for Stop().
+    std::shared_ptr<BoundedQueue<Packet>> read_queue_;
+    std::shared_ptr<BoundedQueue<Packet>> preprocess_queue_;
+    std::mutex queue_mutex_;
+    std::atomic<bool> stopped_{false};
+    std::mutex run_mutex_;
+
+    std::mutex exception_mutex_;
+    std::exception_ptr exception_;
+
+    mutable std::mutex statistics_mutex_;
+    std::array<StageStatistics, kNumStages> statistics_;
+
+    /// Ray casted model of the last frame, target of the next tracking.
+    std::unique_ptr<Frame> raycast_frame_;
+};
+
+void AsyncPipeline::Impl::ReadStage(const FrameSource& source) {
+    double blocked_ms = 0.0;
+    while (!stopped_) {
+        Packet packet;
+        packet.start_ = Clock::now();
+        {
+            OPEN3D_TRACE_ZONE("slam", "AsyncPipeline read");
+            t::geometry::RGBDImage image;
+            if (!source(image)) {
+                break;
+            }
+            packet.depth_ = image.depth_.To(device_);
+            packet.color_ = image.color_.To(device_);
+        }
+        packet.frame_id_ = next_frame_id_++;
+        packet.stage_ms_[int(Stage::Read)] = MillisecondsSince(packet.start_);
+        if (!read_queue_->Push(std::move(packet), blocked_ms)) {
+            break;
+        }
+    }
+    read_queue_->Close();
+    AddBlockedTime(Stage::Read, blocked_ms);
+}
+
+void AsyncPipeline::Impl::PreprocessStage() {
+    double blocked_ms = 0.0;
+    Packet packet;
+    while (read_queue_->Pop(packet)) {
+        const Clock::time_point start = Clock::now();
+        {
+            OPEN3D_TRACE_ZONE("slam", "AsyncPipeline preprocess");
+            packet.pyramid_ = std::make_shared<t::geometry::RGBDImagePyramid>(
+                    t::geometry::RGBDImage(packet.color_, packet.depth_),
+                    intrinsics_, Model::kNumTrackingLevels,
+                    params_.depth_scale_, params_.depth_max_,
+                    params_.depth_diff_);
+        }
+        packet.stage_ms_[int(Stage::Preprocess)] = MillisecondsSince(start);
+        if (!preprocess_queue_->Push(std::move(packet), blocked_ms)) {
+            break;
+        }
+    }
+    preprocess_queue_->Close();
+    AddBlockedTime(Stage::Preprocess, blocked_ms);
+}
+
+int64_t AsyncPipeline::Impl::ModelStage(const FrameCallback& callback) {
+    int64_t num_frames = 0;
+    Packet packet;
+    while (preprocess_queue_->Pop(packet)) {
+        const int64_t rows = packet.depth_.GetRows();
+        const int64_t cols = packet.depth_.GetCols();
+        Frame input_frame(rows, cols, intrinsics_, device_);
+        input_frame.SetDataFromImage("depth", packet.depth_);
+        input_frame.SetDataFromImage("color", packet.color_);
+
+        AsyncFrameResult result;
+        result.frame_id_ = packet.frame_id_;
+        result.pose_ = model_.GetCurrentFramePose();
+        result.tracking_success_ = true;
+
+        // The model is empty before the first frame is integrated.
+        if (raycast_frame_ != nullptr) {
+            if (raycast_frame_->GetHeight() != rows ||
+                raycast_frame_->GetWidth() != cols) {
+                utility::LogError(
+                        "Frame {} is {}x{}, but previous frames are {}x{}.",
+                        packet.frame_id_, cols, rows,
+                        raycast_frame_->GetWidth(),
+                        raycast_frame_->GetHeight());
+            }
+            const Clock::time_point start = Clock::now();
+            result.odometry_result_ = model_.TrackFrameToModel(
+                    *packet.pyramid_, *raycast_frame_, params_.depth_scale_,
+                    params_.depth_max_, params_.depth_diff_);
+            core::Tensor translation =
+                    result.odometry_result_.transformation_.Slice(0, 0, 3)
+                            .Slice(1, 3, 4);
+            const double translation_norm = std::sqrt(
+                    (translation * translation).Sum({0, 1}).Item<double>());
+            result.tracking_success_ =
+                    result.odometry_result_.fitness_ >=
+                            params_.fitness_threshold_ &&
+                    translation_norm < params_.translation_threshold_;
+            if (result.tracking_success_) {
+                result.pose_ = result.pose_.Matmul(
+                        result.odometry_result_.transformation_);
+            } else {
+                utility::LogWarning(
+                        "Tracking failed for frame {}, fitness: {:.3f}, "
+                        "translation: {:.3f}. Using the previous pose.",
+                        packet.frame_id_, result.odometry_result_.fitness_,
+                        translation_norm);
+            }
+            packet.stage_ms_[int(Stage::Track)] = MillisecondsSince(start);
+        } else {
+            raycast_frame_.reset(new Frame(rows, cols, intrinsics_, device_));
+        }
+        model_.UpdateFramePose(model_.frame_id_ + 1, result.pose_);
+
+        if (result.tracking_success_) {
+            const Clock::time_point start = Clock::now();
+            model_.Integrate(input_frame, params_.depth_scale_,
+                             params_.depth_max_);
+            packet.stage_ms_[int(Stage::Integrate)] = MillisecondsSince(start);
+        }
+
+        const Clock::time_point start = Clock::now();
+        model_.SynthesizeModelFrame(*raycast_frame_, params_.depth_scale_,
+                                    params_.depth_min_, params_.depth_max_,
+                                    params_.enable_raycast_color_);
+        packet.stage_ms_[int(Stage::RayCast)] = MillisecondsSince(start);
+
+        result.stage_ms_ = packet.stage_ms_;
+        result.latency_ms_ = MillisecondsSince(packet.start_);
+        AddFrame(packet);
+        ++num_frames;
+        if (callback) {
+            callback(result);
+        }
+        if (stopped_) {
+            break;
+        }
+    }
+    return num_frames;
+}
+
+void AsyncPipeline::Impl::Fail(std::exception_ptr exception) {
+    {
+        std::lock_guard<std::mutex> lock(exception_mutex_);
+        if (!exception_) {
+            exception_ = exception;
+        }
+    }
+    Abort();
+}
+
+void AsyncPipeline::Impl::Abort() {
+    stopped_ = true;
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    if (read_queue_ != nullptr) {
+        read_queue_->Abort();
+        preprocess_queue_->Abort();
+    }
+}
+
+void AsyncPipeline::Impl::AddBlockedTime(Stage stage, double ms) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    statistics_[int(stage)].blocked_ms_ += ms;
+}
+
+void AsyncPipeline::Impl::AddFrame(const Packet& packet) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    for (int i = 0; i < kNumStages; ++i) {
+        // Skipped stages, e.g. tracking the first frame, are not counted.
+        if (packet.stage_ms_[i] <= 0.0) {
+            continue;
+        }
+        StageStatistics& statistics = statistics_[i];
+        statistics.count_++;
+        statistics.mean_ms_ += (packet.stage_ms_[i] - statistics.mean_ms_) /
+                               statistics.count_;
+        statistics.max_ms_ = std::max(statistics.max_ms_, packet.stage_ms_[i]);
+    }
+}
+
+AsyncPipeline::AsyncPipeline(Model& model,
+                             const core::Tensor& intrinsics,
+                             const AsyncPipelineParams& params) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (params.queue_size_ < 1) {
+        utility::LogError("Queue size must be positive, but got {}.",
+                          params.queue_size_);
+    }
+    impl_.reset(new Impl(model, intrinsics, params));
+}
+
+AsyncPipeline::~AsyncPipeline() {}
+
+int64_t AsyncPipeline::Run(const FrameSource& source,
+                           const FrameCallback& callback) {
+    std::lock_guard<std::mutex> run_lock(impl_->run_mutex_);
+    const size_t capacity = size_t(impl_->params_.queue_size_);
+    {
+        std::lock_guard<std::mutex> lock(impl_->queue_mutex_);
+        impl_->read_queue_ = std::make_shared<BoundedQueue<Packet>>(capacity);
+        impl_->preprocess_queue_ =
+                std::make_shared<BoundedQueue<Packet>>(capacity);
+        impl_->stopped_ = false;
+    }
+    impl_->exception_ = nullptr;
+
+    Impl* impl = impl_.get();
+    std::thread read_thread([impl, &source]() {
+        try {
+            impl->ReadStage(source);
+        } catch (...) {
+            impl->Fail(std::current_exception());
+        }
+    });
+    std::thread preprocess_thread([impl]() {
+        try {
+            impl->PreprocessStage();
+        } catch (...) {
+            impl->Fail(std::current_exception());
+        }
+    });
+
+    // The model stages run in the calling thread.
+    int64_t num_frames = 0;
+    try {
+        num_frames = impl->ModelStage(callback);
+    } catch (...) {
+        impl->Fail(std::current_exception());
+    }
+    // Unblocks the upstream stages if the model stages returned early.
+    impl->Abort();
+    read_thread.join();
+    preprocess_thread.join();
+    {
+        std::lock_guard<std::mutex> lock(impl->queue_mutex_);
+        impl->read_queue_.reset();
+        impl->preprocess_queue_.reset();
+    }
+
+    if (impl->exception_) {
+        std::rethrow_exception(impl->exception_);
+    }
+    return num_frames;
+}
+
+void AsyncPipeline::Stop() { impl_->Abort(); }
+
+AsyncPipeline::StageStatistics AsyncPipeline::GetStageStatistics(
+        Stage stage) const {
+    std::lock_guard<std::mutex> lock(impl_->statistics_mutex_);
+    return impl_->statistics_[int(stage)];
+}
+
+std::string AsyncPipeline::GetStatisticsSummary() const {
+    static const char* stage_names[kNumStages] = {"Read", "Preprocess", "Track",
+                                                  "Integrate", "RayCast"};
+    std::lock_guard<std::mutex> lock(impl_->statistics_mutex_);
+    std::string summary;
+    for (int i = 0; i < kNumStages; ++i) {
+        const StageStatistics& statistics = impl_->statistics_[i];
+        summary += fmt::format(
+                "{:<10}: {} frames, mean {:.2f} ms, max {:.2f} ms, blocked "
+                "{:.2f} ms\n",
+                stage_names[i], statistics.count_, statistics.mean_ms_,
+                statistics.max_ms_, statistics.blocked_ms_);
+    }
+    return summary;
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
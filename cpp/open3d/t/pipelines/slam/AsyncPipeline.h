@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+#include "open3d/t/pipelines/slam/Model.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+/// Parameters of AsyncPipeline. The defaults follow the DenseSLAM example.
+struct AsyncPipelineParams {
+    /// Scale factor to convert raw depth into meters.
+    float depth_scale_ = 1000.0f;
+    /// Depth where ray casting starts from.
+    float depth_min_ = 0.1f;
+    /// Depth truncation to discard points far away from the camera.
+    float depth_max_ = 3.0f;
+    /// Depth difference threshold used to filter projective associations.
+    float depth_diff_ = 0.07f;
+    /// Tracking is accepted if its fitness is at least this value ...
+    double fitness_threshold_ = 0.1;
+    /// ... and the frame to frame translation is below this value in meters.
+    double translation_threshold_ = 0.15;
+    /// Capacity of the queue between two consecutive stages. A full queue
+    /// blocks its producer, which bounds the number of frames in flight.
+    int queue_size_ = 2;
+    /// Ray cast color in addition to depth.
+    bool enable_raycast_color_ = false;
+};
+
+/// Result of one frame, delivered in input order.
+struct AsyncFrameResult {
+    /// Index of the frame in the input sequence.
+    int64_t frame_id_ = 0;
+    /// (4, 4) Float64 frame to world pose on CPU after tracking.
+    core::Tensor pose_;
+    /// Whether tracking was accepted; the frame is integrated only if so.
+    /// The first frame is always accepted.
+    bool tracking_success_ = false;
+    /// Result of frame to model odometry. Identity for the first frame.
+    odometry::OdometryResult odometry_result_;
+    /// Processing time of every stage in milliseconds, indexed by
+    /// AsyncPipeline::Stage.
+    std::array<double, 5> stage_ms_ = {};
+    /// Time from the start of the read until the frame is ray casted,
+    /// including the time spent in queues.
+    double latency_ms_ = 0.0;
+};
+
+/// \class AsyncPipeline
+///
+/// \brief Runs dense SLAM on a Model with the stages of consecutive frames
+/// overlapping.
+///
+/// Every stage runs in its own thread, connected by bounded FIFO queues:
+/// - Read: fetches the next RGBD image and uploads it to the model device.
+/// - Preprocess: converts depth to meters and builds the source vertex map
+///   pyramid with PyrDownDepth and CreateVertexMap.
+/// - Track, Integrate, RayCast: run serially in one thread, since tracking a
+///   frame needs the model ray casted from the previous frame.
+/// While frame i is tracked, integrated and ray casted, frames i + 1 and on
+/// are being read and preprocessed. Frames are processed strictly in input
+/// order, so results are identical to running the stages sequentially.
+class AsyncPipeline {
+public:
+    enum class Stage { Read = 0, Preprocess, Track, Integrate, RayCast };
+    static constexpr int kNumStages = 5;
+
+    /// Fills the next RGBD image (UInt16 or Float32 depth, color of the same
+    /// size) and returns true, or returns false at the end of the input.
+    typedef std::function<bool(t::geometry::RGBDImage&)> FrameSource;
+    /// Receives the result of every frame, in order, from the thread running
+    /// the model stages.
+    typedef std::function<void(const AsyncFrameResult&)> FrameCallback;
+
+    /// Latency statistics of a stage.
+    struct StageStatistics {
+        int64_t count_ = 0;
+        double mean_ms_ = 0.0;
+        double max_ms_ = 0.0;
+        /// Total time the stage was blocked by a full downstream queue.
+        double blocked_ms_ = 0.0;
+    };
+
+    /// \param model The model to track against and integrate into. It must
+    /// outlive the pipeline and must not be used by others while Run() is in
+    /// progress.
+    /// \param intrinsics (3, 3) intrinsic matrix of the input frames.
+    /// \param params Parameters of the pipeline.
+    AsyncPipeline(Model& model,
+                  const core::Tensor& intrinsics,
+                  const AsyncPipelineParams& params = AsyncPipelineParams());
+    ~AsyncPipeline();
+    AsyncPipeline(const AsyncPipeline&) = delete;
+    AsyncPipeline& operator=(const AsyncPipeline&) = delete;
+
+    /// Processes frames from \p source until it is exhausted or Stop() is
+    /// called, and blocks until all stages have finished. Exceptions thrown
+    /// by \p source, \p callback or any stage stop the pipeline and are
+    /// rethrown here. Frame ids continue over successive calls.
+    /// \return Number of frames processed by the model stages in this call.
+    int64_t Run(const FrameSource& source,
+                const FrameCallback& callback = nullptr);
+
+    /// Requests Run() to return as soon as possible. Frames in flight are
+    /// discarded. Can be called from any thread, including the callback.
+    void Stop();
+
+    /// Latency statistics of \p stage, accumulated over all Run() calls.
+    StageStatistics GetStageStatistics(Stage stage) const;
+
+    /// Human readable summary of the statistics of all stages.
+    std::string GetStatisticsSummary() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,479 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/LoopClosure.h"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+#include "open3d/t/geometry/Utility.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+namespace {
+
+namespace legacy_registration = open3d::pipelines::registration;
+
+Eigen::Matrix4d TensorToMatrix4d(const core::Tensor& T) {
+    return core::eigen_converter::TensorToEigenMatrixXd(T);
+}
+
+core::Tensor Matrix4dToTensor(const Eigen::Matrix4d& T) {
+    return core::eigen_converter::EigenMatrixToTensor(T);
+}
+
+/// Translation in meters and rotation angle in radians between two poses.
+std::pair<double, double> PoseDifference(const core::Tensor& T_a,
+                                         const core::Tensor& T_b) {
+    const Eigen::Matrix4d delta =
+            TensorToMatrix4d(T_a).inverse() * TensorToMatrix4d(T_b);
+    const double cos_angle = std::max(
+            -1.0, std::min(1.0, (delta.block<3, 3>(0, 0).trace() - 1) / 2));
+    return std::make_pair(delta.block<3, 1>(0, 3).norm(), std::acos(cos_angle));
+}
+
+/// Information matrix of registering \p source to \p target, or identity if
+/// either point cloud is empty.
+Eigen::Matrix6d InformationMatrix(const t::geometry::PointCloud& source,
+                                  const t::geometry::PointCloud& target,
+                                  double max_correspondence_distance,
+                                  const core::Tensor& transformation) {
+    if (source.IsEmpty() || target.IsEmpty()) {
+        return Eigen::Matrix6d::Identity();
+    }
+    return core::eigen_converter::TensorToEigenMatrixXd(
+            registration::GetInformationMatrix(source, target,
+                                               max_correspondence_distance,
+                                               transformation));
+}
+
+}  // namespace
+
+KeyframeDatabase::KeyframeDatabase(int descriptor_rows, int descriptor_cols)
+    : descriptor_rows_(descriptor_rows), descriptor_cols_(descriptor_cols) {
+    if (descriptor_rows <= 0 || descriptor_cols <= 0) {
+        utility::LogError("Invalid descriptor grid {}x{}.", descriptor_rows,
+                          descriptor_cols);
+    }
+}
+
+core::Tensor KeyframeDatabase::ComputeDescriptor(
+        const t::geometry::Image& depth,
+        float depth_scale,
+        float depth_max) const {
+    // Depth in meters on CPU, with invalid pixels set to 0.
+    const core::Tensor depth_m =
+            depth.ClipTransform(depth_scale, 0, depth_max, 0)
+                    .AsTensor()
+                    .To(core::Device("CPU:0"))
+                    .Contiguous();
+    const int64_t rows = depth.GetRows();
+    const int64_t cols = depth.GetCols();
+    const float* data = depth_m.GetDataPtr<float>();
+
+    const int64_t num_cells = descriptor_rows_ * descriptor_cols_;
+    std::vector<double> sum(num_cells, 0.0);
+    std::vector<int64_t> count(num_cells, 0);
+    for (int64_t v = 0; v < rows; ++v) {
+        const int64_t cell_row = v * descriptor_rows_ / rows;
+        for (int64_t u = 0; u < cols; ++u) {
+            const float d = data[v * cols + u];
+            if (d > 0) {
+                const int64_t cell_col = u * descriptor_cols_ / cols;
+                const int64_t cell = cell_row * descriptor_cols_ + cell_col;
+                sum[cell] += d;
+                count[cell]++;
+            }
+        }
+    }
+
+    // Mean depth per cell, relative to the mean over all valid cells so that
+    // the descriptor captures the layout rather than the distance.
+    double mean = 0.0;
+    int64_t num_valid = 0;
+    for (int64_t i = 0; i < num_cells; ++i) {
+        if (count[i] > 0) {
+            sum[i] /= count[i];
+            mean += sum[i];
+            num_valid++;
+        }
+    }
+    mean = num_valid > 0 ? mean / num_valid : 0.0;
+
+    std::vector<float> descriptor(num_cells, 0.0f);
+    double norm = 0.0;
+    for (int64_t i = 0; i < num_cells; ++i) {
+        if (count[i] > 0) {
+            descriptor[i] = float(sum[i] - mean);
+            norm += descriptor[i] * descriptor[i];
+        }
+    }
+    if (norm > 0) {
+        const float inv_norm = float(1.0 / std::sqrt(norm));
+        for (float& value : descriptor) {
+            value *= inv_norm;
+        }
+    }
+    return core::Tensor(descriptor, {num_cells}, core::Float32);
+}
+
+int64_t KeyframeDatabase::Add(const Keyframe& keyframe) {
+    const int64_t num_cells = descriptor_rows_ * descriptor_cols_;
+    core::AssertTensorShape(keyframe.descriptor_, {num_cells});
+    const core::Tensor descriptor = keyframe.descriptor_.To(
+            core::Device("CPU:0"), core::Float32).Contiguous();
+    const float* data = descriptor.GetDataPtr<float>();
+    descriptors_.insert(descriptors_.end(), data, data + num_cells);
+    keyframes_.push_back(keyframe);
+    return Size() - 1;
+}
+
+std::vector<std::pair<int64_t, double>> KeyframeDatabase::Query(
+        const core::Tensor& descriptor,
+        int64_t end,
+        int max_candidates,
+        double min_similarity) const {
+    const int64_t num_cells = descriptor_rows_ * descriptor_cols_;
+    core::AssertTensorShape(descriptor, {num_cells});
+    end = std::min(end, Size());
+    std::vector<std::pair<int64_t, double>> candidates;
+    if (end <= 0 || max_candidates <= 0) {
+        return candidates;
+    }
+
+    const core::Tensor query =
+            descriptor.To(core::Device("CPU:0"), core::Float32).Contiguous();
+    Eigen::Map<const Eigen::MatrixXf> descriptors(descriptors_.data(),
+                                                  num_cells, end);
+    Eigen::Map<const Eigen::VectorXf> query_map(query.GetDataPtr<float>(),
+                                                num_cells);
+    const Eigen::VectorXf similarities = descriptors.transpose() * query_map;
+
+    for (int64_t i = 0; i < end; ++i) {
+        if (similarities(i) >= min_similarity) {
+            candidates.emplace_back(i, similarities(i));
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const std::pair<int64_t, double>& a,
+                 const std::pair<int64_t, double>& b) {
+                  return a.second > b.second;
+              });
+    if (int64_t(candidates.size()) > max_candidates) {
+        candidates.resize(max_candidates);
+    }
+    return candidates;
+}
+
+struct LoopClosure::Impl {
+    Impl(Model& model, const LoopClosureParams& params)
+        : model_(model), params_(params) {}
+
+    bool ShouldAddKeyframe(int frame_id, const core::Tensor& pose) const;
+    Keyframe CreateKeyframe(const Frame& input_frame,
+                            const Frame& raycast_frame) const;
+    /// Verifies the loop candidates of the last keyframe and adds accepted
+    /// loops to the pose graph. Returns the number of accepted loops.
+    int AddLoopEdges(const std::vector<std::pair<int64_t, double>>& candidates);
+    /// Optimizes the pose graph and applies the new poses.
+    void Optimize();
+
+    Model& model_;
+    LoopClosureParams params_;
+    KeyframeDatabase database_;
+    legacy_registration::PoseGraph pose_graph_;
+    core::Tensor intrinsics_;
+    /// Keyframes to re-integrate.
+    std::set<int64_t> pending_;
+};
+
+bool LoopClosure::Impl::ShouldAddKeyframe(int frame_id,
+                                          const core::Tensor& pose) const {
+    if (database_.Size() == 0) {
+        return true;
+    }
+    const Keyframe& last = database_[database_.Size() - 1];
+    return frame_id - last.frame_id_ >= params_.keyframe_interval_ ||
+           PoseDifference(last.pose_, pose).first >=
+                   params_.keyframe_translation_;
+}
+
+Keyframe LoopClosure::Impl::CreateKeyframe(const Frame& input_frame,
+                                           const Frame& raycast_frame) const {
+    const core::Device host("CPU:0");
+    Keyframe keyframe;
+    keyframe.frame_id_ = model_.frame_id_;
+    keyframe.pose_ = model_.GetCurrentFramePose().To(host, core::Float64);
+    keyframe.integrated_pose_ = keyframe.pose_;
+    keyframe.descriptor_ = database_.ComputeDescriptor(
+            raycast_frame.GetDataAsImage("depth"), params_.depth_scale_,
+            params_.depth_max_);
+
+    t::geometry::Image depth = input_frame.GetDataAsImage("depth");
+    keyframe.point_cloud_ =
+            t::geometry::PointCloud::CreateFromDepthImage(
+                    depth, intrinsics_,
+                    core::Tensor::Eye(4, core::Float32, host),
+                    params_.depth_scale_, params_.depth_max_)
+                    .VoxelDownSample(params_.voxel_size_);
+    if (keyframe.point_cloud_.GetPointPositions().GetLength() >= 3) {
+        keyframe.point_cloud_.EstimateNormals(30, 2 * params_.voxel_size_);
+    } else {
+        keyframe.point_cloud_.Clear();
+    }
+
+    keyframe.depth_ = depth.To(host);
+    keyframe.color_ = input_frame.GetDataAsImage("color").To(host);
+    return keyframe;
+}
+
+int LoopClosure::Impl::AddLoopEdges(
+        const std::vector<std::pair<int64_t, double>>& candidates) {
+    const int64_t index = database_.Size() - 1;
+    const Keyframe& keyframe = database_[index];
+    if (keyframe.point_cloud_.IsEmpty()) {
+        return 0;
+    }
+
+    int num_loops = 0;
+    for (const std::pair<int64_t, double>& candidate : candidates) {
+        OPEN3D_TRACE_ZONE("slam", "LoopClosure verify");
+        const Keyframe& other = database_[candidate.first];
+        if (other.point_cloud_.IsEmpty()) {
+            continue;
+        }
+        const core::Tensor init = t::geometry::InverseTransformation(
+                                          other.pose_)
+                                          .Matmul(keyframe.pose_);
+        registration::RegistrationResult result;
+        try {
+            result = registration::ICP(
+                    keyframe.point_cloud_, other.point_cloud_,
+                    params_.max_correspondence_distance_, init,
+                    registration::TransformationEstimationPointToPlane(),
+                    registration::ICPConvergenceCriteria(1e-6, 1e-6, 30));
+        } catch (const std::runtime_error&) {
+            // ICP throws if the clouds do not overlap at all.
+            continue;
+        }
+        utility::LogDebug(
+                "Loop candidate {} -> {}: similarity {:.3f}, fitness {:.3f}, "
+                "rmse {:.4f}",
+                keyframe.frame_id_, other.frame_id_, candidate.second,
+                result.fitness_, result.inlier_rmse_);
+        if (result.fitness_ < params_.fitness_threshold_) {
+            continue;
+        }
+
+        pose_graph_.edges_.emplace_back(
+                int(index), int(candidate.first),
+                TensorToMatrix4d(result.transformation_),
+                InformationMatrix(keyframe.point_cloud_, other.point_cloud_,
+                                  params_.max_correspondence_distance_,
+                                  result.transformation_),
+                /*uncertain=*/true);
+        num_loops++;
+    }
+    return num_loops;
+}
+
+void LoopClosure::Impl::Optimize() {
+    OPEN3D_TRACE_ZONE("slam", "LoopClosure optimize");
+    legacy_registration::GlobalOptimization(
+            pose_graph_,
+            legacy_registration::GlobalOptimizationLevenbergMarquardt(),
+            legacy_registration::GlobalOptimizationConvergenceCriteria(),
+            legacy_registration::GlobalOptimizationOption(
+                    params_.max_correspondence_distance_,
+                    /*edge_prune_threshold=*/0.25,
+                    /*preference_loop_closure=*/1.0,
+                    /*reference_node=*/0));
+
+    const int64_t last = database_.Size() - 1;
+    const core::Tensor last_pose = database_[last].pose_;
+    for (int64_t i = 0; i <= last; ++i) {
+        Keyframe& keyframe = database_[i];
+        keyframe.pose_ = Matrix4dToTensor(pose_graph_.nodes_[i].pose_);
+        const std::pair<double, double> difference =
+                PoseDifference(keyframe.integrated_pose_, keyframe.pose_);
+        if (difference.first > params_.reintegration_threshold_ ||
+            difference.second > params_.reintegration_rotation_threshold_) {
+            pending_.insert(i);
+        }
+    }
+
+    // Frames after the last keyframe follow its correction.
+    const core::Tensor correction =
+            database_[last].pose_.Matmul(
+                    t::geometry::InverseTransformation(last_pose));
+    model_.T_frame_to_world_ =
+            correction.Matmul(model_.GetCurrentFramePose()).Contiguous();
+}
+
+LoopClosure::LoopClosure(Model& model, const LoopClosureParams& params)
+    : impl_(new Impl(model, params)) {}
+
+LoopClosure::~LoopClosure() {}
+
+bool LoopClosure::ProcessFrame(const Frame& input_frame,
+                               const Frame& raycast_frame) {
+    OPEN3D_TRACE_ZONE("slam", "LoopClosure");
+    const core::Tensor pose = impl_->model_.GetCurrentFramePose();
+    if (!impl_->ShouldAddKeyframe(impl_->model_.frame_id_, pose)) {
+        return false;
+    }
+    if (impl_->intrinsics_.NumElements() == 0) {
+        impl_->intrinsics_ = input_frame.GetIntrinsics().To(
+                core::Device("CPU:0"), core::Float64);
+    }
+
+    Keyframe keyframe = impl_->CreateKeyframe(input_frame, raycast_frame);
+    const int64_t index = impl_->database_.Size();
+    impl_->pose_graph_.nodes_.emplace_back(TensorToMatrix4d(keyframe.pose_));
+    if (index > 0) {
+        // Odometry edge from the tracked poses.
+        const Keyframe& previous = impl_->database_[index - 1];
+        const core::Tensor odometry =
+                t::geometry::InverseTransformation(previous.pose_)
+                        .Matmul(keyframe.pose_);
+        impl_->pose_graph_.edges_.emplace_back(
+                int(index), int(index - 1), TensorToMatrix4d(odometry),
+                InformationMatrix(keyframe.point_cloud_,
+                                  previous.point_cloud_,
+                                  impl_->params_.max_correspondence_distance_,
+                                  odometry),
+                /*uncertain=*/false);
+    }
+
+    const std::vector<std::pair<int64_t, double>> candidates =
+            impl_->database_.Query(
+                    keyframe.descriptor_,
+                    index - impl_->params_.min_keyframe_gap_ + 1,
+                    impl_->params_.max_candidates_,
+                    impl_->params_.min_similarity_);
+    impl_->database_.Add(keyframe);
+    if (impl_->AddLoopEdges(candidates) == 0) {
+        return false;
+    }
+    impl_->Optimize();
+    return true;
+}
+
+int64_t LoopClosure::Reintegrate() {
+    OPEN3D_TRACE_ZONE("slam", "LoopClosure reintegrate");
+    if (impl_->pending_.empty()) {
+        return 0;
+    }
+    t::geometry::VoxelBlockGrid& grid = impl_->model_.voxel_grid_;
+    const core::Device device = grid.GetHashMap().GetDevice();
+    const core::Tensor& intrinsics = impl_->intrinsics_;
+    const float depth_scale = impl_->params_.depth_scale_;
+    const float depth_max = impl_->params_.depth_max_;
+    KeyframeDatabase& database = impl_->database_;
+
+    // Blocks seen by the moved keyframes, before and after the correction.
+    std::vector<core::Tensor> block_coords;
+    for (int64_t i : impl_->pending_) {
+        const Keyframe& keyframe = database[i];
+        const t::geometry::Image depth = keyframe.depth_.To(device);
+        for (const core::Tensor& pose :
+             {keyframe.integrated_pose_, keyframe.pose_}) {
+            block_coords.push_back(grid.GetUniqueBlockCoordinates(
+                    depth, intrinsics,
+                    t::geometry::InverseTransformation(pose), depth_scale,
+                    depth_max));
+        }
+    }
+    const core::Tensor all_coords = core::Concatenate(block_coords, 0);
+    core::HashSet affected(all_coords.GetLength(), core::Int32, {3}, device);
+    core::Tensor buf_indices, masks;
+    affected.Insert(all_coords, buf_indices, masks);
+    const core::Tensor affected_coords = all_coords.IndexGet({masks});
+    grid.EraseBlocks(affected_coords);
+
+    // Rebuild the affected blocks from all keyframes that observe them.
+    for (int64_t i = 0; i < database.Size(); ++i) {
+        Keyframe& keyframe = database[i];
+        const t::geometry::Image depth = keyframe.depth_.To(device);
+        const core::Tensor extrinsics =
+                t::geometry::InverseTransformation(keyframe.pose_);
+        core::Tensor coords = grid.GetUniqueBlockCoordinates(
+                depth, intrinsics, extrinsics, depth_scale, depth_max);
+        affected.Find(coords, buf_indices, masks);
+        coords = coords.IndexGet({masks});
+        if (coords.GetLength() > 0) {
+            grid.Integrate(coords, depth, keyframe.color_.To(device),
+                           intrinsics, extrinsics, depth_scale, depth_max);
+        }
+        keyframe.integrated_pose_ = keyframe.pose_;
+    }
+    impl_->pending_.clear();
+    return affected_coords.GetLength();
+}
+
+bool LoopClosure::HasPendingReintegration() const {
+    return !impl_->pending_.empty();
+}
+
+const open3d::pipelines::registration::PoseGraph& LoopClosure::GetPoseGraph()
+        const {
+    return impl_->pose_graph_;
+}
+
+const KeyframeDatabase& LoopClosure::GetKeyframeDatabase() const {
+    return impl_->database_;
+}
+
+std::vector<std::pair<int, int>> LoopClosure::GetLoopClosures() const {
+    std::vector<std::pair<int, int>> loops;
+    for (const legacy_registration::PoseGraphEdge& edge :
+         impl_->pose_graph_.edges_) {
+        if (edge.uncertain_) {
+            loops.emplace_back(
+                    impl_->database_[edge.source_node_id_].frame_id_,
+                    impl_->database_[edge.target_node_id_].frame_id_);
+        }
+    }
+    return loops;
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,202 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/Model.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+/// A frame kept for place recognition, loop verification and re-integration.
+struct Keyframe {
+    /// Index of the frame in the input sequence.
+    int frame_id_ = -1;
+    /// (4, 4) Float64 frame to world pose on CPU, updated by optimization.
+    core::Tensor pose_;
+    /// Pose the frame was last integrated into the volume with.
+    core::Tensor integrated_pose_;
+    /// (D,) Float32 global descriptor on CPU, see
+    /// KeyframeDatabase::ComputeDescriptor.
+    core::Tensor descriptor_;
+    /// Down sampled point cloud with normals in camera coordinates.
+    t::geometry::PointCloud point_cloud_;
+    /// Raw input depth and color on CPU, kept for re-integration.
+    t::geometry::Image depth_;
+    t::geometry::Image color_;
+};
+
+/// \class KeyframeDatabase
+///
+/// \brief Keyframes with global depth descriptors for place recognition.
+///
+/// The descriptor of a depth image is its mean depth over a coarse grid of
+/// cells, with the mean removed and normalized to unit length, so candidates
+/// are ranked by the cosine similarity of their coarse scene layout. Queries
+/// are a dense matrix-vector product over all keyframes, which is cheap for
+/// the thousands of keyframes of a large scene.
+class KeyframeDatabase {
+public:
+    /// \param descriptor_rows Number of grid rows of the descriptor.
+    /// \param descriptor_cols Number of grid columns of the descriptor.
+    KeyframeDatabase(int descriptor_rows = 12, int descriptor_cols = 16);
+
+    /// Computes the (rows * cols,) Float32 descriptor of \p depth.
+    /// \param depth UInt16 or Float32 depth image, e.g. ray casted from the
+    /// model, which is less noisy than the raw input.
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation.
+    core::Tensor ComputeDescriptor(const t::geometry::Image& depth,
+                                   float depth_scale,
+                                   float depth_max) const;
+
+    /// Appends \p keyframe and returns its index.
+    int64_t Add(const Keyframe& keyframe);
+
+    /// Finds the keyframes most similar to \p descriptor among the first \p
+    /// end keyframes.
+    /// \return Up to \p max_candidates pairs of (keyframe index, similarity)
+    /// with similarity at least \p min_similarity, most similar first.
+    std::vector<std::pair<int64_t, double>> Query(
+            const core::Tensor& descriptor,
+            int64_t end,
+            int max_candidates,
+            double min_similarity) const;
+
+    int64_t Size() const { return int64_t(keyframes_.size()); }
+    Keyframe& operator[](int64_t index) { return keyframes_[index]; }
+    const Keyframe& operator[](int64_t index) const {
+        return keyframes_[index];
+    }
+
+private:
+    int descriptor_rows_;
+    int descriptor_cols_;
+    std::vector<Keyframe> keyframes_;
+    /// Descriptors of all keyframes, one after another.
+    std::vector<float> descriptors_;
+};
+
+/// Parameters of LoopClosure.
+struct LoopClosureParams {
+    /// Scale factor to convert raw depth into meters.
+    float depth_scale_ = 1000.0f;
+    /// Depth truncation of the input frames.
+    float depth_max_ = 3.0f;
+    /// A keyframe is added every keyframe_interval_ frames ...
+    int keyframe_interval_ = 10;
+    /// ... or once the camera moved this far from the last keyframe.
+    double keyframe_translation_ = 0.3;
+    /// Keyframes closer than this in the sequence are not loop candidates,
+    /// since they are already constrained by odometry.
+    int min_keyframe_gap_ = 10;
+    /// Maximum number of candidates verified per keyframe.
+    int max_candidates_ = 3;
+    /// Minimum descriptor similarity of a candidate.
+    double min_similarity_ = 0.9;
+    /// Voxel size to down sample keyframe point clouds.
+    double voxel_size_ = 0.05;
+    /// Maximum correspondence distance of ICP verification, also used by the
+    /// pose graph optimization.
+    double max_correspondence_distance_ = 0.07;
+    /// Minimum ICP fitness to accept a loop.
+    double fitness_threshold_ = 0.3;
+    /// Keyframes whose pose moved more than this in meters are re-integrated.
+    double reintegration_threshold_ = 0.01;
+    /// Keyframes whose pose rotated more than this in radians are
+    /// re-integrated. The default moves a point 0.5 m away by about 1 cm.
+    double reintegration_rotation_threshold_ = 0.02;
+};
+
+/// \class LoopClosure
+///
+/// \brief Loop closure and pose graph backend for a Model.
+///
+/// Keyframes are selected from the tracked frames and form the nodes of a
+/// pose graph, connected by odometry edges. Every new keyframe queries the
+/// KeyframeDatabase for earlier places with a similar descriptor; candidates
+/// are verified with point-to-plane tensor ICP, and accepted loops are added
+/// as uncertain edges, after which the pose graph is optimized with
+/// GlobalOptimization, warm started from the current poses. The current pose
+/// of the model is corrected along with the last keyframe.
+///
+/// Re-integration is deferred to Reintegrate(), so that it can be run when
+/// the application has time, e.g. between frames or on demand. It rebuilds
+/// the blocks seen by the keyframes whose pose changed from the keyframes,
+/// which keeps the map consistent without an offline optimization pass.
+class LoopClosure {
+public:
+    /// \param model The model to correct. It must outlive this object.
+    /// \param params Parameters of loop closure.
+    LoopClosure(Model& model,
+                const LoopClosureParams& params = LoopClosureParams());
+    ~LoopClosure();
+    LoopClosure(const LoopClosure&) = delete;
+    LoopClosure& operator=(const LoopClosure&) = delete;
+
+    /// Processes the current frame of the model. Call it after the frame is
+    /// tracked, integrated and ray casted, for successfully tracked frames.
+    /// \param input_frame Input RGBD frame.
+    /// \param raycast_frame RGBD frame ray casted at the current pose, used to
+    /// compute the keyframe descriptor.
+    /// \return True if a loop was closed and the poses were optimized.
+    bool ProcessFrame(const Frame& input_frame, const Frame& raycast_frame);
+
+    /// Rebuilds the blocks affected by pose corrections since the last call.
+    /// \return Number of rebuilt blocks.
+    int64_t Reintegrate();
+
+    /// Whether any keyframe is waiting to be re-integrated.
+    bool HasPendingReintegration() const;
+
+    /// Keyframe pose graph, with poses from frame to world.
+    const open3d::pipelines::registration::PoseGraph& GetPoseGraph() const;
+
+    const KeyframeDatabase& GetKeyframeDatabase() const;
+
+    /// Accepted loops as pairs of (frame id, earlier frame id).
+    std::vector<std::pair<int, int>> GetLoopClosures() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
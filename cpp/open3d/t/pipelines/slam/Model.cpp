@@ -29,16 +29,24 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/RGBDImagePyramid.h"
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 #include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace slam {
 
+// One entry per level of the tracking pyramid, from coarse to fine.
+static const std::vector<odometry::OdometryConvergenceCriteria>
+        tracking_criteria = {6, 3, 1};
+
+constexpr int64_t Model::kNumTrackingLevels;
+
 Model::Model(float voxel_size,
              int block_resolution,
              int est_block_count,
@@ -59,6 +67,7 @@ void Model::SynthesizeModelFrame(Frame& raycast_frame,
                                  float depth_min,
                                  float depth_max,
                                  bool enable_color) {
+    OPEN3D_TRACE_ZONE("slam", "SynthesizeModelFrame");
     auto result = voxel_grid_.RayCast(
             frustum_block_coords_, raycast_frame.GetIntrinsics(),
             t::geometry::InverseTransformation(GetCurrentFramePose()),
@@ -82,17 +91,32 @@ odometry::OdometryResult Model::TrackFrameToModel(const Frame& input_frame,
                                                   float depth_scale,
                                                   float depth_max,
                                                   float depth_diff) {
+    return TrackFrameToModel(
+            t::geometry::RGBDImagePyramid(
+                    t::geometry::RGBDImage(input_frame.GetDataAsImage("color"),
+                                           input_frame.GetDataAsImage("depth")),
+                    input_frame.GetIntrinsics(), kNumTrackingLevels,
+                    depth_scale, depth_max, depth_diff),
+            raycast_frame, depth_scale, depth_max, depth_diff);
+}
+
+odometry::OdometryResult Model::TrackFrameToModel(
+        const t::geometry::RGBDImagePyramid& input_pyramid,
+        const Frame& raycast_frame,
+        float depth_scale,
+        float depth_max,
+        float depth_diff) {
+    OPEN3D_TRACE_ZONE("slam", "TrackFrameToModel");
     const static core::Tensor identity =
             core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
 
-    // TODO: more customized / optimized
-    return odometry::RGBDOdometryMultiScale(
-            t::geometry::RGBDImage(input_frame.GetDataAsImage("color"),
-                                   input_frame.GetDataAsImage("depth")),
+    t::geometry::RGBDImagePyramid model_pyramid(
             t::geometry::RGBDImage(raycast_frame.GetDataAsImage("color"),
                                    raycast_frame.GetDataAsImage("depth")),
-            raycast_frame.GetIntrinsics(), identity, depth_scale, depth_max,
-            std::vector<odometry::OdometryConvergenceCriteria>{6, 3, 1},
+            raycast_frame.GetIntrinsics(), kNumTrackingLevels, depth_scale,
+            depth_max, depth_diff);
+    return odometry::RGBDOdometryMultiScale(
+            input_pyramid, model_pyramid, identity, tracking_criteria,
             odometry::Method::PointToPlane,
             odometry::OdometryLossParams(depth_diff));
 }
@@ -100,6 +124,7 @@ odometry::OdometryResult Model::TrackFrameToModel(const Frame& input_frame,
 void Model::Integrate(const Frame& input_frame,
                       float depth_scale,
                       float depth_max) {
+    OPEN3D_TRACE_ZONE("slam", "Integrate");
     t::geometry::Image depth = input_frame.GetDataAsImage("depth");
     t::geometry::Image color = input_frame.GetDataAsImage("color");
     core::Tensor intrinsic = input_frame.GetIntrinsics();
@@ -113,11 +138,13 @@ void Model::Integrate(const Frame& input_frame,
 
 t::geometry::PointCloud Model::ExtractPointCloud(int estimated_number,
                                                  float weight_threshold) {
+    OPEN3D_TRACE_ZONE("slam", "ExtractPointCloud");
     return voxel_grid_.ExtractPointCloud(estimated_number, weight_threshold);
 }
 
 t::geometry::TriangleMesh Model::ExtractTriangleMesh(int estimated_number,
                                                      float weight_threshold) {
+    OPEN3D_TRACE_ZONE("slam", "ExtractTriangleMesh");
     return voxel_grid_.ExtractTriangleMesh(estimated_number, weight_threshold);
 }
 
@@ -29,6 +29,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/RGBDImagePyramid.h"
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 #include "open3d/t/pipelines/slam/Frame.h"
@@ -87,6 +88,21 @@ public:
                                                float depth_max,
                                                float depth_diff);
 
+    /// Track using PointToPlane depth odometry, with the input frame already
+    /// preprocessed, e.g. ahead of time in a pipelined system.
+    /// \param input_pyramid Pyramid of the input RGBD frame with
+    /// kNumTrackingLevels levels.
+    /// \param raycast_frame RGBD frame generated by raycasting.
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation to discard points far away from the
+    /// camera.
+    odometry::OdometryResult TrackFrameToModel(
+            const t::geometry::RGBDImagePyramid& input_pyramid,
+            const Frame& raycast_frame,
+            float depth_scale,
+            float depth_max,
+            float depth_diff);
+
     /// Integrate RGBD frame into the volumetric voxel grid.
     /// \param input_frame Input RGBD frame.
     /// \param depth_scale Scale factor to convert raw data into meter metric.
@@ -118,6 +134,9 @@ public:
     core::HashMap GetHashMap();
 
 public:
+    /// Number of pyramid levels used in TrackFrameToModel.
+    static constexpr int64_t kNumTrackingLevels = 3;
+
     /// Maintained volumetric map.
     t::geometry::VoxelBlockGrid voxel_grid_;
     core::Tensor frustum_block_coords_;
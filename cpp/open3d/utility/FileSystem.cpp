@@ -108,6 +108,24 @@ std::string GetWorkingDirectory() {
     return std::string(buff);
 }
 
+std::string GetTempDirectoryPath() {
+#ifdef WINDOWS
+    char buff[MAX_PATH + 1];
+    const DWORD length = GetTempPathA(MAX_PATH + 1, buff);
+    std::string directory =
+            length > 0 && length <= MAX_PATH ? std::string(buff, length) : ".";
+#else
+    const char *tmpdir = std::getenv("TMPDIR");
+    std::string directory =
+            tmpdir != nullptr && tmpdir[0] != '\0' ? tmpdir : "/tmp";
+#endif
+    while (directory.size() > 1 &&
+           (directory.back() == '/' || directory.back() == '\\')) {
+        directory.pop_back();
+    }
+    return directory;
+}
+
 std::vector<std::string> GetPathComponents(const std::string &path) {
     auto SplitByPathSeparators = [](const std::string &path) {
         std::vector<std::string> components;
@@ -46,6 +46,10 @@ std::string GetRegularizedDirectoryName(const std::string &directory);
 
 std::string GetWorkingDirectory();
 
+/// \brief Returns the directory for temporary files, without a trailing
+/// separator: TMPDIR, or /tmp, on POSIX and GetTempPath on Windows.
+std::string GetTempDirectoryPath();
+
 std::vector<std::string> GetPathComponents(const std::string &path);
 
 bool ChangeWorkingDirectory(const std::string &directory);
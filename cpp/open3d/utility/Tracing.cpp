@@ -0,0 +1,350 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Tracing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// Single-writer ring buffer owned by one thread.
+struct ThreadBuffer {
+    ThreadBuffer(size_t capacity, uint32_t thread_id, uint64_t generation)
+        : events_(capacity),
+          head_(0),
+          thread_id_(thread_id),
+          generation_(generation) {}
+
+    void Push(const TraceEvent& event) {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        events_[head % events_.size()] = event;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    std::vector<TraceEvent> events_;
+    /// Total number of events pushed so far.
+    std::atomic<uint64_t> head_;
+    const uint32_t thread_id_;
+    const uint64_t generation_;
+};
+
+std::string EscapeJSON(const char* str) {
+    std::string escaped;
+    for (const char* c = str; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            escaped += '\\';
+            escaped += *c;
+        } else if ((unsigned char)*c < 0x20) {
+            escaped += fmt::format("\\u{:04x}", (int)*c);
+        } else {
+            escaped += *c;
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+struct Tracer::Impl {
+    ThreadBuffer& GetThreadBuffer() {
+        static std::atomic<uint32_t> next_thread_id(0);
+        thread_local const uint32_t thread_id = next_thread_id++;
+        thread_local std::shared_ptr<ThreadBuffer> buffer;
+
+        // A new generation starts on every Enable() and Clear(); the buffer of
+        // the previous generation is simply dropped by its owner.
+        const uint64_t generation = generation_.load(std::memory_order_acquire);
+        if (!buffer || buffer->generation_ != generation) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffer = std::make_shared<ThreadBuffer>(
+                    capacity_, thread_id,
+                    generation_.load(std::memory_order_relaxed));
+            buffers_.push_back(buffer);
+        }
+        return *buffer;
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> generation_{0};
+    const std::chrono::steady_clock::time_point epoch_ =
+            std::chrono::steady_clock::now();
+    /// Guards buffers_ and capacity_.
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    size_t capacity_ = 1 << 16;
+};
+
+Tracer::Tracer() : impl_(new Tracer::Impl()) {}
+
+Tracer::~Tracer() {}
+
+Tracer& Tracer::GetInstance() {
+    static Tracer instance;
+    return instance;
+}
+
+void Tracer::Enable(size_t events_per_thread /* = 1 << 16 */) {
+    if (events_per_thread == 0) {
+        utility::LogError("events_per_thread must be positive.");
+    }
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    impl_->capacity_ = events_per_thread;
+    impl_->buffers_.clear();
+    impl_->generation_++;
+    impl_->enabled_.store(true, std::memory_order_release);
+}
+
+void Tracer::Disable() {
+    impl_->enabled_.store(false, std::memory_order_release);
+}
+
+bool Tracer::IsEnabled() const {
+    return impl_->enabled_.load(std::memory_order_relaxed);
+}
+
+void Tracer::Clear() {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    impl_->buffers_.clear();
+    impl_->generation_++;
+}
+
+int64_t Tracer::Now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - impl_->epoch_)
+            .count();
+}
+
+void Tracer::RecordZone(const char* category,
+                        const char* name,
+                        int64_t start_ns) {
+    if (!IsEnabled()) {
+        return;
+    }
+    TraceEvent event;
+    event.type_ = TraceEvent::Type::Zone;
+    event.category_ = category;
+    event.name_ = name;
+    event.timestamp_ns_ = start_ns;
+    event.duration_ns_ = Now() - start_ns;
+    ThreadBuffer& buffer = impl_->GetThreadBuffer();
+    event.thread_id_ = buffer.thread_id_;
+    buffer.Push(event);
+}
+
+void Tracer::RecordCounter(const char* category,
+                           const char* name,
+                           double value) {
+    if (!IsEnabled()) {
+        return;
+    }
+    TraceEvent event;
+    event.type_ = TraceEvent::Type::Counter;
+    event.category_ = category;
+    event.name_ = name;
+    event.timestamp_ns_ = Now();
+    event.value_ = value;
+    ThreadBuffer& buffer = impl_->GetThreadBuffer();
+    event.thread_id_ = buffer.thread_id_;
+    buffer.Push(event);
+}
+
+void Tracer::RecordMalloc(const char* device_name,
+                          int device_id,
+                          const void* ptr,
+                          size_t byte_size) {
+    if (!IsEnabled()) {
+        return;
+    }
+    TraceEvent event;
+    event.type_ = TraceEvent::Type::Malloc;
+    event.category_ = "memory";
+    event.name_ = device_name;
+    event.timestamp_ns_ = Now();
+    event.value_ = (double)byte_size;
+    event.address_ = (uint64_t)(uintptr_t)ptr;
+    event.device_id_ = device_id;
+    ThreadBuffer& buffer = impl_->GetThreadBuffer();
+    event.thread_id_ = buffer.thread_id_;
+    buffer.Push(event);
+}
+
+void Tracer::RecordFree(const char* device_name,
+                        int device_id,
+                        const void* ptr) {
+    if (!IsEnabled()) {
+        return;
+    }
+    TraceEvent event;
+    event.type_ = TraceEvent::Type::Free;
+    event.category_ = "memory";
+    event.name_ = device_name;
+    event.timestamp_ns_ = Now();
+    event.address_ = (uint64_t)(uintptr_t)ptr;
+    event.device_id_ = device_id;
+    ThreadBuffer& buffer = impl_->GetThreadBuffer();
+    event.thread_id_ = buffer.thread_id_;
+    buffer.Push(event);
+}
+
+std::vector<TraceEvent> Tracer::GetEvents() const {
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        for (const auto& buffer : impl_->buffers_) {
+            const uint64_t head = buffer->head_.load(std::memory_order_acquire);
+            const uint64_t capacity = buffer->events_.size();
+            const uint64_t begin = head > capacity ? head - capacity : 0;
+            for (uint64_t i = begin; i < head; ++i) {
+                events.push_back(buffer->events_[i % capacity]);
+            }
+        }
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const TraceEvent& a, const TraceEvent& b) {
+                         return a.timestamp_ns_ < b.timestamp_ns_;
+                     });
+    return events;
+}
+
+size_t Tracer::GetNumDroppedEvents() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    size_t num_dropped = 0;
+    for (const auto& buffer : impl_->buffers_) {
+        const uint64_t head = buffer->head_.load(std::memory_order_acquire);
+        const uint64_t capacity = buffer->events_.size();
+        num_dropped += head > capacity ? (size_t)(head - capacity) : 0;
+    }
+    return num_dropped;
+}
+
+std::string Tracer::ToChromeTraceJSON() const {
+    const std::vector<TraceEvent> events = GetEvents();
+
+    std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    auto append = [&json, &first](const std::string& record) {
+        if (!first) json += ",\n";
+        json += record;
+        first = false;
+    };
+
+    std::set<uint32_t> thread_ids;
+    for (const TraceEvent& event : events) {
+        thread_ids.insert(event.thread_id_);
+    }
+    for (uint32_t thread_id : thread_ids) {
+        append(fmt::format(
+                "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                "\"tid\":{},\"args\":{{\"name\":\"Thread {}\"}}}}",
+                thread_id, thread_id));
+    }
+
+    // Bytes of live allocations, keyed by device and address.
+    std::map<std::pair<std::string, uint64_t>, double> live_allocations;
+    std::map<std::string, double> allocated_bytes;
+    for (const TraceEvent& event : events) {
+        const double ts = event.timestamp_ns_ / 1000.0;
+        const std::string category = EscapeJSON(event.category_);
+        const std::string name = EscapeJSON(event.name_);
+        switch (event.type_) {
+            case TraceEvent::Type::Zone:
+                append(fmt::format(
+                        "{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\","
+                        "\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}",
+                        name, category, ts, event.duration_ns_ / 1000.0,
+                        event.thread_id_));
+                break;
+            case TraceEvent::Type::Counter:
+                append(fmt::format(
+                        "{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"C\","
+                        "\"ts\":{:.3f},\"pid\":0,\"tid\":{},"
+                        "\"args\":{{\"value\":{}}}}}",
+                        name, category, ts, event.thread_id_, event.value_));
+                break;
+            case TraceEvent::Type::Malloc:
+            case TraceEvent::Type::Free: {
+                const std::string device =
+                        fmt::format("{}:{}", name, event.device_id_);
+                const auto key = std::make_pair(device, event.address_);
+                double bytes = event.value_;
+                if (event.type_ == TraceEvent::Type::Malloc) {
+                    live_allocations[key] = bytes;
+                    allocated_bytes[device] += bytes;
+                } else {
+                    auto it = live_allocations.find(key);
+                    // Allocated before tracing was enabled, or dropped.
+                    bytes = it == live_allocations.end() ? 0.0 : it->second;
+                    if (it != live_allocations.end()) {
+                        live_allocations.erase(it);
+                    }
+                    allocated_bytes[device] -= bytes;
+                }
+                append(fmt::format(
+                        "{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"i\","
+                        "\"s\":\"t\",\"ts\":{:.3f},\"pid\":0,\"tid\":{},"
+                        "\"args\":{{\"device\":\"{}\",\"bytes\":{},"
+                        "\"address\":\"{:#x}\"}}}}",
+                        event.type_ == TraceEvent::Type::Malloc ? "Malloc"
+                                                                : "Free",
+                        category, ts, event.thread_id_, device, bytes,
+                        event.address_));
+                append(fmt::format(
+                        "{{\"name\":\"Allocated bytes {}\",\"cat\":\"{}\","
+                        "\"ph\":\"C\",\"ts\":{:.3f},\"pid\":0,"
+                        "\"args\":{{\"bytes\":{}}}}}",
+                        device, category, ts, allocated_bytes[device]));
+                break;
+            }
+        }
+    }
+    json += "]}\n";
+    return json;
+}
+
+bool Tracer::WriteChromeTrace(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        utility::LogWarning("Failed to open {} for writing.", filename);
+        return false;
+    }
+    file << ToChromeTraceJSON();
+    return file.good();
+}
+
+}  // namespace utility
+}  // namespace open3d
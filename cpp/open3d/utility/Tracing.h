@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/Preprocessor.h"
+
+namespace open3d {
+namespace utility {
+
+/// \brief A single record of the tracer.
+///
+/// \p category_ and \p name_ must point to strings with static storage
+/// duration (e.g. string literals), since only the pointers are recorded.
+struct TraceEvent {
+    enum class Type : uint8_t {
+        Zone = 0,     ///< Timed scope: [timestamp_ns_, + duration_ns_).
+        Counter = 1,  ///< Sampled value_ of a named counter.
+        Malloc = 2,   ///< Allocation of value_ bytes at address_.
+        Free = 3,     ///< Release of the allocation at address_.
+    };
+
+    Type type_ = Type::Zone;
+    const char* category_ = "";
+    const char* name_ = "";
+    /// Nanoseconds since the tracer was created.
+    int64_t timestamp_ns_ = 0;
+    int64_t duration_ns_ = 0;
+    double value_ = 0.0;
+    uint64_t address_ = 0;
+    /// Device index for memory events.
+    int32_t device_id_ = 0;
+    /// Sequential id of the recording thread.
+    uint32_t thread_id_ = 0;
+};
+
+/// \class Tracer
+///
+/// \brief Low-overhead, process-wide tracer for pipeline stages.
+///
+/// Every thread records into its own fixed-size ring buffer, so recording is
+/// lock-free; once a buffer is full the oldest events are overwritten. The
+/// tracer starts disabled, in which case recording costs one relaxed atomic
+/// load. The OPEN3D_TRACE_* macros used to instrument Open3D are compiled out
+/// unless the library is built with BUILD_TRACING=ON; the functions of this
+/// class are always available.
+///
+/// Collection and export are meant to be called while no traced work is
+/// running; events recorded concurrently may be missed or torn.
+class Tracer {
+public:
+    static Tracer& GetInstance();
+
+    ~Tracer();
+    Tracer(const Tracer&) = delete;
+    void operator=(const Tracer&) = delete;
+
+    /// Starts recording, keeping at most \p events_per_thread events per
+    /// thread. Previously recorded events are discarded.
+    void Enable(size_t events_per_thread = 1 << 16);
+
+    /// Stops recording. Recorded events are kept until Clear() or Enable().
+    void Disable();
+
+    bool IsEnabled() const;
+
+    /// Discards all recorded events.
+    void Clear();
+
+    /// Nanoseconds since the tracer was created.
+    int64_t Now() const;
+
+    /// Records a zone that started at \p start_ns (see Now()) and ends now.
+    void RecordZone(const char* category, const char* name, int64_t start_ns);
+
+    /// Records the current value of a counter.
+    void RecordCounter(const char* category, const char* name, double value);
+
+    /// Records an allocation of \p byte_size bytes on \p device_name:device_id.
+    void RecordMalloc(const char* device_name,
+                      int device_id,
+                      const void* ptr,
+                      size_t byte_size);
+
+    /// Records the release of \p ptr on \p device_name:device_id.
+    void RecordFree(const char* device_name, int device_id, const void* ptr);
+
+    /// Returns all buffered events of all threads, sorted by timestamp.
+    std::vector<TraceEvent> GetEvents() const;
+
+    /// Number of events that were overwritten because a ring buffer was full.
+    size_t GetNumDroppedEvents() const;
+
+    /// Serializes the buffered events in the Chrome trace event JSON format,
+    /// which can be opened in chrome://tracing and https://ui.perfetto.dev.
+    /// Memory events are exported as instant events plus a per-device
+    /// "allocated bytes" counter track.
+    std::string ToChromeTraceJSON() const;
+
+    /// Writes ToChromeTraceJSON() to \p filename. Returns false on failure.
+    bool WriteChromeTrace(const std::string& filename) const;
+
+private:
+    Tracer();
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \class ScopedTraceZone
+///
+/// \brief Records a zone covering the lifetime of the object.
+class ScopedTraceZone {
+public:
+    ScopedTraceZone(const char* category, const char* name)
+        : category_(category), name_(name), enabled_(false), start_ns_(0) {
+        Tracer& tracer = Tracer::GetInstance();
+        if (tracer.IsEnabled()) {
+            enabled_ = true;
+            start_ns_ = tracer.Now();
+        }
+    }
+
+    ~ScopedTraceZone() {
+        if (enabled_) {
+            Tracer::GetInstance().RecordZone(category_, name_, start_ns_);
+        }
+    }
+
+    ScopedTraceZone(const ScopedTraceZone&) = delete;
+    ScopedTraceZone& operator=(const ScopedTraceZone&) = delete;
+
+private:
+    const char* category_;
+    const char* name_;
+    bool enabled_;
+    int64_t start_ns_;
+};
+
+}  // namespace utility
+}  // namespace open3d
+
+/// OPEN3D_TRACE_ZONE(category, name)
+///
+/// Records a zone from this statement to the end of the enclosing scope.
+/// Both arguments must be string literals.
+///
+/// OPEN3D_TRACE_COUNTER(category, name, value)
+///
+/// Records the current value of a counter.
+#ifdef BUILD_TRACING
+#define OPEN3D_TRACE_ZONE(category, name)             \
+    ::open3d::utility::ScopedTraceZone OPEN3D_CONCAT( \
+            open3d_trace_zone_, __LINE__)(category, name)
+#define OPEN3D_TRACE_COUNTER(category, name, value)                        \
+    do {                                                                   \
+        ::open3d::utility::Tracer& open3d_tracer_ =                        \
+                ::open3d::utility::Tracer::GetInstance();                  \
+        if (open3d_tracer_.IsEnabled()) {                                  \
+            open3d_tracer_.RecordCounter(category, name, (double)(value)); \
+        }                                                                  \
+    } while (0)
+#else
+#define OPEN3D_TRACE_ZONE(category, name)
+#define OPEN3D_TRACE_COUNTER(category, name, value)
+#endif
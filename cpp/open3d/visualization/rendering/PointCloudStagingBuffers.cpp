@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudStagingBuffers.h"
+
+#include <atomic>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+constexpr int kNumAttributes = 3;
+
+struct Slot {
+    std::vector<float> data;
+    std::atomic<bool> in_flight{false};
+};
+
+/// Owns what an upload needs until the renderer releases it: a slot, a buffer
+/// allocated because all slots were in flight, or the zero-copy tensor.
+struct Ticket {
+    std::shared_ptr<Slot> slot;
+    std::vector<float> buffer;
+    core::Tensor tensor;
+};
+
+void ReleaseUpload(void* buffer, size_t size, void* user) {
+    Ticket* ticket = static_cast<Ticket*>(user);
+    if (ticket->slot) {
+        ticket->slot->in_flight = false;
+    }
+    delete ticket;
+}
+
+/// \brief Converts \p num_points rows of \p src_components values to floats
+/// scaled by \p scale, written with a stride of \p dst_components. Missing
+/// components are zero.
+template <typename scalar_t>
+void ConvertRows(const scalar_t* src,
+                 int src_components,
+                 float* dst,
+                 int dst_components,
+                 int64_t num_points,
+                 float scale) {
+    if (src_components == dst_components) {
+        const int64_t num_values = num_points * dst_components;
+#pragma omp parallel for simd schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_values; ++i) {
+            dst[i] = float(src[i]) * scale;
+        }
+        return;
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int c = 0; c < dst_components; ++c) {
+            dst[i * dst_components + c] =
+                    c < src_components
+                            ? float(src[i * src_components + c]) * scale
+                            : 0.f;
+        }
+    }
+}
+
+bool IsScalarUV(const core::Tensor& values) {
+    return values.NumDims() == 1 ||
+           (values.NumDims() == 2 && values.GetShape(1) == 1);
+}
+
+}  // namespace
+
+struct PointCloudStagingBuffers::Pool {
+    std::vector<std::shared_ptr<Slot>> slots[kNumAttributes];
+    int next_slot[kNumAttributes] = {0, 0, 0};
+    int64_t num_allocations = 0;
+};
+
+PointCloudStagingBuffers::PointCloudStagingBuffers(int num_slots)
+    : pool_(std::make_shared<Pool>()) {
+    if (num_slots < 0) {
+        utility::LogError("num_slots {} must be non-negative.", num_slots);
+    }
+    for (auto& slots : pool_->slots) {
+        for (int i = 0; i < num_slots; ++i) {
+            slots.push_back(std::make_shared<Slot>());
+        }
+    }
+}
+
+PointCloudStagingBuffers::~PointCloudStagingBuffers() {}
+
+int PointCloudStagingBuffers::NumComponents(Attribute attribute) {
+    return attribute == Attribute::UV ? 2 : 3;
+}
+
+PointCloudStagingBuffers::Upload PointCloudStagingBuffers::Stage(
+        Attribute attribute, const core::Tensor& values) {
+    const int components = NumComponents(attribute);
+    const bool is_uv_scalar = attribute == Attribute::UV && IsScalarUV(values);
+    if (!is_uv_scalar &&
+        (values.NumDims() != 2 || values.GetShape(1) != components)) {
+        utility::LogError("Expected values of shape (N, {}), but got {}.",
+                          components, values.GetShape());
+    }
+    const int64_t num_points = values.GetLength();
+    std::unique_ptr<Ticket> ticket(new Ticket());
+    Upload upload;
+    upload.size = num_points * components * sizeof(float);
+    if (!is_uv_scalar && values.GetDtype() == core::Float32 &&
+        values.GetDevice().GetType() == core::Device::DeviceType::CPU &&
+        values.IsContiguous()) {
+        ticket->tensor = values;
+        upload.data = const_cast<void*>(values.GetDataPtr());
+    } else {
+        float* dst = nullptr;
+        auto& slots = pool_->slots[int(attribute)];
+        int& next_slot = pool_->next_slot[int(attribute)];
+        const size_t num_floats = num_points * components;
+        for (size_t i = 0; i < slots.size() && !dst; ++i) {
+            auto& slot = slots[(next_slot + i) % slots.size()];
+            bool expected = false;
+            if (slot->in_flight.compare_exchange_strong(expected, true)) {
+                next_slot = int((next_slot + i + 1) % slots.size());
+                if (slot->data.capacity() < num_floats) {
+                    ++pool_->num_allocations;
+                }
+                slot->data.resize(num_floats);
+                ticket->slot = slot;
+                dst = slot->data.data();
+            }
+        }
+        if (!dst) {
+            ++pool_->num_allocations;
+            ticket->buffer.resize(num_floats);
+            dst = ticket->buffer.data();
+        }
+        Convert(attribute, values, dst);
+        upload.data = dst;
+    }
+    upload.callback = ReleaseUpload;
+    upload.user = ticket.release();
+    return upload;
+}
+
+PointCloudStagingBuffers::Upload PointCloudStagingBuffers::StageConstant(
+        Attribute attribute, int64_t num_points, float value) {
+    return Stage(attribute, core::Tensor::Full({num_points,
+                                                NumComponents(attribute)},
+                                               value, core::Float32));
+}
+
+int PointCloudStagingBuffers::NumSlotsInFlight() const {
+    int count = 0;
+    for (const auto& slots : pool_->slots) {
+        for (const auto& slot : slots) {
+            count += slot->in_flight ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+int64_t PointCloudStagingBuffers::NumAllocations() const {
+    return pool_->num_allocations;
+}
+
+void PointCloudStagingBuffers::Convert(Attribute attribute,
+                                       const core::Tensor& values,
+                                       float* dst) {
+    const int64_t num_points = values.GetLength();
+    if (num_points == 0) {
+        return;
+    }
+    // Contiguous CPU values are converted in place, others are gathered
+    // first.
+    const core::Tensor src = values.To(core::Device("CPU:0")).Contiguous();
+    const int src_components = src.NumDims() == 1 ? 1 : int(src.GetShape(1));
+    float scale = 1.f;
+    if (attribute == Attribute::Colors && src.GetDtype() == core::UInt8) {
+        scale = 1.f / 255;
+    } else if (attribute == Attribute::Colors &&
+               src.GetDtype() == core::UInt16) {
+        scale = 1.f / 65535;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        ConvertRows(src.GetDataPtr<scalar_t>(), src_components, dst,
+                    NumComponents(attribute), num_points, scale);
+    });
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
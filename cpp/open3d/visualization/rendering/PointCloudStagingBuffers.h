@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// \class PointCloudStagingBuffers
+///
+/// \brief Persistent host buffers holding point cloud attributes in the
+/// layout of the point cloud vertex buffers, for repeated uploads.
+///
+/// Every attribute has a ring of slots that are reused across updates. A slot
+/// is in flight from Stage until the renderer calls the release callback of
+/// its upload, and Stage takes the next free slot. If all slots are in flight
+/// a new buffer is allocated for the upload, so the caller never waits for
+/// the renderer.
+///
+/// Contiguous Float32 CPU tensors already in the vertex layout are handed to
+/// the renderer without a copy. The upload keeps a reference to the tensor
+/// until it is released. Other tensors are converted into a slot in one
+/// parallel pass; CUDA tensors are copied to the host first.
+///
+/// Uploads can outlive the PointCloudStagingBuffers that created them. This
+/// class does not depend on Filament, so it can be tested and benchmarked
+/// without a display.
+class PointCloudStagingBuffers {
+public:
+    /// Attributes staged for the vertex buffers. Normals are converted to
+    /// tangent frames by the renderer.
+    enum class Attribute { Positions, Colors, UV };
+
+    /// Release callback, with the signature of Filament BufferDescriptor
+    /// callbacks.
+    using Callback = void (*)(void* buffer, size_t size, void* user);
+
+    /// \brief A host buffer ready for upload. The renderer must call
+    /// callback(data, size, user) exactly once, after it has consumed the
+    /// buffer.
+    struct Upload {
+        void* data = nullptr;
+        size_t size = 0;
+        Callback callback = nullptr;
+        void* user = nullptr;
+    };
+
+public:
+    /// \param num_slots Number of reused buffers per attribute.
+    explicit PointCloudStagingBuffers(int num_slots = 3);
+    ~PointCloudStagingBuffers();
+
+    PointCloudStagingBuffers(const PointCloudStagingBuffers&) = delete;
+    PointCloudStagingBuffers& operator=(const PointCloudStagingBuffers&) =
+            delete;
+
+    /// Number of floats per point of an attribute.
+    static int NumComponents(Attribute attribute);
+
+    /// \brief Stages the values of an attribute for upload.
+    ///
+    /// \param attribute The attribute to stage.
+    /// \param values (N, 3) positions or colors of any float dtype, or UInt8
+    /// or UInt16 colors that are normalized to [0, 1]. For UV, (N, 2) texture
+    /// coordinates or (N,) or (N, 1) scalars that are stored as (scalar, 0).
+    Upload Stage(Attribute attribute, const core::Tensor& values);
+
+    /// Stages \p value for every component of \p num_points points.
+    Upload StageConstant(Attribute attribute, int64_t num_points, float value);
+
+    /// Number of slots of all attributes that are in flight.
+    int NumSlotsInFlight() const;
+
+    /// Number of buffers allocated so far, by growing a slot or because all
+    /// slots were in flight.
+    int64_t NumAllocations() const;
+
+    /// \brief Converts attribute values to the packed Float32 vertex layout.
+    ///
+    /// \param dst Output array of NumComponents(attribute) * N floats.
+    static void Convert(Attribute attribute,
+                        const core::Tensor& values,
+                        float* dst);
+
+private:
+    struct Pool;
+    std::shared_ptr<Pool> pool_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
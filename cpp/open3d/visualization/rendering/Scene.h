@@ -106,6 +106,13 @@ public:
     virtual void UpdateGeometry(const std::string& object_name,
                                 const t::geometry::PointCloud& point_cloud,
                                 uint32_t update_flags) = 0;
+    /// Updates the flagged arrays of the points [offset, offset + N) of a
+    /// point cloud geometry from the N points of \p point_cloud. Only this
+    /// range is converted and uploaded.
+    virtual void UpdateGeometryRange(const std::string& object_name,
+                                     const t::geometry::PointCloud& point_cloud,
+                                     uint32_t update_flags,
+                                     size_t offset) = 0;
     virtual void RemoveGeometry(const std::string& object_name) = 0;
     virtual void ShowGeometry(const std::string& object_name, bool show) = 0;
     virtual bool GeometryIsVisible(const std::string& object_name) = 0;
@@ -537,6 +537,24 @@ bool FilamentScene::HasGeometry(const std::string& object_name) const {
 void FilamentScene::UpdateGeometry(const std::string& object_name,
                                    const t::geometry::PointCloud& point_cloud,
                                    uint32_t update_flags) {
+    UpdatePointCloudBuffers(object_name, point_cloud, update_flags, 0, true);
+}
+
+void FilamentScene::UpdateGeometryRange(
+        const std::string& object_name,
+        const t::geometry::PointCloud& point_cloud,
+        uint32_t update_flags,
+        size_t offset) {
+    UpdatePointCloudBuffers(object_name, point_cloud, update_flags, offset,
+                            false);
+}
+
+void FilamentScene::UpdatePointCloudBuffers(
+        const std::string& object_name,
+        const t::geometry::PointCloud& point_cloud,
+        uint32_t update_flags,
+        size_t offset,
+        bool resize) {
     auto geoms = GetGeometry(object_name, false);
     if (!geoms.empty()) {
         // Note: There should only be a single entry in geoms
@@ -552,68 +570,54 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
         // created. If the number of points has changed then it cannot be
         // updated. In that case, you must remove the geometry then add it
         // again.
-        if (n_vertices > vbuf->getVertexCount()) {
+        if (offset + n_vertices > vbuf->getVertexCount()) {
             utility::LogWarning(
                     "Geometry for point cloud {} cannot be updated because the "
                     "number of points exceeds the existing point count (Old: "
-                    "{}, New: {})",
-                    object_name, vbuf->getVertexCount(), n_vertices);
+                    "{}, New: {} at offset {})",
+                    object_name, vbuf->getVertexCount(), n_vertices, offset);
             return;
         }
 
-        bool geometry_update_needed = n_vertices != vbuf->getVertexCount();
-        bool pcloud_is_gpu =
-                points.GetDevice().GetType() == core::Device::DeviceType::CUDA;
-        t::geometry::PointCloud cpu_pcloud;
-        if (pcloud_is_gpu) {
-            cpu_pcloud = point_cloud.To(core::Device("CPU:0"));
+        bool geometry_update_needed =
+                resize && n_vertices != vbuf->getVertexCount();
+        if (!g->staging_buffers) {
+            g->staging_buffers = std::make_shared<PointCloudStagingBuffers>();
         }
+        auto& staging = *g->staging_buffers;
+        using Attribute = PointCloudStagingBuffers::Attribute;
+
+        // Contiguous Float32 CPU arrays are uploaded without a copy, others
+        // are converted into the reused staging buffers. Only the points
+        // starting at offset are written.
+        auto set_buffer = [&](uint8_t buffer_index, Attribute attribute,
+                              const core::Tensor& values) {
+            auto upload = staging.Stage(attribute, values);
+            filament::VertexBuffer::BufferDescriptor descriptor(
+                    upload.data, upload.size, upload.callback, upload.user);
+            const size_t element_size =
+                    PointCloudStagingBuffers::NumComponents(attribute) *
+                    sizeof(float);
+            vbuf->setBufferAt(engine_, buffer_index, std::move(descriptor),
+                              uint32_t(offset * element_size));
+        };
 
         // Update the each of the attribute requested
         if (update_flags & kUpdatePointsFlag) {
-            const size_t vertex_array_size = n_vertices * 3 * sizeof(float);
-            if (pcloud_is_gpu) {
-                auto vertex_data =
-                        static_cast<float*>(malloc(vertex_array_size));
-                memcpy(vertex_data, cpu_pcloud.GetPointPositions().GetDataPtr(),
-                       vertex_array_size);
-                filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                        vertex_data, vertex_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
-            } else {
-                filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                        points.GetDataPtr(), vertex_array_size);
-                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
-            }
+            set_buffer(0, Attribute::Positions, points);
         }
 
         if (update_flags & kUpdateColorsFlag && point_cloud.HasPointColors()) {
-            const size_t color_array_size = n_vertices * 3 * sizeof(float);
-            if (pcloud_is_gpu) {
-                auto color_data = static_cast<float*>(malloc(color_array_size));
-                memcpy(color_data, cpu_pcloud.GetPointPositions().GetDataPtr(),
-                       color_array_size);
-                filament::VertexBuffer::BufferDescriptor color_descriptor(
-                        color_data, color_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
-            } else {
-                filament::VertexBuffer::BufferDescriptor color_descriptor(
-                        point_cloud.GetPointColors().GetDataPtr(),
-                        color_array_size);
-                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
-            }
+            set_buffer(1, Attribute::Colors, point_cloud.GetPointColors());
         }
 
         if (update_flags & kUpdateNormalsFlag &&
             point_cloud.HasPointNormals()) {
             const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-            const void* normal_data = nullptr;
-            if (pcloud_is_gpu) {
-                const auto& normals = point_cloud.GetPointNormals();
-                normal_data = normals.GetDataPtr();
-            } else {
-                normal_data = cpu_pcloud.GetPointNormals().GetDataPtr();
-            }
+            const auto normals = point_cloud.GetPointNormals()
+                                         .To(core::Device("CPU:0"))
+                                         .To(core::Float32)
+                                         .Contiguous();
 
             // Converting normals to Filament type - quaternions
             auto float4v_tangents = static_cast<filament::math::quatf*>(
@@ -622,37 +626,24 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
                                        .vertexCount(n_vertices)
                                        .normals(reinterpret_cast<
                                                 const filament::math::float3*>(
-                                               normal_data))
+                                               normals.GetDataPtr()))
                                        .build();
             orientation->getQuats(float4v_tangents, n_vertices);
             filament::VertexBuffer::BufferDescriptor normals_descriptor(
                     float4v_tangents, normal_array_size, DeallocateBuffer);
-            vbuf->setBufferAt(engine_, 2, std::move(normals_descriptor));
+            vbuf->setBufferAt(engine_, 2, std::move(normals_descriptor),
+                              uint32_t(offset * 4 * sizeof(float)));
             delete orientation;
         }
 
         if (update_flags & kUpdateUv0Flag) {
-            const size_t uv_array_size = n_vertices * 2 * sizeof(float);
+            // Update in PointCloudBuffers.cpp, too:
+            //     TPointCloudBuffersBuilder::ConstructBuffers
             if (point_cloud.HasPointAttr("uv")) {
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        point_cloud.GetPointAttr("uv").GetDataPtr(),
-                        uv_array_size);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
+                set_buffer(3, Attribute::UV, point_cloud.GetPointAttr("uv"));
             } else if (point_cloud.HasPointAttr("__visualization_scalar")) {
-                // Update in PointCloudBuffers.cpp, too:
-                //     TPointCloudBuffersBuilder::ConstructBuffers
-                float* uv_array = static_cast<float*>(malloc(uv_array_size));
-                memset(uv_array, 0, uv_array_size);
-                const float* src = static_cast<const float*>(
-                        point_cloud.GetPointAttr("__visualization_scalar")
-                                .GetDataPtr());
-                const size_t n = 2 * n_vertices;
-                for (size_t i = 0; i < n; i += 2) {
-                    uv_array[i] = *src++;
-                }
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        uv_array, uv_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
+                set_buffer(3, Attribute::UV,
+                           point_cloud.GetPointAttr("__visualization_scalar"));
             }
         }
 
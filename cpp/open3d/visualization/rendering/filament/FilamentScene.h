@@ -54,6 +54,7 @@
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/visualization/rendering/Camera.h"
 #include "open3d/visualization/rendering/MaterialRecord.h"
+#include "open3d/visualization/rendering/PointCloudStagingBuffers.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 #include "open3d/visualization/rendering/Scene.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
@@ -127,6 +128,10 @@ public:
     void UpdateGeometry(const std::string& object_name,
                         const t::geometry::PointCloud& point_cloud,
                         uint32_t update_flags) override;
+    void UpdateGeometryRange(const std::string& object_name,
+                             const t::geometry::PointCloud& point_cloud,
+                             uint32_t update_flags,
+                             size_t offset) override;
     void RemoveGeometry(const std::string& object_name) override;
     void ShowGeometry(const std::string& object_name, bool show) override;
     bool GeometryIsVisible(const std::string& object_name) override;
@@ -290,6 +295,8 @@ private:
         filament::RenderableManager::PrimitiveType primitive_type;
         VertexBufferHandle vb;
         IndexBufferHandle ib;
+        // Reused by point cloud updates, created by the first update
+        std::shared_ptr<PointCloudStagingBuffers> staging_buffers;
         void ReleaseResources(filament::Engine& engine,
                               FilamentResourceManager& manager);
     };
@@ -316,6 +323,11 @@ private:
                                   const MaterialRecord& material,
                                   bool shader_only = false);
     void UpdateMaterialProperties(RenderableGeometry& geom);
+    void UpdatePointCloudBuffers(const std::string& object_name,
+                                 const t::geometry::PointCloud& point_cloud,
+                                 uint32_t update_flags,
+                                 size_t offset,
+                                 bool resize);
     void UpdateDefaultLit(GeometryMaterialInstance& geom_mi);
     void UpdateDefaultLitSSR(GeometryMaterialInstance& geom_mi);
     void UpdateDefaultUnlit(GeometryMaterialInstance& geom_mi);
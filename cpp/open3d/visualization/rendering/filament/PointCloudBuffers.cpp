@@ -47,6 +47,7 @@
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/visualization/rendering/PointCloudStagingBuffers.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
@@ -387,32 +388,23 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
         return {};
     }
 
-    const size_t vertex_array_size = n_vertices * 3 * sizeof(float);
-    float* vertex_array = static_cast<float*>(malloc(vertex_array_size));
-    memcpy(vertex_array, points.GetDataPtr(), vertex_array_size);
-    VertexBuffer::BufferDescriptor pts_descriptor(
-            vertex_array, vertex_array_size,
-            GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 0, std::move(pts_descriptor));
-
-    const size_t color_array_size = n_vertices * 3 * sizeof(float);
+    // Points and colors are Float32 on CPU, so they are handed to Filament
+    // without a copy. The uploads keep the tensors alive until released.
+    PointCloudStagingBuffers staging(0);
+    using Attribute = PointCloudStagingBuffers::Attribute;
+    auto set_buffer = [&](uint8_t buffer_index,
+                          const PointCloudStagingBuffers::Upload& upload) {
+        VertexBuffer::BufferDescriptor descriptor(upload.data, upload.size,
+                                                  upload.callback, upload.user);
+        vbuf->setBufferAt(engine, buffer_index, std::move(descriptor));
+    };
+    set_buffer(0, staging.Stage(Attribute::Positions, points));
     if (geometry_.HasPointColors()) {
-        float* color_array = static_cast<float*>(malloc(color_array_size));
-        memcpy(color_array, geometry_.GetPointColors().GetDataPtr(),
-               color_array_size);
-        VertexBuffer::BufferDescriptor color_descriptor(
-                color_array, color_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
+        set_buffer(1, staging.Stage(Attribute::Colors,
+                                    geometry_.GetPointColors()));
     } else {
-        float* color_array = static_cast<float*>(malloc(color_array_size));
-        for (size_t i = 0; i < n_vertices * 3; ++i) {
-            color_array[i] = 1.f;
-        }
-        VertexBuffer::BufferDescriptor color_descriptor(
-                color_array, color_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
+        set_buffer(1, staging.StageConstant(Attribute::Colors, n_vertices,
+                                            1.f));
     }
 
     const size_t normal_array_size = n_vertices * 4 * sizeof(float);
@@ -448,27 +440,17 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
         vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
     }
 
-    const size_t uv_array_size = n_vertices * 2 * sizeof(float);
-    float* uv_array = static_cast<float*>(malloc(uv_array_size));
     if (geometry_.HasPointAttr("uv")) {
-        const float* uv_src = static_cast<const float*>(
-                geometry_.GetPointAttr("uv").GetDataPtr());
-        memcpy(uv_array, uv_src, uv_array_size);
+        set_buffer(3,
+                   staging.Stage(Attribute::UV, geometry_.GetPointAttr("uv")));
     } else if (geometry_.HasPointAttr("__visualization_scalar")) {
         // Update in FilamentScene::UpdateGeometry(), too.
-        memset(uv_array, 0, uv_array_size);
-        const float* src = static_cast<const float*>(
-                geometry_.GetPointAttr("__visualization_scalar").GetDataPtr());
-        const size_t n = 2 * n_vertices;
-        for (size_t i = 0; i < n; i += 2) {
-            uv_array[i] = *src++;
-        }
+        set_buffer(3, staging.Stage(Attribute::UV,
+                                    geometry_.GetPointAttr(
+                                            "__visualization_scalar")));
     } else {
-        memset(uv_array, 0, uv_array_size);
+        set_buffer(3, staging.StageConstant(Attribute::UV, n_vertices, 0.f));
     }
-    VertexBuffer::BufferDescriptor uv_descriptor(
-            uv_array, uv_array_size, GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 3, std::move(uv_descriptor));
 
     auto ib_handle = CreateIndexBuffer(n_vertices);
 
@@ -0,0 +1,620 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/utility/PointCloudLOD.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "open3d/geometry/LinearOctree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace {
+
+constexpr char kMagic[8] = {'O', '3', 'D', 'L', 'O', 'D', '\0', '\0'};
+constexpr uint32_t kVersion = 1;
+
+int PopCount(uint8_t mask) {
+    int count = 0;
+    for (; mask; mask &= mask - 1) ++count;
+    return count;
+}
+
+/// Min bound of the child of child index \p child of a cube.
+Eigen::Vector3d ChildOrigin(const Eigen::Vector3d &origin,
+                            double size,
+                            int child) {
+    return origin + Eigen::Vector3d(child & 1, (child >> 1) & 1,
+                                    (child >> 2) & 1) *
+                            (size / 2);
+}
+
+/// Appends the children of \p node in \p child_mask to \p nodes.
+void AddChildren(std::vector<PointCloudLOD::Node> &nodes,
+                 int node,
+                 uint8_t child_mask) {
+    nodes[node].child_mask_ = child_mask;
+    if (child_mask == 0) {
+        return;
+    }
+    nodes[node].first_child_ = int(nodes.size());
+    for (int child = 0; child < 8; ++child) {
+        if (child_mask & (1 << child)) {
+            const PointCloudLOD::Node &parent = nodes[node];
+            PointCloudLOD::Node child_node;
+            child_node.origin_ =
+                    ChildOrigin(parent.origin_, parent.size_, child);
+            child_node.size_ = parent.size_ / 2;
+            child_node.depth_ = parent.depth_ + 1;
+            child_node.parent_ = node;
+            child_node.first_child_ = -1;
+            child_node.child_mask_ = 0;
+            child_node.offset_ = 0;
+            child_node.num_points_ = 0;
+            nodes.push_back(child_node);
+        }
+    }
+}
+
+PointCloudLOD::Node CreateRoot(const Eigen::Vector3d &origin, double size) {
+    PointCloudLOD::Node root;
+    root.origin_ = origin;
+    root.size_ = size;
+    root.depth_ = 0;
+    root.parent_ = -1;
+    root.first_child_ = -1;
+    root.child_mask_ = 0;
+    root.offset_ = 0;
+    root.num_points_ = 0;
+    return root;
+}
+
+/// \brief Takes the points of a node of the linear octree not taken by its
+/// ancestors: all of them for a leaf, else the point nearest to the center of
+/// every occupied cell at \p cell_depth.
+///
+/// \return The child mask of the children with remaining points.
+uint8_t SampleNode(const geometry::LinearOctree &octree,
+                   const std::vector<uint64_t> &codes,
+                   int linear_node,
+                   int depth,
+                   int sample_depth,
+                   int max_leaf_points,
+                   std::vector<uint8_t> &taken,
+                   std::vector<int> &samples) {
+    const int begin = octree.node_point_begin_[linear_node];
+    const int end = octree.node_point_end_[linear_node];
+    int num_remaining = 0;
+    for (int i = begin; i < end; ++i) {
+        num_remaining += taken[i] ? 0 : 1;
+    }
+    if (octree.node_first_child_[linear_node] < 0 ||
+        num_remaining <= max_leaf_points) {
+        for (int i = begin; i < end; ++i) {
+            if (!taken[i]) {
+                taken[i] = 1;
+                samples.push_back(i);
+            }
+        }
+        return 0;
+    }
+
+    // The points of a cell are a run of equal code prefixes.
+    const int max_depth = int(octree.max_depth_);
+    const int cell_depth = std::min(depth + sample_depth, max_depth);
+    const int shift = 3 * (max_depth - cell_depth);
+    const double cell_size = octree.size_ / double(uint64_t(1) << cell_depth);
+    for (int run_begin = begin; run_begin < end;) {
+        const uint64_t cell = codes[run_begin] >> shift;
+        int run_end = run_begin + 1;
+        while (run_end < end && codes[run_end] >> shift == cell) {
+            ++run_end;
+        }
+        const Eigen::Array3d cell_index =
+                ((octree.points_[run_begin] - octree.origin_) / cell_size)
+                        .array()
+                        .floor();
+        const Eigen::Vector3d center =
+                octree.origin_ + ((cell_index + 0.5) * cell_size).matrix();
+        int best = -1;
+        double best_distance2 = std::numeric_limits<double>::infinity();
+        for (int i = run_begin; i < run_end; ++i) {
+            if (taken[i]) continue;
+            const double distance2 = (octree.points_[i] - center).squaredNorm();
+            if (distance2 < best_distance2) {
+                best = i;
+                best_distance2 = distance2;
+            }
+        }
+        if (best >= 0) {
+            taken[best] = 1;
+            samples.push_back(best);
+        }
+        run_begin = run_end;
+    }
+
+    uint8_t child_mask = 0;
+    const int first_child = octree.node_first_child_[linear_node];
+    const int num_children = PopCount(octree.node_child_masks_[linear_node]);
+    for (int child = first_child; child < first_child + num_children;
+         ++child) {
+        for (int i = octree.node_point_begin_[child];
+             i < octree.node_point_end_[child]; ++i) {
+            if (!taken[i]) {
+                child_mask |= uint8_t(1 << (octree.node_codes_[child] & 7));
+                break;
+            }
+        }
+    }
+    return child_mask;
+}
+
+template <typename T>
+void WriteBinary(std::ofstream &file, const T &value) {
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadBinary(std::ifstream &file, T &value) {
+    return bool(file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+/// Bytes per point in the file: 3 floats and 3 color channels, if any.
+int64_t PointStride(bool has_colors) {
+    return 3 * sizeof(float) + (has_colors ? 3 : 0);
+}
+
+}  // namespace
+
+std::shared_ptr<PointCloudLOD> PointCloudLOD::CreateFromPointCloud(
+        const geometry::PointCloud &point_cloud,
+        int sample_depth,
+        int max_leaf_points,
+        int max_depth) {
+    if (sample_depth < 0) {
+        utility::LogError("sample_depth {} must be non-negative.",
+                          sample_depth);
+    }
+    if (max_leaf_points < 0) {
+        utility::LogError("max_leaf_points {} must be non-negative.",
+                          max_leaf_points);
+    }
+    if (max_depth < 0 || max_depth > int(geometry::LinearOctree::kMaxDepth)) {
+        utility::LogError("max_depth {} must be in [0, {}].", max_depth,
+                          geometry::LinearOctree::kMaxDepth);
+    }
+    auto lod = std::make_shared<PointCloudLOD>();
+    geometry::LinearOctree octree(max_depth);
+    octree.ConvertFromPointCloud(point_cloud);
+    if (octree.IsEmpty()) {
+        return lod;
+    }
+    lod->origin_ = octree.origin_;
+    lod->size_ = octree.size_;
+    lod->has_colors_ = !octree.colors_.empty();
+
+    // Leaf cell code of every point, in Morton order.
+    std::vector<uint64_t> codes(octree.points_.size());
+    const int num_linear_nodes = int(octree.NumNodes());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int node = octree.level_offsets_[max_depth]; node < num_linear_nodes;
+         ++node) {
+        for (int i = octree.node_point_begin_[node];
+             i < octree.node_point_end_[node]; ++i) {
+            codes[i] = octree.node_codes_[node];
+        }
+    }
+
+    // Sample the nodes level by level from the root. The nodes of a level have
+    // disjoint point ranges, so they are sampled in parallel.
+    std::vector<uint8_t> taken(octree.points_.size(), 0);
+    std::vector<std::vector<int>> node_samples;
+    std::vector<int> level(1, 0);
+    lod->nodes_.push_back(CreateRoot(lod->origin_, lod->size_));
+    while (!level.empty()) {
+        const int level_begin = int(node_samples.size());
+        const int level_size = int(level.size());
+        node_samples.resize(level_begin + level_size);
+        std::vector<uint8_t> child_masks(level_size);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < level_size; ++i) {
+            const int node = level_begin + i;
+            child_masks[i] = SampleNode(octree, codes, level[i],
+                                        lod->nodes_[node].depth_, sample_depth,
+                                        max_leaf_points, taken,
+                                        node_samples[node]);
+        }
+
+        std::vector<int> next_level;
+        for (int i = 0; i < level_size; ++i) {
+            AddChildren(lod->nodes_, level_begin + i, child_masks[i]);
+            const int first_child = octree.node_first_child_[level[i]];
+            const int num_children =
+                    PopCount(octree.node_child_masks_[level[i]]);
+            for (int child = first_child; child < first_child + num_children;
+                 ++child) {
+                if (child_masks[i] & (1 << (octree.node_codes_[child] & 7))) {
+                    next_level.push_back(child);
+                }
+            }
+        }
+        level.swap(next_level);
+    }
+
+    // Gather the points in node order.
+    const int num_nodes = int(lod->nodes_.size());
+    int64_t num_points = 0;
+    for (int node = 0; node < num_nodes; ++node) {
+        lod->nodes_[node].offset_ = num_points;
+        lod->nodes_[node].num_points_ = int64_t(node_samples[node].size());
+        num_points += lod->nodes_[node].num_points_;
+    }
+    lod->points_.resize(num_points);
+    if (lod->has_colors_) {
+        lod->colors_.resize(num_points);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int node = 0; node < num_nodes; ++node) {
+        int64_t offset = lod->nodes_[node].offset_;
+        for (int i : node_samples[node]) {
+            lod->points_[offset] = octree.points_[i];
+            if (lod->has_colors_) {
+                lod->colors_[offset] = octree.colors_[i];
+            }
+            ++offset;
+        }
+    }
+    return lod;
+}
+
+std::shared_ptr<PointCloudLOD> PointCloudLOD::Open(
+        const std::string &filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        utility::LogWarning("Read PointCloudLOD failed: unable to open {}.",
+                            filename);
+        return nullptr;
+    }
+    char magic[sizeof(kMagic)];
+    uint32_t version = 0;
+    auto lod = std::make_shared<PointCloudLOD>();
+    uint8_t has_colors = 0;
+    int64_t num_nodes = 0;
+    if (!file.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !ReadBinary(file, version) || version != kVersion) {
+        utility::LogWarning("Read PointCloudLOD failed: {} is not a level of "
+                            "detail file.",
+                            filename);
+        return nullptr;
+    }
+    if (!ReadBinary(file, lod->origin_(0)) ||
+        !ReadBinary(file, lod->origin_(1)) ||
+        !ReadBinary(file, lod->origin_(2)) || !ReadBinary(file, lod->size_) ||
+        !ReadBinary(file, has_colors) || !ReadBinary(file, num_nodes) ||
+        num_nodes < 0) {
+        utility::LogWarning("Read PointCloudLOD failed: bad header in {}.",
+                            filename);
+        return nullptr;
+    }
+    lod->has_colors_ = has_colors != 0;
+
+    // Validate the counts against the file size before allocating for them.
+    const int64_t table_offset = int64_t(file.tellg());
+    file.seekg(0, std::ios::end);
+    const int64_t file_size = int64_t(file.tellg());
+    file.seekg(table_offset);
+    const int64_t node_bytes = 1 + int64_t(sizeof(int64_t));
+    if (num_nodes > (file_size - table_offset) / node_bytes) {
+        utility::LogWarning("Read PointCloudLOD failed: {} is shorter than "
+                            "its header.",
+                            filename);
+        return nullptr;
+    }
+    lod->data_offset_ = table_offset + num_nodes * node_bytes;
+    const int64_t max_points =
+            (file_size - lod->data_offset_) / PointStride(lod->has_colors_);
+
+    std::vector<uint8_t> child_masks(num_nodes);
+    std::vector<int64_t> num_points(num_nodes);
+    if (!file.read(reinterpret_cast<char *>(child_masks.data()), num_nodes) ||
+        !file.read(reinterpret_cast<char *>(num_points.data()),
+                   num_nodes * sizeof(int64_t))) {
+        utility::LogWarning("Read PointCloudLOD failed: truncated node table "
+                            "in {}.",
+                            filename);
+        return nullptr;
+    }
+    if (num_nodes > 0) {
+        lod->nodes_.push_back(CreateRoot(lod->origin_, lod->size_));
+    }
+    int64_t total_points = 0;
+    for (int64_t node = 0; node < int64_t(lod->nodes_.size()); ++node) {
+        if (lod->nodes_.size() + PopCount(child_masks[node]) >
+                    size_t(num_nodes) ||
+            num_points[node] < 0) {
+            utility::LogWarning("Read PointCloudLOD failed: inconsistent "
+                                "node table in {}.",
+                                filename);
+            return nullptr;
+        }
+        if (num_points[node] > max_points - total_points) {
+            utility::LogWarning("Read PointCloudLOD failed: truncated points "
+                                "in {}.",
+                                filename);
+            return nullptr;
+        }
+        AddChildren(lod->nodes_, int(node), child_masks[node]);
+        lod->nodes_[node].offset_ = total_points;
+        lod->nodes_[node].num_points_ = num_points[node];
+        total_points += num_points[node];
+    }
+    if (int64_t(lod->nodes_.size()) != num_nodes) {
+        utility::LogWarning("Read PointCloudLOD failed: inconsistent node "
+                            "table in {}.",
+                            filename);
+        return nullptr;
+    }
+    lod->filename_ = filename;
+    return lod;
+}
+
+bool PointCloudLOD::WriteToFile(const std::string &filename) const {
+    // A hierarchy opened from filename reads its points back from it, so write
+    // to a temporary file and move it into place once it is complete.
+    const std::string tmp_filename = filename + ".tmp";
+    std::ofstream file(tmp_filename, std::ios::binary);
+    if (!file) {
+        utility::LogWarning("Write PointCloudLOD failed: unable to open {}.",
+                            tmp_filename);
+        return false;
+    }
+    file.write(kMagic, sizeof(kMagic));
+    WriteBinary(file, kVersion);
+    WriteBinary(file, origin_(0));
+    WriteBinary(file, origin_(1));
+    WriteBinary(file, origin_(2));
+    WriteBinary(file, size_);
+    WriteBinary(file, uint8_t(has_colors_ ? 1 : 0));
+    WriteBinary(file, int64_t(nodes_.size()));
+    for (const Node &node : nodes_) {
+        WriteBinary(file, node.child_mask_);
+    }
+    for (const Node &node : nodes_) {
+        WriteBinary(file, node.num_points_);
+    }
+
+    // One chunk of points per node.
+    std::vector<char> chunk;
+    const int64_t stride = PointStride(has_colors_);
+    for (int node = 0; node < int(nodes_.size()); ++node) {
+        auto pcd = LoadNode(node);
+        if (!pcd) {
+            file.close();
+            utility::filesystem::RemoveFile(tmp_filename);
+            return false;
+        }
+        chunk.resize(pcd->points_.size() * stride);
+        char *data = chunk.data();
+        for (size_t i = 0; i < pcd->points_.size(); ++i) {
+            const Eigen::Vector3f point =
+                    (pcd->points_[i] - origin_).cast<float>();
+            std::memcpy(data, point.data(), 3 * sizeof(float));
+            data += 3 * sizeof(float);
+            if (has_colors_) {
+                for (int c = 0; c < 3; ++c) {
+                    *data++ = char(uint8_t(std::round(
+                            std::min(std::max(pcd->colors_[i](c), 0.0), 1.0) *
+                            255)));
+                }
+            }
+        }
+        file.write(chunk.data(), chunk.size());
+    }
+    file.close();
+    if (!file) {
+        utility::LogWarning("Write PointCloudLOD failed: unable to write {}.",
+                            tmp_filename);
+        utility::filesystem::RemoveFile(tmp_filename);
+        return false;
+    }
+    // std::rename does not replace an existing file on Windows.
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0 &&
+        (!utility::filesystem::RemoveFile(filename) ||
+         std::rename(tmp_filename.c_str(), filename.c_str()) != 0)) {
+        utility::LogWarning("Write PointCloudLOD failed: unable to move {} to "
+                            "{}.",
+                            tmp_filename, filename);
+        utility::filesystem::RemoveFile(tmp_filename);
+        return false;
+    }
+    return true;
+}
+
+int64_t PointCloudLOD::NumPoints() const {
+    int64_t num_points = 0;
+    for (const Node &node : nodes_) {
+        num_points += node.num_points_;
+    }
+    return num_points;
+}
+
+std::shared_ptr<geometry::PointCloud> PointCloudLOD::LoadNode(int node) const {
+    if (node < 0 || node >= int(nodes_.size())) {
+        utility::LogError("Node {} is out of range [0, {}).", node,
+                          nodes_.size());
+    }
+    const int64_t offset = nodes_[node].offset_;
+    const int64_t num_points = nodes_[node].num_points_;
+    auto pcd = std::make_shared<geometry::PointCloud>();
+    if (IsLoaded()) {
+        pcd->points_.assign(points_.begin() + offset,
+                            points_.begin() + offset + num_points);
+        if (has_colors_) {
+            pcd->colors_.assign(colors_.begin() + offset,
+                                colors_.begin() + offset + num_points);
+        }
+        return pcd;
+    }
+
+    const int64_t stride = PointStride(has_colors_);
+    std::vector<char> chunk(num_points * stride);
+    std::ifstream file(filename_, std::ios::binary);
+    file.seekg(data_offset_ + offset * stride);
+    if (!file || !file.read(chunk.data(), chunk.size())) {
+        utility::LogWarning("Read PointCloudLOD failed: unable to read node "
+                            "{} from {}.",
+                            node, filename_);
+        return nullptr;
+    }
+    pcd->points_.resize(num_points);
+    if (has_colors_) {
+        pcd->colors_.resize(num_points);
+    }
+    const char *data = chunk.data();
+    for (int64_t i = 0; i < num_points; ++i) {
+        Eigen::Vector3f point;
+        std::memcpy(point.data(), data, 3 * sizeof(float));
+        data += 3 * sizeof(float);
+        pcd->points_[i] = origin_ + point.cast<double>();
+        if (has_colors_) {
+            for (int c = 0; c < 3; ++c) {
+                pcd->colors_[i](c) = uint8_t(*data++) / 255.0;
+            }
+        }
+    }
+    return pcd;
+}
+
+std::shared_ptr<geometry::PointCloud> PointCloudLOD::LoadNodes(
+        const std::vector<int> &nodes) const {
+    auto pcd = std::make_shared<geometry::PointCloud>();
+    for (int node : nodes) {
+        auto node_pcd = LoadNode(node);
+        if (node_pcd) {
+            *pcd += *node_pcd;
+        }
+    }
+    return pcd;
+}
+
+std::vector<int> PointCloudLOD::SelectNodes(
+        const Eigen::Matrix4d &view_projection,
+        int viewport_height,
+        int64_t point_budget,
+        double min_node_size) const {
+    std::vector<int> selected;
+    if (nodes_.empty() || point_budget <= 0) {
+        return selected;
+    }
+
+    // Frustum planes from the rows of the matrix, with the inside at
+    // plane.dot(point) >= 0.
+    const Eigen::RowVector4d r0 = view_projection.row(0);
+    const Eigen::RowVector4d r1 = view_projection.row(1);
+    const Eigen::RowVector4d r2 = view_projection.row(2);
+    const Eigen::RowVector4d r3 = view_projection.row(3);
+    const std::array<Eigen::RowVector4d, 6> planes = {
+            r3 + r0, r3 - r0, r3 + r1, r3 - r1, r3 + r2, r3 - r2};
+    auto is_visible = [&](const Node &node) {
+        for (const Eigen::RowVector4d &plane : planes) {
+            // The corner of the cube furthest along the plane normal.
+            Eigen::Vector4d corner(node.origin_(0), node.origin_(1),
+                                   node.origin_(2), 1);
+            for (int c = 0; c < 3; ++c) {
+                corner(c) += plane(c) > 0 ? node.size_ : 0;
+            }
+            if (plane.dot(corner) < 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Projected radius of the bounding sphere of a node, in pixels. The scale
+    // of clip y per world unit is the norm of the second row.
+    const double pixels_per_unit =
+            r1.head<3>().norm() * double(viewport_height) / 2;
+    const double w_per_unit = r3.head<3>().norm();
+    auto projected_size = [&](const Node &node) {
+        const double radius = node.size_ * std::sqrt(3.0) / 2;
+        const Eigen::Vector4d center(node.origin_(0) + node.size_ / 2,
+                                     node.origin_(1) + node.size_ / 2,
+                                     node.origin_(2) + node.size_ / 2, 1);
+        const double w = r3.dot(center);
+        if (w <= radius * w_per_unit) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return radius * pixels_per_unit / w;
+    };
+
+    std::priority_queue<std::pair<double, int>> queue;
+    if (is_visible(nodes_[0])) {
+        queue.emplace(projected_size(nodes_[0]), 0);
+    }
+    int64_t num_points = 0;
+    while (!queue.empty()) {
+        const double size = queue.top().first;
+        const int node = queue.top().second;
+        queue.pop();
+        if (num_points + nodes_[node].num_points_ > point_budget) {
+            break;
+        }
+        num_points += nodes_[node].num_points_;
+        selected.push_back(node);
+        if (size < min_node_size || nodes_[node].first_child_ < 0) {
+            continue;
+        }
+        const int first_child = nodes_[node].first_child_;
+        const int num_children = PopCount(nodes_[node].child_mask_);
+        for (int child = first_child; child < first_child + num_children;
+             ++child) {
+            if (is_visible(nodes_[child])) {
+                queue.emplace(projected_size(nodes_[child]), child);
+            }
+        }
+    }
+    return selected;
+}
+
+}  // namespace visualization
+}  // namespace open3d
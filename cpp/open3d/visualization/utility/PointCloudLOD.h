@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}  // namespace geometry
+
+namespace visualization {
+
+/// \class PointCloudLOD
+///
+/// \brief Level of detail hierarchy of a point cloud for streaming rendering.
+///
+/// Like Potree, every node of an octree holds a subsample of the points in
+/// its cube, at most one point per cell of a grid of 2^sample_depth cells per
+/// axis. Every point is stored in exactly one node: the points taken by a node
+/// are removed from its descendants, so a node together with its ancestors is
+/// a level of detail of its cube. Nodes with few enough remaining points are
+/// leaves and keep all of them.
+///
+/// The nodes are stored in breadth-first order, with the children of a node
+/// stored contiguously. The points of every node are a chunk of the file
+/// written by WriteToFile, so a hierarchy opened with Open only reads the node
+/// table and LoadNode reads the chunk of a node on demand. Together with
+/// SelectNodes, a renderer only needs to hold the visible nodes in memory.
+class PointCloudLOD {
+public:
+    /// \brief A node of the hierarchy.
+    struct Node {
+        /// Min bound of the cube of the node.
+        Eigen::Vector3d origin_;
+        /// Edge size of the cube of the node.
+        double size_;
+        /// Depth of the node, 0 for the root.
+        int depth_;
+        /// Index of the parent node, or -1 for the root.
+        int parent_;
+        /// Index of the first child, or -1 for leaves.
+        int first_child_;
+        /// Bit i is set if the node has the child of child index i, i.e.
+        /// x + 2 * y + 4 * z, like geometry::Octree.
+        uint8_t child_mask_;
+        /// Index of the first point of the node in the chunk stream.
+        int64_t offset_;
+        /// Number of points of the node.
+        int64_t num_points_;
+    };
+
+public:
+    PointCloudLOD() : origin_(0, 0, 0), size_(0), has_colors_(false) {}
+    ~PointCloudLOD() {}
+
+public:
+    /// \brief Builds the hierarchy of a point cloud. The points are sorted with
+    /// geometry::LinearOctree, and the nodes are sampled from the root down
+    /// in parallel.
+    ///
+    /// \param point_cloud Input point cloud. Its colors are kept, if any.
+    /// \param sample_depth A node keeps at most one point per cell of a grid
+    /// of 2^sample_depth cells per axis.
+    /// \param max_leaf_points A node with at most this many remaining points
+    /// is a leaf.
+    /// \param max_depth Max depth of the hierarchy, at most 21. Nodes at this
+    /// depth are leaves regardless of max_leaf_points.
+    static std::shared_ptr<PointCloudLOD> CreateFromPointCloud(
+            const geometry::PointCloud &point_cloud,
+            int sample_depth = 7,
+            int max_leaf_points = 20000,
+            int max_depth = 12);
+
+    /// \brief Opens a hierarchy written by WriteToFile. Only the node table is
+    /// read, the points are read by LoadNode.
+    ///
+    /// \return nullptr if the file cannot be read.
+    static std::shared_ptr<PointCloudLOD> Open(const std::string &filename);
+
+    /// \brief Writes the hierarchy to a chunked binary file.
+    ///
+    /// Points are stored as float offsets from origin_, and colors as 8 bit
+    /// channels. The file is written to filename + ".tmp" and then moved into
+    /// place, so a hierarchy opened from \p filename can be written back to it.
+    bool WriteToFile(const std::string &filename) const;
+
+    /// Returns true if the hierarchy has no nodes.
+    bool IsEmpty() const { return nodes_.empty(); }
+
+    /// Number of nodes.
+    size_t NumNodes() const { return nodes_.size(); }
+
+    /// Total number of points over all nodes.
+    int64_t NumPoints() const;
+
+    /// Returns true if the points have colors.
+    bool HasColors() const { return has_colors_; }
+
+    /// Returns true if the points are held in memory, false if they are read
+    /// from the file on demand.
+    bool IsLoaded() const { return filename_.empty(); }
+
+    /// \brief Returns the points of a node, from memory or read from the file.
+    /// Can be called from multiple threads.
+    std::shared_ptr<geometry::PointCloud> LoadNode(int node) const;
+
+    /// Returns the points of several nodes merged into one point cloud.
+    std::shared_ptr<geometry::PointCloud> LoadNodes(
+            const std::vector<int> &nodes) const;
+
+    /// \brief Selects the nodes to render for a view, with a budget of points.
+    ///
+    /// Starting from the root, the visible nodes are refined in order of
+    /// decreasing projected size until the budget is reached. A node is only
+    /// selected after its parent, so the selected nodes are a connected top
+    /// part of the tree.
+    ///
+    /// \param view_projection The world to clip space matrix, i.e. the
+    /// projection matrix times the view matrix, with OpenGL clip conventions.
+    /// \param viewport_height Height of the viewport in pixels.
+    /// \param point_budget Max total number of points of the selected nodes.
+    /// \param min_node_size Nodes with a smaller projected size in pixels are
+    /// not refined.
+    /// \return The selected node indices, parents before children.
+    std::vector<int> SelectNodes(const Eigen::Matrix4d &view_projection,
+                                 int viewport_height,
+                                 int64_t point_budget,
+                                 double min_node_size = 0) const;
+
+public:
+    /// Min bound of the root cube.
+    Eigen::Vector3d origin_;
+    /// Edge size of the root cube.
+    double size_;
+    /// Nodes in breadth-first order.
+    std::vector<Node> nodes_;
+    /// Points of all nodes, in node order. Empty if opened from a file.
+    std::vector<Eigen::Vector3d> points_;
+    /// Colors of the points, or empty.
+    std::vector<Eigen::Vector3d> colors_;
+
+private:
+    bool has_colors_;
+    /// File the points are read from, empty if they are in memory.
+    std::string filename_;
+    /// Byte offset of the first point in filename_.
+    int64_t data_offset_ = 0;
+};
+
+}  // namespace visualization
+}  // namespace open3d
@@ -29,6 +29,8 @@
 #include <sstream>
 #include <unordered_map>
 
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "pybind/docstring.h"
@@ -361,6 +363,93 @@ void pybind_octree(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "Octree", "create_from_voxel_grid",
             {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
+
+    // LinearOctree
+    py::class_<LinearOctree, std::shared_ptr<LinearOctree>> linear_octree(
+            m, "LinearOctree",
+            "Pointerless octree with the nodes stored in breadth-first order, "
+            "built by a parallel sort of the Morton codes of the points.");
+    py::detail::bind_default_constructor<LinearOctree>(linear_octree);
+    py::detail::bind_copy_functions<LinearOctree>(linear_octree);
+    linear_octree
+            .def(py::init([](size_t max_depth) {
+                     return new LinearOctree(max_depth);
+                 }),
+                 "max_depth"_a)
+            .def(py::init([](size_t max_depth, const Eigen::Vector3d &origin,
+                             double size) {
+                     return new LinearOctree(max_depth, origin, size);
+                 }),
+                 "max_depth"_a, "origin"_a, "size"_a)
+            .def("__repr__",
+                 [](const LinearOctree &octree) {
+                     std::ostringstream repr;
+                     repr << "LinearOctree with " << octree.NumNodes()
+                          << " nodes, " << octree.NumPoints() << " points";
+                     repr << ", max_depth: " << octree.max_depth_;
+                     return repr.str();
+                 })
+            .def("convert_from_point_cloud",
+                 &LinearOctree::ConvertFromPointCloud, "point_cloud"_a,
+                 "size_expand"_a = 0.01,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Builds the octree from a point cloud.")
+            .def("is_empty", &LinearOctree::IsEmpty,
+                 "Returns True if the octree has no nodes.")
+            .def("num_nodes", &LinearOctree::NumNodes)
+            .def("num_points", &LinearOctree::NumPoints)
+            .def("get_node_info", &LinearOctree::GetNodeInfo, "node"_a,
+                 "Returns the OctreeNodeInfo of a node index.")
+            .def("get_point_indices", &LinearOctree::GetPointIndices, "node"_a,
+                 "Returns the indices of the points in a node.")
+            .def("locate_leaf_node", &LinearOctree::LocateLeafNode, "point"_a,
+                 "Returns the index of the leaf node of the point, or -1.")
+            .def("locate_leaf_nodes", &LinearOctree::LocateLeafNodes,
+                 "points"_a, py::call_guard<py::gil_scoped_release>(),
+                 "Returns the leaf node index of every point, in parallel.")
+            .def(
+                    "search_knn_vector_3d",
+                    [](const LinearOctree &octree,
+                       const Eigen::Vector3d &query, int knn) {
+                        std::vector<int> indices;
+                        std::vector<double> distance2;
+                        int k = octree.SearchKNN(query, knn, indices,
+                                                 distance2);
+                        return std::make_tuple(k, indices, distance2);
+                    },
+                    "query"_a, "knn"_a)
+            .def(
+                    "search_radius_vector_3d",
+                    [](const LinearOctree &octree,
+                       const Eigen::Vector3d &query, double radius) {
+                        std::vector<int> indices;
+                        std::vector<double> distance2;
+                        int k = octree.SearchRadius(query, radius, indices,
+                                                    distance2);
+                        return std::make_tuple(k, indices, distance2);
+                    },
+                    "query"_a, "radius"_a)
+            .def("search_bounding_box", &LinearOctree::SearchBoundingBox,
+                 "bbox"_a,
+                 "Returns the sorted indices of the points inside the box.")
+            .def("extract_level_of_detail",
+                 &LinearOctree::ExtractLevelOfDetail, "depth"_a,
+                 "Returns one point per node of the given depth, at the "
+                 "centroid of its points.")
+            .def("to_octree", &LinearOctree::ToOctree,
+                 "Converts to a pointer based Octree.")
+            .def_readwrite("origin", &LinearOctree::origin_,
+                           "(3, 1) float numpy array: Global min bound "
+                           "(include).")
+            .def_readwrite("size", &LinearOctree::size_,
+                           "float: Outer bounding box edge size for the whole "
+                           "octree.")
+            .def_readwrite("max_depth", &LinearOctree::max_depth_,
+                           "int: Maximum depth of the octree, at most 21.");
+    docstring::ClassMethodDocInject(m, "LinearOctree", "__init__");
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "convert_from_point_cloud",
+                                    map_octree_argument_docstrings);
 }
 
 void pybind_octree_methods(py::module &m) {}
@@ -344,8 +344,9 @@ void pybind_trianglemesh(py::module &m) {
                     "Ball Pivoting Algorithm\", 2014. The surface "
                     "reconstruction is done by rolling a ball with a given "
                     "radius over the point cloud, whenever the ball touches "
-                    "three points a triangle is created.",
-                    "pcd"_a, "radii"_a)
+                    "three points a triangle is created. Tiles of the point "
+                    "cloud are reconstructed in parallel and then stitched.",
+                    "pcd"_a, "radii"_a, "tile_size"_a = 0.0)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
                         "Function that computes a triangle mesh from a "
@@ -356,6 +357,47 @@ void pybind_trianglemesh(py::module &m) {
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
                         "linear_fit"_a = false, "n_threads"_a = -1)
+            .def_static(
+                    "create_from_point_cloud_poisson_tiled",
+                    py::overload_cast<const PointCloud &, double, size_t, bool,
+                                      int, const std::string &>(
+                            &TriangleMesh::CreateFromPointCloudPoissonTiled),
+                    "Function that computes a triangle mesh from an oriented "
+                    "PointCloud pcd with Screened Poisson Reconstruction on "
+                    "cubic tiles with aligned grids. The tiles are "
+                    "reconstructed one after the other with an overlap, "
+                    "cropped and merged along their common faces.",
+                    "pcd"_a, "tile_size"_a, "depth"_a = 8,
+                    "linear_fit"_a = false, "n_threads"_a = -1,
+                    "scratch_dir"_a = "",
+                    py::call_guard<py::gil_scoped_release>())
+            .def_static(
+                    "create_from_point_cloud_poisson_tiled",
+                    // The chunk is returned by the callable, since a
+                    // PointCloud reference passed to Python is a copy.
+                    [](const py::function &read_chunk, double tile_size,
+                       size_t depth, bool linear_fit, int n_threads,
+                       const std::string &scratch_dir,
+                       size_t max_buffered_points) {
+                        return TriangleMesh::CreateFromPointCloudPoissonTiled(
+                                [&read_chunk](PointCloud &chunk) {
+                                    py::object next = read_chunk();
+                                    if (next.is_none()) {
+                                        return false;
+                                    }
+                                    chunk = next.cast<const PointCloud &>();
+                                    return true;
+                                },
+                                tile_size, depth, linear_fit, n_threads,
+                                scratch_dir, max_buffered_points);
+                    },
+                    "Out-of-core variant that reads the oriented points in "
+                    "chunks: read_chunk returns the next chunk as a "
+                    "PointCloud, or None when there are no more points. The "
+                    "points are spilled to one file per tile in scratch_dir.",
+                    "read_chunk"_a, "tile_size"_a, "depth"_a = 8,
+                    "linear_fit"_a = false, "n_threads"_a = -1,
+                    "scratch_dir"_a = "", "max_buffered_points"_a = 1 << 22)
             .def_static("create_box", &TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -675,7 +717,13 @@ void pybind_trianglemesh(py::module &m) {
               "reconstructed. Has to contain normals."},
              {"radii",
               "The radii of the ball that are used for the surface "
-              "reconstruction."}});
+              "reconstruction."},
+             {"tile_size",
+              "Side length of the tiles that are reconstructed in parallel. "
+              "0 or a negative value uses 50 times the largest radius. "
+              "Otherwise it has to be at least 4 times the largest radius. "
+              "The seams between tiles may be triangulated differently than "
+              "by a single pass."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
             {{"pcd",
@@ -700,6 +748,31 @@ void pybind_trianglemesh(py::module &m) {
              {"n_threads",
               "Number of threads used for reconstruction. Set to -1 to "
               "automatically determine it."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_poisson_tiled",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed. Has to contain normals."},
+             {"read_chunk",
+              "Callable without arguments that returns the next chunk of "
+              "points with normals as a PointCloud, or None at the end. Either "
+              "all chunks have colors or none."},
+             {"tile_size", "Side length of the cubic tiles."},
+             {"depth",
+              "Depth of the octree of each tile. The grid spacing is "
+              "tile_size / (0.75 * 2^depth)."},
+             {"linear_fit",
+              "If true, the reconstructor will use linear interpolation to "
+              "estimate the positions of iso-vertices."},
+             {"n_threads",
+              "Number of threads used for the reconstruction of a tile. Set "
+              "to -1 to automatically determine it."},
+             {"scratch_dir",
+              "Directory of the temporary tile files. The system temporary "
+              "directory if empty."},
+             {"max_buffered_points",
+              "Number of points held in memory before they are appended to "
+              "the tile files."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_box",
             {{"width", "x-directional length."},
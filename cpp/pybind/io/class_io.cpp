@@ -318,6 +318,26 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_octree",
                                  map_shared_argument_docstrings);
 
+    // open3d::geometry::LinearOctree
+    m_io.def(
+            "read_linear_octree",
+            [](const std::string &filename) {
+                py::gil_scoped_release release;
+                geometry::LinearOctree octree;
+                ReadLinearOctree(filename, octree);
+                return octree;
+            },
+            "Function to read LinearOctree from a binary file", "filename"_a);
+    m_io.def(
+            "write_linear_octree",
+            [](const std::string &filename,
+               const geometry::LinearOctree &octree) {
+                py::gil_scoped_release release;
+                return WriteLinearOctree(filename, octree);
+            },
+            "Function to write LinearOctree to a compact binary file",
+            "filename"_a, "octree"_a);
+
     // open3d::camera
     m_io.def(
             "read_pinhole_camera_intrinsic",
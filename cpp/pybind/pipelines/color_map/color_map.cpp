@@ -104,7 +104,12 @@ void pybind_color_map_options(py::module &m) {
             {"debug_output_dir",
              "If specified, the intermediate results will be stored in in the "
              "debug output dir. Existing files will be overwritten if the "
-             "names are the same."}};
+             "names are the same."},
+            {"use_raycasting_visibility",
+             "bool: (Default ``False``) If ``True``, visibility is computed by "
+             "raycasting the mesh once per camera, which rejects vertices "
+             "occluded by the mesh and scales with the number of pixels "
+             "instead of the number of vertices."}};
 
     py::class_<pipelines::color_map::RigidOptimizerOption>
             rigid_optimizer_option(m, "RigidOptimizerOption",
@@ -116,7 +121,8 @@ void pybind_color_map_options(py::module &m) {
                         int half_dilation_kernel_size_for_discontinuity_map,
                         int image_boundary_margin,
                         int invisible_vertex_color_knn,
-                        const std::string &debug_output_dir) {
+                        const std::string &debug_output_dir,
+                        bool use_raycasting_visibility) {
                 auto option = new pipelines::color_map::RigidOptimizerOption;
                 option->maximum_iteration_ = maximum_iteration;
                 option->maximum_allowable_depth_ = maximum_allowable_depth;
@@ -130,6 +136,7 @@ void pybind_color_map_options(py::module &m) {
                 option->invisible_vertex_color_knn_ =
                         invisible_vertex_color_knn;
                 option->debug_output_dir_ = debug_output_dir;
+                option->use_raycasting_visibility_ = use_raycasting_visibility;
                 return option;
             }),
             "maximum_iteration"_a = 0, "maximum_allowable_depth"_a = 2.5,
@@ -137,7 +144,7 @@ void pybind_color_map_options(py::module &m) {
             "depth_threshold_for_discontinuity_check"_a = 0.1,
             "half_dilation_kernel_size_for_discontinuity_map"_a = 3,
             "image_boundary_margin"_a = 10, "invisible_vertex_color_knn"_a = 3,
-            "debug_output_dir"_a = "");
+            "debug_output_dir"_a = "", "use_raycasting_visibility"_a = false);
 
     docstring::ClassMethodDocInject(m, "RigidOptimizerOption", "__init__",
                                     colormap_docstrings);
@@ -154,7 +161,8 @@ void pybind_color_map_options(py::module &m) {
                         int half_dilation_kernel_size_for_discontinuity_map,
                         int image_boundary_margin,
                         int invisible_vertex_color_knn,
-                        const std::string &debug_output_dir) {
+                        const std::string &debug_output_dir,
+                        bool use_raycasting_visibility) {
                 auto option = new pipelines::color_map::NonRigidOptimizerOption;
                 option->number_of_vertical_anchors_ =
                         number_of_vertical_anchors;
@@ -172,6 +180,7 @@ void pybind_color_map_options(py::module &m) {
                 option->invisible_vertex_color_knn_ =
                         invisible_vertex_color_knn;
                 option->debug_output_dir_ = debug_output_dir;
+                option->use_raycasting_visibility_ = use_raycasting_visibility;
                 return option;
             }),
             "number_of_vertical_anchors"_a = 16,
@@ -181,7 +190,7 @@ void pybind_color_map_options(py::module &m) {
             "depth_threshold_for_discontinuity_check"_a = 0.1,
             "half_dilation_kernel_size_for_discontinuity_map"_a = 3,
             "image_boundary_margin"_a = 10, "invisible_vertex_color_knn"_a = 3,
-            "debug_output_dir"_a = "");
+            "debug_output_dir"_a = "", "use_raycasting_visibility"_a = false);
 
     docstring::ClassMethodDocInject(m, "NonRigidOptimizerOption", "__init__",
                                     colormap_docstrings);
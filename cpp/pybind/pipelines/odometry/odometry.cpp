@@ -174,6 +174,37 @@ Anonymous submission.)");
             "__repr__", [](const RGBDOdometryJacobianFromHybridTerm &te) {
                 return std::string("RGBDOdometryJacobianFromHybridTerm");
             });
+
+    // open3d.odometry.OdometrySession
+    py::class_<OdometrySession> session(
+            m, "OdometrySession",
+            "Persistent RGBD odometry state that caches the preprocessed "
+            "target pyramid between consecutive frames.");
+    session.def(py::init<const camera::PinholeCameraIntrinsic &,
+                         const OdometryOption &>(),
+                "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
+                "option"_a = OdometryOption())
+            .def("set_target", &OdometrySession::SetTarget,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Preprocesses and caches the target RGBD image.",
+                 "rgbd_target"_a)
+            .def("advance_target", &OdometrySession::AdvanceTarget,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Makes the source frame of the last compute call the new "
+                 "target.")
+            .def("has_target", &OdometrySession::HasTarget,
+                 "Returns True if a target frame has been set.")
+            .def("compute", &OdometrySession::Compute,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Estimates 6D rigid motion from the source RGBD image to the "
+                 "cached target. Output: (is_success, 4x4 motion matrix, 6x6 "
+                 "information matrix).",
+                 "rgbd_source"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+                 "jacobian"_a = RGBDOdometryJacobianFromHybridTerm())
+            .def("__repr__", [](const OdometrySession &s) {
+                return std::string("OdometrySession with ") +
+                       (s.HasTarget() ? "a" : "no") + " cached target.";
+            });
 }
 
 void pybind_odometry_methods(py::module &m) {
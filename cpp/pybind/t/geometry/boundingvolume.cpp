@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/BoundingVolume.h"
+
+#include <string>
+
+#include "pybind/docstring.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_boundingvolume(py::module& m) {
+    py::class_<AxisAlignedBoundingBox, PyGeometry<AxisAlignedBoundingBox>,
+               std::shared_ptr<AxisAlignedBoundingBox>, Geometry>
+            aabb(m, "AxisAlignedBoundingBox",
+                 "A bounding box aligned with the coordinate axes. The bounds "
+                 "are Float32 or Float64 tensors of shape (3,).");
+    aabb.def(py::init<const core::Device&>(),
+             "device"_a = core::Device("CPU:0"))
+            .def(py::init<const core::Tensor&, const core::Tensor&>(),
+                 "min_bound"_a, "max_bound"_a)
+            .def("__repr__", &AxisAlignedBoundingBox::ToString);
+    aabb.def_property_readonly("device", &AxisAlignedBoundingBox::GetDevice);
+    aabb.def_property_readonly("dtype", &AxisAlignedBoundingBox::GetDtype);
+    aabb.def("to", &AxisAlignedBoundingBox::To,
+             "Transfer the box to a specified device.", "device"_a,
+             "copy"_a = false);
+    aabb.def("clone", &AxisAlignedBoundingBox::Clone,
+             "Returns copy of the box on the same device.");
+    aabb.def("get_min_bound", &AxisAlignedBoundingBox::GetMinBound);
+    aabb.def("get_max_bound", &AxisAlignedBoundingBox::GetMaxBound);
+    aabb.def("get_center", &AxisAlignedBoundingBox::GetCenter);
+    aabb.def("get_extent", &AxisAlignedBoundingBox::GetExtent);
+    aabb.def("get_half_extent", &AxisAlignedBoundingBox::GetHalfExtent);
+    aabb.def("get_max_extent", &AxisAlignedBoundingBox::GetMaxExtent);
+    aabb.def("volume", &AxisAlignedBoundingBox::Volume);
+    aabb.def("get_box_points", &AxisAlignedBoundingBox::GetBoxPoints,
+             "Returns the eight corners of the box.");
+    aabb.def("get_point_mask_within_bounding_box",
+             &AxisAlignedBoundingBox::GetPointMaskWithinBoundingBox,
+             "Returns a boolean mask of the points inside the box.",
+             "points"_a);
+    aabb.def("get_point_indices_within_bounding_box",
+             &AxisAlignedBoundingBox::GetPointIndicesWithinBoundingBox,
+             "Returns the indices of the points inside the box.", "points"_a);
+    aabb.def_static("create_from_points",
+                    &AxisAlignedBoundingBox::CreateFromPoints,
+                    "Creates the tightest box containing the points.",
+                    "points"_a);
+    aabb.def_static("from_legacy", &AxisAlignedBoundingBox::FromLegacy,
+                    "box"_a, "dtype"_a = core::Float32,
+                    "device"_a = core::Device("CPU:0"),
+                    "Create from a legacy AxisAlignedBoundingBox.");
+    aabb.def("to_legacy", &AxisAlignedBoundingBox::ToLegacy,
+             "Convert to a legacy AxisAlignedBoundingBox.");
+
+    py::class_<OrientedBoundingBox, PyGeometry<OrientedBoundingBox>,
+               std::shared_ptr<OrientedBoundingBox>, Geometry>
+            obb(m, "OrientedBoundingBox",
+                "A bounding box oriented along an arbitrary frame, defined by "
+                "its center, rotation and extent.");
+    obb.def(py::init<const core::Device&>(),
+            "device"_a = core::Device("CPU:0"))
+            .def(py::init<const core::Tensor&, const core::Tensor&,
+                          const core::Tensor&>(),
+                 "center"_a, "rotation"_a, "extent"_a)
+            .def("__repr__", &OrientedBoundingBox::ToString);
+    obb.def_property_readonly("device", &OrientedBoundingBox::GetDevice);
+    obb.def_property_readonly("dtype", &OrientedBoundingBox::GetDtype);
+    obb.def("to", &OrientedBoundingBox::To,
+            "Transfer the box to a specified device.", "device"_a,
+            "copy"_a = false);
+    obb.def("clone", &OrientedBoundingBox::Clone,
+            "Returns copy of the box on the same device.");
+    obb.def("get_center", &OrientedBoundingBox::GetCenter);
+    obb.def("get_rotation", &OrientedBoundingBox::GetRotation);
+    obb.def("get_extent", &OrientedBoundingBox::GetExtent);
+    obb.def("get_half_extent", &OrientedBoundingBox::GetHalfExtent);
+    obb.def("get_min_bound", &OrientedBoundingBox::GetMinBound);
+    obb.def("get_max_bound", &OrientedBoundingBox::GetMaxBound);
+    obb.def("volume", &OrientedBoundingBox::Volume);
+    obb.def("get_box_points", &OrientedBoundingBox::GetBoxPoints,
+            "Returns the eight corners of the box.");
+    obb.def("get_axis_aligned_bounding_box",
+            &OrientedBoundingBox::GetAxisAlignedBoundingBox,
+            "Returns the axis aligned box around this box.");
+    obb.def("get_point_mask_within_bounding_box",
+            &OrientedBoundingBox::GetPointMaskWithinBoundingBox,
+            "Returns a boolean mask of the points inside the box.",
+            "points"_a);
+    obb.def("get_point_indices_within_bounding_box",
+            &OrientedBoundingBox::GetPointIndicesWithinBoundingBox,
+            "Returns the indices of the points inside the box.", "points"_a);
+    obb.def_static("create_from_axis_aligned_bounding_box",
+                   &OrientedBoundingBox::CreateFromAxisAlignedBoundingBox,
+                   "aabb"_a);
+    obb.def_static("create_from_points", &OrientedBoundingBox::CreateFromPoints,
+                   "Creates a box oriented along the principal axes of the "
+                   "points.",
+                   "points"_a);
+    obb.def_static("from_legacy", &OrientedBoundingBox::FromLegacy, "box"_a,
+                   "dtype"_a = core::Float32,
+                   "device"_a = core::Device("CPU:0"),
+                   "Create from a legacy OrientedBoundingBox.");
+    obb.def("to_legacy", &OrientedBoundingBox::ToLegacy,
+            "Convert to a legacy OrientedBoundingBox.");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
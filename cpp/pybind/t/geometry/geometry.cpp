@@ -53,6 +53,7 @@ void pybind_geometry(py::module& m) {
     pybind_geometry_class(m_submodule);
     pybind_drawable_geometry_class(m_submodule);
     pybind_tensormap(m_submodule);
+    pybind_boundingvolume(m_submodule);
     pybind_pointcloud(m_submodule);
     pybind_lineset(m_submodule);
     pybind_trianglemesh(m_submodule);
@@ -60,6 +61,7 @@ void pybind_geometry(py::module& m) {
     pybind_tsdf_voxelgrid(m_submodule);
     pybind_voxel_block_grid(m_submodule);
     pybind_raycasting_scene(m_submodule);
+    pybind_voxelgrid(m_submodule);
 }
 
 }  // namespace geometry
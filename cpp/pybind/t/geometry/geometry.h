@@ -50,6 +50,7 @@ public:
 
 void pybind_geometry(py::module& m);
 void pybind_geometry_class(py::module& m);
+void pybind_boundingvolume(py::module& m);
 void pybind_drawable_geometry_class(py::module& m);
 void pybind_tensormap(py::module& m);
 void pybind_image(py::module& m);
@@ -60,6 +61,7 @@ void pybind_image(py::module& m);
 void pybind_tsdf_voxelgrid(py::module& m);
 void pybind_voxel_block_grid(py::module& m);
 void pybind_raycasting_scene(py::module& m);
+void pybind_voxelgrid(py::module& m);
 
 }  // namespace geometry
 }  // namespace t
@@ -31,6 +31,7 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/RGBDImagePyramid.h"
 #include "pybind/docstring.h"
 #include "pybind/pybind_utils.h"
 #include "pybind/t/geometry/geometry.h"
@@ -326,6 +327,45 @@ void pybind_image(py::module &m) {
     docstring::ClassMethodDocInject(m, "RGBDImage", "to_legacy");
     docstring::ClassMethodDocInject(m, "RGBDImage", "__init__",
                                     map_shared_argument_docstrings);
+
+    py::class_<RGBDImagePyramid> rgbd_image_pyramid(
+            m, "RGBDImagePyramid",
+            "Multi-resolution RGBD frame for multi-scale RGBD odometry, with "
+            "levels from coarse (0) to fine. Depth and vertex maps are "
+            "computed on construction, normal maps, intensity and gradients "
+            "on first access. Copies share the cached levels.");
+    rgbd_image_pyramid
+            .def(py::init<const RGBDImage &, const core::Tensor &, int64_t,
+                          float, float, float>(),
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Parameterized constructor", "rgbd"_a, "intrinsics"_a,
+                 "n_levels"_a = 3, "depth_scale"_a = 1000.0f,
+                 "depth_max"_a = 3.0f, "depth_diff"_a = 0.07f)
+            .def_property_readonly("num_levels",
+                                   &RGBDImagePyramid::GetNumLevels)
+            .def_property_readonly("device", &RGBDImagePyramid::GetDevice)
+            .def("get_intrinsics", &RGBDImagePyramid::GetIntrinsics,
+                 "Float64 intrinsic matrix of a level.", "level"_a)
+            .def("get_depth", &RGBDImagePyramid::GetDepth,
+                 "Depth in meters of a level, invalid pixels are NaN.",
+                 "level"_a)
+            .def("get_vertex_map", &RGBDImagePyramid::GetVertexMap,
+                 "Vertex map of a level.", "level"_a)
+            .def("get_normal_map", &RGBDImagePyramid::GetNormalMap,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Normal map of a level.", "level"_a)
+            .def("get_intensity", &RGBDImagePyramid::GetIntensity,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Float32 intensity of a level.", "level"_a)
+            .def("get_intensity_gradients",
+                 &RGBDImagePyramid::GetIntensityGradients,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Sobel gradients (dx, dy) of the intensity of a level.",
+                 "level"_a)
+            .def("get_depth_gradients", &RGBDImagePyramid::GetDepthGradients,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Sobel gradients (dx, dy) of the depth of a level.",
+                 "level"_a);
 }
 
 }  // namespace geometry
@@ -113,6 +113,17 @@ The attributes of the point cloud have different levels::
     pcd.point["lables"] = o3c.core.Tensor([3, 1, 4], o3d.core.int32, device)
 )");
 
+    py::enum_<PointCloud::VoxelReductionType>(
+            pointcloud, "VoxelReductionType",
+            "Per-voxel attribute reduction used in voxel_down_sample.")
+            .value("Mean", PointCloud::VoxelReductionType::Mean)
+            .value("CentroidNearest",
+                   PointCloud::VoxelReductionType::CentroidNearest)
+            .value("MaxIntensity", PointCloud::VoxelReductionType::MaxIntensity)
+            .value("MajorityLabel",
+                   PointCloud::VoxelReductionType::MajorityLabel)
+            .export_values();
+
     // Constructors.
     pointcloud
             .def(py::init<const core::Device&>(),
@@ -189,6 +200,64 @@ The attributes of the point cloud have different levels::
             },
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
+    pointcloud.def(
+            "voxel_down_sample",
+            [](const PointCloud& pointcloud, const double voxel_size,
+               const PointCloud::VoxelReductionType& reduction) {
+                return pointcloud.VoxelDownSample(
+                        voxel_size, reduction, core::HashBackendType::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Downsamples a point cloud with a specified voxel size, reducing "
+            "all attributes of the points in a voxel with the given "
+            "reduction.",
+            "voxel_size"_a, "reduction"_a);
+
+    pointcloud.def("select_by_mask", &PointCloud::SelectByMask,
+                   "Select points by a boolean mask.", "boolean_mask"_a,
+                   "invert"_a = false);
+    pointcloud.def("select_by_index", &PointCloud::SelectByIndex,
+                   "Select points by their indices.", "indices"_a,
+                   "invert"_a = false, "remove_duplicates"_a = false);
+    pointcloud.def("crop",
+                   py::overload_cast<const AxisAlignedBoundingBox&, bool>(
+                           &PointCloud::Crop, py::const_),
+                   "Crops the point cloud to an axis aligned bounding box.",
+                   "aabb"_a, "invert"_a = false);
+    pointcloud.def("crop",
+                   py::overload_cast<const OrientedBoundingBox&, bool>(
+                           &PointCloud::Crop, py::const_),
+                   "Crops the point cloud to an oriented bounding box.",
+                   "obb"_a, "invert"_a = false);
+    pointcloud.def("get_axis_aligned_bounding_box",
+                   &PointCloud::GetAxisAlignedBoundingBox,
+                   "Returns the axis aligned bounding box of the points.");
+    pointcloud.def("get_oriented_bounding_box",
+                   &PointCloud::GetOrientedBoundingBox,
+                   "Returns an oriented bounding box of the points.");
+    pointcloud.def(
+            "farthest_point_down_sample",
+            [](const PointCloud& pointcloud, int64_t num_samples,
+               int64_t start_index, double voxel_size) {
+                return pointcloud.FarthestPointDownSample(
+                        num_samples, start_index, voxel_size,
+                        core::HashBackendType::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Downsamples a point cloud with farthest point sampling. If "
+            "voxel_size is positive, the sampling runs over one point per "
+            "voxel, which is much faster on large point clouds.",
+            "num_samples"_a, "start_index"_a = 0, "voxel_size"_a = 0.0);
+    pointcloud.def(
+            "poisson_disk_down_sample",
+            [](const PointCloud& pointcloud, double radius) {
+                return pointcloud.PoissonDiskDownSample(
+                        radius, core::HashBackendType::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Downsamples a point cloud with Poisson-disk sampling, such that "
+            "no two kept points are closer than radius.",
+            "radius"_a);
 
     pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
                    py::call_guard<py::gil_scoped_release>(),
@@ -155,6 +155,169 @@ The attributes of the triangle mesh have different levels::
                       "Scale points.");
     triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
                       "Rotate points and normals (if exist).");
+    triangle_mesh.def("select_by_mask", &TriangleMesh::SelectByMask,
+                      "Select vertices by a boolean mask, with the triangles "
+                      "between them.",
+                      "vertex_mask"_a);
+    triangle_mesh.def("select_by_index", &TriangleMesh::SelectByIndex,
+                      "Select vertices by their indices, with the triangles "
+                      "between them.",
+                      "indices"_a);
+    triangle_mesh.def("crop",
+                      py::overload_cast<const AxisAlignedBoundingBox&, bool>(
+                              &TriangleMesh::Crop, py::const_),
+                      "Crops the mesh to an axis aligned bounding box.",
+                      "aabb"_a, "invert"_a = false);
+    triangle_mesh.def("crop",
+                      py::overload_cast<const OrientedBoundingBox&, bool>(
+                              &TriangleMesh::Crop, py::const_),
+                      "Crops the mesh to an oriented bounding box.", "obb"_a,
+                      "invert"_a = false);
+    triangle_mesh.def("get_axis_aligned_bounding_box",
+                      &TriangleMesh::GetAxisAlignedBoundingBox,
+                      "Returns the axis aligned bounding box of the vertices.");
+    triangle_mesh.def("get_oriented_bounding_box",
+                      &TriangleMesh::GetOrientedBoundingBox,
+                      "Returns an oriented bounding box of the vertices.");
+    triangle_mesh.def(
+            "simplify_vertex_clustering",
+            [](const TriangleMesh& mesh, double voxel_size) {
+                return mesh.SimplifyVertexClustering(
+                        voxel_size, core::HashBackendType::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Simplifies the mesh by merging the vertices in each voxel into "
+            "the minimum of their quadric error.",
+            "voxel_size"_a);
+    triangle_mesh.def(
+            "simplify_quadric_decimation",
+            &TriangleMesh::SimplifyQuadricDecimation,
+            py::call_guard<py::gil_scoped_release>(),
+            "Simplifies the mesh with parallel quadric error edge collapses. "
+            "target_reduction is the fraction of triangles to remove.",
+            "target_reduction"_a,
+            "maximum_error"_a = std::numeric_limits<double>::infinity(),
+            "boundary_weight"_a = 1.0);
+    triangle_mesh.def("get_self_intersecting_triangles",
+                      &TriangleMesh::GetSelfIntersectingTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns the (K, 2) indices of intersecting triangle "
+                      "pairs, skipping triangles that share a vertex.");
+    triangle_mesh.def("is_self_intersecting",
+                      &TriangleMesh::IsSelfIntersecting,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Tests if the triangle mesh is self-intersecting.");
+    triangle_mesh.def("is_intersecting", &TriangleMesh::IsIntersecting,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Tests if the triangle mesh intersects another "
+                      "triangle mesh.",
+                      "other"_a);
+    triangle_mesh.def("compute_vertex_adjacency",
+                      &TriangleMesh::ComputeVertexAdjacency,
+                      "Returns the (splits, neighbors) CSR vertex adjacency. "
+                      "The sorted neighbors of vertex i are "
+                      "neighbors[splits[i]:splits[i + 1]].");
+    triangle_mesh.def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Sharpens the vertex positions, normals and colors with "
+                      "v_o = v_i + strength * sum_n (v_i - v_n).",
+                      "number_of_iterations"_a = 1, "strength"_a = 1.0);
+    triangle_mesh.def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Smooths the vertex positions, normals and colors by "
+                      "averaging each vertex with its neighbors.",
+                      "number_of_iterations"_a = 1);
+    triangle_mesh.def("filter_smooth_laplacian",
+                      &TriangleMesh::FilterSmoothLaplacian,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Laplacian smoothing with inverse distance or cotangent "
+                      "weights.",
+                      "number_of_iterations"_a = 1, "lambda"_a = 0.5,
+                      "use_cotangent_weights"_a = false);
+    triangle_mesh.def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Taubin smoothing, alternating Laplacian steps with "
+                      "lambda and mu.",
+                      "number_of_iterations"_a = 1, "lambda"_a = 0.5,
+                      "mu"_a = -0.53, "use_cotangent_weights"_a = false);
+    triangle_mesh.def("compute_triangle_normals",
+                      &TriangleMesh::ComputeTriangleNormals,
+                      "Computes the triangle normals from the vertex "
+                      "positions.",
+                      "normalized"_a = true);
+    triangle_mesh.def("compute_vertex_normals",
+                      &TriangleMesh::ComputeVertexNormals,
+                      "Computes the vertex normals as the area or angle "
+                      "weighted sum of the incident triangle normals.",
+                      "normalized"_a = true, "angle_weighted"_a = false);
+    triangle_mesh.def("compute_vertex_areas",
+                      &TriangleMesh::ComputeVertexAreas,
+                      "Returns the barycentric area of each vertex.");
+    triangle_mesh.def("compute_vertex_curvatures",
+                      &TriangleMesh::ComputeVertexCurvatures,
+                      "Returns the (mean, gaussian) curvature estimates of "
+                      "each vertex.");
+    triangle_mesh.def(
+            "remove_duplicated_vertices",
+            [](const TriangleMesh& mesh) {
+                return mesh.RemoveDuplicatedVertices(
+                        core::HashBackendType::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Returns a copy with vertices of identical position merged into "
+            "their first occurrence.");
+    triangle_mesh.def(
+            "remove_duplicated_triangles",
+            [](const TriangleMesh& mesh) {
+                return mesh.RemoveDuplicatedTriangles(
+                        core::HashBackendType::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Returns a copy without triangles that repeat an earlier "
+            "triangle with the same vertices and orientation.");
+    triangle_mesh.def("remove_unreferenced_vertices",
+                      &TriangleMesh::RemoveUnreferencedVertices,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns a copy without vertices that no triangle "
+                      "references.");
+    triangle_mesh.def("remove_degenerate_triangles",
+                      &TriangleMesh::RemoveDegenerateTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns a copy without triangles that reference a "
+                      "vertex twice.");
+    triangle_mesh.def("compute_edge_to_triangles",
+                      &TriangleMesh::ComputeEdgeToTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns the sorted (E, 2) edges, the (E + 1) splits "
+                      "and the triangles incident to each edge.");
+    triangle_mesh.def("cluster_connected_triangles",
+                      &TriangleMesh::ClusterConnectedTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns the cluster of each triangle, and the number "
+                      "of triangles and the area of each cluster.");
+    triangle_mesh.def("get_non_manifold_edges",
+                      &TriangleMesh::GetNonManifoldEdges,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns the (K, 2) edges with more than two incident "
+                      "triangles, or with one if boundary edges are not "
+                      "allowed.",
+                      "allow_boundary_edges"_a = true);
+    triangle_mesh.def("is_edge_manifold", &TriangleMesh::IsEdgeManifold,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Tests if the triangle mesh is edge manifold.",
+                      "allow_boundary_edges"_a = true);
+    triangle_mesh.def("get_non_manifold_vertices",
+                      &TriangleMesh::GetNonManifoldVertices,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns the indices of the vertices whose incident "
+                      "triangles form more than one fan.");
+    triangle_mesh.def("is_vertex_manifold", &TriangleMesh::IsVertexManifold,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Tests if the triangle mesh is vertex manifold.");
+    triangle_mesh.def("is_watertight", &TriangleMesh::IsWatertight,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Tests if the triangle mesh is edge and vertex "
+                      "manifold without boundary and not self-intersecting.");
 
     triangle_mesh.def_static(
             "from_legacy", &TriangleMesh::FromLegacy, "mesh_legacy"_a,
@@ -189,6 +189,23 @@ void pybind_voxel_block_grid(py::module& m) {
             "file_name"_a);
     vbg.def_static("load", &VoxelBlockGrid::Load,
                    "Load a voxel block grid from a npz file.", "file_name"_a);
+
+    vbg.def("save_chunked", &VoxelBlockGrid::SaveChunked,
+            "Save the voxel block grid to a chunked, compressed file. If "
+            "block_coords is given, only these blocks are saved, and the "
+            "ones that are not active are recorded as erased.",
+            "file_name"_a, "block_coords"_a = py::none(),
+            "compressed"_a = true);
+    vbg.def_static("load_chunked", &VoxelBlockGrid::LoadChunked,
+                   "Load a voxel block grid from a chunked file. If "
+                   "block_range is given, only the blocks within the "
+                   "inclusive (2, 3) range are loaded.",
+                   "file_name"_a, "device"_a = core::Device("CPU:0"),
+                   "block_range"_a = py::none());
+    vbg.def("update_from_chunked", &VoxelBlockGrid::UpdateFromChunked,
+            "Insert or overwrite the blocks stored in a chunked file, and "
+            "erase the blocks it records as erased.",
+            "file_name"_a, "block_range"_a = py::none());
 }
 }  // namespace geometry
 }  // namespace t
@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <string>
+
+#include "pybind/docstring.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_voxelgrid(py::module& m) {
+    py::class_<VoxelGrid, PyGeometry<VoxelGrid>, std::shared_ptr<VoxelGrid>,
+               Geometry>
+            voxel_grid(m, "VoxelGrid",
+                       "A sparse occupancy grid of equally sized voxels, "
+                       "stored as a hash set of Int32 voxel indices. Voxel "
+                       "(i, j, k) spans origin + [i, i + 1) * voxel_size "
+                       "along x, and likewise along y and z.");
+    voxel_grid
+            .def(py::init<double, const core::Tensor&, const core::Device&,
+                          int64_t>(),
+                 "voxel_size"_a = 1.0, "origin"_a = core::Tensor(),
+                 "device"_a = core::Device("CPU:0"),
+                 "init_capacity"_a = 1024)
+            .def("__repr__", &VoxelGrid::ToString);
+    voxel_grid.def_property_readonly("device", &VoxelGrid::GetDevice);
+    voxel_grid.def_property_readonly("voxel_size", &VoxelGrid::GetVoxelSize);
+    voxel_grid.def_property_readonly("origin", &VoxelGrid::GetOrigin);
+    voxel_grid.def("num_voxels", &VoxelGrid::NumVoxels);
+    voxel_grid.def("to", &VoxelGrid::To,
+                   "Transfer the voxel grid to a specified device.",
+                   "device"_a, "copy"_a = false);
+    voxel_grid.def("clone", &VoxelGrid::Clone,
+                   "Returns copy of the voxel grid on the same device.");
+    voxel_grid.def("get_voxel_indices", &VoxelGrid::GetVoxelIndices,
+                   "Returns the (N, 3) Int32 indices of the occupied voxels.");
+    voxel_grid.def("get_voxel_centers", &VoxelGrid::GetVoxelCenters,
+                   "Returns the (N, 3) Float32 centers of the occupied "
+                   "voxels, in the order of get_voxel_indices.");
+    voxel_grid.def("compute_voxel_indices", &VoxelGrid::ComputeVoxelIndices,
+                   "Returns the Int32 indices of the voxels containing the "
+                   "points.",
+                   "points"_a);
+    voxel_grid.def("contains_voxels", &VoxelGrid::ContainsVoxels,
+                   "Returns a boolean mask of the occupied voxel indices.",
+                   "voxel_indices"_a);
+    voxel_grid.def("check_if_included", &VoxelGrid::CheckIfIncluded,
+                   "Returns a boolean mask of the points that fall into "
+                   "occupied voxels.",
+                   "points"_a);
+    voxel_grid.def("insert_voxels", &VoxelGrid::InsertVoxels,
+                   "Occupy the voxels with the given indices.",
+                   "voxel_indices"_a);
+    voxel_grid.def("erase_voxels", &VoxelGrid::EraseVoxels,
+                   "Free the voxels with the given indices.",
+                   "voxel_indices"_a);
+    voxel_grid.def("insert_points", &VoxelGrid::InsertPoints,
+                   "Occupy the voxels containing the points.", "points"_a);
+    voxel_grid.def("insert_triangle_mesh", &VoxelGrid::InsertTriangleMesh,
+                   "Occupy the voxels intersecting the triangles of the "
+                   "mesh.",
+                   "mesh"_a);
+    voxel_grid.def("union", &VoxelGrid::Union,
+                   "Returns the voxels occupied in either grid.", "other"_a);
+    voxel_grid.def("intersect", &VoxelGrid::Intersect,
+                   "Returns the voxels occupied in both grids.", "other"_a);
+    voxel_grid.def("subtract", &VoxelGrid::Subtract,
+                   "Returns the voxels of this grid not occupied in the "
+                   "other grid.",
+                   "other"_a);
+    voxel_grid.def("dilate", &VoxelGrid::Dilate,
+                   "Occupy the 26-neighbors of the occupied voxels, "
+                   "iterations times.",
+                   "iterations"_a = 1);
+    voxel_grid.def("erode", &VoxelGrid::Erode,
+                   "Free the occupied voxels with a free 26-neighbor, "
+                   "iterations times.",
+                   "iterations"_a = 1);
+    voxel_grid.def("carve_depth_map", &VoxelGrid::CarveDepthMap,
+                   "Free the voxels none of whose corners lies behind the "
+                   "depth map.",
+                   "depth"_a, "intrinsic"_a, "extrinsic"_a,
+                   "depth_scale"_a = 1000.0f,
+                   "keep_voxels_outside_image"_a = false);
+    voxel_grid.def("carve_silhouette", &VoxelGrid::CarveSilhouette,
+                   "Free the voxels none of whose corners projects into the "
+                   "silhouette mask.",
+                   "mask"_a, "intrinsic"_a, "extrinsic"_a,
+                   "keep_voxels_outside_image"_a = false);
+    voxel_grid.def_static("create_from_point_cloud",
+                          &VoxelGrid::CreateFromPointCloud,
+                          "Creates a voxel grid with the voxels containing "
+                          "the points of the point cloud.",
+                          "pcd"_a, "voxel_size"_a);
+    voxel_grid.def_static("create_from_triangle_mesh",
+                          &VoxelGrid::CreateFromTriangleMesh,
+                          "Creates a voxel grid with the voxels intersecting "
+                          "the triangles of the mesh.",
+                          "mesh"_a, "voxel_size"_a);
+    voxel_grid.def_static("from_legacy", &VoxelGrid::FromLegacy,
+                          "voxel_grid"_a, "device"_a = core::Device("CPU:0"),
+                          "Create from a legacy VoxelGrid. Voxel colors are "
+                          "dropped.");
+    voxel_grid.def("to_legacy", &VoxelGrid::ToLegacy,
+                   "Convert to a legacy VoxelGrid without colors.");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "pybind/t/pipelines/color_map/color_map.h"
+
+#include "open3d/t/pipelines/color_map/ColorMapOptimizer.h"
+#include "pybind/docstring.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+template <typename Option, typename Class>
+static void BindRigidOptimizerOptionFields(Class &option) {
+    option.def_readwrite("maximum_iteration", &Option::maximum_iteration_,
+                         "Number of iterations for optimization steps.")
+            .def_readwrite("maximum_allowable_depth",
+                           &Option::maximum_allowable_depth_,
+                           "Points with larger sensor depth are invisible.")
+            .def_readwrite("depth_threshold_for_visibility_check",
+                           &Option::depth_threshold_for_visibility_check_,
+                           "Maximum difference between the vertex depth and "
+                           "the sensor depth of visible points.")
+            .def_readwrite("depth_threshold_for_discontinuity_check",
+                           &Option::depth_threshold_for_discontinuity_check_,
+                           "Points with larger depth gradient magnitude are "
+                           "invisible.")
+            .def_readwrite(
+                    "half_dilation_kernel_size_for_discontinuity_map",
+                    &Option::half_dilation_kernel_size_for_discontinuity_map_,
+                    "Half-kernel size of the dilation applied on the depth "
+                    "discontinuity mask.")
+            .def_readwrite("image_boundary_margin",
+                           &Option::image_boundary_margin_,
+                           "Points projected within this margin of the image "
+                           "border are ignored.")
+            .def_readwrite("invisible_vertex_color_knn",
+                           &Option::invisible_vertex_color_knn_,
+                           "Invisible vertices are colored with the average "
+                           "color of this many nearest visible vertices.")
+            .def_readwrite("depth_scale", &Option::depth_scale_,
+                           "Scale to convert the depth images to meters.");
+}
+
+void pybind_color_map_classes(py::module &m) {
+    py::class_<RigidOptimizerOption> rigid_optimizer_option(
+            m, "RigidOptimizerOption", "Rigid optimizer option class.");
+    py::detail::bind_copy_functions<RigidOptimizerOption>(
+            rigid_optimizer_option);
+    rigid_optimizer_option.def(py::init<>());
+    BindRigidOptimizerOptionFields<RigidOptimizerOption>(
+            rigid_optimizer_option);
+
+    py::class_<NonRigidOptimizerOption, RigidOptimizerOption>
+            non_rigid_optimizer_option(m, "NonRigidOptimizerOption",
+                                       "Non-rigid optimizer option class.");
+    py::detail::bind_copy_functions<NonRigidOptimizerOption>(
+            non_rigid_optimizer_option);
+    non_rigid_optimizer_option.def(py::init<>())
+            .def_readwrite(
+                    "number_of_vertical_anchors",
+                    &NonRigidOptimizerOption::number_of_vertical_anchors_,
+                    "Number of vertical anchor points of the image warping "
+                    "field.")
+            .def_readwrite(
+                    "non_rigid_anchor_point_weight",
+                    &NonRigidOptimizerOption::non_rigid_anchor_point_weight_,
+                    "Weight of the warping field regularization.");
+}
+
+void pybind_color_map_methods(py::module &m) {
+    static const std::unordered_map<std::string, std::string>
+            map_shared_argument_docstrings = {
+                    {"mesh", "The mesh to color."},
+                    {"images_rgbd",
+                     "RGB-D images on the mesh device, with UInt16 or "
+                     "Float32 depth."},
+                    {"intrinsics",
+                     "(3, 3) intrinsic matrix shared by all the images."},
+                    {"extrinsics",
+                     "(4, 4) initial world to camera transformation per "
+                     "image."},
+                    {"option", "Optimization options."}};
+
+    m.def("run_rigid_optimizer", &RunRigidOptimizer,
+          py::call_guard<py::gil_scoped_release>(),
+          "Optimizes the camera poses for photometric consistency and colors "
+          "the mesh. Returns the colored mesh and the optimized extrinsics.",
+          "mesh"_a, "images_rgbd"_a, "intrinsics"_a, "extrinsics"_a,
+          "option"_a);
+    docstring::FunctionDocInject(m, "run_rigid_optimizer",
+                                 map_shared_argument_docstrings);
+
+    m.def("run_non_rigid_optimizer", &RunNonRigidOptimizer,
+          py::call_guard<py::gil_scoped_release>(),
+          "Jointly optimizes the camera poses and per-image warping fields, "
+          "and colors the mesh. Returns the colored mesh, the optimized "
+          "extrinsics and the warping fields.",
+          "mesh"_a, "images_rgbd"_a, "intrinsics"_a, "extrinsics"_a,
+          "option"_a);
+    docstring::FunctionDocInject(m, "run_non_rigid_optimizer",
+                                 map_shared_argument_docstrings);
+}
+
+void pybind_color_map(py::module &m) {
+    py::module m_submodule = m.def_submodule(
+            "color_map", "Tensor color map optimization pipeline.");
+    pybind_color_map_classes(m_submodule);
+    pybind_color_map_methods(m_submodule);
+}
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -191,7 +191,14 @@ static const std::unordered_map<std::string, std::string>
                  "by CreateVertexMap before calling this function."}};
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("rgbd_odometry_multi_scale", &RGBDOdometryMultiScale,
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const t::geometry::RGBDImage &,
+                            const t::geometry::RGBDImage &,
+                            const core::Tensor &, const core::Tensor &,
+                            const float, const float,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi Scale RGBD odometry.", "source"_a, "target"_a,
           "intrinsics"_a,
@@ -203,6 +210,22 @@ void pybind_odometry_methods(py::module &m) {
           "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
     docstring::FunctionDocInject(m, "rgbd_odometry_multi_scale",
                                  map_shared_argument_docstrings);
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const t::geometry::RGBDImagePyramid &,
+                            const t::geometry::RGBDImagePyramid &,
+                            const core::Tensor &,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi Scale RGBD odometry on preprocessed "
+          "RGBDImagePyramid, which are reused across frames.",
+          "source"_a, "target"_a,
+          "init_source_to_target"_a =
+                  core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+          "criteria_list"_a =
+                  std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
+          "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
 
     m.def("compute_odometry_result_point_to_plane",
           &ComputeOdometryResultPointToPlane,
@@ -24,7 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/t/pipelines/slam/AsyncPipeline.h"
 #include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/LoopClosure.h"
 #include "open3d/t/pipelines/slam/Model.h"
 #include "pybind/docstring.h"
 
@@ -94,13 +96,24 @@ void pybind_slam_model(py::module &m) {
     docstring::ClassMethodDocInject(m, "Model", "synthesize_model_frame",
                                     map_shared_argument_docstrings);
 
-    model.def("track_frame_to_model", &Model::TrackFrameToModel,
+    model.def("track_frame_to_model",
+              py::overload_cast<const Frame &, const Frame &, float, float,
+                                float>(&Model::TrackFrameToModel),
               py::call_guard<py::gil_scoped_release>(),
               "Track input frame against raycasted frame from model.",
               "input_frame"_a, "model_frame"_a, "depth_scale"_a = 1000.0,
               "depth_max"_a = 3.0, "depth_diff"_a = 0.07);
     docstring::ClassMethodDocInject(m, "Model", "track_frame_to_model",
                                     map_shared_argument_docstrings);
+    model.def("track_frame_to_model",
+              py::overload_cast<const t::geometry::RGBDImagePyramid &,
+                                const Frame &, float, float, float>(
+                      &Model::TrackFrameToModel),
+              py::call_guard<py::gil_scoped_release>(),
+              "Track a preprocessed input frame against raycasted frame from "
+              "model.",
+              "input_pyramid"_a, "model_frame"_a, "depth_scale"_a = 1000.0,
+              "depth_max"_a = 3.0, "depth_diff"_a = 0.07);
 
     model.def("integrate", &Model::Integrate,
               py::call_guard<py::gil_scoped_release>(),
@@ -160,11 +173,181 @@ void pybind_slam_frame(py::module &m) {
               "Get a 2D image from from the given key in the map.");
 }
 
+void pybind_slam_async_pipeline(py::module &m) {
+    py::class_<AsyncPipelineParams> params(
+            m, "AsyncPipelineParams", "Parameters of AsyncPipeline.");
+    py::detail::bind_copy_functions<AsyncPipelineParams>(params);
+    params.def(py::init<>())
+            .def_readwrite("depth_scale", &AsyncPipelineParams::depth_scale_,
+                           "Scale factor to convert raw depth into meters.")
+            .def_readwrite("depth_min", &AsyncPipelineParams::depth_min_,
+                           "Depth where ray casting starts from.")
+            .def_readwrite("depth_max", &AsyncPipelineParams::depth_max_,
+                           "Depth truncation of the input frames.")
+            .def_readwrite("depth_diff", &AsyncPipelineParams::depth_diff_,
+                           "Depth difference threshold used to filter "
+                           "projective associations.")
+            .def_readwrite("fitness_threshold",
+                           &AsyncPipelineParams::fitness_threshold_,
+                           "Minimum fitness to accept tracking.")
+            .def_readwrite("translation_threshold",
+                           &AsyncPipelineParams::translation_threshold_,
+                           "Maximum frame to frame translation to accept "
+                           "tracking.")
+            .def_readwrite("queue_size", &AsyncPipelineParams::queue_size_,
+                           "Capacity of the queue between two stages.")
+            .def_readwrite("enable_raycast_color",
+                           &AsyncPipelineParams::enable_raycast_color_,
+                           "Ray cast color in addition to depth.");
+
+    py::class_<AsyncFrameResult> result(m, "AsyncFrameResult",
+                                        "Result of a frame of AsyncPipeline.");
+    result.def_readonly("frame_id", &AsyncFrameResult::frame_id_)
+            .def_readonly("pose", &AsyncFrameResult::pose_)
+            .def_readonly("tracking_success",
+                          &AsyncFrameResult::tracking_success_)
+            .def_readonly("odometry_result",
+                          &AsyncFrameResult::odometry_result_)
+            .def_readonly("stage_ms", &AsyncFrameResult::stage_ms_)
+            .def_readonly("latency_ms", &AsyncFrameResult::latency_ms_);
+
+    py::class_<AsyncPipeline> pipeline(
+            m, "AsyncPipeline",
+            "Runs dense SLAM on a Model with read, preprocess and model "
+            "stages of consecutive frames overlapping in separate threads.");
+    py::enum_<AsyncPipeline::Stage>(pipeline, "Stage")
+            .value("Read", AsyncPipeline::Stage::Read)
+            .value("Preprocess", AsyncPipeline::Stage::Preprocess)
+            .value("Track", AsyncPipeline::Stage::Track)
+            .value("Integrate", AsyncPipeline::Stage::Integrate)
+            .value("RayCast", AsyncPipeline::Stage::RayCast)
+            .export_values();
+    py::class_<AsyncPipeline::StageStatistics>(pipeline, "StageStatistics")
+            .def_readonly("count", &AsyncPipeline::StageStatistics::count_)
+            .def_readonly("mean_ms", &AsyncPipeline::StageStatistics::mean_ms_)
+            .def_readonly("max_ms", &AsyncPipeline::StageStatistics::max_ms_)
+            .def_readonly("blocked_ms",
+                          &AsyncPipeline::StageStatistics::blocked_ms_);
+
+    pipeline.def(py::init<Model &, const core::Tensor &,
+                          const AsyncPipelineParams &>(),
+                 "model"_a, "intrinsics"_a,
+                 "params"_a = AsyncPipelineParams(), py::keep_alive<1, 2>());
+    pipeline.def(
+            "run",
+            [](AsyncPipeline &pipeline, py::function source,
+               py::object callback) {
+                // Both functions are called from worker threads.
+                AsyncPipeline::FrameSource frame_source =
+                        [&source](t::geometry::RGBDImage &image) {
+                            py::gil_scoped_acquire acquire;
+                            py::object next = source();
+                            if (next.is_none()) {
+                                return false;
+                            }
+                            image = next.cast<t::geometry::RGBDImage>();
+                            return true;
+                        };
+                AsyncPipeline::FrameCallback frame_callback = nullptr;
+                if (!callback.is_none()) {
+                    frame_callback = [&callback](
+                                             const AsyncFrameResult &result) {
+                        py::gil_scoped_acquire acquire;
+                        callback(result);
+                    };
+                }
+                py::gil_scoped_release release;
+                return pipeline.Run(frame_source, frame_callback);
+            },
+            "Processes frames until source returns None or stop is called. "
+            "Returns the number of processed frames.",
+            "source"_a, "callback"_a = py::none());
+    pipeline.def("stop", &AsyncPipeline::Stop,
+                 "Requests run to return as soon as possible.");
+    pipeline.def("get_stage_statistics", &AsyncPipeline::GetStageStatistics,
+                 "Latency statistics of a stage.", "stage"_a);
+    pipeline.def("get_statistics_summary",
+                 &AsyncPipeline::GetStatisticsSummary,
+                 "Human readable summary of the statistics of all stages.");
+}
+
+void pybind_slam_loop_closure(py::module &m) {
+    py::class_<LoopClosureParams> params(m, "LoopClosureParams",
+                                         "Parameters of LoopClosure.");
+    py::detail::bind_copy_functions<LoopClosureParams>(params);
+    params.def(py::init<>())
+            .def_readwrite("depth_scale", &LoopClosureParams::depth_scale_,
+                           "Scale factor to convert raw depth into meters.")
+            .def_readwrite("depth_max", &LoopClosureParams::depth_max_,
+                           "Depth truncation of the keyframes.")
+            .def_readwrite("keyframe_interval",
+                           &LoopClosureParams::keyframe_interval_,
+                           "Maximum number of frames between two keyframes.")
+            .def_readwrite("keyframe_translation",
+                           &LoopClosureParams::keyframe_translation_,
+                           "Camera motion in meters that triggers a new "
+                           "keyframe.")
+            .def_readwrite("min_keyframe_gap",
+                           &LoopClosureParams::min_keyframe_gap_,
+                           "Minimum number of keyframes between the two ends "
+                           "of a loop.")
+            .def_readwrite("max_candidates",
+                           &LoopClosureParams::max_candidates_,
+                           "Maximum number of loop candidates verified per "
+                           "keyframe.")
+            .def_readwrite("min_similarity",
+                           &LoopClosureParams::min_similarity_,
+                           "Minimum descriptor similarity of a loop "
+                           "candidate.")
+            .def_readwrite("voxel_size", &LoopClosureParams::voxel_size_,
+                           "Voxel size of the keyframe point clouds.")
+            .def_readwrite("max_correspondence_distance",
+                           &LoopClosureParams::max_correspondence_distance_,
+                           "Maximum correspondence distance of loop "
+                           "verification and pose graph optimization.")
+            .def_readwrite("fitness_threshold",
+                           &LoopClosureParams::fitness_threshold_,
+                           "Minimum ICP fitness to accept a loop.")
+            .def_readwrite("reintegration_threshold",
+                           &LoopClosureParams::reintegration_threshold_,
+                           "Pose change in meters above which a keyframe is "
+                           "re-integrated.")
+            .def_readwrite(
+                    "reintegration_rotation_threshold",
+                    &LoopClosureParams::reintegration_rotation_threshold_,
+                    "Pose rotation in radians above which a keyframe is "
+                    "re-integrated.");
+
+    py::class_<LoopClosure> loop_closure(
+            m, "LoopClosure",
+            "Keyframe based loop closure and pose graph optimization for a "
+            "Model.");
+    loop_closure.def(py::init<Model &, const LoopClosureParams &>(), "model"_a,
+                     "params"_a = LoopClosureParams(), py::keep_alive<1, 2>());
+    loop_closure.def("process_frame", &LoopClosure::ProcessFrame,
+                     "Processes the current frame of the model after it has "
+                     "been integrated. Returns True if a loop was closed and "
+                     "the poses were optimized.",
+                     "input_frame"_a, "raycast_frame"_a);
+    loop_closure.def("reintegrate", &LoopClosure::Reintegrate,
+                     "Rebuilds the voxel blocks affected by optimized "
+                     "keyframe poses. Returns the number of rebuilt blocks.");
+    loop_closure.def("has_pending_reintegration",
+                     &LoopClosure::HasPendingReintegration);
+    loop_closure.def("get_pose_graph", &LoopClosure::GetPoseGraph,
+                     "Returns the keyframe pose graph.");
+    loop_closure.def("get_loop_closures", &LoopClosure::GetLoopClosures,
+                     "Returns accepted loops as (frame id, earlier frame id) "
+                     "pairs.");
+}
+
 void pybind_slam(py::module &m) {
     py::module m_submodule =
             m.def_submodule("slam", "Tensor DenseSLAM pipeline.");
     pybind_slam_model(m_submodule);
     pybind_slam_frame(m_submodule);
+    pybind_slam_async_pipeline(m_submodule);
+    pybind_slam_loop_closure(m_submodule);
 }
 
 }  // namespace slam
@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Tracing.h"
+
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace utility {
+
+void pybind_tracing(py::module& m) {
+    m.def(
+            "enable_tracing",
+            [](size_t events_per_thread) {
+                Tracer::GetInstance().Enable(events_per_thread);
+            },
+            "Start recording trace events. Previously recorded events are "
+            "discarded. Pipeline stages are only instrumented if Open3D is "
+            "built with -DBUILD_TRACING=ON.",
+            "events_per_thread"_a = 1 << 16);
+    docstring::FunctionDocInject(
+            m, "enable_tracing",
+            {{"events_per_thread",
+              "Size of the per-thread ring buffer. Once full, the oldest "
+              "events are overwritten."}});
+
+    m.def(
+            "disable_tracing", []() { Tracer::GetInstance().Disable(); },
+            "Stop recording trace events. Recorded events are kept.");
+    docstring::FunctionDocInject(m, "disable_tracing");
+
+    m.def(
+            "is_tracing_enabled",
+            []() { return Tracer::GetInstance().IsEnabled(); },
+            "Returns True if trace events are being recorded.");
+    docstring::FunctionDocInject(m, "is_tracing_enabled");
+
+    m.def(
+            "clear_tracing", []() { Tracer::GetInstance().Clear(); },
+            "Discard all recorded trace events.");
+    docstring::FunctionDocInject(m, "clear_tracing");
+
+    m.def(
+            "get_chrome_trace",
+            []() { return Tracer::GetInstance().ToChromeTraceJSON(); },
+            "Returns the recorded events in the Chrome trace event JSON "
+            "format, which can be opened in chrome://tracing and "
+            "https://ui.perfetto.dev.");
+    docstring::FunctionDocInject(m, "get_chrome_trace");
+
+    m.def(
+            "write_chrome_trace",
+            [](const std::string& filename) {
+                return Tracer::GetInstance().WriteChromeTrace(filename);
+            },
+            "Write the recorded events as Chrome trace event JSON. Returns "
+            "False on failure.",
+            "filename"_a);
+    docstring::FunctionDocInject(
+            m, "write_chrome_trace",
+            {{"filename", "Path of the output .json file."}});
+}
+
+}  // namespace utility
+}  // namespace open3d
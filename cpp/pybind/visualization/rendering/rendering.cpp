@@ -496,6 +496,11 @@ void pybind_rendering_classes(py::module &m) {
                  "The flags should be ORed from Scene.UPDATE_POINTS_FLAG, "
                  "Scene.UPDATE_NORMALS_FLAG, Scene.UPDATE_COLORS_FLAG, and "
                  "Scene.UPDATE_UV0_FLAG")
+            .def("update_geometry_range", &Scene::UpdateGeometryRange,
+                 "Updates the flagged arrays of the points starting at offset "
+                 "from the points of the tgeometry.PointCloud, uploading only "
+                 "that range: update_geometry_range(name, point_cloud, "
+                 "update_flags, offset)")
             .def("enable_indirect_light", &Scene::EnableIndirectLight,
                  "Enables or disables indirect lighting")
             .def("set_indirect_light", &Scene::SetIndirectLight,
@@ -28,7 +28,9 @@
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/IJsonConvertibleIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
+#include "open3d/visualization/utility/PointCloudLOD.h"
 #include "open3d/visualization/utility/SelectionPolygonVolume.h"
 #include "open3d/visualization/visualizer/Visualizer.h"
 #include "pybind/docstring.h"
@@ -84,6 +86,57 @@ void pybind_visualization_utility(py::module &m) {
     docstring::ClassMethodDocInject(m, "SelectionPolygonVolume",
                                     "crop_triangle_mesh",
                                     {{"input", "The input triangle mesh."}});
+
+    py::class_<PointCloudLOD, std::shared_ptr<PointCloudLOD>> lod(
+            m, "PointCloudLOD",
+            "Level of detail hierarchy of a point cloud for streaming "
+            "rendering. Every octree node holds a grid subsample of the "
+            "points of its cube that are not in its ancestors.");
+    py::detail::bind_default_constructor<PointCloudLOD>(lod);
+    lod.def_static("create_from_point_cloud",
+                   &PointCloudLOD::CreateFromPointCloud, "point_cloud"_a,
+                   "sample_depth"_a = 7, "max_leaf_points"_a = 20000,
+                   "max_depth"_a = 12,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Builds the hierarchy of a point cloud.")
+            .def_static("open", &PointCloudLOD::Open, "filename"_a,
+                        "Opens a hierarchy file, reading only its node "
+                        "table. The points are read on demand.")
+            .def("write_to_file", &PointCloudLOD::WriteToFile, "filename"_a,
+                 "Writes the hierarchy to a chunked binary file.")
+            .def("__repr__",
+                 [](const PointCloudLOD &lod) {
+                     return fmt::format(
+                             "PointCloudLOD with {} nodes and {} points.",
+                             lod.NumNodes(), lod.NumPoints());
+                 })
+            .def("num_nodes", &PointCloudLOD::NumNodes)
+            .def("num_points", &PointCloudLOD::NumPoints)
+            .def("has_colors", &PointCloudLOD::HasColors)
+            .def("load_node", &PointCloudLOD::LoadNode, "node"_a,
+                 "Returns the points of a node.")
+            .def("load_nodes", &PointCloudLOD::LoadNodes, "nodes"_a,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Returns the points of several nodes as one point cloud.")
+            .def("select_nodes", &PointCloudLOD::SelectNodes,
+                 "view_projection"_a, "viewport_height"_a, "point_budget"_a,
+                 "min_node_size"_a = 0.0,
+                 "Selects the visible nodes to render within a budget of "
+                 "points, parents before children.")
+            .def_readonly("origin", &PointCloudLOD::origin_,
+                          "``(3, 1)`` float64 numpy array: Min bound of the "
+                          "root cube.")
+            .def_readonly("size", &PointCloudLOD::size_,
+                          "float: Edge size of the root cube.");
+    docstring::ClassMethodDocInject(
+            m, "PointCloudLOD", "select_nodes",
+            {{"view_projection",
+              "The world to clip space matrix with OpenGL conventions."},
+             {"viewport_height", "Height of the viewport in pixels."},
+             {"point_budget", "Max total number of points."},
+             {"min_node_size",
+              "Nodes with a smaller projected size in pixels are not "
+              "refined."}});
 }
 
 // Visualization util functions have similar arguments, sharing arg docstrings
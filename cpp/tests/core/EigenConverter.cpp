@@ -89,5 +89,68 @@ TEST_P(EigenConverterPermuteDevices, TensorToEigenMatrix) {
             core::Tensor::Ones({5, 4}, core::Int32, cpu_device)));
 }
 
+TEST(EigenConverter, EigenVectorAsTensor) {
+    std::vector<Eigen::Vector3d> points{Eigen::Vector3d(0, 1, 2),
+                                        Eigen::Vector3d(3, 4, 5)};
+    core::Tensor points_view =
+            core::eigen_converter::EigenVector3dVectorAsTensor(points);
+    EXPECT_EQ(points_view.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(points_view.GetDtype(), core::Float64);
+    EXPECT_EQ(points_view.GetDataPtr(), static_cast<void *>(points.data()));
+    EXPECT_TRUE(points_view.AllClose(
+            core::Tensor::Arange(0, 6, 1, core::Float64).Reshape({2, 3})));
+
+    // Writes go both ways.
+    points_view[1][2] = 10.0;
+    EXPECT_EQ(points[1](2), 10.0);
+    points[0](0) = -1.0;
+    EXPECT_EQ(points_view[0][0].Item<double>(), -1.0);
+
+    // Copying conversions never alias the source vector.
+    core::Tensor points_copy =
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    points, core::Float64, core::Device("CPU:0"));
+    EXPECT_NE(points_copy.GetDataPtr(), static_cast<void *>(points.data()));
+    EXPECT_TRUE(points_copy.AllClose(points_view));
+
+    std::vector<Eigen::Vector3i> triangles{Eigen::Vector3i(0, 1, 2)};
+    core::Tensor triangles_view =
+            core::eigen_converter::EigenVector3iVectorAsTensor(triangles);
+    EXPECT_EQ(triangles_view.GetDtype(), core::Int32);
+    EXPECT_TRUE(triangles_view.AllEqual(core::Tensor::Init<int>({{0, 1, 2}})));
+
+    std::vector<Eigen::Vector2i> empty_lines;
+    EXPECT_EQ(core::eigen_converter::EigenVector2iVectorAsTensor(empty_lines)
+                      .GetShape(),
+              core::SizeVector({0, 2}));
+}
+
+TEST(EigenConverter, TensorAsEigenMatrixMap) {
+    core::Tensor tensor =
+            core::Tensor::Arange(0, 12, 1, core::Float64).Reshape({3, 4});
+
+    // A column slice is not contiguous, the map follows its strides.
+    core::Tensor slice = tensor.Slice(1, 1, 4);
+    auto map = core::eigen_converter::TensorAsEigenMatrixXdMap(slice);
+    EXPECT_EQ(map.rows(), 3);
+    EXPECT_EQ(map.cols(), 3);
+    EXPECT_EQ(map.data(), slice.GetDataPtr<double>());
+    for (int64_t i = 0; i < 3; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(map(i, j), static_cast<double>(i * 4 + j + 1));
+        }
+    }
+
+    // Strided slices of the right dtype convert to legacy vectors directly.
+    std::vector<Eigen::Vector3d> points =
+            core::eigen_converter::TensorToEigenVector3dVector(slice);
+    ASSERT_EQ(points.size(), 3u);
+    EXPECT_EQ(points[2], Eigen::Vector3d(9, 10, 11));
+
+    EXPECT_ANY_THROW(core::eigen_converter::TensorAsEigenMatrixXfMap(slice));
+    EXPECT_ANY_THROW(core::eigen_converter::TensorAsEigenMatrixXdMap(
+            tensor.Reshape({12})));
+}
+
 }  // namespace tests
 }  // namespace open3d
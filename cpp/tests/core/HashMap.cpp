@@ -34,6 +34,7 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/hashmap/HashSet.h"
+#include "open3d/t/io/HashMapIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Optional.h"
 #include "tests/Tests.h"
@@ -82,6 +83,7 @@ TEST_P(HashMapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -112,6 +114,7 @@ TEST_P(HashMapPermuteDevices, Find) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -156,6 +159,7 @@ TEST_P(HashMapPermuteDevices, Insert) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -209,6 +213,7 @@ TEST_P(HashMapPermuteDevices, Erase) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -264,6 +269,50 @@ TEST_P(HashMapPermuteDevices, Erase) {
     }
 }
 
+TEST_P(HashMapPermuteDevices, EraseAndReinsert) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+        backends.push_back(core::HashBackendType::StdGPU);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
+    }
+
+    const int n = 10000;
+    for (auto backend : backends) {
+        core::HashMap hashmap(2 * n, core::Int32, {3}, core::Int32, {1},
+                              device, backend);
+
+        // Repeatedly erase and insert a sliding window of keys, so that erased
+        // slots pile up and have to be reclaimed.
+        core::Tensor buf_indices, masks;
+        for (int round = 0; round < 8; ++round) {
+            core::Tensor window =
+                    core::Tensor::Arange(round * n / 2, round * n / 2 + n, 1,
+                                         core::Int32, device);
+            core::Tensor keys =
+                    window.Reshape({n, 1}).Expand({n, 3}).Contiguous();
+            hashmap.Insert(keys, window, buf_indices, masks);
+            EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(),
+                      round == 0 ? n : n / 2);
+            EXPECT_EQ(hashmap.Size(), n);
+
+            hashmap.Find(keys, buf_indices, masks);
+            EXPECT_TRUE(masks.All());
+            core::Tensor values = hashmap.GetValueTensor().IndexGet(
+                    {buf_indices.To(core::Int64)});
+            EXPECT_TRUE(values.Reshape({n}).AllEqual(window));
+
+            // Erase the older half of the window.
+            hashmap.Erase(keys.Slice(0, 0, n / 2), masks);
+            EXPECT_TRUE(masks.All());
+            EXPECT_EQ(hashmap.Size(), n / 2);
+        }
+    }
+}
+
 TEST_P(HashMapPermuteDevices, Reserve) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends;
@@ -272,6 +321,7 @@ TEST_P(HashMapPermuteDevices, Reserve) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -326,6 +376,7 @@ TEST_P(HashMapPermuteDevices, Clear) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -404,6 +455,7 @@ TEST_P(HashMapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -463,6 +515,7 @@ TEST_P(HashMapPermuteDevices, MultivalueInsertion) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -536,6 +589,7 @@ TEST_P(HashMapPermuteDevices, HashSet) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -602,5 +656,108 @@ TEST_P(HashMapPermuteDevices, HashMapIO) {
     utility::filesystem::RemoveFile(file_name_ext);
 }
 
+TEST_P(HashMapPermuteDevices, HashMapIOChunked) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "hashmap_chunked.bin";
+    const std::string delta_file_name = "hashmap_chunked_delta.bin";
+
+    // A 20^3 grid of keys, with a multi-valued payload.
+    const int res = 20;
+    const int n = res * res * res;
+    std::vector<int> keys_data(3 * n);
+    std::vector<float> values_data(2 * n);
+    for (int i = 0; i < n; ++i) {
+        keys_data[3 * i + 0] = i % res - res / 2;
+        keys_data[3 * i + 1] = (i / res) % res;
+        keys_data[3 * i + 2] = i / (res * res);
+        values_data[2 * i + 0] = i;
+        values_data[2 * i + 1] = -i;
+    }
+    core::Tensor keys(keys_data, {n, 3}, core::Int32, device);
+    core::Tensor values(values_data, {n, 2}, core::Float32, device);
+
+    core::HashMap hashmap(n, core::Int32, {3}, core::Float32, {2}, device);
+    hashmap.Insert(keys, values);
+
+    auto check_values = [&](core::HashMap &hashmap_loaded,
+                            const core::Tensor &query_keys,
+                            const core::Tensor &expected_values) {
+        core::Tensor buf_indices, masks;
+        hashmap_loaded.Find(query_keys, buf_indices, masks);
+        EXPECT_TRUE(masks.All());
+        core::Tensor found_values = hashmap_loaded.GetValueTensor().IndexGet(
+                {buf_indices.To(core::Int64)});
+        EXPECT_TRUE(found_values.AllClose(expected_values));
+    };
+
+    for (bool compressed : {true, false}) {
+        t::io::WriteHashMapChunked(file_name, hashmap, utility::nullopt,
+                                   compressed, {{"name", "grid"}});
+        EXPECT_EQ(t::io::ReadHashMapChunkedMetadata(file_name).at("name"),
+                  "grid");
+
+        core::HashMap hashmap_loaded =
+                t::io::ReadHashMapChunked(file_name, device);
+        EXPECT_EQ(hashmap_loaded.Size(), n);
+        check_values(hashmap_loaded, keys, values);
+    }
+
+    // Partial load of the blocks with x in [-2, 1] and z in [0, 4].
+    core::Tensor key_range(std::vector<int>{-2, 0, 0, 1, res - 1, 4}, {2, 3},
+                           core::Int32, device);
+    core::HashMap hashmap_range =
+            t::io::ReadHashMapChunked(file_name, device, key_range);
+    EXPECT_EQ(hashmap_range.Size(), 4 * res * 5);
+    core::Tensor keys_in_range(std::vector<int>{-2, 0, 0, 1, 19, 4}, {2, 3},
+                               core::Int32, device);
+    check_values(hashmap_range, keys_in_range,
+                 core::Tensor(std::vector<float>{8, -8, 1991, -1991}, {2, 2},
+                              core::Float32, device));
+    core::Tensor buf_indices, masks;
+    hashmap_range.Find(core::Tensor(std::vector<int>{2, 0, 0}, {1, 3},
+                                    core::Int32, device),
+                       buf_indices, masks);
+    EXPECT_FALSE(masks.Any());
+
+    // Delta: overwrite the first 100 entries, add new ones and erase 50.
+    core::Tensor delta_keys = keys.Slice(0, 0, 100).Clone();
+    core::Tensor new_keys = delta_keys + core::Tensor::Init<int>({0, 0, 100},
+                                                                device);
+    core::HashMap hashmap_delta = hashmap.Clone();
+    hashmap_delta.Insert(new_keys, values.Slice(0, 0, 100));
+    core::Tensor delta_values = values.Slice(0, 0, 100) * 2;
+    hashmap_delta.Find(delta_keys, buf_indices, masks);
+    hashmap_delta.GetValueTensor().IndexSet({buf_indices.To(core::Int64)},
+                                            delta_values);
+    core::Tensor erased_keys = keys.Slice(0, 100, 150).Clone();
+    hashmap_delta.Erase(erased_keys);
+    t::io::WriteHashMapChunked(
+            delta_file_name, hashmap_delta,
+            delta_keys.Append(new_keys, 0).Append(erased_keys, 0));
+    EXPECT_TRUE(t::io::ReadHashMapChunkedErasedKeys(delta_file_name)
+                        .AllEqual(erased_keys.To(core::Device("CPU:0"))));
+
+    core::HashMap hashmap_updated =
+            t::io::ReadHashMapChunked(file_name, device);
+    t::io::ReadHashMapChunked(delta_file_name, hashmap_updated);
+    EXPECT_EQ(hashmap_updated.Size(), n + 100 - 50);
+    check_values(hashmap_updated, delta_keys, delta_values);
+    check_values(hashmap_updated, new_keys, values.Slice(0, 0, 100));
+    check_values(hashmap_updated, keys.Slice(0, 150, n),
+                 values.Slice(0, 150, n));
+    hashmap_updated.Find(erased_keys, buf_indices, masks);
+    EXPECT_FALSE(masks.Any());
+
+    // Erased keys outside of the key range are kept.
+    core::HashMap hashmap_partial =
+            t::io::ReadHashMapChunked(file_name, device);
+    t::io::ReadHashMapChunked(delta_file_name, hashmap_partial, key_range);
+    hashmap_partial.Find(erased_keys, buf_indices, masks);
+    EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), 50 - 10);
+
+    utility::filesystem::RemoveFile(file_name);
+    utility::filesystem::RemoveFile(delta_file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,186 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static geometry::PointCloud CreateRandomPointCloud(size_t size) {
+    geometry::PointCloud pc;
+    pc.points_.resize(size);
+    pc.colors_.resize(size);
+    Rand(pc.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(2, 1, 3), 0);
+    Rand(pc.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    return pc;
+}
+
+TEST(LinearOctree, Constructor) {
+    geometry::LinearOctree octree(0, Eigen::Vector3d(-1, -1, -1), 2);
+    ExpectEQ(octree.origin_, Eigen::Vector3d(-1, -1, -1));
+    EXPECT_EQ(octree.size_, 2);
+    EXPECT_TRUE(octree.IsEmpty());
+    EXPECT_EQ(octree.NumNodes(), 0);
+}
+
+TEST(LinearOctree, ToOctreeEqualsOctree) {
+    geometry::PointCloud pc = CreateRandomPointCloud(2000);
+    for (size_t max_depth : {0, 1, 4, 7}) {
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(pc, 0.01);
+        geometry::LinearOctree linear_octree(max_depth);
+        linear_octree.ConvertFromPointCloud(pc, 0.01);
+        EXPECT_EQ(linear_octree.NumPoints(), pc.points_.size());
+        EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+    }
+}
+
+TEST(LinearOctree, SetFromChildMasks) {
+    geometry::PointCloud pc = CreateRandomPointCloud(500);
+    geometry::LinearOctree src(5);
+    src.ConvertFromPointCloud(pc, 0.01);
+
+    std::vector<int> leaf_point_counts;
+    for (size_t node = 0; node < src.NumNodes(); ++node) {
+        if (src.IsLeafNode(int(node))) {
+            leaf_point_counts.push_back(src.node_point_end_[node] -
+                                        src.node_point_begin_[node]);
+        }
+    }
+    geometry::LinearOctree dst(src.max_depth_, src.origin_, src.size_);
+    EXPECT_FALSE(dst.SetFromChildMasks(src.node_child_masks_,
+                                       leaf_point_counts));
+    dst.points_ = src.points_;
+    dst.point_indices_ = src.point_indices_;
+    EXPECT_TRUE(dst.SetFromChildMasks(src.node_child_masks_,
+                                      leaf_point_counts));
+    EXPECT_EQ(dst.node_codes_, src.node_codes_);
+    EXPECT_EQ(dst.node_first_child_, src.node_first_child_);
+    EXPECT_EQ(dst.level_offsets_, src.level_offsets_);
+    EXPECT_EQ(dst.node_point_begin_, src.node_point_begin_);
+    EXPECT_EQ(dst.node_point_end_, src.node_point_end_);
+}
+
+TEST(LinearOctree, LocateLeafNode) {
+    geometry::PointCloud pc = CreateRandomPointCloud(1000);
+    geometry::LinearOctree octree(6);
+    octree.ConvertFromPointCloud(pc, 0.01);
+
+    std::vector<int> leaves = octree.LocateLeafNodes(pc.points_);
+    ASSERT_EQ(leaves.size(), pc.points_.size());
+    for (size_t i = 0; i < pc.points_.size(); ++i) {
+        ASSERT_GE(leaves[i], 0);
+        EXPECT_EQ(leaves[i], octree.LocateLeafNode(pc.points_[i]));
+        EXPECT_TRUE(octree.IsLeafNode(leaves[i]));
+        std::vector<int> indices = octree.GetPointIndices(leaves[i]);
+        EXPECT_NE(std::find(indices.begin(), indices.end(), int(i)),
+                  indices.end());
+    }
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(10, 10, 10)), -1);
+}
+
+TEST(LinearOctree, Search) {
+    geometry::PointCloud pc = CreateRandomPointCloud(1000);
+    geometry::LinearOctree octree(5);
+    octree.ConvertFromPointCloud(pc, 0.01);
+
+    std::vector<Eigen::Vector3d> queries(20);
+    Rand(queries, Eigen::Vector3d(-1.5, -1.5, -1.5), Eigen::Vector3d(2, 2, 3),
+         2);
+    for (const Eigen::Vector3d &query : queries) {
+        std::vector<double> distance2(pc.points_.size());
+        std::vector<int> order(pc.points_.size());
+        for (size_t i = 0; i < pc.points_.size(); ++i) {
+            distance2[i] = (pc.points_[i] - query).squaredNorm();
+        }
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return distance2[a] < distance2[b];
+        });
+
+        std::vector<int> indices;
+        std::vector<double> dists;
+        EXPECT_EQ(octree.SearchKNN(query, 10, indices, dists), 10);
+        for (int k = 0; k < 10; ++k) {
+            EXPECT_NEAR(dists[k], distance2[order[k]], 1e-12);
+        }
+
+        const double radius = 0.4;
+        size_t expected = std::count_if(
+                distance2.begin(), distance2.end(),
+                [&](double d2) { return d2 <= radius * radius; });
+        EXPECT_EQ(size_t(octree.SearchRadius(query, radius, indices, dists)),
+                  expected);
+        EXPECT_TRUE(std::is_sorted(dists.begin(), dists.end()));
+        for (int index : indices) {
+            EXPECT_LE(distance2[index], radius * radius);
+        }
+    }
+
+    geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(-0.5, 0, 0.5),
+                                          Eigen::Vector3d(0.5, 0.8, 2));
+    std::vector<int> expected;
+    for (size_t i = 0; i < pc.points_.size(); ++i) {
+        if ((pc.points_[i].array() >= bbox.min_bound_.array()).all() &&
+            (pc.points_[i].array() <= bbox.max_bound_.array()).all()) {
+            expected.push_back(int(i));
+        }
+    }
+    EXPECT_EQ(octree.SearchBoundingBox(bbox), expected);
+}
+
+TEST(LinearOctree, ExtractLevelOfDetail) {
+    geometry::PointCloud pc = CreateRandomPointCloud(1000);
+    geometry::LinearOctree octree(4);
+    octree.ConvertFromPointCloud(pc, 0.01);
+
+    auto root = octree.ExtractLevelOfDetail(0);
+    ASSERT_EQ(root->points_.size(), 1u);
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    for (const Eigen::Vector3d &point : pc.points_) {
+        centroid += point;
+    }
+    ExpectEQ(root->points_[0],
+             Eigen::Vector3d(centroid / double(pc.points_.size())));
+
+    for (size_t depth = 0; depth <= octree.max_depth_; ++depth) {
+        auto lod = octree.ExtractLevelOfDetail(depth);
+        EXPECT_EQ(lod->points_.size(), size_t(octree.level_offsets_[depth + 1] -
+                                              octree.level_offsets_[depth]));
+        EXPECT_TRUE(lod->HasColors());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
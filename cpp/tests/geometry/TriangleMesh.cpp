@@ -27,7 +27,9 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -454,6 +456,11 @@ TEST(TriangleMesh, ComputeVertexNormals) {
     tm.ComputeVertexNormals();
 
     ExpectEQ(ref, tm.vertex_normals_);
+
+    // Existing vertex normals are overwritten, not accumulated.
+    tm.ComputeVertexNormals();
+
+    ExpectEQ(ref, tm.vertex_normals_);
 }
 
 TEST(TriangleMesh, ComputeAdjacencyList) {
@@ -1066,6 +1073,55 @@ TEST(TriangleMesh, IsSelfIntersecting) {
     EXPECT_TRUE(mesh1.IsSelfIntersecting());
 }
 
+TEST(TriangleMesh, GetSelfIntersectingTriangles) {
+    EXPECT_TRUE(
+            geometry::TriangleMesh().GetSelfIntersectingTriangles().empty());
+    EXPECT_TRUE(geometry::TriangleMesh::CreateSphere()
+                        ->GetSelfIntersectingTriangles()
+                        .empty());
+
+    // Two overlapping spheres merged into one mesh, compared against testing
+    // every triangle pair.
+    geometry::TriangleMesh mesh = *geometry::TriangleMesh::CreateSphere(1.0);
+    geometry::TriangleMesh other = *geometry::TriangleMesh::CreateSphere(1.0);
+    other.Translate(Eigen::Vector3d(1.0, 0.2, 0.1));
+    mesh += other;
+
+    std::vector<Eigen::Vector2i> ref;
+    for (int i = 0; i < int(mesh.triangles_.size()); ++i) {
+        const Eigen::Vector3i &p = mesh.triangles_[i];
+        for (int j = i + 1; j < int(mesh.triangles_.size()); ++j) {
+            const Eigen::Vector3i &q = mesh.triangles_[j];
+            bool shares_vertex = false;
+            for (int k = 0; k < 3; ++k) {
+                shares_vertex |= p(k) == q(0) || p(k) == q(1) || p(k) == q(2);
+            }
+            if (!shares_vertex &&
+                geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh.vertices_[p(0)], mesh.vertices_[p(1)],
+                        mesh.vertices_[p(2)], mesh.vertices_[q(0)],
+                        mesh.vertices_[q(1)], mesh.vertices_[q(2)])) {
+                ref.emplace_back(i, j);
+            }
+        }
+    }
+    EXPECT_FALSE(ref.empty());
+    ExpectEQ(mesh.GetSelfIntersectingTriangles(), ref);
+    EXPECT_TRUE(mesh.IsSelfIntersecting());
+}
+
+TEST(TriangleMesh, IsIntersecting) {
+    geometry::TriangleMesh mesh = *geometry::TriangleMesh::CreateSphere(1.0);
+    geometry::TriangleMesh other = *geometry::TriangleMesh::CreateSphere(0.5);
+    // Nested spheres have overlapping bounding boxes but do not intersect.
+    EXPECT_TRUE(mesh.IsBoundingBoxIntersecting(other));
+    EXPECT_FALSE(mesh.IsIntersecting(other));
+    other.Translate(Eigen::Vector3d(0.8, 0, 0));
+    EXPECT_TRUE(mesh.IsIntersecting(other));
+    other.Translate(Eigen::Vector3d(2, 0, 0));
+    EXPECT_FALSE(mesh.IsIntersecting(other));
+}
+
 TEST(TriangleMesh, GetVolume) {
     EXPECT_NEAR(geometry::TriangleMesh::CreateBox()->GetVolume(), 1.0, 0.01);
     EXPECT_NEAR(geometry::TriangleMesh::CreateSphere()->GetVolume(),
@@ -1890,6 +1946,80 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudPoissonTiled) {
+    // Fibonacci samples of the unit sphere, reconstructed in 2 x 2 x 2 tiles.
+    geometry::PointCloud pcd;
+    const int n = 20000;
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int i = 0; i < n; ++i) {
+        const double z = 1.0 - 2.0 * (i + 0.5) / n;
+        const double r = std::sqrt(1.0 - z * z);
+        const Eigen::Vector3d point(r * std::cos(golden_angle * i),
+                                    r * std::sin(golden_angle * i), z);
+        pcd.points_.push_back(point);
+        pcd.normals_.push_back(point);
+    }
+
+    const std::string scratch_dir = "poisson_tiled_test";
+    EXPECT_TRUE(utility::filesystem::MakeDirectory(scratch_dir));
+
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::vector<double> densities;
+    std::tie(mesh, densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+                    pcd, 1.0, 5, false, 1, scratch_dir);
+    EXPECT_GT(mesh->triangles_.size(), 0u);
+    EXPECT_EQ(densities.size(), mesh->vertices_.size());
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+    }
+    EXPECT_TRUE(mesh->IsEdgeManifold(false));
+
+    // Stream the same points in small chunks through a small buffer. A single
+    // thread makes both reconstructions deterministic.
+    size_t begin = 0;
+    auto read_chunk = [&](geometry::PointCloud& chunk) {
+        if (begin >= pcd.points_.size()) {
+            return false;
+        }
+        const size_t end = std::min(begin + 1000, pcd.points_.size());
+        chunk.points_.assign(pcd.points_.begin() + begin,
+                             pcd.points_.begin() + end);
+        chunk.normals_.assign(pcd.normals_.begin() + begin,
+                              pcd.normals_.begin() + end);
+        begin = end;
+        return true;
+    };
+    std::shared_ptr<geometry::TriangleMesh> streamed;
+    std::tie(streamed, densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+                    read_chunk, 1.0, 5, false, 1, scratch_dir, 5000);
+    EXPECT_EQ(streamed->vertices_.size(), mesh->vertices_.size());
+    EXPECT_EQ(streamed->triangles_.size(), mesh->triangles_.size());
+
+    // Chunks have to agree with the first one on colors.
+    begin = 0;
+    auto read_chunk_colors = [&](geometry::PointCloud& chunk) {
+        const bool has_colors = begin > 0;
+        if (!read_chunk(chunk)) {
+            return false;
+        }
+        if (has_colors) {
+            chunk.colors_.assign(chunk.points_.size(),
+                                 Eigen::Vector3d(0.5, 0.5, 0.5));
+        }
+        return true;
+    };
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+            read_chunk_colors, 1.0, 5, false, 1, scratch_dir, 5000));
+
+    // The tile files are removed.
+    std::vector<std::string> filenames;
+    utility::filesystem::ListFilesInDirectory(scratch_dir, filenames);
+    EXPECT_TRUE(filenames.empty());
+    EXPECT_TRUE(utility::filesystem::DeleteDirectory(scratch_dir));
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -1915,6 +2045,54 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // Jittered samples of a smooth height field.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 40; ++i) {
+        for (int j = 0; j < 40; ++j) {
+            const double x = i + 0.3 * std::sin(7.0 * j + i);
+            const double y = j + 0.3 * std::cos(5.0 * i + j);
+            pcd.points_.emplace_back(x, y,
+                                     std::sin(0.1 * x) * std::cos(0.1 * y));
+            pcd.normals_.push_back(
+                    Eigen::Vector3d(
+                            -0.1 * std::cos(0.1 * x) * std::cos(0.1 * y),
+                            0.1 * std::sin(0.1 * x) * std::sin(0.1 * y), 1)
+                            .normalized());
+        }
+    }
+    const std::vector<double> radii = {1.0, 2.0};
+    auto single = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii, 1000);
+    EXPECT_GT(single->triangles_.size(), 0.95 * 2 * 39 * 39);
+    EXPECT_TRUE(single->IsEdgeManifold());
+
+    // 4 x 4 tiles, stitched into a manifold surface. The seams may be
+    // triangulated differently than in a single pass, so compare what the
+    // meshes cover rather than their triangles.
+    auto tiled = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii, 10);
+    EXPECT_TRUE(tiled->IsEdgeManifold());
+    EXPECT_TRUE(tiled->IsVertexManifold());
+    EXPECT_NEAR(double(tiled->triangles_.size()),
+                double(single->triangles_.size()),
+                0.01 * single->triangles_.size());
+    EXPECT_NEAR(tiled->GetSurfaceArea(), single->GetSurfaceArea(),
+                0.01 * single->GetSurfaceArea());
+
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            geometry::PointCloud(pcd.points_), radii));
+    // Tiles must be at least 4 times the largest radius.
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii, 7.9));
+    // The number of tiles must fit the bucketing keys.
+    geometry::PointCloud sparse;
+    sparse.points_ = {{0, 0, 0}, {1e8, 1e8, 1e8}};
+    sparse.normals_ = {{0, 0, 1}, {0, 0, 1}};
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            sparse, radii, 8));
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
@@ -29,7 +29,9 @@
 #include <json/json.h>
 
 #include <cstdio>
+#include <fstream>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/Octree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/io/PointCloudIO.h"
@@ -105,5 +107,53 @@ TEST(OctreeIO, JsonFileIOSevenCubes) {
     WriteReadAndAssertEqual(octree);
 }
 
+TEST(OctreeIO, LinearOctreeBinaryFileIO) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(utility::GetDataPathCommon("fragment.ply"), pcd);
+    geometry::LinearOctree src_octree(6);
+    src_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    std::string file_name = utility::GetDataPathCommon("temp_octree.bin");
+    EXPECT_TRUE(io::WriteLinearOctree(file_name, src_octree));
+    geometry::LinearOctree dst_octree;
+    EXPECT_TRUE(io::ReadLinearOctree(file_name, dst_octree));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    ExpectEQ(dst_octree.origin_, src_octree.origin_);
+    EXPECT_EQ(dst_octree.size_, src_octree.size_);
+    EXPECT_EQ(dst_octree.max_depth_, src_octree.max_depth_);
+    EXPECT_EQ(dst_octree.node_codes_, src_octree.node_codes_);
+    EXPECT_EQ(dst_octree.node_child_masks_, src_octree.node_child_masks_);
+    EXPECT_EQ(dst_octree.point_indices_, src_octree.point_indices_);
+    ExpectEQ(dst_octree.points_, src_octree.points_);
+    ExpectEQ(dst_octree.colors_, src_octree.colors_);
+    EXPECT_TRUE(*dst_octree.ToOctree() == *src_octree.ToOctree());
+}
+
+TEST(OctreeIO, LinearOctreeBinaryFileCorrupted) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1)};
+    geometry::LinearOctree src_octree(2);
+    src_octree.ConvertFromPointCloud(pcd, 0.01);
+    std::string file_name = utility::GetDataPathCommon("temp_octree.bin");
+
+    // Offset of the number of points in the header.
+    const std::streamoff num_points_offset = 8 + 4 + 4 + 3 * 8 + 8 + 1 + 8 + 8;
+    for (int64_t num_points : {int64_t(3), int64_t(1) << 60}) {
+        EXPECT_TRUE(io::WriteLinearOctree(file_name, src_octree));
+        {
+            std::fstream file(file_name, std::ios::binary | std::ios::in |
+                                                 std::ios::out);
+            file.seekp(num_points_offset);
+            file.write(reinterpret_cast<const char*>(&num_points),
+                       sizeof(num_points));
+        }
+        geometry::LinearOctree dst_octree;
+        EXPECT_FALSE(io::ReadLinearOctree(file_name, dst_octree));
+        EXPECT_TRUE(dst_octree.IsEmpty());
+    }
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/color_map/ColorMapUtils.h"
+
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+const int kWidth = 64;
+const int kHeight = 64;
+const double kFocal = 50;
+const double kCenter = 32;
+
+/// Adds a grid of nx * ny vertices with spacing step on the plane z.
+void AddPlane(geometry::TriangleMesh& mesh,
+              double x0,
+              double y0,
+              double step,
+              int nx,
+              int ny,
+              double z) {
+    const int offset = int(mesh.vertices_.size());
+    for (int j = 0; j < ny; ++j) {
+        for (int i = 0; i < nx; ++i) {
+            mesh.vertices_.emplace_back(x0 + i * step, y0 + j * step, z);
+        }
+    }
+    for (int j = 0; j + 1 < ny; ++j) {
+        for (int i = 0; i + 1 < nx; ++i) {
+            const int v00 = offset + i + j * nx;
+            const int v10 = v00 + 1, v01 = v00 + nx, v11 = v01 + 1;
+            mesh.triangles_.emplace_back(v00, v10, v11);
+            mesh.triangles_.emplace_back(v00, v11, v01);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ColorMapUtils, CreateVertexAndImageVisibilityByRaycasting) {
+    // A near plane at z = 1 covers the right part of the view of a far plane
+    // at z = 2. The vertices of the far plane project to pixel centers of the
+    // first camera, the edges of the near plane fall between pixels.
+    geometry::TriangleMesh mesh;
+    const double far_step = 0.04;
+    AddPlane(mesh, -1.4, -1.4, far_step, 71, 71, 2.0);
+    AddPlane(mesh, 0.112, -0.607, 0.02, 30, 61, 1.0);
+    const double near_min_x = 0.112, near_max_x = 0.112 + 29 * 0.02;
+    const double near_min_y = -0.607, near_max_y = -0.607 + 60 * 0.02;
+
+    camera::PinholeCameraTrajectory trajectory;
+    std::vector<geometry::Image> images_depth, images_mask;
+    for (double tx : {0.0, 0.013}) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.SetIntrinsics(kWidth, kHeight, kFocal, kFocal,
+                                            kCenter, kCenter);
+        parameters.extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters.extrinsic_(0, 3) = tx;
+        trajectory.parameters_.push_back(parameters);
+
+        // Depth seen at the projection (u, v) = (x, y) of pixel (x, y), as
+        // sampled by the rounded projections of the depth test.
+        geometry::Image depth, mask;
+        depth.Prepare(kWidth, kHeight, 1, 4);
+        mask.Prepare(kWidth, kHeight, 1, 1);
+        for (int y = 0; y < kHeight; ++y) {
+            for (int x = 0; x < kWidth; ++x) {
+                const double wx = (x - kCenter) / kFocal - tx;
+                const double wy = (y - kCenter) / kFocal;
+                const bool near = wx >= near_min_x && wx <= near_max_x &&
+                                  wy >= near_min_y && wy <= near_max_y;
+                *depth.PointerAt<float>(x, y) = near ? 1.0f : 2.0f;
+            }
+        }
+        images_depth.push_back(depth);
+        images_mask.push_back(mask);
+    }
+
+    std::vector<std::vector<int>> vertex_to_image, image_to_vertex;
+    std::tie(vertex_to_image, image_to_vertex) =
+            pipelines::color_map::CreateVertexAndImageVisibility(
+                    mesh, images_depth, images_mask, trajectory, 3.0, 0.03);
+    std::vector<std::vector<int>> vertex_to_image_raycast,
+            image_to_vertex_raycast;
+    std::tie(vertex_to_image_raycast, image_to_vertex_raycast) =
+            pipelines::color_map::CreateVertexAndImageVisibilityByRaycasting(
+                    mesh, images_depth, images_mask, trajectory, 3.0, 0.03);
+
+    // Without self occlusion beyond the depth images, both agree. In
+    // particular the far vertex projecting to pixel (37, 32) of the first
+    // camera, next to the left edge of the near plane, is visible in both.
+    const int far_vertex = 40 + 35 * 71;
+    ASSERT_EQ(image_to_vertex.size(), 2u);
+    EXPECT_EQ(vertex_to_image[far_vertex], std::vector<int>({0, 1}));
+    EXPECT_EQ(vertex_to_image_raycast[far_vertex], std::vector<int>({0, 1}));
+    EXPECT_GT(image_to_vertex[1].size(), 0u);
+    EXPECT_EQ(image_to_vertex_raycast, image_to_vertex);
+    EXPECT_EQ(vertex_to_image_raycast, vertex_to_image);
+}
+
+}  // namespace tests
+}  // namespace open3d
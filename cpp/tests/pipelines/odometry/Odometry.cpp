@@ -24,12 +24,87 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/odometry/Odometry.h"
+
+#include <cmath>
+
+#include "open3d/geometry/RGBDImage.h"
 #include "tests/Tests.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(Odometry, DISABLED_ComputeRGBDOdometry) { NotImplemented(); }
+// Smooth intensity pattern over a slanted plane, shifted by \p shift pixels.
+static geometry::RGBDImage CreateSyntheticRGBDImage(int width,
+                                                    int height,
+                                                    double shift) {
+    geometry::Image color;
+    geometry::Image depth;
+    color.Prepare(width, height, 1, 4);
+    depth.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            double x = u + shift;
+            *color.PointerAt<float>(u, v) = (float)(
+                    0.5 + 0.25 * std::sin(0.3 * x) * std::cos(0.25 * v));
+            *depth.PointerAt<float>(u, v) = (float)(1.0 + 0.002 * x);
+        }
+    }
+    return geometry::RGBDImage(color, depth);
+}
+
+static camera::PinholeCameraIntrinsic SyntheticIntrinsic() {
+    return camera::PinholeCameraIntrinsic(80, 60, 80.0, 80.0, 40.0, 30.0);
+}
+
+TEST(Odometry, ComputeRGBDOdometry) {
+    geometry::RGBDImage frame = CreateSyntheticRGBDImage(80, 60, 0.0);
+
+    bool success;
+    Eigen::Matrix4d trans;
+    Eigen::Matrix6d info;
+    std::tie(success, trans, info) = pipelines::odometry::ComputeRGBDOdometry(
+            frame, frame, SyntheticIntrinsic());
+    EXPECT_TRUE(success);
+    ExpectEQ(trans, Eigen::Matrix4d(Eigen::Matrix4d::Identity()), 1e-6);
+    EXPECT_GT(info(3, 3), 1.0);
+
+    // Mismatched image sizes.
+    geometry::RGBDImage small = CreateSyntheticRGBDImage(40, 30, 0.0);
+    std::tie(success, trans, info) = pipelines::odometry::ComputeRGBDOdometry(
+            small, frame, SyntheticIntrinsic());
+    EXPECT_FALSE(success);
+}
+
+TEST(Odometry, OdometrySession) {
+    const camera::PinholeCameraIntrinsic intrinsic = SyntheticIntrinsic();
+    std::vector<geometry::RGBDImage> frames;
+    for (int i = 0; i < 3; i++) {
+        frames.push_back(CreateSyntheticRGBDImage(80, 60, 0.5 * i));
+    }
+
+    pipelines::odometry::OdometrySession session(intrinsic);
+    EXPECT_FALSE(session.HasTarget());
+    EXPECT_FALSE(session.AdvanceTarget());
+    EXPECT_FALSE(std::get<0>(session.Compute(frames[1])));
+
+    EXPECT_TRUE(session.SetTarget(frames[0]));
+    EXPECT_TRUE(session.HasTarget());
+    for (int i = 1; i < 3; i++) {
+        bool success, ref_success;
+        Eigen::Matrix4d trans, ref_trans;
+        Eigen::Matrix6d info, ref_info;
+        std::tie(success, trans, info) = session.Compute(frames[i]);
+        std::tie(ref_success, ref_trans, ref_info) =
+                pipelines::odometry::ComputeRGBDOdometry(
+                        frames[i], frames[i - 1], intrinsic);
+        EXPECT_TRUE(success);
+        EXPECT_EQ(success, ref_success);
+        ExpectEQ(trans, ref_trans, 1e-8);
+        ExpectEQ(info, ref_info, 1e-6);
+        EXPECT_TRUE(session.AdvanceTarget());
+    }
+}
 
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { NotImplemented(); }
 
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/BoundingVolume.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class BoundingVolumePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(BoundingVolume,
+                         BoundingVolumePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(BoundingVolumePermuteDevices, AxisAlignedBoundingBox) {
+    core::Device device = GetParam();
+
+    t::geometry::AxisAlignedBoundingBox empty(device);
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_EQ(empty.GetDevice(), device);
+
+    t::geometry::AxisAlignedBoundingBox box(
+            core::Tensor::Init<float>({0, 0, 0}, device),
+            core::Tensor::Init<float>({1, 2, 3}, device));
+    EXPECT_FALSE(box.IsEmpty());
+    EXPECT_DOUBLE_EQ(box.Volume(), 6);
+    EXPECT_DOUBLE_EQ(box.GetMaxExtent(), 3);
+    EXPECT_TRUE(box.GetCenter().AllClose(
+            core::Tensor::Init<float>({0.5, 1, 1.5}, device)));
+    EXPECT_TRUE(box.GetBoxPoints().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {1, 0, 0},
+                                       {0, 2, 0},
+                                       {0, 0, 3},
+                                       {1, 2, 3},
+                                       {0, 2, 3},
+                                       {1, 0, 3},
+                                       {1, 2, 0}},
+                                      device)));
+
+    core::Tensor points = core::Tensor::Init<float>(
+            {{0.5, 0.5, 0.5}, {1, 2, 3}, {1.5, 0, 0}, {0, -0.1, 0}}, device);
+    EXPECT_TRUE(box.GetPointMaskWithinBoundingBox(points).AllEqual(
+            core::Tensor::Init<bool>({true, true, false, false}, device)));
+    EXPECT_TRUE(box.GetPointIndicesWithinBoundingBox(points).AllEqual(
+            core::Tensor::Init<int64_t>({0, 1}, device)));
+
+    t::geometry::AxisAlignedBoundingBox from_points =
+            t::geometry::AxisAlignedBoundingBox::CreateFromPoints(points);
+    EXPECT_TRUE(from_points.GetMinBound().AllClose(
+            core::Tensor::Init<float>({0, -0.1, 0}, device)));
+    EXPECT_TRUE(from_points.GetMaxBound().AllClose(
+            core::Tensor::Init<float>({1.5, 2, 3}, device)));
+
+    geometry::AxisAlignedBoundingBox legacy = box.ToLegacy();
+    EXPECT_EQ(legacy.min_bound_, Eigen::Vector3d(0, 0, 0));
+    EXPECT_EQ(legacy.max_bound_, Eigen::Vector3d(1, 2, 3));
+    t::geometry::AxisAlignedBoundingBox from_legacy =
+            t::geometry::AxisAlignedBoundingBox::FromLegacy(
+                    legacy, core::Float64, device);
+    EXPECT_EQ(from_legacy.GetDtype(), core::Float64);
+    EXPECT_TRUE(from_legacy.GetMaxBound().AllClose(
+            core::Tensor::Init<double>({1, 2, 3}, device)));
+}
+
+TEST_P(BoundingVolumePermuteDevices, OrientedBoundingBox) {
+    core::Device device = GetParam();
+
+    // A 2 x 1 x 1 box rotated by 90 degrees around z, i.e. its long axis is
+    // along y.
+    core::Tensor R = core::Tensor::Init<double>(
+            {{0, -1, 0}, {1, 0, 0}, {0, 0, 1}}, device);
+    t::geometry::OrientedBoundingBox box(
+            core::Tensor::Init<double>({1, 1, 1}, device), R,
+            core::Tensor::Init<double>({2, 1, 1}, device));
+    EXPECT_DOUBLE_EQ(box.Volume(), 2);
+    EXPECT_TRUE(box.GetMinBound().AllClose(
+            core::Tensor::Init<double>({0.5, 0, 0.5}, device)));
+    EXPECT_TRUE(box.GetMaxBound().AllClose(
+            core::Tensor::Init<double>({1.5, 2, 1.5}, device)));
+
+    core::Tensor points = core::Tensor::Init<double>(
+            {{1, 1.9, 1}, {1.9, 1, 1}, {1, 1, 1}, {1, 2.1, 1}}, device);
+    EXPECT_TRUE(box.GetPointMaskWithinBoundingBox(points).AllEqual(
+            core::Tensor::Init<bool>({true, false, true, false}, device)));
+
+    t::geometry::AxisAlignedBoundingBox aabb = box.GetAxisAlignedBoundingBox();
+    EXPECT_TRUE(aabb.GetMinBound().AllClose(box.GetMinBound()));
+    t::geometry::OrientedBoundingBox from_aabb =
+            t::geometry::OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
+                    aabb);
+    EXPECT_TRUE(from_aabb.GetCenter().AllClose(box.GetCenter()));
+    EXPECT_TRUE(from_aabb.GetExtent().AllClose(
+            core::Tensor::Init<double>({1, 2, 1}, device)));
+
+    // Points along a tilted line segment with a small spread.
+    core::Tensor line = core::Tensor::Init<float>({{0, 0, 0},
+                                                   {1, 1, 0},
+                                                   {2, 2, 0},
+                                                   {3, 3, 0},
+                                                   {1.5, 1.6, 0},
+                                                   {1.5, 1.4, 0}},
+                                                  device);
+    t::geometry::OrientedBoundingBox fit =
+            t::geometry::OrientedBoundingBox::CreateFromPoints(line);
+    EXPECT_EQ(fit.GetDtype(), core::Float32);
+    // All points lie on the box, up to rounding.
+    t::geometry::OrientedBoundingBox padded(fit.GetCenter(), fit.GetRotation(),
+                                            fit.GetExtent() + 1e-4);
+    EXPECT_TRUE(padded.GetPointMaskWithinBoundingBox(line).All());
+    EXPECT_NEAR(fit.GetExtent()[0].Item<float>(), 3 * std::sqrt(2.f), 1e-4);
+    EXPECT_LT(fit.Volume(), 1e-6);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -31,6 +31,7 @@
 #include "core/CoreTest.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/geometry/RGBDImagePyramid.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/utility/Preprocessor.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
@@ -852,6 +853,69 @@ TEST_P(ImagePermuteDevices, DepthToVertexNormalMaps) {
     EXPECT_TRUE(normal_map.AsTensor().AllClose(t_normal_ref));
 }
 
+TEST_P(ImagePermuteDevices, RGBDImagePyramid) {
+    core::Device device = GetParam();
+
+    t::geometry::Image depth =
+            t::io::CreateImageFromFile(
+                    utility::GetDataPathCommon("RGBD/depth/00000.png"))
+                    ->To(device);
+    t::geometry::Image color =
+            t::io::CreateImageFromFile(
+                    utility::GetDataPathCommon("RGBD/color/00000.jpg"))
+                    ->To(device);
+
+    const float depth_diff = 0.07f;
+    t::geometry::RGBDImagePyramid pyramid(
+            t::geometry::RGBDImage(color, depth), CreateIntrinsics(), 3,
+            1000.0f, 3.0f, depth_diff);
+    ASSERT_EQ(pyramid.GetNumLevels(), 3);
+    EXPECT_EQ(pyramid.GetDevice(), device);
+    EXPECT_ANY_THROW(pyramid.GetDepth(3));
+
+    // Invalid pixels are NaN, which never compare equal.
+    auto expect_equal = [](const core::Tensor &a, const core::Tensor &b) {
+        ASSERT_EQ(a.GetShape(), b.GetShape());
+        core::Tensor a_nan = a.IsNan();
+        EXPECT_TRUE(a_nan.AllEqual(b.IsNan()));
+        core::Tensor a_valid = a.Clone();
+        core::Tensor b_valid = b.Clone();
+        a_valid.SetItem(core::TensorKey::IndexTensor(a_nan),
+                        core::Tensor::Init<float>(0, a.GetDevice()));
+        b_valid.SetItem(core::TensorKey::IndexTensor(a_nan),
+                        core::Tensor::Init<float>(0, b.GetDevice()));
+        EXPECT_TRUE(a_valid.AllEqual(b_valid));
+    };
+
+    // Levels are ordered from coarse to fine and match the unfused image
+    // operations.
+    t::geometry::Image depth_ref = depth.ClipTransform(1000.0, 0.0, 3.0, NAN);
+    for (int64_t level = 2; level >= 0; --level) {
+        const core::Tensor &intrinsics = pyramid.GetIntrinsics(level);
+        EXPECT_TRUE(intrinsics.AllClose(
+                CreateIntrinsics(static_cast<float>(1 << (2 - level)))));
+        expect_equal(pyramid.GetDepth(level).AsTensor(), depth_ref.AsTensor());
+        expect_equal(pyramid.GetVertexMap(level).AsTensor(),
+                     depth_ref.CreateVertexMap(intrinsics, NAN).AsTensor());
+        depth_ref = depth_ref.PyrDownDepth(depth_diff * 2, NAN);
+    }
+
+    // Lazily computed levels are cached and shared by copies.
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        EXPECT_THROW(pyramid.GetIntensity(0), std::runtime_error);
+    } else {
+        t::geometry::RGBDImagePyramid pyramid_copy = pyramid;
+        EXPECT_EQ(pyramid.GetIntensity(2).GetRows(), depth.GetRows());
+        EXPECT_EQ(pyramid.GetIntensity(0).GetRows(),
+                  pyramid.GetDepth(0).GetRows());
+        EXPECT_EQ(pyramid_copy.GetIntensity(1).GetDataPtr(),
+                  pyramid.GetIntensity(1).GetDataPtr());
+        EXPECT_EQ(pyramid_copy.GetNormalMap(1).GetDataPtr(),
+                  pyramid.GetNormalMap(1).GetDataPtr());
+    }
+}
+
 TEST_P(ImagePermuteDevices, DISABLED_CreateVertexMap_Visual) {
     core::Device device = GetParam();
 
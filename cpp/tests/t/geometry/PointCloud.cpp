@@ -324,6 +324,34 @@ TEST_P(PointCloudPermuteDevices, FromLegacy) {
             core::Tensor::Ones({2, 3}, dtype, device)));
 }
 
+TEST(PointCloud, FromLegacyView) {
+    geometry::PointCloud legacy_pcd;
+    legacy_pcd.points_ = std::vector<Eigen::Vector3d>{Eigen::Vector3d(0, 0, 0),
+                                                      Eigen::Vector3d(1, 2, 3)};
+    legacy_pcd.normals_ = std::vector<Eigen::Vector3d>{
+            Eigen::Vector3d(0, 0, 1), Eigen::Vector3d(0, 0, 1)};
+
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyView(legacy_pcd);
+    EXPECT_TRUE(pcd.HasPointPositions());
+    EXPECT_FALSE(pcd.HasPointColors());
+    EXPECT_TRUE(pcd.HasPointNormals());
+    EXPECT_EQ(pcd.GetDevice(), core::Device("CPU:0"));
+    EXPECT_EQ(pcd.GetPointPositions().GetDtype(), core::Float64);
+    EXPECT_EQ(pcd.GetPointPositions().GetDataPtr(),
+              static_cast<void *>(legacy_pcd.points_.data()));
+
+    // In-place tensor operations are visible in the legacy point cloud.
+    pcd.Translate(core::Tensor::Init<double>({1, 1, 1}));
+    EXPECT_EQ(legacy_pcd.points_[1], Eigen::Vector3d(2, 3, 4));
+
+    // The copying conversion stays independent.
+    t::geometry::PointCloud pcd_copy = t::geometry::PointCloud::FromLegacy(
+            legacy_pcd, core::Float64, core::Device("CPU:0"));
+    EXPECT_NE(pcd_copy.GetPointPositions().GetDataPtr(),
+              static_cast<void *>(legacy_pcd.points_.data()));
+}
+
 TEST_P(PointCloudPermuteDevices, ToLegacy) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Float32;
@@ -694,5 +722,226 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, VoxelDownSampleReduction) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Init<float>({{0.1, 0.3, 0.9},
+                                       {0.9, 0.2, 0.4},
+                                       {0.3, 0.6, 0.8},
+                                       {0.2, 0.4, 0.2}},
+                                      device));
+    pcd.SetPointColors(core::Tensor::Init<uint8_t>(
+            {{10, 20, 30}, {20, 30, 40}, {30, 40, 50}, {40, 50, 60}}, device));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Init<float>({0.5, 0.9, 0.1, 0.3}, device));
+    pcd.SetPointAttr("labels",
+                     core::Tensor::Init<int32_t>({2, 1, 2, 3}, device));
+    pcd.SetPointAttr(
+            "valid",
+            core::Tensor::Init<bool>({false, true, true, true}, device));
+    using Reduction = t::geometry::PointCloud::VoxelReductionType;
+
+    // Mean: integer and Bool attributes keep the value of the first point.
+    auto pcd_down = pcd.VoxelDownSample(1, Reduction::Mean);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.375, 0.375, 0.575}}, device)));
+    EXPECT_TRUE(pcd_down.GetPointColors().AllEqual(
+            core::Tensor::Init<uint8_t>({{10, 20, 30}}, device)));
+    EXPECT_TRUE(pcd_down.GetPointAttr("intensities").AllClose(
+            core::Tensor::Init<float>({0.45}, device)));
+    EXPECT_TRUE(pcd_down.GetPointAttr("labels").AllEqual(
+            core::Tensor::Init<int32_t>({2}, device)));
+    EXPECT_TRUE(pcd_down.GetPointAttr("valid").AllEqual(
+            core::Tensor::Init<bool>({false}, device)));
+
+    // CentroidNearest.
+    pcd_down = pcd.VoxelDownSample(1, Reduction::CentroidNearest);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.3, 0.6, 0.8}}, device)));
+    EXPECT_TRUE(pcd_down.GetPointColors().AllClose(
+            core::Tensor::Init<uint8_t>({{30, 40, 50}}, device)));
+
+    // MaxIntensity.
+    pcd_down = pcd.VoxelDownSample(1, Reduction::MaxIntensity);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.9, 0.2, 0.4}}, device)));
+    EXPECT_TRUE(pcd_down.GetPointAttr("labels").AllClose(
+            core::Tensor::Init<int32_t>({1}, device)));
+
+    // MajorityLabel: positions are averaged over the points labeled 2.
+    pcd_down = pcd.VoxelDownSample(1, Reduction::MajorityLabel);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.2, 0.45, 0.85}}, device)));
+    EXPECT_TRUE(pcd_down.GetPointAttr("labels").AllClose(
+            core::Tensor::Init<int32_t>({2}, device)));
+    pcd.GetPointAttr("valid")[0] = true;
+    pcd.GetPointAttr("valid")[2] = false;
+    pcd_down = pcd.VoxelDownSample(1, Reduction::MajorityLabel);
+    EXPECT_TRUE(pcd_down.GetPointAttr("valid").AllEqual(
+            core::Tensor::Init<bool>({true}, device)));
+
+    // Multiple voxels keep all attributes in sync.
+    pcd_down = pcd.VoxelDownSample(0.65, Reduction::Mean);
+    EXPECT_EQ(pcd_down.GetPointPositions().GetLength(), 3);
+    EXPECT_EQ(pcd_down.GetPointColors().GetLength(), 3);
+    EXPECT_EQ(pcd_down.GetPointAttr("labels").GetLength(), 3);
+    EXPECT_NEAR(pcd_down.GetPointAttr("intensities").Sum({0}).Item<float>(),
+                0.3 + 0.9 + 0.3, 1e-5);
+
+    // Missing attribute.
+    t::geometry::PointCloud pcd_no_labels(pcd.GetPointPositions());
+    EXPECT_ANY_THROW(
+            pcd_no_labels.VoxelDownSample(1, Reduction::MajorityLabel));
+}
+
+TEST_P(PointCloudPermuteDevices, FarthestPointDownSample) {
+    core::Device device = GetParam();
+
+    // Points on a line at x = 0, 1, ..., 9.
+    core::Tensor positions =
+            core::Tensor::Zeros({10, 3}, core::Float32, device);
+    positions.Slice(1, 0, 1) =
+            core::Tensor::Arange(0, 10, 1, core::Float32, device)
+                    .Reshape({10, 1});
+    t::geometry::PointCloud pcd(positions);
+    pcd.SetPointAttr("labels",
+                     core::Tensor::Arange(0, 10, 1, core::Int32, device));
+
+    auto pcd_down = pcd.FarthestPointDownSample(3);
+    EXPECT_TRUE(pcd_down.GetPointAttr("labels").AllClose(
+            core::Tensor::Init<int32_t>({0, 9, 4}, device)));
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {9, 0, 0}, {4, 0, 0}},
+                                      device)));
+
+    pcd_down = pcd.FarthestPointDownSample(2, 3);
+    EXPECT_TRUE(pcd_down.GetPointAttr("labels").AllClose(
+            core::Tensor::Init<int32_t>({3, 9}, device)));
+
+    // Approximate mode: one candidate per voxel of size 2.
+    pcd_down = pcd.FarthestPointDownSample(5, 0, 2.0);
+    EXPECT_EQ(pcd_down.GetPointPositions().GetLength(), 5);
+    core::Tensor voxels =
+            (pcd_down.GetPointPositions().Slice(1, 0, 1) / 2).Floor();
+    EXPECT_EQ(voxels.Reshape({5}).To(core::Int64).Sum({0}).Item<int64_t>(),
+              0 + 1 + 2 + 3 + 4);
+
+    EXPECT_ANY_THROW(pcd.FarthestPointDownSample(11));
+    EXPECT_ANY_THROW(pcd.FarthestPointDownSample(6, 0, 2.0));
+}
+
+TEST_P(PointCloudPermuteDevices, PoissonDiskDownSample) {
+    core::Device device = GetParam();
+
+    // 11 x 11 grid with spacing 0.1.
+    std::vector<float> points;
+    for (int i = 0; i <= 10; ++i) {
+        for (int j = 0; j <= 10; ++j) {
+            points.insert(points.end(), {0.1f * i, 0.1f * j, 0.0f});
+        }
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {121, 3}, core::Float32, device));
+    const float radius = 0.25;
+    auto pcd_down = pcd.PoissonDiskDownSample(radius);
+
+    core::Tensor samples =
+            pcd_down.GetPointPositions().To(core::Device("CPU:0"));
+    const int64_t num_samples = samples.GetLength();
+    EXPECT_GT(num_samples, 4);
+    EXPECT_LT(num_samples, 121);
+
+    // No two samples are closer than radius.
+    for (int64_t i = 0; i < num_samples; ++i) {
+        core::Tensor diff = samples - samples[i];
+        core::Tensor dists = (diff * diff).Sum({1}).Sqrt();
+        EXPECT_EQ(dists.Lt(radius).To(core::Int64).Sum({0}).Item<int64_t>(), 1);
+    }
+
+    // The sampling is maximal: every point is within radius of a sample.
+    core::Tensor all = pcd.GetPointPositions().To(core::Device("CPU:0"));
+    for (int64_t i = 0; i < all.GetLength(); ++i) {
+        core::Tensor diff = samples - all[i];
+        core::Tensor dists = (diff * diff).Sum({1}).Sqrt();
+        EXPECT_LT(dists.Min({0}).Item<float>(), radius);
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, SelectByMask) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}}, device));
+    pcd.SetPointColors(
+            core::Tensor::Init<float>({{0}, {10}, {20}, {30}}, device)
+                    .Expand({4, 3})
+                    .Contiguous());
+    core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, true, false}, device);
+
+    t::geometry::PointCloud selected = pcd.SelectByMask(mask);
+    EXPECT_TRUE(selected.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {2, 2, 2}}, device)));
+    EXPECT_TRUE(selected.GetPointColors().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {20, 20, 20}}, device)));
+
+    t::geometry::PointCloud inverted = pcd.SelectByMask(mask, true);
+    EXPECT_TRUE(inverted.GetPointColors().AllClose(
+            core::Tensor::Init<float>({{10, 10, 10}, {30, 30, 30}}, device)));
+
+    EXPECT_ANY_THROW(pcd.SelectByMask(core::Tensor::Init<bool>(
+            {true, false}, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, SelectByIndex) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}}, device));
+    core::Tensor indices = core::Tensor::Init<int64_t>({3, 1, 3}, device);
+
+    EXPECT_TRUE(pcd.SelectByIndex(indices).GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{3, 3, 3}, {1, 1, 1}, {3, 3, 3}},
+                                      device)));
+    EXPECT_TRUE(pcd.SelectByIndex(indices, false, true)
+                        .GetPointPositions()
+                        .AllClose(core::Tensor::Init<float>(
+                                {{1, 1, 1}, {3, 3, 3}}, device)));
+    EXPECT_TRUE(pcd.SelectByIndex(indices.To(core::Int32), true)
+                        .GetPointPositions()
+                        .AllClose(core::Tensor::Init<float>(
+                                {{0, 0, 0}, {2, 2, 2}}, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, Crop) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}}, device));
+    pcd.SetPointNormals(pcd.GetPointPositions() * 2);
+
+    t::geometry::AxisAlignedBoundingBox aabb(
+            core::Tensor::Init<float>({0.5, 0.5, 0.5}, device),
+            core::Tensor::Init<float>({2, 2, 2}, device));
+    t::geometry::PointCloud cropped = pcd.Crop(aabb);
+    EXPECT_TRUE(cropped.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{1, 1, 1}, {2, 2, 2}}, device)));
+    EXPECT_TRUE(cropped.GetPointNormals().AllClose(
+            core::Tensor::Init<float>({{2, 2, 2}, {4, 4, 4}}, device)));
+    EXPECT_EQ(pcd.Crop(aabb, true).GetPointPositions().GetLength(), 2);
+
+    t::geometry::OrientedBoundingBox obb =
+            t::geometry::OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
+                    aabb);
+    EXPECT_TRUE(pcd.Crop(obb).GetPointPositions().AllClose(
+            cropped.GetPointPositions()));
+
+    t::geometry::AxisAlignedBoundingBox bounds =
+            pcd.GetAxisAlignedBoundingBox();
+    EXPECT_TRUE(bounds.GetMinBound().AllClose(pcd.GetMinBound()));
+    EXPECT_TRUE(bounds.GetMaxBound().AllClose(pcd.GetMaxBound()));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -26,7 +26,12 @@
 
 #include "open3d/t/geometry/TriangleMesh.h"
 
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorCheck.h"
 #include "tests/Tests.h"
 
@@ -393,6 +398,68 @@ TEST_P(TriangleMeshPermuteDevices, FromLegacy) {
             core::Tensor::Ones({2, 3}, float_dtype, device) * 4));
 }
 
+TEST(TriangleMesh, FromLegacyView) {
+    geometry::TriangleMesh legacy_mesh;
+    legacy_mesh.vertices_ = std::vector<Eigen::Vector3d>{
+            Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 0, 0),
+            Eigen::Vector3d(0, 1, 0)};
+    legacy_mesh.vertex_normals_ = std::vector<Eigen::Vector3d>(
+            3, Eigen::Vector3d(0, 0, 1));
+    legacy_mesh.triangles_ =
+            std::vector<Eigen::Vector3i>{Eigen::Vector3i(0, 1, 2)};
+
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyView(legacy_mesh);
+    EXPECT_TRUE(mesh.HasVertexPositions());
+    EXPECT_TRUE(mesh.HasVertexNormals());
+    EXPECT_FALSE(mesh.HasVertexColors());
+    EXPECT_TRUE(mesh.HasTriangleIndices());
+    EXPECT_FALSE(mesh.HasTriangleNormals());
+    EXPECT_EQ(mesh.GetDevice(), core::Device("CPU:0"));
+    EXPECT_EQ(mesh.GetVertexPositions().GetDtype(), core::Float64);
+    EXPECT_EQ(mesh.GetTriangleIndices().GetDtype(), core::Int32);
+    EXPECT_EQ(mesh.GetVertexPositions().GetDataPtr(),
+              static_cast<void*>(legacy_mesh.vertices_.data()));
+    EXPECT_EQ(mesh.GetVertexNormals().GetDataPtr(),
+              static_cast<void*>(legacy_mesh.vertex_normals_.data()));
+    EXPECT_EQ(mesh.GetTriangleIndices().GetDataPtr(),
+              static_cast<void*>(legacy_mesh.triangles_.data()));
+
+    // In-place tensor operations are visible in the legacy mesh, and the
+    // other way around.
+    mesh.GetVertexPositions().Mul_(2);
+    EXPECT_EQ(legacy_mesh.vertices_[1], Eigen::Vector3d(2, 0, 0));
+    legacy_mesh.triangles_[0] = Eigen::Vector3i(2, 1, 0);
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int>({{2, 1, 0}})));
+
+    // Attributes that do not match the legacy layout are copied back:
+    // a strided Float64 slice, Float32 colors and Int64 triangles.
+    core::Tensor padded = core::Tensor::Init<double>(
+            {{0, 0, 0, -1}, {1, 0, 0, -1}, {0, 1, 0, -1}});
+    mesh.SetVertexPositions(padded.Slice(1, 0, 3));
+    EXPECT_FALSE(mesh.GetVertexPositions().IsContiguous());
+    mesh.SetVertexColors(core::Tensor::Init<float>(
+            {{0.5, 0, 0}, {0, 0.5, 0}, {0, 0, 0.5}}));
+    mesh.SetTriangleIndices(core::Tensor::Init<int64_t>({{0, 2, 1}}));
+
+    geometry::TriangleMesh copied = mesh.ToLegacy();
+    EXPECT_EQ(copied.vertices_,
+              std::vector<Eigen::Vector3d>({Eigen::Vector3d(0, 0, 0),
+                                            Eigen::Vector3d(1, 0, 0),
+                                            Eigen::Vector3d(0, 1, 0)}));
+    EXPECT_EQ(copied.vertex_colors_,
+              std::vector<Eigen::Vector3d>({Eigen::Vector3d(0.5, 0, 0),
+                                            Eigen::Vector3d(0, 0.5, 0),
+                                            Eigen::Vector3d(0, 0, 0.5)}));
+    EXPECT_EQ(copied.triangles_,
+              std::vector<Eigen::Vector3i>({Eigen::Vector3i(0, 2, 1)}));
+    EXPECT_NE(static_cast<void*>(copied.vertices_.data()), padded.GetDataPtr());
+
+    // The legacy mesh keeps the values written through the view.
+    EXPECT_EQ(legacy_mesh.vertices_[1], Eigen::Vector3d(2, 0, 0));
+}
+
 TEST_P(TriangleMeshPermuteDevices, ToLegacy) {
     core::Device device = GetParam();
 
@@ -426,5 +493,524 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacy) {
                       {Eigen::Vector3d(4, 4, 4), Eigen::Vector3d(4, 4, 4)}));
 }
 
+// Creates a flat n x n vertex grid in the z = 0 plane with unit spacing.
+static t::geometry::TriangleMesh CreateGridMesh(int64_t n,
+                                                const core::Device& device) {
+    std::vector<float> positions;
+    std::vector<int64_t> triangles;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            positions.insert(positions.end(), {float(i), float(j), 0.f});
+        }
+    }
+    for (int64_t j = 0; j + 1 < n; ++j) {
+        for (int64_t i = 0; i + 1 < n; ++i) {
+            int64_t a = i + n * j, b = a + 1, c = a + n + 1, d = a + n;
+            triangles.insert(triangles.end(), {a, b, c, a, c, d});
+        }
+    }
+    int64_t num_triangles = static_cast<int64_t>(triangles.size()) / 3;
+    return t::geometry::TriangleMesh(
+            core::Tensor(positions, {n * n, 3}, core::Float32, device),
+            core::Tensor(triangles, {num_triangles, 3}, core::Int64, device));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SimplifyVertexClustering) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh = CreateGridMesh(3, device);
+    mesh.SetVertexColors(mesh.GetVertexPositions().Clone());
+
+    // Clusters {0, 1} x {0, 1}, {2} x {0, 1}, {0, 1} x {2} and {2} x {2}.
+    // Only the two triangles of the last quad span three clusters.
+    t::geometry::TriangleMesh simplified = mesh.SimplifyVertexClustering(1.5);
+    EXPECT_EQ(simplified.GetVertexPositions().GetLength(), 4);
+    EXPECT_EQ(simplified.GetTriangleIndices().GetLength(), 2);
+    EXPECT_EQ(simplified.GetTriangleIndices().GetDtype(), core::Int64);
+
+    // Flat clusters fall back to the mean position.
+    std::vector<float> positions =
+            simplified.GetVertexPositions().ToFlatVector<float>();
+    std::vector<std::vector<float>> xyz;
+    for (size_t i = 0; i < positions.size(); i += 3) {
+        xyz.push_back({positions[i], positions[i + 1], positions[i + 2]});
+    }
+    std::sort(xyz.begin(), xyz.end());
+    std::vector<std::vector<float>> expected_xyz = {
+            {0.5, 0.5, 0}, {0.5, 2, 0}, {2, 0.5, 0}, {2, 2, 0}};
+    EXPECT_EQ(xyz, expected_xyz);
+    EXPECT_TRUE(simplified.GetVertexColors().AllClose(
+            simplified.GetVertexPositions()));
+
+    // Both triangles keep their counter-clockwise orientation.
+    core::Tensor triangles = simplified.GetTriangleIndices();
+    core::Tensor p0 = simplified.GetVertexPositions().IndexGet(
+            {triangles.Slice(1, 0, 1).Reshape({-1})});
+    core::Tensor p1 = simplified.GetVertexPositions().IndexGet(
+            {triangles.Slice(1, 1, 2).Reshape({-1})});
+    core::Tensor p2 = simplified.GetVertexPositions().IndexGet(
+            {triangles.Slice(1, 2, 3).Reshape({-1})});
+    core::Tensor e1 = p1 - p0;
+    core::Tensor e2 = p2 - p0;
+    core::Tensor nz = e1.Slice(1, 0, 1) * e2.Slice(1, 1, 2) -
+                      e1.Slice(1, 1, 2) * e2.Slice(1, 0, 1);
+    EXPECT_TRUE(nz.Gt(0).All());
+
+    EXPECT_ANY_THROW(mesh.SimplifyVertexClustering(0));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SimplifyQuadricDecimation) {
+    core::Device device = GetParam();
+
+    // Large enough to be split into several cells.
+    t::geometry::TriangleMesh mesh = CreateGridMesh(32, device);
+    mesh.SetVertexColors(mesh.GetVertexPositions().Clone());
+    const int64_t num_triangles = mesh.GetTriangleIndices().GetLength();
+
+    t::geometry::TriangleMesh simplified = mesh.SimplifyQuadricDecimation(0.9);
+    const int64_t num_vertices = simplified.GetVertexPositions().GetLength();
+    const int64_t target = num_triangles / 10 + 1;
+    EXPECT_LE(simplified.GetTriangleIndices().GetLength(), target + 1);
+    EXPECT_GT(simplified.GetTriangleIndices().GetLength(), 0);
+    EXPECT_LT(num_vertices, mesh.GetVertexPositions().GetLength());
+    EXPECT_EQ(simplified.GetDevice(), device);
+    EXPECT_EQ(simplified.GetVertexColors().GetLength(), num_vertices);
+
+    // The plane and its boundary are preserved.
+    core::Tensor positions = simplified.GetVertexPositions();
+    EXPECT_TRUE(positions.Slice(1, 2, 3).AllClose(
+            core::Tensor::Zeros({num_vertices, 1}, core::Float32, device)));
+    EXPECT_TRUE(simplified.GetMinBound().AllClose(
+            core::Tensor::Init<float>({0, 0, 0}, device)));
+    EXPECT_TRUE(simplified.GetMaxBound().AllClose(
+            core::Tensor::Init<float>({31, 31, 0}, device)));
+
+    core::Tensor triangles = simplified.GetTriangleIndices();
+    EXPECT_TRUE(triangles.Ge(0).All());
+    EXPECT_TRUE(triangles.Lt(num_vertices).All());
+
+    // No reduction keeps the mesh.
+    t::geometry::TriangleMesh same = mesh.SimplifyQuadricDecimation(0);
+    EXPECT_EQ(same.GetTriangleIndices().GetLength(), num_triangles);
+
+    EXPECT_ANY_THROW(mesh.SimplifyQuadricDecimation(1.0));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SelectByIndex) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh = CreateGridMesh(3, device);
+    mesh.SetTriangleColors(
+            core::Tensor::Arange(0, 8, 1, core::Float32, device)
+                    .Reshape({8, 1})
+                    .Expand({8, 3})
+                    .Contiguous());
+
+    // The first two rows of vertices hold the two triangles of the first
+    // two quads.
+    t::geometry::TriangleMesh selected = mesh.SelectByIndex(
+            core::Tensor::Init<int64_t>({4, 0, 1, 2, 3, 5, 4}, device));
+    EXPECT_EQ(selected.GetVertexPositions().GetLength(), 6);
+    EXPECT_TRUE(selected.GetVertexPositions().AllClose(
+            mesh.GetVertexPositions().Slice(0, 0, 6)));
+    EXPECT_TRUE(selected.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int64_t>(
+                    {{0, 1, 4}, {0, 4, 3}, {1, 2, 5}, {1, 5, 4}}, device)));
+    EXPECT_TRUE(selected.GetTriangleColors().Slice(1, 0, 1).AllClose(
+            core::Tensor::Init<float>({{0}, {1}, {2}, {3}}, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, Crop) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh = CreateGridMesh(3, device);
+    t::geometry::AxisAlignedBoundingBox aabb(
+            core::Tensor::Init<float>({0.5, 0.5, -1}, device),
+            core::Tensor::Init<float>({2, 2, 1}, device));
+
+    // Only the last quad has all its vertices inside the box.
+    t::geometry::TriangleMesh cropped = mesh.Crop(aabb);
+    EXPECT_EQ(cropped.GetVertexPositions().GetLength(), 4);
+    EXPECT_TRUE(cropped.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int64_t>({{0, 1, 3}, {0, 3, 2}}, device)));
+
+    t::geometry::TriangleMesh outside = mesh.Crop(aabb, true);
+    EXPECT_EQ(outside.GetVertexPositions().GetLength(), 5);
+    EXPECT_EQ(outside.GetTriangleIndices().GetLength(), 0);
+
+    EXPECT_TRUE(mesh.GetAxisAlignedBoundingBox().GetMaxBound().AllClose(
+            core::Tensor::Init<float>({2, 2, 0}, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SelfIntersection) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh = CreateGridMesh(3, device);
+    EXPECT_FALSE(mesh.IsSelfIntersecting());
+    EXPECT_EQ(mesh.GetSelfIntersectingTriangles().GetShape(),
+              core::SizeVector({0, 2}));
+
+    // A triangle piercing the first quad.
+    t::geometry::TriangleMesh pierced(
+            mesh.GetVertexPositions().Append(
+                    core::Tensor::Init<float>(
+                            {{0.5, 0.2, -1}, {0.5, 0.2, 1}, {0.1, 0.6, 1}},
+                            device),
+                    0),
+            mesh.GetTriangleIndices().Append(
+                    core::Tensor::Init<int64_t>({{9, 10, 11}}, device), 0));
+    EXPECT_TRUE(pierced.IsSelfIntersecting());
+    core::Tensor pairs = pierced.GetSelfIntersectingTriangles();
+    EXPECT_EQ(pairs.GetDevice(), device);
+    EXPECT_TRUE(pairs.AllEqual(
+            core::Tensor::Init<int64_t>({{0, 8}, {1, 8}}, device)));
+
+    t::geometry::TriangleMesh other(
+            core::Tensor::Init<float>(
+                    {{0.5, 0.2, -1}, {0.5, 0.2, 1}, {0.1, 0.6, 1}}, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}}, device));
+    EXPECT_TRUE(mesh.IsIntersecting(other));
+    other.Translate(core::Tensor::Init<float>({0, 0, 2}, device));
+    EXPECT_FALSE(mesh.IsIntersecting(other));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeVertexAdjacency) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<double>(
+                    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}},
+                    device),
+            core::Tensor::Init<int32_t>(
+                    {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}}, device));
+    core::Tensor splits, neighbors;
+    std::tie(splits, neighbors) = mesh.ComputeVertexAdjacency();
+    EXPECT_TRUE(splits.AllEqual(
+            core::Tensor::Init<int64_t>({0, 4, 7, 10, 13, 16}, device)));
+    EXPECT_TRUE(neighbors.AllEqual(core::Tensor::Init<int64_t>(
+            {1, 2, 3, 4, 0, 2, 4, 0, 1, 3, 0, 2, 4, 0, 1, 3}, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, FilterSmooth) {
+    core::Device device = GetParam();
+
+    // Same fan as the legacy filter tests, with the same references.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<double>(
+                    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}},
+                    device),
+            core::Tensor::Init<int64_t>(
+                    {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}}, device));
+    mesh.SetVertexColors(core::Tensor::Ones({5, 3}, core::Float32, device));
+    auto fan = [&](double r) {
+        return core::Tensor::Init<double>(
+                {{0, 0, 0}, {r, 0, 0}, {0, r, 0}, {-r, 0, 0}, {0, -r, 0}},
+                device);
+    };
+
+    t::geometry::TriangleMesh sharpened =
+            mesh.FilterSharpen(1, 1).FilterSharpen(9, 0.1);
+    EXPECT_TRUE(sharpened.GetVertexPositions().AllClose(fan(42.417997), 0,
+                                                        1e-5));
+    // Constant colors are kept by all filters.
+    EXPECT_TRUE(sharpened.GetVertexColors().AllClose(
+            core::Tensor::Ones({5, 3}, core::Float32, device)));
+    // The input mesh is not modified.
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(fan(1)));
+
+    EXPECT_TRUE(mesh.FilterSmoothSimple(4).GetVertexPositions().AllClose(
+            fan(0.003906), 0, 1e-4));
+    EXPECT_TRUE(mesh.FilterSmoothLaplacian(11, 0.5)
+                        .GetVertexPositions()
+                        .AllClose(fan(0.000488), 0, 1e-3));
+    EXPECT_TRUE(mesh.FilterSmoothTaubin(11, 0.5, -0.53)
+                        .GetVertexPositions()
+                        .AllClose(fan(0.052514), 0, 1e-4));
+
+    // On the symmetric fan the cotangent weights of the rim vertices are
+    // equal, so the center stays in place and the rim contracts evenly.
+    core::Tensor cot = mesh.FilterSmoothLaplacian(1, 0.5, true)
+                               .GetVertexPositions();
+    EXPECT_TRUE(cot[0].AllClose(core::Tensor::Zeros({3}, core::Float64,
+                                                    device)));
+    EXPECT_NEAR(cot[1][0].Item<double>(), -cot[3][0].Item<double>(), 1e-12);
+    EXPECT_LT(cot[1][0].Item<double>(), 1.0);
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeNormals) {
+    core::Device device = GetParam();
+
+    // Planar fan in the z = 0 plane.
+    t::geometry::TriangleMesh fan(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -2, 0}},
+                    device),
+            core::Tensor::Init<int64_t>(
+                    {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}}, device));
+    fan.ComputeTriangleNormals();
+    EXPECT_TRUE(fan.GetTriangleNormals().AllClose(
+            core::Tensor::Init<float>({0, 0, 1}, device).Expand({4, 3})));
+    fan.ComputeTriangleNormals(false);
+    EXPECT_TRUE(fan.GetTriangleNormals().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 1}, {0, 0, 1}, {0, 0, 2}, {0, 0, 2}}, device)));
+    for (bool angle_weighted : {false, true}) {
+        fan.ComputeVertexNormals(true, angle_weighted);
+        EXPECT_TRUE(fan.GetVertexNormals().AllClose(
+                core::Tensor::Init<float>({0, 0, 1}, device).Expand({5, 3})));
+    }
+    EXPECT_TRUE(fan.ComputeVertexAreas().AllClose(core::Tensor::Init<float>(
+            {1, 0.5, 1.0 / 3, 0.5, 2.0 / 3}, device)));
+
+    // Area weighted normals match the legacy TriangleMesh.
+    auto sphere_legacy = geometry::TriangleMesh::CreateSphere(2.0, 20);
+    t::geometry::TriangleMesh sphere = t::geometry::TriangleMesh::FromLegacy(
+            *sphere_legacy, core::Float64, core::Int32, device);
+    sphere.ComputeVertexNormals();
+    sphere_legacy->ComputeVertexNormals();
+    EXPECT_TRUE(sphere.GetVertexNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    sphere_legacy->vertex_normals_, core::Float64, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeVertexCurvatures) {
+    core::Device device = GetParam();
+
+    const double radius = 2.0;
+    auto sphere_legacy = geometry::TriangleMesh::CreateSphere(radius, 20);
+    t::geometry::TriangleMesh sphere = t::geometry::TriangleMesh::FromLegacy(
+            *sphere_legacy, core::Float64, core::Int64, device);
+    core::Tensor areas = sphere.ComputeVertexAreas();
+    EXPECT_NEAR(areas.Sum({0}).Item<double>(),
+                sphere_legacy->GetSurfaceArea(), 1e-9);
+
+    core::Tensor mean, gaussian;
+    std::tie(mean, gaussian) = sphere.ComputeVertexCurvatures();
+    EXPECT_EQ(mean.GetShape(), areas.GetShape());
+    // The angle deficits of a closed genus 0 mesh sum to 4 pi.
+    EXPECT_NEAR((gaussian * areas).Sum({0}).Item<double>(), 4 * M_PI, 1e-9);
+    // Close to 1 / r and 1 / r^2, up to the discretization.
+    EXPECT_GT(mean.Min({0}).Item<double>(), 0.7 / radius);
+    EXPECT_LT(mean.Max({0}).Item<double>(), 1.1 / radius);
+    EXPECT_GT(gaussian.Min({0}).Item<double>(), 0.7 / (radius * radius));
+    EXPECT_LT(gaussian.Max({0}).Item<double>(), 1.1 / (radius * radius));
+}
+
+TEST_P(TriangleMeshPermuteDevices, RemoveDuplicated) {
+    core::Device device = GetParam();
+
+    // Two triangles of a quad with the shared edge duplicated, -0 and 0
+    // positions, a repeated triangle, a rotated copy, a flipped copy, a
+    // degenerate triangle and an unreferenced vertex.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {1, 0, 0},
+                                       {0, 1, 0},
+                                       {1, -0.f, 0},
+                                       {0, 1, -0.f},
+                                       {1, 1, 0},
+                                       {5, 5, 5}},
+                                      device),
+            core::Tensor::Init<int32_t>({{0, 1, 2},
+                                         {3, 5, 4},
+                                         {0, 1, 2},
+                                         {1, 2, 0},
+                                         {0, 2, 1},
+                                         {0, 0, 1}},
+                                        device));
+    mesh.SetVertexColors(
+            core::Tensor::Arange(0, 7, 1, core::Float32, device)
+                    .Reshape({7, 1})
+                    .Expand({7, 3})
+                    .Contiguous());
+    mesh.SetTriangleNormals(
+            core::Tensor::Arange(0, 6, 1, core::Float64, device)
+                    .Reshape({6, 1})
+                    .Expand({6, 3})
+                    .Contiguous());
+
+    t::geometry::TriangleMesh vertices = mesh.RemoveDuplicatedVertices();
+    EXPECT_EQ(vertices.GetVertexPositions().GetLength(), 5);
+    EXPECT_TRUE(vertices.GetVertexColors()
+                        .Slice(1, 0, 1)
+                        .Reshape({5})
+                        .AllEqual(core::Tensor::Init<float>({0, 1, 2, 5, 6},
+                                                            device)));
+    EXPECT_EQ(vertices.GetTriangleIndices().GetDtype(), core::Int32);
+    EXPECT_TRUE(vertices.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int32_t>({{0, 1, 2},
+                                         {1, 3, 2},
+                                         {0, 1, 2},
+                                         {1, 2, 0},
+                                         {0, 2, 1},
+                                         {0, 0, 1}},
+                                        device)));
+    // The input mesh is not modified.
+    EXPECT_EQ(mesh.GetVertexPositions().GetLength(), 7);
+
+    // Rotations keep the orientation and are duplicates, flips are not.
+    t::geometry::TriangleMesh triangles = vertices.RemoveDuplicatedTriangles();
+    EXPECT_TRUE(triangles.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int32_t>(
+                    {{0, 1, 2}, {1, 3, 2}, {0, 2, 1}, {0, 0, 1}}, device)));
+    EXPECT_TRUE(triangles.GetTriangleNormals()
+                        .Slice(1, 0, 1)
+                        .Reshape({4})
+                        .AllEqual(core::Tensor::Init<double>({0, 1, 4, 5},
+                                                             device)));
+
+    t::geometry::TriangleMesh cleaned =
+            triangles.RemoveDegenerateTriangles().RemoveUnreferencedVertices();
+    EXPECT_TRUE(cleaned.GetVertexPositions().AllEqual(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device)));
+    EXPECT_TRUE(cleaned.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int32_t>({{0, 1, 2}, {1, 3, 2}, {0, 2, 1}},
+                                        device)));
+    EXPECT_EQ(cleaned.GetTriangleNormals().GetLength(), 3);
+
+    // Float64 positions are deduplicated as well.
+    t::geometry::TriangleMesh mesh64 = mesh.Clone();
+    mesh64.SetVertexPositions(mesh.GetVertexPositions().To(core::Float64));
+    EXPECT_EQ(mesh64.RemoveDuplicatedVertices()
+                      .GetVertexPositions()
+                      .GetLength(),
+              5);
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeEdgeToTriangles) {
+    core::Device device = GetParam();
+
+    // Fan around vertex 0 with a fin on edge (0, 1).
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<double>({{0, 0, 0},
+                                        {1, 0, 0},
+                                        {0, 1, 0},
+                                        {-1, 0, 0},
+                                        {0, -1, 0},
+                                        {0, 0, 1}},
+                                       device),
+            core::Tensor::Init<int64_t>(
+                    {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}, {1, 0, 5}},
+                    device));
+    core::Tensor edges, splits, edge_triangles;
+    std::tie(edges, splits, edge_triangles) = mesh.ComputeEdgeToTriangles();
+    EXPECT_TRUE(edges.AllEqual(core::Tensor::Init<int64_t>({{0, 1},
+                                                            {0, 2},
+                                                            {0, 3},
+                                                            {0, 4},
+                                                            {0, 5},
+                                                            {1, 2},
+                                                            {1, 4},
+                                                            {1, 5},
+                                                            {2, 3},
+                                                            {3, 4}},
+                                                           device)));
+    EXPECT_TRUE(splits.AllEqual(core::Tensor::Init<int64_t>(
+            {0, 3, 5, 7, 9, 10, 11, 12, 13, 14, 15}, device)));
+    EXPECT_TRUE(edge_triangles.AllEqual(core::Tensor::Init<int64_t>(
+            {0, 3, 4, 0, 1, 1, 2, 2, 3, 4, 0, 3, 4, 1, 2}, device)));
+
+    EXPECT_TRUE(mesh.GetNonManifoldEdges().AllEqual(
+            core::Tensor::Init<int64_t>({{0, 1}}, device)));
+    EXPECT_FALSE(mesh.IsEdgeManifold());
+    EXPECT_EQ(mesh.GetNonManifoldEdges(false).GetLength(), 7);
+
+    t::geometry::TriangleMesh empty(device);
+    std::tie(edges, splits, edge_triangles) = empty.ComputeEdgeToTriangles();
+    EXPECT_EQ(edges.GetShape(), core::SizeVector({0, 2}));
+    EXPECT_TRUE(splits.AllEqual(core::Tensor::Init<int64_t>({0}, device)));
+    EXPECT_TRUE(empty.IsEdgeManifold(false));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ClusterConnectedTriangles) {
+    core::Device device = GetParam();
+
+    // Three interleaved components: two unit quads and a single triangle.
+    // Triangles that only share a vertex are not connected.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<double>({{0, 0, 0},
+                                        {1, 0, 0},
+                                        {1, 1, 0},
+                                        {0, 1, 0},
+                                        {2, 1, 0},
+                                        {2, 2, 0},
+                                        {1, 2, 0},
+                                        {3, 3, 0},
+                                        {4, 3, 0}},
+                                       device),
+            core::Tensor::Init<int64_t>({{4, 5, 6},
+                                         {0, 1, 2},
+                                         {2, 7, 8},
+                                         {0, 2, 3},
+                                         {2, 4, 6}},
+                                        device));
+    core::Tensor clusters, counts, areas;
+    std::tie(clusters, counts, areas) = mesh.ClusterConnectedTriangles();
+    EXPECT_TRUE(clusters.AllEqual(
+            core::Tensor::Init<int64_t>({0, 1, 2, 1, 0}, device)));
+    EXPECT_TRUE(counts.AllEqual(core::Tensor::Init<int64_t>({2, 2, 1},
+                                                            device)));
+    EXPECT_TRUE(areas.AllClose(core::Tensor::Init<double>({1, 1, 1}, device)));
+
+    // A long strip is one cluster, whatever the union order.
+    const int64_t n = 10000;
+    core::Tensor ids = core::Tensor::Arange(0, n, 1, core::Int64, device);
+    core::Tensor strip_triangles =
+            core::Tensor::Empty({n, 3}, core::Int64, device);
+    strip_triangles.Slice(1, 0, 1) = ids.Reshape({n, 1});
+    strip_triangles.Slice(1, 1, 2) = ids.Reshape({n, 1}) + 1;
+    strip_triangles.Slice(1, 2, 3) = ids.Reshape({n, 1}) + 2;
+    t::geometry::TriangleMesh strip(
+            core::Tensor::Zeros({n + 2, 3}, core::Float32, device),
+            strip_triangles);
+    std::tie(clusters, counts, areas) = strip.ClusterConnectedTriangles();
+    EXPECT_TRUE(clusters.AllEqual(
+            core::Tensor::Zeros({n}, core::Int64, device)));
+    EXPECT_TRUE(counts.AllEqual(core::Tensor::Init<int64_t>({n}, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ManifoldChecks) {
+    core::Device device = GetParam();
+
+    // Two tetrahedra touching at vertex 0.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<double>({{0, 0, 0},
+                                        {1, 0, 0},
+                                        {0, 1, 0},
+                                        {0, 0, 1},
+                                        {-1, 0, 0},
+                                        {0, -1, 0},
+                                        {0, 0, -1}},
+                                       device),
+            core::Tensor::Init<int64_t>({{0, 2, 1},
+                                         {0, 1, 3},
+                                         {0, 3, 2},
+                                         {1, 2, 3},
+                                         {0, 4, 5},
+                                         {0, 6, 4},
+                                         {0, 5, 6},
+                                         {4, 6, 5}},
+                                        device));
+    EXPECT_TRUE(mesh.IsEdgeManifold(false));
+    EXPECT_TRUE(mesh.GetNonManifoldVertices().AllEqual(
+            core::Tensor::Init<int64_t>({0}, device)));
+    EXPECT_FALSE(mesh.IsVertexManifold());
+    EXPECT_FALSE(mesh.IsWatertight());
+
+    t::geometry::TriangleMesh tetrahedron =
+            mesh.SelectByIndex(core::Tensor::Init<int64_t>({0, 1, 2, 3},
+                                                           device));
+    EXPECT_TRUE(tetrahedron.IsVertexManifold());
+    EXPECT_TRUE(tetrahedron.IsWatertight());
+
+    // Removing a face leaves a manifold mesh with a boundary.
+    t::geometry::TriangleMesh open = tetrahedron.Clone();
+    open.SetTriangleIndices(open.GetTriangleIndices().Slice(0, 0, 3));
+    EXPECT_TRUE(open.IsEdgeManifold());
+    EXPECT_FALSE(open.IsEdgeManifold(false));
+    EXPECT_TRUE(open.IsVertexManifold());
+    EXPECT_FALSE(open.IsWatertight());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -278,6 +278,48 @@ TEST_P(VoxelBlockGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, EraseBlocks) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::Float32, device, 8);
+        core::HashMap hashmap = vbg.GetHashMap();
+        const int64_t num_blocks = hashmap.Size();
+        core::Tensor keys = hashmap.GetKeyTensor().IndexGet(
+                {hashmap.GetActiveIndices().To(core::Int64)});
+
+        // Erasing inactive blocks is a no-op.
+        core::Tensor far_keys = keys + 100000;
+        EXPECT_EQ(vbg.EraseBlocks(far_keys), 0);
+        EXPECT_EQ(hashmap.Size(), num_blocks);
+
+        EXPECT_EQ(vbg.EraseBlocks(keys), num_blocks);
+        EXPECT_EQ(hashmap.Size(), 0);
+
+        // Blocks rebuilt in reused buffers must not see stale voxels.
+        core::Tensor intrinsic = GetIntrinsicTensor();
+        std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+        for (size_t i = 0; i < extrinsics.size(); ++i) {
+            Image depth = t::io::CreateImageFromFile(
+                                  fmt::format("{}/RGBD/depth/{:05d}.png",
+                                              std::string(TEST_DATA_DIR), i))
+                                  ->To(device);
+            Image color = t::io::CreateImageFromFile(
+                                  fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                              std::string(TEST_DATA_DIR), i))
+                                  ->To(device);
+            core::Tensor frustum_block_coords = vbg.GetUniqueBlockCoordinates(
+                    depth, intrinsic, extrinsics[i]);
+            vbg.Integrate(frustum_block_coords, depth, color, intrinsic,
+                          extrinsics[i]);
+        }
+        EXPECT_EQ(hashmap.Size(), num_blocks);
+        EXPECT_NEAR(vbg.ExtractPointCloud().GetPointPositions().GetLength(),
+                    225628, 3);
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, IO) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends = EnumerateBackends(device);
@@ -299,6 +341,60 @@ TEST_P(VoxelBlockGridPermuteDevices, IO) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, IOChunked) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    std::string file_name = "tmp_chunked.bin";
+    std::string delta_file_name = "tmp_chunked_delta.bin";
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::UInt16, device, 16);
+        vbg.SaveChunked(file_name);
+
+        EXPECT_TRUE(utility::filesystem::FileExists(file_name));
+        auto pcd = vbg.ExtractPointCloud();
+
+        auto vbg_loaded = VoxelBlockGrid::LoadChunked(file_name, device);
+        EXPECT_EQ(vbg_loaded.GetHashMap().Size(), vbg.GetHashMap().Size());
+        auto pcd_loaded = vbg_loaded.ExtractPointCloud();
+        EXPECT_EQ(pcd.GetPointPositions().GetLength(),
+                  pcd_loaded.GetPointPositions().GetLength());
+
+        // Partial load of the blocks with non-negative coordinates.
+        core::Tensor active_indices;
+        vbg.GetHashMap().GetActiveIndices(active_indices);
+        core::Tensor block_coords = vbg.GetHashMap().GetKeyTensor().IndexGet(
+                {active_indices.To(core::Int64)});
+        core::Tensor non_negative =
+                block_coords.Ge(0).To(core::Int64).Sum({1}).Eq(3);
+        int64_t num_non_negative =
+                non_negative.To(core::Int64).Sum({0}).Item<int64_t>();
+
+        core::Tensor block_range(std::vector<int>{0, 0, 0, 1000, 1000, 1000},
+                                 {2, 3}, core::Int32, device);
+        auto vbg_partial =
+                VoxelBlockGrid::LoadChunked(file_name, device, block_range);
+        EXPECT_EQ(vbg_partial.GetHashMap().Size(), num_non_negative);
+
+        // Loading the remaining blocks restores the whole grid.
+        vbg_partial.UpdateFromChunked(file_name);
+        EXPECT_EQ(vbg_partial.GetHashMap().Size(), vbg.GetHashMap().Size());
+
+        // A delta records the erased blocks.
+        core::Tensor erased_coords = block_coords.Slice(0, 0, 10);
+        EXPECT_EQ(vbg.EraseBlocks(erased_coords), 10);
+        vbg.SaveChunked(delta_file_name, erased_coords);
+        vbg_loaded.UpdateFromChunked(delta_file_name);
+        EXPECT_EQ(vbg_loaded.GetHashMap().Size(), vbg.GetHashMap().Size());
+        core::Tensor buf_indices, masks;
+        vbg_loaded.GetHashMap().Find(erased_coords, buf_indices, masks);
+        EXPECT_FALSE(masks.Any());
+
+        utility::filesystem::RemoveFile(file_name);
+        utility::filesystem::RemoveFile(delta_file_name);
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -335,6 +431,18 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
             EXPECT_TRUE(result_odometry.Contains("normal"));
             EXPECT_TRUE(result_odometry.Contains("depth"));
 
+            // The ray cast depth agrees with the last integrated frame.
+            core::Tensor input_depth = depth.AsTensor().To(core::Float32);
+            core::Tensor cast_depth = result_odometry["depth"];
+            core::Tensor valid = input_depth.Gt(0).LogicalAnd(cast_depth.Gt(0));
+            core::Tensor consistent =
+                    (input_depth - cast_depth).Abs().Lt(30.0).LogicalAnd(valid);
+            float num_valid =
+                    valid.To(core::Float32).Sum({0, 1, 2}).Item<float>();
+            float num_consistent =
+                    consistent.To(core::Float32).Sum({0, 1, 2}).Item<float>();
+            EXPECT_GT(num_consistent, 0.9 * num_valid);
+
             auto result_rendering = vbg.RayCast(
                     frustum_block_coords, intrinsic, extrinsics[i],
                     depth.GetCols(), depth.GetRows(), {"depth", "color"},
@@ -359,6 +467,38 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     }
 }
 
+TEST(VoxelBlockGrid, RayCastingOpenAddressing) {
+    // CPU ray casting goes through the block lookup table, so it must not
+    // depend on the TBB backend.
+    core::Device device("CPU:0");
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_min = 0.1;
+    const float depth_max = 3.0;
+    int i = extrinsics.size() - 1;
+
+    Image depth = *t::io::CreateImageFromFile(fmt::format(
+            "{}/RGBD/depth/{:05d}.png", std::string(TEST_DATA_DIR), i));
+
+    std::vector<TensorMap> results;
+    for (auto backend : {core::HashBackendType::TBB,
+                         core::HashBackendType::OpenAddressing}) {
+        auto vbg = Integrate(backend, core::Float32, device,
+                             /* block_resolution = */ 8);
+        core::Tensor frustum_block_coords = vbg.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsics[i], depth_scale, depth_max);
+        results.push_back(vbg.RayCast(
+                frustum_block_coords, intrinsic, extrinsics[i],
+                depth.GetCols(), depth.GetRows(), {"depth", "color"},
+                depth_scale, depth_min, depth_max, 1.0));
+    }
+
+    EXPECT_GT(results[1]["depth"].Gt(0).NonZero().GetShape(1), 0);
+    EXPECT_TRUE(results[1]["depth"].AllClose(results[0]["depth"]));
+    EXPECT_TRUE(results[1]["color"].AllClose(results[0]["color"]));
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, DISABLED_RayCastingVisualize) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -0,0 +1,303 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <tuple>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class VoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelGrid,
+                         VoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+/// Voxel indices as a set, for comparisons independent of the order.
+static std::set<std::tuple<int, int, int>> VoxelSet(
+        const core::Tensor& voxel_indices) {
+    const std::vector<int> values =
+            voxel_indices.To(core::Device("CPU:0")).ToFlatVector<int>();
+    std::set<std::tuple<int, int, int>> voxels;
+    for (size_t i = 0; i < values.size(); i += 3) {
+        voxels.emplace(values[i], values[i + 1], values[i + 2]);
+    }
+    return voxels;
+}
+
+/// Indices of the voxels of the cube [lo, hi]^3.
+static core::Tensor CubeIndices(int lo, int hi, const core::Device& device) {
+    std::vector<int> values;
+    for (int x = lo; x <= hi; ++x) {
+        for (int y = lo; y <= hi; ++y) {
+            for (int z = lo; z <= hi; ++z) {
+                values.insert(values.end(), {x, y, z});
+            }
+        }
+    }
+    const int64_t n = static_cast<int64_t>(values.size() / 3);
+    return core::Tensor(values, {n, 3}, core::Int32, device);
+}
+
+TEST_P(VoxelGridPermuteDevices, InsertEraseContains) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid(
+            0.5, core::Tensor::Init<double>({1, 0, 0}, device), device);
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+    EXPECT_EQ(voxel_grid.GetDevice(), device);
+    EXPECT_EQ(voxel_grid.GetVoxelIndices().GetShape(),
+              core::SizeVector({0, 3}));
+
+    voxel_grid.InsertVoxels(core::Tensor::Init<int>(
+            {{0, 0, 0}, {1, 2, 3}, {0, 0, 0}, {-1, -1, -1}}, device));
+    EXPECT_EQ(voxel_grid.NumVoxels(), 3);
+    EXPECT_TRUE(voxel_grid
+                        .ContainsVoxels(core::Tensor::Init<int>(
+                                {{1, 2, 3}, {1, 2, 2}, {-1, -1, -1}}, device))
+                        .AllEqual(core::Tensor::Init<bool>({true, false, true},
+                                                           device)));
+
+    // Points are mapped to the voxels containing them.
+    core::Tensor points = core::Tensor::Init<float>({{1.1, 0.2, 0.3},
+                                                     {0.9, 0.2, 0.3},
+                                                     {0.6, -0.4, -0.1},
+                                                     {1.6, 1, 1.5}},
+                                                    device);
+    EXPECT_TRUE(voxel_grid.ComputeVoxelIndices(points).AllEqual(
+            core::Tensor::Init<int>(
+                    {{0, 0, 0}, {-1, 0, 0}, {-1, -1, -1}, {1, 2, 3}}, device)));
+    EXPECT_TRUE(voxel_grid.CheckIfIncluded(points).AllEqual(
+            core::Tensor::Init<bool>({true, false, true, true}, device)));
+
+    t::geometry::VoxelGrid copy = voxel_grid.Clone();
+    voxel_grid.EraseVoxels(
+            core::Tensor::Init<int>({{1, 2, 3}, {5, 5, 5}}, device));
+    EXPECT_EQ(voxel_grid.NumVoxels(), 2);
+    EXPECT_EQ(copy.NumVoxels(), 3);
+    EXPECT_EQ(VoxelSet(voxel_grid.GetVoxelIndices()),
+              (std::set<std::tuple<int, int, int>>{{0, 0, 0}, {-1, -1, -1}}));
+
+    // Centers follow the order of the indices.
+    core::Tensor centers = voxel_grid.GetVoxelCenters();
+    core::Tensor expected_centers =
+            (voxel_grid.GetVoxelIndices().To(core::Float32) + 0.5) * 0.5 +
+            core::Tensor::Init<float>({1, 0, 0}, device);
+    EXPECT_TRUE(centers.AllClose(expected_centers));
+
+    voxel_grid.Clear();
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromPointCloud) {
+    core::Device device = GetParam();
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    open3d::geometry::PointCloud pcd_legacy;
+    for (int i = 0; i < 1000; ++i) {
+        pcd_legacy.points_.emplace_back(dist(rng), dist(rng), dist(rng));
+    }
+    const double voxel_size = 0.2;
+    auto legacy = open3d::geometry::VoxelGrid::CreateFromPointCloud(
+            pcd_legacy, voxel_size);
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromPointCloud(
+                    t::geometry::PointCloud::FromLegacy(
+                            pcd_legacy, core::Float64, device),
+                    voxel_size);
+
+    std::set<std::tuple<int, int, int>> expected;
+    for (const auto& it : legacy->voxels_) {
+        expected.emplace(it.first(0), it.first(1), it.first(2));
+    }
+    EXPECT_EQ(VoxelSet(voxel_grid.GetVoxelIndices()), expected);
+    EXPECT_EQ(VoxelSet(t::geometry::VoxelGrid::FromLegacy(*legacy, device)
+                               .GetVoxelIndices()),
+              expected);
+    EXPECT_EQ(voxel_grid.ToLegacy().voxels_.size(), expected.size());
+
+    // Batch membership agrees with the legacy queries.
+    std::vector<Eigen::Vector3d> queries;
+    for (int i = 0; i < 500; ++i) {
+        queries.emplace_back(dist(rng), dist(rng), dist(rng));
+    }
+    const std::vector<bool> legacy_included = legacy->CheckIfIncluded(queries);
+    const core::Tensor query_points =
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    queries, core::Float64, device);
+    const std::vector<bool> included =
+            voxel_grid.CheckIfIncluded(query_points)
+                    .To(core::Device("CPU:0"))
+                    .ToFlatVector<bool>();
+    EXPECT_EQ(included, legacy_included);
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromTriangleMesh) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(device);
+    // Vertices stay off the voxel planes so that the reference test does not
+    // depend on rounding of touching contacts.
+    mesh.SetVertexPositions(core::Tensor::Init<double>({{0.05, 0.1, 0.2},
+                                                        {1.33, 0.17, 0.4},
+                                                        {0.42, 1.1, 0.9},
+                                                        {0.23, 0.3, 1.43},
+                                                        {1.97, 1.98, 1.99}},
+                                                       device));
+    mesh.SetTriangleIndices(core::Tensor::Init<int64_t>(
+            {{0, 1, 2}, {0, 1, 3}, {1, 2, 3}, {0, 2, 3}, {0, 4, 1}}, device));
+    const double voxel_size = 0.1;
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromTriangleMesh(mesh, voxel_size);
+
+    // Brute force over the voxels of the bounding box.
+    const core::Device host("CPU:0");
+    const std::vector<double> origin =
+            voxel_grid.GetOrigin().To(host).ToFlatVector<double>();
+    const std::vector<double> vertices =
+            mesh.GetVertexPositions().To(host).ToFlatVector<double>();
+    const std::vector<int64_t> triangles =
+            mesh.GetTriangleIndices().To(host).ToFlatVector<int64_t>();
+    auto vertex = [&](int64_t i) {
+        return Eigen::Vector3d(vertices[3 * i], vertices[3 * i + 1],
+                               vertices[3 * i + 2]);
+    };
+    const Eigen::Vector3d half_size = Eigen::Vector3d::Constant(voxel_size / 2);
+    std::set<std::tuple<int, int, int>> expected;
+    for (int x = 0; x < 21; ++x) {
+        for (int y = 0; y < 21; ++y) {
+            for (int z = 0; z < 21; ++z) {
+                const Eigen::Vector3d center =
+                        Eigen::Vector3d(origin[0], origin[1], origin[2]) +
+                        (Eigen::Vector3d(x, y, z).array() + 0.5).matrix() *
+                                voxel_size;
+                for (size_t t = 0; t < triangles.size(); t += 3) {
+                    if (open3d::geometry::IntersectionTest::TriangleAABB(
+                                center, half_size, vertex(triangles[t]),
+                                vertex(triangles[t + 1]),
+                                vertex(triangles[t + 2]))) {
+                        expected.emplace(x, y, z);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    EXPECT_EQ(VoxelSet(voxel_grid.GetVoxelIndices()), expected);
+}
+
+TEST_P(VoxelGridPermuteDevices, BooleanOperations) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid a(1.0, core::Tensor(), device);
+    a.InsertVoxels(CubeIndices(0, 2, device));
+    t::geometry::VoxelGrid b(1.0, core::Tensor(), device);
+    b.InsertVoxels(CubeIndices(1, 3, device));
+
+    EXPECT_EQ(a.Union(b).NumVoxels(), 27 + 27 - 8);
+    EXPECT_EQ(VoxelSet(a.Intersect(b).GetVoxelIndices()),
+              VoxelSet(CubeIndices(1, 2, device)));
+    t::geometry::VoxelGrid difference = a.Subtract(b);
+    EXPECT_EQ(difference.NumVoxels(), 27 - 8);
+    EXPECT_FALSE(difference.ContainsVoxels(CubeIndices(1, 2, device)).Any());
+    EXPECT_EQ(a.NumVoxels(), 27);
+
+    t::geometry::VoxelGrid other_size(0.5, core::Tensor(), device);
+    EXPECT_ANY_THROW(a.Union(other_size));
+}
+
+TEST_P(VoxelGridPermuteDevices, DilateErode) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid(1.0, core::Tensor(), device);
+    voxel_grid.InsertVoxels(core::Tensor::Init<int>({{0, 0, 0}}, device));
+    voxel_grid.Dilate();
+    EXPECT_EQ(VoxelSet(voxel_grid.GetVoxelIndices()),
+              VoxelSet(CubeIndices(-1, 1, device)));
+    voxel_grid.Dilate();
+    EXPECT_EQ(voxel_grid.NumVoxels(), 125);
+
+    voxel_grid.Erode(2);
+    EXPECT_EQ(VoxelSet(voxel_grid.GetVoxelIndices()),
+              (std::set<std::tuple<int, int, int>>{{0, 0, 0}}));
+    voxel_grid.Erode();
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+}
+
+TEST_P(VoxelGridPermuteDevices, Carve) {
+    core::Device device = GetParam();
+
+    // A 10 x 10 x 10 grid of 0.1 voxels in front of a camera at the origin.
+    t::geometry::VoxelGrid voxel_grid(
+            0.1, core::Tensor::Init<double>({-0.5, -0.5, 1.0}, device),
+            device);
+    voxel_grid.InsertVoxels(CubeIndices(0, 9, device));
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{50, 0, 31.5}, {0, 50, 31.5}, {0, 0, 1}});
+    core::Tensor extrinsic = core::Tensor::Eye(4, core::Float64,
+                                               core::Device("CPU:0"));
+
+    // Voxels entirely in front of the depth of 1.55 are carved.
+    t::geometry::Image depth(core::Tensor::Full({64, 64, 1}, 1550,
+                                                core::UInt16, device));
+    t::geometry::VoxelGrid carved = voxel_grid.Clone();
+    carved.CarveDepthMap(depth, intrinsic, extrinsic, 1000.0f);
+    EXPECT_EQ(carved.NumVoxels(), 10 * 10 * 5);
+    EXPECT_TRUE(carved.GetVoxelIndices().Slice(1, 2, 3).Ge(5).All());
+
+    // Voxels that do not project into the silhouette, the left half of the
+    // image, are carved.
+    core::Tensor mask = core::Tensor::Zeros({64, 64, 1}, core::UInt8, device);
+    mask.Slice(1, 0, 32) = core::Tensor::Ones({64, 32, 1}, core::UInt8, device);
+    carved = voxel_grid.Clone();
+    carved.CarveSilhouette(t::geometry::Image(mask), intrinsic, extrinsic);
+    EXPECT_EQ(carved.NumVoxels(), 6 * 10 * 10);
+    EXPECT_TRUE(carved.GetVoxelIndices().Slice(1, 0, 1).Le(5).All());
+
+    // A camera that does not see the grid carves everything, unless the
+    // voxels outside of the image are kept.
+    core::Tensor away = extrinsic.Clone();
+    away[0][3] = 10.0;
+    carved = voxel_grid.Clone();
+    carved.CarveDepthMap(depth, intrinsic, away, 1000.0f, true);
+    EXPECT_EQ(carved.NumVoxels(), 1000);
+    carved.CarveDepthMap(depth, intrinsic, away, 1000.0f, false);
+    EXPECT_TRUE(carved.IsEmpty());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,387 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class ColorMapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ColorMap,
+                         ColorMapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+namespace {
+
+const int64_t kRows = 64;
+const int64_t kCols = 64;
+
+core::Tensor GetIntrinsics() {
+    return core::Tensor::Init<double>({{50, 0, 32}, {0, 50, 32}, {0, 0, 1}});
+}
+
+/// Random points in the view frustum of GetIntrinsics(), at depth [1, 2].
+core::Tensor GetVertices(const core::Device& device) {
+    const int64_t n = 500;
+    std::vector<float> vertices(3 * n);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(-1, 1);
+    for (int64_t i = 0; i < n; ++i) {
+        const float z = 1.5f + 0.5f * uniform(rng);
+        vertices[3 * i + 0] = 0.4f * z * uniform(rng);
+        vertices[3 * i + 1] = 0.4f * z * uniform(rng);
+        vertices[3 * i + 2] = z;
+    }
+    return core::Tensor(vertices, {n, 3}, core::Float32, device);
+}
+
+float GetIntensity(float u, float v) {
+    return 0.5f + 0.2f * std::sin(u / 6.0f) + 0.2f * std::cos(v / 7.0f);
+}
+
+/// Smooth intensity image and its gradients.
+void GetIntensity(const core::Device& device,
+                  core::Tensor& intensity,
+                  core::Tensor& intensity_dx,
+                  core::Tensor& intensity_dy) {
+    std::vector<float> values(kRows * kCols), dx(kRows * kCols),
+            dy(kRows * kCols);
+    for (int64_t v = 0; v < kRows; ++v) {
+        for (int64_t u = 0; u < kCols; ++u) {
+            const int64_t idx = v * kCols + u;
+            values[idx] = GetIntensity(u, v);
+            dx[idx] = 0.2f / 6.0f * std::cos(u / 6.0f);
+            dy[idx] = -0.2f / 7.0f * std::sin(v / 7.0f);
+        }
+    }
+    intensity = core::Tensor(values, {kRows, kCols, 1}, core::Float32, device);
+    intensity_dx = core::Tensor(dx, {kRows, kCols, 1}, core::Float32, device);
+    intensity_dy = core::Tensor(dy, {kRows, kCols, 1}, core::Float32, device);
+}
+
+/// Identity warping field with 5 vertical anchors.
+core::Tensor GetWarpingField(const core::Device& device, float& anchor_step) {
+    const int64_t anchor_h = 5;
+    anchor_step = static_cast<float>(kRows) / (anchor_h - 1);
+    const int64_t anchor_w =
+            static_cast<int64_t>(std::ceil(kCols / anchor_step) + 1);
+    std::vector<float> field(anchor_h * anchor_w * 2);
+    for (int64_t j = 0; j < anchor_h; ++j) {
+        for (int64_t i = 0; i < anchor_w; ++i) {
+            field[(i + j * anchor_w) * 2] = i * anchor_step;
+            field[(i + j * anchor_w) * 2 + 1] = j * anchor_step;
+        }
+    }
+    return core::Tensor(field, {anchor_h, anchor_w, 2}, core::Float32, device);
+}
+
+}  // namespace
+
+TEST_P(ColorMapPermuteDevices, ComputeVertexVisibility) {
+    core::Device device = GetParam();
+
+    const core::Tensor vertices = core::Tensor::Init<float>(
+            {{0, 0, 1}, {0.1, 0, 1.2}, {0, 0.1, 1}, {0, 0, 3}, {10, 0, 1}},
+            device);
+    core::Tensor depth =
+            core::Tensor::Ones({kRows, kCols, 1}, core::Float32, device);
+    core::Tensor mask =
+            core::Tensor::Zeros({kRows, kCols, 1}, core::UInt8, device);
+    // Depth discontinuity at the projection of the 3rd vertex.
+    mask.SetItem({core::TensorKey::Index(37), core::TensorKey::Index(32)},
+                 core::Tensor::Init<uint8_t>({255}, device));
+
+    core::Tensor visibility;
+    t::pipelines::kernel::color_map::ComputeVertexVisibility(
+            vertices, depth, mask, GetIntrinsics(),
+            core::Tensor::Eye(4, core::Float64, device), visibility, 2.5,
+            0.03);
+    EXPECT_EQ(visibility.ToFlatVector<bool>(),
+              std::vector<bool>({true, false, false, false, false}));
+}
+
+TEST_P(ColorMapPermuteDevices, AccumulateVertexValues) {
+    core::Device device = GetParam();
+
+    const core::Tensor vertices = GetVertices(device);
+    const int64_t n = vertices.GetLength();
+    core::Tensor intensity, intensity_dx, intensity_dy;
+    GetIntensity(device, intensity, intensity_dx, intensity_dy);
+    const core::Tensor visible_indices =
+            core::Tensor::Arange(0, n, 2, core::Int64, device);
+    const core::Tensor extrinsics = core::Tensor::Eye(4, core::Float64, device);
+
+    core::Tensor value_sum = core::Tensor::Zeros({n, 1}, core::Float32, device);
+    core::Tensor weight_sum = core::Tensor::Zeros({n}, core::Float32, device);
+    t::pipelines::kernel::color_map::AccumulateVertexValues(
+            vertices, visible_indices, intensity, GetIntrinsics(), extrinsics,
+            core::Tensor(), value_sum, weight_sum, 0, 0);
+    EXPECT_EQ(weight_sum.Sum({0}).Item<float>(), n / 2);
+    EXPECT_EQ(weight_sum.Slice(0, 1, n, 2).Sum({0}).Item<float>(), 0);
+
+    // The identity warping field does not change the values.
+    float anchor_step;
+    const core::Tensor warping_field = GetWarpingField(device, anchor_step);
+    core::Tensor value_sum_warped =
+            core::Tensor::Zeros({n, 1}, core::Float32, device);
+    core::Tensor weight_sum_warped =
+            core::Tensor::Zeros({n}, core::Float32, device);
+    t::pipelines::kernel::color_map::AccumulateVertexValues(
+            vertices, visible_indices, intensity, GetIntrinsics(), extrinsics,
+            warping_field, value_sum_warped, weight_sum_warped, anchor_step,
+            0);
+    EXPECT_TRUE(weight_sum_warped.AllClose(weight_sum));
+    EXPECT_TRUE(value_sum_warped.AllClose(value_sum));
+}
+
+TEST_P(ColorMapPermuteDevices, ComputeRigidColorMapResult) {
+    core::Device device = GetParam();
+
+    const core::Tensor vertices = GetVertices(device);
+    const int64_t n = vertices.GetLength();
+    core::Tensor intensity, intensity_dx, intensity_dy;
+    GetIntensity(device, intensity, intensity_dx, intensity_dy);
+    const core::Tensor visible_indices =
+            core::Tensor::Arange(0, n, 1, core::Int64, device);
+    const core::Tensor intrinsics = GetIntrinsics();
+
+    // Proxy intensity of the vertices at the ground truth (identity) pose.
+    const core::Tensor vertices_host = vertices.To(core::Device("CPU:0"));
+    const float* vertices_ptr = vertices_host.GetDataPtr<float>();
+    std::vector<float> proxy(n);
+    for (int64_t i = 0; i < n; ++i) {
+        const float* vertex = vertices_ptr + 3 * i;
+        proxy[i] = GetIntensity(50 * vertex[0] / vertex[2] + 32,
+                                50 * vertex[1] / vertex[2] + 32);
+    }
+    const core::Tensor proxy_intensity(proxy, {n}, core::Float32, device);
+
+    const core::Tensor extrinsics_gt = core::Tensor::Eye(4, core::Float64,
+                                                         core::Device("CPU:0"));
+    core::Tensor extrinsics = t::pipelines::kernel::PoseToTransformation(
+            core::Tensor::Init<double>({0.01, -0.01, 0.005, 0.02, 0.01, 0}));
+    for (int i = 0; i < 10; ++i) {
+        core::Tensor delta;
+        float residual;
+        int count;
+        t::pipelines::kernel::color_map::ComputeRigidColorMapResult(
+                vertices, visible_indices, proxy_intensity, intensity,
+                intensity_dx, intensity_dy, intrinsics, extrinsics, delta,
+                residual, count, 0);
+        extrinsics = t::pipelines::kernel::PoseToTransformation(delta).Matmul(
+                extrinsics);
+    }
+    EXPECT_TRUE(extrinsics.AllClose(extrinsics_gt, 1e-3, 2e-3));
+}
+
+TEST_P(ColorMapPermuteDevices, ComputeNonRigidColorMapSystem) {
+    core::Device device = GetParam();
+
+    const core::Tensor vertices = GetVertices(device);
+    const int64_t n = vertices.GetLength();
+    core::Tensor intensity, intensity_dx, intensity_dy;
+    GetIntensity(device, intensity, intensity_dx, intensity_dy);
+    const core::Tensor visible_indices =
+            core::Tensor::Arange(0, n, 1, core::Int64, device);
+    const core::Tensor proxy_intensity =
+            core::Tensor::Full({n}, 0.5, core::Float32, device);
+    const core::Tensor intrinsics = GetIntrinsics();
+    const core::Tensor extrinsics = core::Tensor::Eye(4, core::Float64, device);
+    float anchor_step;
+    const core::Tensor warping_field = GetWarpingField(device, anchor_step);
+
+    core::Tensor reduction;
+    t::pipelines::kernel::color_map::ComputeNonRigidColorMapSystem(
+            vertices, visible_indices, proxy_intensity, intensity,
+            intensity_dx, intensity_dy, intrinsics, extrinsics, warping_field,
+            reduction, anchor_step, 0);
+
+    // With the identity warping field, the pose block matches the rigid
+    // system.
+    core::Tensor delta_rigid, delta_non_rigid;
+    float residual_rigid, residual_non_rigid;
+    int count_rigid, count_non_rigid;
+    t::pipelines::kernel::color_map::ComputeRigidColorMapResult(
+            vertices, visible_indices, proxy_intensity, intensity,
+            intensity_dx, intensity_dy, intrinsics, extrinsics, delta_rigid,
+            residual_rigid, count_rigid, 0);
+    t::pipelines::kernel::DecodeAndSolve6x6(reduction.Slice(0, 0, 29),
+                                            delta_non_rigid,
+                                            residual_non_rigid,
+                                            count_non_rigid);
+    EXPECT_EQ(count_rigid, count_non_rigid);
+    EXPECT_NEAR(residual_rigid, residual_non_rigid, 1e-3);
+    EXPECT_TRUE(delta_rigid.AllClose(delta_non_rigid, 1e-3, 1e-4));
+
+    // The anchor-anchor blocks are symmetric.
+    const core::Tensor reduction_host = reduction.To(core::Device("CPU:0"));
+    const float* A = reduction_host.GetDataPtr<float>();
+    const int64_t anchor_h = warping_field.GetShape(0);
+    const int64_t anchor_w = warping_field.GetShape(1);
+    const int64_t block_size =
+            t::pipelines::kernel::color_map::kNonRigidAnchorReductionSize;
+    for (int64_t j = 0; j + 1 < anchor_h; ++j) {
+        for (int64_t i = 0; i + 1 < anchor_w; ++i) {
+            const float* block = A + 29 + (i + j * anchor_w) * block_size;
+            const float* block_right = block + block_size;
+            // Block (i, j)-(i + 1, j) is slot 7, block (i + 1, j)-(i, j) is
+            // slot 1.
+            for (int c = 0; c < 2; ++c) {
+                for (int d = 0; d < 2; ++d) {
+                    EXPECT_NEAR(block[12 + 7 * 4 + c * 2 + d],
+                                block_right[12 + 1 * 4 + d * 2 + c], 1e-4);
+                }
+            }
+        }
+    }
+}
+
+TEST_P(ColorMapPermuteDevices, ComputeNonRigidColorMapSystemBruteForce) {
+    core::Device device = GetParam();
+    namespace color_map = t::pipelines::kernel::color_map;
+
+    const core::Tensor vertices = GetVertices(device);
+    const int64_t n = vertices.GetLength();
+    core::Tensor intensity, intensity_dx, intensity_dy;
+    GetIntensity(device, intensity, intensity_dx, intensity_dy);
+    const core::Tensor visible_indices =
+            core::Tensor::Arange(0, n, 1, core::Int64, device);
+    const core::Tensor proxy_intensity =
+            core::Tensor::Full({n}, 0.5, core::Float32, device);
+    float anchor_step;
+    const core::Tensor warping_field = GetWarpingField(device, anchor_step);
+    const int64_t anchor_h = warping_field.GetShape(0);
+    const int64_t anchor_w = warping_field.GetShape(1);
+
+    core::Tensor reduction;
+    color_map::ComputeNonRigidColorMapSystem(
+            vertices, visible_indices, proxy_intensity, intensity,
+            intensity_dx, intensity_dy, GetIntrinsics(),
+            core::Tensor::Eye(4, core::Float64, device), warping_field,
+            reduction, anchor_step, 0);
+
+    // Dense JtJ and Jtr over the pose and all anchors. With the identity pose
+    // and warping field, the warped pixel is the projection itself.
+    const std::vector<float> vertices_host = vertices.ToFlatVector<float>();
+    const std::vector<float> values = intensity.ToFlatVector<float>();
+    const std::vector<float> values_dx = intensity_dx.ToFlatVector<float>();
+    const std::vector<float> values_dy = intensity_dy.ToFlatVector<float>();
+    auto interpolate = [&](const std::vector<float>& image, double u,
+                           double v) {
+        const int64_t u0 = static_cast<int64_t>(u);
+        const int64_t v0 = static_cast<int64_t>(v);
+        const int64_t u1 = std::min(u0 + 1, kCols - 1);
+        const int64_t v1 = std::min(v0 + 1, kRows - 1);
+        const double pu = u - u0, pv = v - v0;
+        return (1 - pu) * (1 - pv) * image[v0 * kCols + u0] +
+               pu * (1 - pv) * image[v0 * kCols + u1] +
+               (1 - pu) * pv * image[v1 * kCols + u0] +
+               pu * pv * image[v1 * kCols + u1];
+    };
+    const int64_t dim = 6 + 2 * anchor_h * anchor_w;
+    Eigen::MatrixXd JTJ = Eigen::MatrixXd::Zero(dim, dim);
+    Eigen::VectorXd JTr = Eigen::VectorXd::Zero(dim);
+    for (int64_t idx = 0; idx < n; ++idx) {
+        const float* xyz = vertices_host.data() + 3 * idx;
+        const double u = 50.0 * xyz[0] / xyz[2] + 32;
+        const double v = 50.0 * xyz[1] / xyz[2] + 32;
+        const int64_t i = static_cast<int64_t>(u / anchor_step);
+        const int64_t j = static_cast<int64_t>(v / anchor_step);
+        if (u < 0 || u >= kCols || v < 0 || v >= kRows || i >= anchor_w - 1 ||
+            j >= anchor_h - 1) {
+            continue;
+        }
+        const double p = u / anchor_step - i, q = v / anchor_step - j;
+        const double dIdx = interpolate(values_dx, u, v);
+        const double dIdy = interpolate(values_dy, u, v);
+        const double r = interpolate(values, u, v) - 0.5;
+
+        Eigen::VectorXd J = Eigen::VectorXd::Zero(dim);
+        const double v0 = dIdx * 50 / xyz[2];
+        const double v1 = dIdy * 50 / xyz[2];
+        const double v2 = -(v0 * xyz[0] + v1 * xyz[1]) / xyz[2];
+        J.head<6>() << -xyz[2] * v1 + xyz[1] * v2, xyz[2] * v0 - xyz[0] * v2,
+                -xyz[1] * v0 + xyz[0] * v1, v0, v1, v2;
+        const int64_t corners[4] = {i + j * anchor_w, i + (j + 1) * anchor_w,
+                                    i + 1 + j * anchor_w,
+                                    i + 1 + (j + 1) * anchor_w};
+        const double weights[4] = {(1 - p) * (1 - q), (1 - p) * q,
+                                   p * (1 - q), p * q};
+        for (int k = 0; k < 4; ++k) {
+            J(6 + 2 * corners[k]) = dIdx * weights[k];
+            J(6 + 2 * corners[k] + 1) = dIdy * weights[k];
+        }
+        JTJ += J * J.transpose();
+        JTr += J * r;
+    }
+
+    // Every element of every anchor block matches the dense system. Neighbor
+    // slots outside of the anchor grid stay zero.
+    const std::vector<float> A = reduction.ToFlatVector<float>();
+    for (int64_t j = 0; j < anchor_h; ++j) {
+        for (int64_t i = 0; i < anchor_w; ++i) {
+            const int64_t a = i + j * anchor_w;
+            const float* block =
+                    A.data() + 29 + a * color_map::kNonRigidAnchorReductionSize;
+            for (int c = 0; c < 2; ++c) {
+                const int64_t row = 6 + 2 * a + c;
+                for (int p = 0; p < 6; ++p) {
+                    EXPECT_NEAR(block[c * 6 + p], JTJ(row, p), 1e-3);
+                }
+                for (int di = -1; di <= 1; ++di) {
+                    for (int dj = -1; dj <= 1; ++dj) {
+                        const int64_t ni = i + di, nj = j + dj;
+                        const bool inside = ni >= 0 && ni < anchor_w &&
+                                            nj >= 0 && nj < anchor_h;
+                        const int slot = (di + 1) * 3 + (dj + 1);
+                        const int64_t col = 6 + 2 * (ni + nj * anchor_w);
+                        for (int d = 0; d < 2; ++d) {
+                            const double expected =
+                                    inside ? JTJ(row, col + d) : 0.0;
+                            EXPECT_NEAR(block[12 + slot * 4 + c * 2 + d],
+                                        expected, 1e-3);
+                        }
+                    }
+                }
+                EXPECT_NEAR(block[color_map::kNonRigidAnchorJtrOffset + c],
+                            JTr(row), 1e-3);
+            }
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -322,5 +322,59 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
     core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
 }
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScalePyramid) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    std::vector<t::geometry::RGBDImage> frames;
+    for (int i : {0, 2}) {
+        t::geometry::Image depth = *t::io::CreateImageFromFile(
+                utility::GetDataPathCommon(
+                        fmt::format("RGBD/depth/{:05d}.png", i)));
+        t::geometry::Image color = *t::io::CreateImageFromFile(
+                utility::GetDataPathCommon(
+                        fmt::format("RGBD/color/{:05d}.jpg", i)));
+        frames.emplace_back(color.To(device), depth.To(device));
+    }
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    core::Tensor trans =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    const std::vector<t::pipelines::odometry::OdometryConvergenceCriteria>
+            criteria{10, 5, 3};
+
+    // Each frame is preprocessed once and used as both source and target.
+    std::vector<t::geometry::RGBDImagePyramid> pyramids;
+    for (const t::geometry::RGBDImage& frame : frames) {
+        pyramids.emplace_back(frame, intrinsic_t, criteria.size(), depth_scale,
+                              depth_max, depth_diff);
+    }
+
+    for (auto method : {t::pipelines::odometry::Method::PointToPlane,
+                        t::pipelines::odometry::Method::Intensity,
+                        t::pipelines::odometry::Method::Hybrid}) {
+        for (int src : {0, 1}) {
+            const int dst = 1 - src;
+            auto result_ref = t::pipelines::odometry::RGBDOdometryMultiScale(
+                    frames[src], frames[dst], intrinsic_t, trans, depth_scale,
+                    depth_max, criteria, method,
+                    t::pipelines::odometry::OdometryLossParams(depth_diff));
+            auto result = t::pipelines::odometry::RGBDOdometryMultiScale(
+                    pyramids[src], pyramids[dst], trans, criteria, method,
+                    t::pipelines::odometry::OdometryLossParams(depth_diff));
+            EXPECT_TRUE(result.transformation_.AllClose(
+                    result_ref.transformation_));
+            EXPECT_DOUBLE_EQ(result.fitness_, result_ref.fitness_);
+        }
+    }
+}
 }  // namespace tests
 }  // namespace open3d
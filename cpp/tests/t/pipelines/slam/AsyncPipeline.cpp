@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/AsyncPipeline.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/pipelines/slam/Model.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class AsyncPipelinePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(AsyncPipeline,
+                         AsyncPipelinePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static const int kWidth = 80;
+static const int kHeight = 60;
+
+static core::Tensor SyntheticIntrinsics() {
+    return core::Tensor::Init<double>(
+            {{80.0, 0, 40.0}, {0, 80.0, 30.0}, {0, 0, 1}});
+}
+
+// Wavy surface at about one meter, shifted by \p shift pixels. Depth is
+// stored in millimeters, as by depth cameras.
+static t::geometry::RGBDImage CreateSyntheticRGBDImage(double shift) {
+    std::vector<uint16_t> depth(kWidth * kHeight);
+    std::vector<uint8_t> color(kWidth * kHeight * 3);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            const double x = u + shift;
+            const int i = v * kWidth + u;
+            depth[i] = uint16_t(1000.0 * (1.0 + 0.1 * std::sin(0.2 * x) *
+                                                        std::cos(0.15 * v)));
+            color[3 * i + 0] = uint8_t(128 + 100 * std::sin(0.3 * x));
+            color[3 * i + 1] = uint8_t(128 + 100 * std::cos(0.2 * v));
+            color[3 * i + 2] = 128;
+        }
+    }
+    return t::geometry::RGBDImage(
+            core::Tensor(color, {kHeight, kWidth, 3}, core::UInt8),
+            core::Tensor(depth, {kHeight, kWidth, 1}, core::UInt16));
+}
+
+static t::pipelines::slam::Model CreateModel(const core::Device& device) {
+    return t::pipelines::slam::Model(
+            0.02, 8, 2000, core::Tensor::Eye(4, core::Float64, core::Device()),
+            device);
+}
+
+TEST_P(AsyncPipelinePermuteDevices, MatchesSequential) {
+    core::Device device = GetParam();
+    // Tracking filters the ray casted depth, which requires IPP on CPU.
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const int num_frames = 5;
+    const core::Tensor intrinsics = SyntheticIntrinsics();
+    t::pipelines::slam::AsyncPipelineParams params;
+
+    // Reference: the loop of the DenseSLAM example.
+    std::vector<core::Tensor> expected_poses;
+    t::pipelines::slam::Model expected_model = CreateModel(device);
+    t::pipelines::slam::Frame input_frame(kHeight, kWidth, intrinsics, device);
+    t::pipelines::slam::Frame raycast_frame(kHeight, kWidth, intrinsics,
+                                            device);
+    for (int i = 0; i < num_frames; ++i) {
+        t::geometry::RGBDImage image = CreateSyntheticRGBDImage(0.5 * i);
+        input_frame.SetDataFromImage("depth", image.depth_.To(device));
+        input_frame.SetDataFromImage("color", image.color_.To(device));
+        core::Tensor pose = expected_model.GetCurrentFramePose();
+        if (i > 0) {
+            t::pipelines::odometry::OdometryResult result =
+                    expected_model.TrackFrameToModel(
+                            input_frame, raycast_frame, params.depth_scale_,
+                            params.depth_max_, params.depth_diff_);
+            pose = pose.Matmul(result.transformation_);
+        }
+        expected_model.UpdateFramePose(i, pose);
+        expected_model.Integrate(input_frame, params.depth_scale_,
+                                 params.depth_max_);
+        expected_model.SynthesizeModelFrame(raycast_frame, params.depth_scale_,
+                                            params.depth_min_,
+                                            params.depth_max_, false);
+        expected_poses.push_back(pose);
+    }
+
+    t::pipelines::slam::Model model = CreateModel(device);
+    t::pipelines::slam::AsyncPipeline pipeline(model, intrinsics, params);
+    int next = 0;
+    std::vector<t::pipelines::slam::AsyncFrameResult> results;
+    const int64_t num_processed = pipeline.Run(
+            [&next](t::geometry::RGBDImage& image) {
+                if (next == num_frames) {
+                    return false;
+                }
+                image = CreateSyntheticRGBDImage(0.5 * next++);
+                return true;
+            },
+            [&results](const t::pipelines::slam::AsyncFrameResult& result) {
+                results.push_back(result);
+            });
+
+    EXPECT_EQ(num_processed, num_frames);
+    ASSERT_EQ(results.size(), size_t(num_frames));
+    for (int i = 0; i < num_frames; ++i) {
+        EXPECT_EQ(results[i].frame_id_, i);
+        EXPECT_TRUE(results[i].tracking_success_);
+        EXPECT_TRUE(results[i].pose_.AllClose(expected_poses[i]));
+        EXPECT_GE(results[i].latency_ms_, 0.0);
+    }
+    EXPECT_TRUE(model.GetCurrentFramePose().AllClose(expected_poses.back()));
+
+    using Stage = t::pipelines::slam::AsyncPipeline::Stage;
+    EXPECT_EQ(pipeline.GetStageStatistics(Stage::Read).count_, num_frames);
+    EXPECT_EQ(pipeline.GetStageStatistics(Stage::Track).count_, num_frames - 1);
+    EXPECT_EQ(pipeline.GetStageStatistics(Stage::RayCast).count_, num_frames);
+}
+
+TEST_P(AsyncPipelinePermuteDevices, StopAndErrors) {
+    core::Device device = GetParam();
+    const core::Tensor intrinsics = SyntheticIntrinsics();
+    t::pipelines::slam::AsyncPipelineParams params;
+    params.queue_size_ = 1;
+
+    // Stopping from the callback of the first frame. The source is never
+    // exhausted, so the read stage is blocked by back-pressure until then.
+    t::pipelines::slam::Model model = CreateModel(device);
+    t::pipelines::slam::AsyncPipeline pipeline(model, intrinsics, params);
+    int num_read = 0;
+    const int64_t num_processed = pipeline.Run(
+            [&num_read](t::geometry::RGBDImage& image) {
+                image = CreateSyntheticRGBDImage(0.0);
+                num_read++;
+                return true;
+            },
+            [&pipeline](const t::pipelines::slam::AsyncFrameResult& result) {
+                EXPECT_EQ(result.frame_id_, 0);
+                pipeline.Stop();
+            });
+    EXPECT_EQ(num_processed, 1);
+    // Frame 0 in the model stages, plus at most one frame in each queue and
+    // one in each blocked upstream stage.
+    EXPECT_LE(num_read, 5);
+
+    // Exceptions of the source are rethrown by Run.
+    t::pipelines::slam::Model other_model = CreateModel(device);
+    t::pipelines::slam::AsyncPipeline other_pipeline(other_model, intrinsics,
+                                                     params);
+    auto failing_source = [](t::geometry::RGBDImage& image) -> bool {
+        throw std::runtime_error("Cannot read frame.");
+    };
+    EXPECT_THROW(other_pipeline.Run(failing_source), std::runtime_error);
+
+    params.queue_size_ = 0;
+    EXPECT_ANY_THROW(
+            t::pipelines::slam::AsyncPipeline(model, intrinsics, params));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,221 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/LoopClosure.h"
+
+#include <Eigen/Geometry>
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/slam/Model.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class LoopClosurePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LoopClosure,
+                         LoopClosurePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static const int kWidth = 80;
+static const int kHeight = 60;
+static const float kDepthScale = 1000.0f;
+static const float kDepthMax = 5.0f;
+
+static core::Tensor SyntheticIntrinsics() {
+    return core::Tensor::Init<double>(
+            {{60.0, 0, 40.0}, {0, 60.0, 30.0}, {0, 0, 1}});
+}
+
+// Renders depth (UInt16, millimeters) and color of a room with a few spheres
+// seen from the frame to world \p pose.
+static t::geometry::RGBDImage RenderRoom(const Eigen::Matrix4d& pose) {
+    const Eigen::Vector3d room_min(-2.5, -1.2, -2.0);
+    const Eigen::Vector3d room_max(2.5, 1.2, 3.0);
+    const std::vector<Eigen::Vector4d> spheres = {{1.0, 0.2, 2.0, 0.5},
+                                                  {-1.5, -0.3, 1.0, 0.4},
+                                                  {0.5, 0.5, -1.2, 0.6},
+                                                  {-1.0, 0.0, -1.0, 0.3}};
+    const Eigen::Matrix3d R = pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d origin = pose.block<3, 1>(0, 3);
+
+    std::vector<uint16_t> depth(kWidth * kHeight, 0);
+    std::vector<uint8_t> color(kWidth * kHeight * 3, 0);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            // With a unit z component, the ray parameter is the depth.
+            const Eigen::Vector3d dir =
+                    R * Eigen::Vector3d((u - 40.0) / 60.0, (v - 30.0) / 60.0,
+                                        1.0);
+            double t_hit = std::numeric_limits<double>::max();
+            for (int i = 0; i < 3; ++i) {
+                if (dir(i) != 0) {
+                    const double bound = dir(i) > 0 ? room_max(i) : room_min(i);
+                    t_hit = std::min(t_hit, (bound - origin(i)) / dir(i));
+                }
+            }
+            for (const Eigen::Vector4d& sphere : spheres) {
+                const Eigen::Vector3d oc = origin - sphere.head<3>();
+                const double a = dir.squaredNorm();
+                const double b = oc.dot(dir);
+                const double c = oc.squaredNorm() - sphere(3) * sphere(3);
+                const double disc = b * b - a * c;
+                if (disc >= 0) {
+                    const double t = (-b - std::sqrt(disc)) / a;
+                    if (t > 0) {
+                        t_hit = std::min(t_hit, t);
+                    }
+                }
+            }
+            const int i = v * kWidth + u;
+            if (t_hit < kDepthMax) {
+                depth[i] = uint16_t(t_hit * kDepthScale);
+            }
+            const Eigen::Vector3d p = origin + t_hit * dir;
+            color[3 * i + 0] = uint8_t(128 + 100 * std::sin(3 * p(0)));
+            color[3 * i + 1] = uint8_t(128 + 100 * std::sin(3 * p(1)));
+            color[3 * i + 2] = uint8_t(128 + 100 * std::sin(3 * p(2)));
+        }
+    }
+    return t::geometry::RGBDImage(
+            core::Tensor(color, {kHeight, kWidth, 3}, core::UInt8),
+            core::Tensor(depth, {kHeight, kWidth, 1}, core::UInt16));
+}
+
+static Eigen::Matrix4d GroundTruthPose(int i, int num_frames) {
+    Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+    pose.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(2 * M_PI * i / num_frames,
+                              Eigen::Vector3d::UnitY())
+                    .toRotationMatrix();
+    return pose;
+}
+
+TEST(LoopClosure, KeyframeDatabase) {
+    t::pipelines::slam::KeyframeDatabase database(6, 8);
+    for (int i = 0; i < 4; ++i) {
+        t::pipelines::slam::Keyframe keyframe;
+        keyframe.frame_id_ = i;
+        keyframe.descriptor_ = database.ComputeDescriptor(
+                RenderRoom(GroundTruthPose(i, 8)).depth_, kDepthScale,
+                kDepthMax);
+        EXPECT_EQ(keyframe.descriptor_.GetShape(), core::SizeVector({48}));
+        EXPECT_NEAR((keyframe.descriptor_ * keyframe.descriptor_)
+                            .Sum({0})
+                            .Item<float>(),
+                    1.0, 1e-5);
+        EXPECT_EQ(database.Add(keyframe), i);
+    }
+
+    const core::Tensor query = database.ComputeDescriptor(
+            RenderRoom(GroundTruthPose(2, 8)).depth_, kDepthScale, kDepthMax);
+    std::vector<std::pair<int64_t, double>> candidates =
+            database.Query(query, database.Size(), 2, -1.0);
+    ASSERT_EQ(candidates.size(), 2u);
+    EXPECT_EQ(candidates[0].first, 2);
+    EXPECT_NEAR(candidates[0].second, 1.0, 1e-5);
+    EXPECT_LT(candidates[1].second, candidates[0].second);
+
+    // Only the first keyframes are searched.
+    candidates = database.Query(query, 2, 4, -1.0);
+    EXPECT_EQ(candidates.size(), 2u);
+    for (const std::pair<int64_t, double>& candidate : candidates) {
+        EXPECT_LT(candidate.first, 2);
+    }
+    EXPECT_TRUE(database.Query(query, 4, 4, 1.1).empty());
+}
+
+TEST_P(LoopClosurePermuteDevices, CloseLoop) {
+    const core::Device device = GetParam();
+    const core::Tensor intrinsics = SyntheticIntrinsics();
+
+    // The camera turns around once in place, while its estimated position
+    // drifts along x.
+    const int num_frames = 24;
+    const double drift_per_frame = 0.002;
+
+    t::pipelines::slam::Model model(
+            0.04, 8, 4000, core::Tensor::Eye(4, core::Float64, core::Device()),
+            device);
+    t::pipelines::slam::LoopClosureParams params;
+    params.depth_scale_ = kDepthScale;
+    params.depth_max_ = kDepthMax;
+    params.keyframe_interval_ = 1;
+    params.min_keyframe_gap_ = num_frames / 2;
+    params.min_similarity_ = 0.8;
+    t::pipelines::slam::LoopClosure loop_closure(model, params);
+
+    t::pipelines::slam::Frame input_frame(kHeight, kWidth, intrinsics, device);
+    t::pipelines::slam::Frame raycast_frame(kHeight, kWidth, intrinsics,
+                                            device);
+    int num_optimizations = 0;
+    for (int i = 0; i <= num_frames; ++i) {
+        const Eigen::Matrix4d pose_gt = GroundTruthPose(i, num_frames);
+        Eigen::Matrix4d pose = pose_gt;
+        pose(0, 3) += drift_per_frame * i;
+
+        t::geometry::RGBDImage image = RenderRoom(pose_gt);
+        input_frame.SetDataFromImage("depth", image.depth_.To(device));
+        input_frame.SetDataFromImage("color", image.color_.To(device));
+        model.UpdateFramePose(i,
+                              core::eigen_converter::EigenMatrixToTensor(pose));
+        model.Integrate(input_frame, kDepthScale, kDepthMax);
+        model.SynthesizeModelFrame(raycast_frame, kDepthScale, 0.1, kDepthMax,
+                                   false);
+        num_optimizations +=
+                loop_closure.ProcessFrame(input_frame, raycast_frame);
+    }
+
+    EXPECT_EQ(loop_closure.GetKeyframeDatabase().Size(), num_frames + 1);
+    EXPECT_GE(num_optimizations, 1);
+    const std::vector<std::pair<int, int>> loops =
+            loop_closure.GetLoopClosures();
+    ASSERT_FALSE(loops.empty());
+    for (const std::pair<int, int>& loop : loops) {
+        EXPECT_GE(loop.first - loop.second, params.min_keyframe_gap_);
+    }
+    EXPECT_EQ(loops.back(), std::make_pair(num_frames, 0));
+
+    // The corrected pose of the last frame is back at the start.
+    const Eigen::Matrix4d corrected =
+            core::eigen_converter::TensorToEigenMatrixXd(
+                    model.GetCurrentFramePose());
+    const double max_error = 0.25 * drift_per_frame * num_frames;
+    const Eigen::Vector3d position = corrected.block<3, 1>(0, 3);
+    EXPECT_LT(position.norm(), max_error);
+
+    EXPECT_TRUE(loop_closure.HasPendingReintegration());
+    EXPECT_GT(loop_closure.Reintegrate(), 0);
+    EXPECT_FALSE(loop_closure.HasPendingReintegration());
+    EXPECT_EQ(loop_closure.Reintegrate(), 0);
+    EXPECT_GT(model.ExtractPointCloud().GetPointPositions().GetLength(), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
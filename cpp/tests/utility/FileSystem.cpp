@@ -263,6 +263,18 @@ TEST(FileSystem, ChangeWorkingDirectory) {
     EXPECT_TRUE(status);
 }
 
+// ----------------------------------------------------------------------------
+// Get the directory for temporary files.
+// ----------------------------------------------------------------------------
+TEST(FileSystem, GetTempDirectoryPath) {
+    std::string path = utility::filesystem::GetTempDirectoryPath();
+
+    EXPECT_FALSE(path.empty());
+    EXPECT_TRUE(utility::filesystem::DirectoryExists(path));
+    EXPECT_TRUE(path.size() == 1 ||
+                (path.back() != '/' && path.back() != '\\'));
+}
+
 // ----------------------------------------------------------------------------
 // Check if a path exists.
 // ----------------------------------------------------------------------------
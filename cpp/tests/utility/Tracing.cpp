@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Tracing.h"
+
+#include <json/json.h>
+
+#include <cstring>
+#include <thread>
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Tracing, DisabledByDefault) {
+    utility::Tracer& tracer = utility::Tracer::GetInstance();
+    tracer.Disable();
+    tracer.Clear();
+    { utility::ScopedTraceZone zone("test", "ignored"); }
+    tracer.RecordCounter("test", "ignored", 1.0);
+    EXPECT_TRUE(tracer.GetEvents().empty());
+}
+
+TEST(Tracing, ZonesAndCounters) {
+    utility::Tracer& tracer = utility::Tracer::GetInstance();
+    tracer.Enable();
+    {
+        utility::ScopedTraceZone outer("test", "outer");
+        utility::ScopedTraceZone inner("test", "inner");
+        tracer.RecordCounter("test", "count", 42.0);
+    }
+    tracer.Disable();
+
+    std::vector<utility::TraceEvent> events = tracer.GetEvents();
+    ASSERT_EQ(events.size(), 3u);
+    // Sorted by start time: outer starts first, the counter is sampled last.
+    EXPECT_EQ(std::strcmp(events[0].name_, "outer"), 0);
+    EXPECT_EQ(std::strcmp(events[1].name_, "inner"), 0);
+    EXPECT_EQ(events[2].type_, utility::TraceEvent::Type::Counter);
+    EXPECT_EQ(events[2].value_, 42.0);
+    EXPECT_GE(events[0].duration_ns_, events[1].duration_ns_);
+    EXPECT_LE(events[0].timestamp_ns_ + events[0].duration_ns_, tracer.Now());
+}
+
+TEST(Tracing, RingBufferPerThread) {
+    utility::Tracer& tracer = utility::Tracer::GetInstance();
+    tracer.Enable(8);
+    const int num_threads = 4;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&tracer]() {
+            for (int i = 0; i < 20; ++i) {
+                tracer.RecordCounter("test", "i", i);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    tracer.Disable();
+
+    std::vector<utility::TraceEvent> events = tracer.GetEvents();
+    EXPECT_EQ(events.size(), (size_t)(num_threads * 8));
+    EXPECT_EQ(tracer.GetNumDroppedEvents(), (size_t)(num_threads * 12));
+    // Only the newest events of each thread are kept.
+    for (const utility::TraceEvent& event : events) {
+        EXPECT_GE(event.value_, 12.0);
+    }
+}
+
+TEST(Tracing, MemoryEvents) {
+    utility::Tracer& tracer = utility::Tracer::GetInstance();
+    tracer.Enable();
+    tracer.RecordMalloc("CPU", 0, (void*)0x1000, 256);
+    tracer.RecordMalloc("CPU", 0, (void*)0x2000, 128);
+    tracer.RecordFree("CPU", 0, (void*)0x1000);
+    tracer.Disable();
+
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+    const std::string json = tracer.ToChromeTraceJSON();
+    std::string errors;
+    ASSERT_TRUE(reader->parse(json.data(), json.data() + json.size(), &root,
+                              &errors))
+            << errors;
+
+    std::vector<double> allocated;
+    for (const Json::Value& event : root["traceEvents"]) {
+        if (event["ph"].asString() == "C" &&
+            event["name"].asString() == "Allocated bytes CPU:0") {
+            allocated.push_back(event["args"]["bytes"].asDouble());
+        }
+    }
+    EXPECT_EQ(allocated, std::vector<double>({256, 384, 128}));
+}
+
+TEST(Tracing, ChromeTraceJSON) {
+    utility::Tracer& tracer = utility::Tracer::GetInstance();
+    tracer.Enable();
+    { utility::ScopedTraceZone zone("test", "quoted \"zone\""); }
+    tracer.Disable();
+
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+    const std::string json = tracer.ToChromeTraceJSON();
+    std::string errors;
+    ASSERT_TRUE(reader->parse(json.data(), json.data() + json.size(), &root,
+                              &errors))
+            << errors;
+
+    int num_zones = 0;
+    for (const Json::Value& event : root["traceEvents"]) {
+        if (event["ph"].asString() == "X") {
+            EXPECT_EQ(event["name"].asString(), "quoted \"zone\"");
+            EXPECT_EQ(event["cat"].asString(), "test");
+            num_zones++;
+        }
+    }
+    EXPECT_EQ(num_zones, 1);
+    tracer.Clear();
+    EXPECT_TRUE(tracer.GetEvents().empty());
+}
+
+TEST(Tracing, MemoryManagerEvents) {
+    utility::Tracer& tracer = utility::Tracer::GetInstance();
+    tracer.Enable();
+    { core::Tensor t = core::Tensor::Zeros({16}, core::Float32); }
+    tracer.Disable();
+
+    std::vector<utility::TraceEvent> events = tracer.GetEvents();
+#ifdef BUILD_TRACING
+    int num_malloc = 0, num_free = 0;
+    for (const utility::TraceEvent& event : events) {
+        num_malloc += event.type_ == utility::TraceEvent::Type::Malloc;
+        num_free += event.type_ == utility::TraceEvent::Type::Free;
+    }
+    EXPECT_GE(num_malloc, 1);
+    EXPECT_EQ(num_malloc, num_free);
+#else
+    EXPECT_TRUE(events.empty());
+#endif
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudStagingBuffers.h"
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+using visualization::rendering::PointCloudStagingBuffers;
+using Attribute = PointCloudStagingBuffers::Attribute;
+
+static std::vector<float> ToVector(
+        const PointCloudStagingBuffers::Upload& upload) {
+    const float* data = static_cast<const float*>(upload.data);
+    return std::vector<float>(data, data + upload.size / sizeof(float));
+}
+
+static void Release(const PointCloudStagingBuffers::Upload& upload) {
+    upload.callback(upload.data, upload.size, upload.user);
+}
+
+TEST(PointCloudStagingBuffers, ZeroCopy) {
+    PointCloudStagingBuffers staging;
+    core::Tensor points = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}});
+    auto upload = staging.Stage(Attribute::Positions, points);
+    EXPECT_EQ(upload.data, points.GetDataPtr());
+    EXPECT_EQ(upload.size, 6 * sizeof(float));
+    EXPECT_EQ(staging.NumSlotsInFlight(), 0);
+    EXPECT_EQ(staging.NumAllocations(), 0);
+
+    // The upload keeps the values alive.
+    const void* data = points.GetDataPtr();
+    points = core::Tensor();
+    EXPECT_EQ(ToVector(upload), std::vector<float>({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(upload.data, data);
+    Release(upload);
+}
+
+TEST(PointCloudStagingBuffers, Convert) {
+    PointCloudStagingBuffers staging;
+
+    auto positions = staging.Stage(
+            Attribute::Positions,
+            core::Tensor::Init<double>({{0.5, 1, 2}, {3, 4, 5}}));
+    EXPECT_EQ(ToVector(positions), std::vector<float>({0.5, 1, 2, 3, 4, 5}));
+
+    auto colors = staging.Stage(
+            Attribute::Colors,
+            core::Tensor::Init<uint8_t>({{0, 51, 255}, {255, 102, 0}}));
+    std::vector<float> expected_colors({0, 0.2f, 1, 1, 0.4f, 0});
+    std::vector<float> actual_colors = ToVector(colors);
+    ASSERT_EQ(actual_colors.size(), expected_colors.size());
+    for (size_t i = 0; i < expected_colors.size(); ++i) {
+        EXPECT_NEAR(actual_colors[i], expected_colors[i], 1e-6);
+    }
+
+    // Scalars are stored as (scalar, 0) texture coordinates.
+    auto uv = staging.Stage(Attribute::UV,
+                            core::Tensor::Init<float>({0.25, 0.5, 0.75}));
+    EXPECT_EQ(ToVector(uv), std::vector<float>({0.25, 0, 0.5, 0, 0.75, 0}));
+
+    // Non contiguous values are converted too.
+    core::Tensor strided =
+            core::Tensor::Init<float>({{0, 1, 2, 3}, {4, 5, 6, 7}})
+                    .Slice(1, 0, 3);
+    auto sliced = staging.Stage(Attribute::Colors, strided);
+    EXPECT_NE(sliced.data, strided.GetDataPtr());
+    EXPECT_EQ(ToVector(sliced), std::vector<float>({0, 1, 2, 4, 5, 6}));
+
+    auto white = staging.StageConstant(Attribute::Colors, 2, 1.f);
+    EXPECT_EQ(ToVector(white), std::vector<float>(6, 1.f));
+
+    for (const auto& upload : {positions, colors, uv, sliced, white}) {
+        Release(upload);
+    }
+    EXPECT_EQ(staging.NumSlotsInFlight(), 0);
+
+    EXPECT_ANY_THROW(staging.Stage(Attribute::Positions,
+                                   core::Tensor::Zeros({2, 2}, core::Float32)));
+}
+
+TEST(PointCloudStagingBuffers, RingBuffer) {
+    PointCloudStagingBuffers staging(2);
+    const core::Tensor values = core::Tensor::Ones({100, 3}, core::Float64);
+
+    // Released slots are reused, so each slot is only allocated once.
+    for (int i = 0; i < 5; ++i) {
+        Release(staging.Stage(Attribute::Positions, values));
+    }
+    EXPECT_EQ(staging.NumAllocations(), 2);
+
+    // Slots in flight are not overwritten: once both slots are taken, a new
+    // buffer is allocated.
+    auto first = staging.Stage(Attribute::Positions, values);
+    auto second = staging.Stage(Attribute::Positions, values);
+    EXPECT_NE(first.data, second.data);
+    EXPECT_EQ(staging.NumSlotsInFlight(), 2);
+    EXPECT_EQ(staging.NumAllocations(), 2);
+    auto third = staging.Stage(Attribute::Positions, values);
+    EXPECT_NE(third.data, first.data);
+    EXPECT_NE(third.data, second.data);
+    EXPECT_EQ(staging.NumAllocations(), 3);
+    Release(third);
+    EXPECT_EQ(staging.NumSlotsInFlight(), 2);
+
+    // Each attribute has its own slots.
+    auto colors = staging.Stage(Attribute::Colors, values);
+    EXPECT_EQ(staging.NumSlotsInFlight(), 3);
+    Release(colors);
+
+    // Uploads can be released after the staging buffers are destroyed.
+    std::unique_ptr<PointCloudStagingBuffers> temporary(
+            new PointCloudStagingBuffers(1));
+    auto orphan = temporary->Stage(Attribute::Positions, values);
+    temporary.reset();
+    EXPECT_EQ(ToVector(orphan), std::vector<float>(300, 1.f));
+    Release(orphan);
+
+    Release(first);
+    Release(second);
+    EXPECT_EQ(staging.NumSlotsInFlight(), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
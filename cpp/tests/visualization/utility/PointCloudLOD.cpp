@@ -0,0 +1,270 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/utility/PointCloudLOD.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <random>
+
+#include "open3d/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static geometry::PointCloud CreateRandomPointCloud(size_t size) {
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0, 1);
+    geometry::PointCloud pc;
+    for (size_t i = 0; i < size; ++i) {
+        pc.points_.emplace_back(2 * dist(gen) - 1, 2 * dist(gen) - 1,
+                                2 * dist(gen) - 1);
+        pc.colors_.emplace_back(dist(gen), dist(gen), dist(gen));
+    }
+    return pc;
+}
+
+// OpenGL perspective projection times the view matrix of a camera at eye
+// looking at the origin, with y up.
+static Eigen::Matrix4d ViewProjection(const Eigen::Vector3d &eye) {
+    const Eigen::Vector3d forward = -eye.normalized();
+    const Eigen::Vector3d right =
+            forward.cross(Eigen::Vector3d(0, 1, 0)).normalized();
+    const Eigen::Vector3d up = right.cross(forward);
+    Eigen::Matrix4d view = Eigen::Matrix4d::Identity();
+    view.block<1, 3>(0, 0) = right.transpose();
+    view.block<1, 3>(1, 0) = up.transpose();
+    view.block<1, 3>(2, 0) = -forward.transpose();
+    view.block<3, 1>(0, 3) = -view.block<3, 3>(0, 0) * eye;
+
+    const double near = 0.1, far = 100, f = 1 / std::tan(M_PI / 6);
+    Eigen::Matrix4d projection = Eigen::Matrix4d::Zero();
+    projection(0, 0) = f;
+    projection(1, 1) = f;
+    projection(2, 2) = (far + near) / (near - far);
+    projection(2, 3) = 2 * far * near / (near - far);
+    projection(3, 2) = -1;
+    return projection * view;
+}
+
+TEST(PointCloudLOD, CreateFromPointCloud) {
+    geometry::PointCloud pc = CreateRandomPointCloud(5000);
+    const int sample_depth = 2;
+    auto lod = visualization::PointCloudLOD::CreateFromPointCloud(
+            pc, sample_depth, 100, 6);
+    ASSERT_FALSE(lod->IsEmpty());
+    EXPECT_TRUE(lod->HasColors());
+    EXPECT_TRUE(lod->IsLoaded());
+    EXPECT_GT(lod->NumNodes(), 1u);
+
+    // Every point is stored exactly once.
+    ASSERT_EQ(lod->NumPoints(), int64_t(pc.points_.size()));
+    auto less = [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+        return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                            b.data() + 3);
+    };
+    std::vector<Eigen::Vector3d> expected = pc.points_;
+    std::vector<Eigen::Vector3d> actual = lod->points_;
+    std::sort(expected.begin(), expected.end(), less);
+    std::sort(actual.begin(), actual.end(), less);
+    ExpectEQ(actual, expected);
+
+    for (int node = 0; node < int(lod->NumNodes()); ++node) {
+        const auto &info = lod->nodes_[node];
+        auto pcd = lod->LoadNode(node);
+        EXPECT_EQ(int64_t(pcd->points_.size()), info.num_points_);
+        for (const Eigen::Vector3d &point : pcd->points_) {
+            EXPECT_TRUE((point.array() >= info.origin_.array()).all());
+            EXPECT_TRUE(
+                    (point.array() < info.origin_.array() + info.size_).all());
+        }
+        if (info.first_child_ >= 0) {
+            // A sampled node has at most one point per grid cell.
+            EXPECT_LE(info.num_points_, 1 << (3 * sample_depth));
+            const auto &child = lod->nodes_[info.first_child_];
+            EXPECT_EQ(child.parent_, node);
+            EXPECT_EQ(child.depth_, info.depth_ + 1);
+            EXPECT_EQ(child.size_, info.size_ / 2);
+        } else {
+            EXPECT_EQ(info.child_mask_, 0);
+        }
+    }
+}
+
+TEST(PointCloudLOD, SelectNodes) {
+    geometry::PointCloud pc = CreateRandomPointCloud(5000);
+    auto lod = visualization::PointCloudLOD::CreateFromPointCloud(pc, 2, 100,
+                                                                  6);
+    const Eigen::Matrix4d view_projection =
+            ViewProjection(Eigen::Vector3d(0, 0, 5));
+
+    // Everything is in view, so an unlimited budget selects all nodes.
+    std::vector<int> all = lod->SelectNodes(view_projection, 600, 1 << 30);
+    EXPECT_EQ(all.size(), lod->NumNodes());
+
+    // A budget selects the largest nodes first, parents before children.
+    const int64_t budget = 1000;
+    std::vector<int> selected = lod->SelectNodes(view_projection, 600, budget);
+    ASSERT_FALSE(selected.empty());
+    EXPECT_LT(selected.size(), lod->NumNodes());
+    EXPECT_EQ(selected[0], 0);
+    int64_t num_points = 0;
+    std::vector<bool> is_selected(lod->NumNodes(), false);
+    for (int node : selected) {
+        num_points += lod->nodes_[node].num_points_;
+        if (node > 0) {
+            EXPECT_TRUE(is_selected[lod->nodes_[node].parent_]);
+        }
+        is_selected[node] = true;
+    }
+    EXPECT_LE(num_points, budget);
+    EXPECT_EQ(int64_t(lod->LoadNodes(selected)->points_.size()), num_points);
+
+    // Nothing is selected when looking away from the cloud, and only part of
+    // the nodes when the cloud is partly in view.
+    Eigen::Matrix4d away = ViewProjection(Eigen::Vector3d(0, 0, 5));
+    away.row(0) *= -1;
+    away.row(2) *= -1;
+    away.row(3) *= -1;
+    EXPECT_TRUE(lod->SelectNodes(away, 600, 1 << 30).empty());
+    Eigen::Matrix4d shifted =
+            ViewProjection(Eigen::Vector3d(0, 0, 2.5)) *
+            Eigen::Affine3d(Eigen::Translation3d(1.5, 0, 0)).matrix();
+    std::vector<int> partial = lod->SelectNodes(shifted, 600, 1 << 30);
+    EXPECT_FALSE(partial.empty());
+    EXPECT_LT(partial.size(), lod->NumNodes());
+}
+
+TEST(PointCloudLOD, FileIO) {
+    geometry::PointCloud pc = CreateRandomPointCloud(5000);
+    auto src = visualization::PointCloudLOD::CreateFromPointCloud(pc, 2, 100,
+                                                                  6);
+    std::string file_name = utility::GetDataPathCommon("temp_lod.bin");
+    EXPECT_TRUE(src->WriteToFile(file_name));
+
+    auto dst = visualization::PointCloudLOD::Open(file_name);
+    ASSERT_NE(dst, nullptr);
+    EXPECT_FALSE(dst->IsLoaded());
+    EXPECT_TRUE(dst->HasColors());
+    ExpectEQ(dst->origin_, src->origin_);
+    EXPECT_EQ(dst->size_, src->size_);
+    ASSERT_EQ(dst->NumNodes(), src->NumNodes());
+    for (int node = 0; node < int(src->NumNodes()); ++node) {
+        const auto &a = src->nodes_[node];
+        const auto &b = dst->nodes_[node];
+        ExpectEQ(b.origin_, a.origin_);
+        EXPECT_EQ(b.depth_, a.depth_);
+        EXPECT_EQ(b.parent_, a.parent_);
+        EXPECT_EQ(b.first_child_, a.first_child_);
+        EXPECT_EQ(b.child_mask_, a.child_mask_);
+        EXPECT_EQ(b.offset_, a.offset_);
+        EXPECT_EQ(b.num_points_, a.num_points_);
+
+        // Points are stored as floats and colors as 8 bit channels.
+        auto src_pcd = src->LoadNode(node);
+        auto dst_pcd = dst->LoadNode(node);
+        ASSERT_NE(dst_pcd, nullptr);
+        ASSERT_EQ(dst_pcd->points_.size(), src_pcd->points_.size());
+        for (size_t i = 0; i < src_pcd->points_.size(); ++i) {
+            EXPECT_LE((dst_pcd->points_[i] - src_pcd->points_[i])
+                              .cwiseAbs()
+                              .maxCoeff(),
+                      1e-6);
+            EXPECT_LE((dst_pcd->colors_[i] - src_pcd->colors_[i])
+                              .cwiseAbs()
+                              .maxCoeff(),
+                      0.5 / 255 + 1e-9);
+        }
+    }
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+TEST(PointCloudLOD, FileIORewrite) {
+    geometry::PointCloud pc = CreateRandomPointCloud(5000);
+    auto src = visualization::PointCloudLOD::CreateFromPointCloud(pc, 2, 100,
+                                                                  6);
+    std::string file_name = utility::GetDataPathCommon("temp_lod.bin");
+    ASSERT_TRUE(src->WriteToFile(file_name));
+
+    // A file backed hierarchy reads its points while writing over its file.
+    auto opened = visualization::PointCloudLOD::Open(file_name);
+    ASSERT_NE(opened, nullptr);
+    EXPECT_TRUE(opened->WriteToFile(file_name));
+    auto reopened = visualization::PointCloudLOD::Open(file_name);
+    ASSERT_NE(reopened, nullptr);
+    ASSERT_EQ(reopened->NumPoints(), src->NumPoints());
+    for (int node = 0; node < int(src->NumNodes()); ++node) {
+        auto src_pcd = src->LoadNode(node);
+        auto dst_pcd = reopened->LoadNode(node);
+        ASSERT_NE(dst_pcd, nullptr);
+        ASSERT_EQ(dst_pcd->points_.size(), src_pcd->points_.size());
+        for (size_t i = 0; i < src_pcd->points_.size(); ++i) {
+            EXPECT_LE((dst_pcd->points_[i] - src_pcd->points_[i])
+                              .cwiseAbs()
+                              .maxCoeff(),
+                      1e-6);
+        }
+    }
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+TEST(PointCloudLOD, FileIOCorrupted) {
+    geometry::PointCloud pc = CreateRandomPointCloud(1000);
+    auto src = visualization::PointCloudLOD::CreateFromPointCloud(pc, 2, 100,
+                                                                  6);
+    std::string file_name = utility::GetDataPathCommon("temp_lod.bin");
+    ASSERT_TRUE(src->WriteToFile(file_name));
+    std::ifstream in(file_name, std::ios::binary);
+    const std::string data((std::istreambuf_iterator<char>(in)),
+                           std::istreambuf_iterator<char>());
+    in.close();
+
+    // The header is the magic, the version, the origin, the size, the color
+    // flag and the node count, followed by the child masks and point counts.
+    const size_t num_nodes_offset = 8 + 4 + 3 * 8 + 8 + 1;
+    const size_t num_points_offset =
+            num_nodes_offset + sizeof(int64_t) + src->NumNodes();
+    auto expect_rejected = [&](size_t offset, int64_t value) {
+        std::string corrupted = data;
+        std::memcpy(&corrupted[offset], &value, sizeof(value));
+        std::ofstream out(file_name, std::ios::binary);
+        out.write(corrupted.data(), corrupted.size());
+        out.close();
+        EXPECT_EQ(visualization::PointCloudLOD::Open(file_name), nullptr);
+    };
+    expect_rejected(num_nodes_offset, int64_t(1) << 60);
+    expect_rejected(num_points_offset, std::numeric_limits<int64_t>::max());
+    expect_rejected(num_points_offset, src->NumPoints() + 1);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,87 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018-2021 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+import os
+import tempfile
+
+
+def _sphere_point_cloud(n):
+    # Fibonacci samples of the unit sphere with outward normals.
+    i = np.arange(n)
+    z = 1.0 - 2.0 * (i + 0.5) / n
+    r = np.sqrt(1.0 - z * z)
+    angle = np.pi * (3.0 - np.sqrt(5.0)) * i
+    points = np.stack([r * np.cos(angle), r * np.sin(angle), z], axis=1)
+    pcd = o3d.geometry.PointCloud()
+    pcd.points = o3d.utility.Vector3dVector(points)
+    pcd.normals = o3d.utility.Vector3dVector(points)
+    return pcd
+
+
+def test_create_from_point_cloud_poisson_tiled_streamed():
+    pcd = _sphere_point_cloud(20000)
+    points = np.asarray(pcd.points)
+
+    with tempfile.TemporaryDirectory() as scratch_dir:
+        mesh, densities = (
+            o3d.geometry.TriangleMesh.create_from_point_cloud_poisson_tiled(
+                pcd,
+                tile_size=1.0,
+                depth=5,
+                n_threads=1,
+                scratch_dir=scratch_dir))
+        assert len(mesh.triangles) > 0
+        assert len(densities) == len(mesh.vertices)
+
+        # Stream the same points in chunks of 1000 points.
+        chunks = iter(range(0, len(points), 1000))
+
+        def read_chunk():
+            begin = next(chunks, None)
+            if begin is None:
+                return None
+            chunk = o3d.geometry.PointCloud()
+            chunk_points = points[begin:begin + 1000]
+            chunk.points = o3d.utility.Vector3dVector(chunk_points)
+            chunk.normals = o3d.utility.Vector3dVector(chunk_points)
+            return chunk
+
+        streamed, streamed_densities = (
+            o3d.geometry.TriangleMesh.create_from_point_cloud_poisson_tiled(
+                read_chunk,
+                tile_size=1.0,
+                depth=5,
+                n_threads=1,
+                scratch_dir=scratch_dir,
+                max_buffered_points=5000))
+        assert len(streamed.vertices) == len(mesh.vertices)
+        assert len(streamed.triangles) == len(mesh.triangles)
+        assert len(streamed_densities) == len(streamed.vertices)
+        radii = np.linalg.norm(np.asarray(streamed.vertices), axis=1)
+        np.testing.assert_allclose(radii, 1.0, atol=0.05)
+        assert os.listdir(scratch_dir) == []